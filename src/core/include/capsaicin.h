@@ -243,6 +243,12 @@ CAPSAICIN_EXPORT void SetFixedFrameRate(bool playMode) noexcept;
  */
 CAPSAICIN_EXPORT void SetFixedFrameTime(double fixed_frame_time) noexcept;
 
+/**
+ * Get the current fixed rate frame time.
+ * @return A duration in seconds.
+ */
+CAPSAICIN_EXPORT double GetFixedFrameTime() noexcept;
+
 /**
  * Get current playback mode.
  * @return True if using fixed frame rate, False is using real-time.
@@ -376,6 +382,25 @@ CAPSAICIN_EXPORT std::pair<uint32_t, uint32_t> GetRenderDimensions() noexcept;
  */
 CAPSAICIN_EXPORT void SetRenderDimensionsScale(float scale) noexcept;
 
+/**
+ * Enable headless offscreen rendering using a fixed output resolution.
+ * When set the window dimensions are taken from the passed values instead of the back buffer and the final
+ * output is not copied to the back buffer, allowing rendering without any window or swap chain. Frames can
+ * then be captured directly from the 'Color' AOV using DumpDebugView.
+ * @param width  The output width (0 to return to using the back buffer).
+ * @param height The output height (0 to return to using the back buffer).
+ */
+CAPSAICIN_EXPORT void SetOffscreenDimensions(uint32_t width, uint32_t height) noexcept;
+
+/**
+ * Set the directory used to cache generated textures (environment cube maps, prefiltered environments and
+ * lookup tables) between runs.
+ * Cached files are named after a hash of their inputs so a directory can be shared by several processes.
+ * @note Must be called before SetRenderer and SetScene for their textures to be cached.
+ * @param directory The cache directory (empty to disable caching).
+ */
+CAPSAICIN_EXPORT void SetTextureCacheDirectory(std::filesystem::path const &directory) noexcept;
+
 /**
  * Gets the internal configuration options.
  * @return The list of available options.
@@ -490,4 +515,23 @@ struct NodeTimestamps
  */
 CAPSAICIN_EXPORT std::vector<NodeTimestamps> GetProfiling() noexcept;
 
+struct Statistic
+{
+    std::string_view name;  /**< The name of the statistic */
+    double           value; /**< The value of the statistic */
+};
+
+struct NodeStatistics
+{
+    std::string_view       name;     /**< The name of the render technique reporting the statistics */
+    std::vector<Statistic> children; /**< The list of statistics reported by the render technique */
+};
+
+/**
+ * Gets the statistics reported by the render techniques (e.g. culling counters) for the current frame.
+ * Should be called after gfxFrame().
+ * @returns Statistics for each render technique (see NodeStatistics for details).
+ */
+CAPSAICIN_EXPORT std::vector<NodeStatistics> GetStatistics() noexcept;
+
 } // namespace Capsaicin
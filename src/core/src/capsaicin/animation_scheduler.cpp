@@ -0,0 +1,188 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "animation_scheduler.h"
+
+#include "frustum.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Capsaicin
+{
+namespace
+{
+float SurfaceArea(glm::vec3 const &boundsMin, glm::vec3 const &boundsMax) noexcept
+{
+    glm::vec3 const extent = glm::max(boundsMax - boundsMin, glm::vec3(0.0F));
+    return 2.0F * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+}
+} // namespace
+
+void AnimationScheduler::setSettings(Settings const &settings) noexcept
+{
+    settings_ = settings;
+}
+
+AnimationScheduler::Settings const &AnimationScheduler::getSettings() const noexcept
+{
+    return settings_;
+}
+
+void AnimationScheduler::schedule(
+    std::vector<InstanceInput> const &instances, View const &view, bool const rebuildAll) noexcept
+{
+    auto const count = static_cast<uint32_t>(instances.size());
+    if (states_.size() != count)
+    {
+        // The instances have changed so any history is no longer valid
+        states_.assign(count, InstanceState {});
+    }
+    actions_.assign(count, Action::Skip);
+    candidates_.clear();
+    statistics_ = {};
+
+    float4 frustum[6];
+    CalculateFrustumPlanes(view.view_projection, frustum);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        InstanceInput const &instance = instances[i];
+        if (!instance.animated)
+        {
+            continue;
+        }
+        InstanceState &state = states_[i];
+        if (rebuildAll || !state.built)
+        {
+            actions_[i]      = Action::Rebuild;
+            state            = InstanceState {};
+            state.build_area = SurfaceArea(instance.bounds_min, instance.bounds_max);
+            state.built      = true;
+            continue;
+        }
+        state.frames_since_update =
+            std::min(state.frames_since_update, std::numeric_limits<uint32_t>::max() - 1) + 1;
+
+        // Select the update rate based on visibility and size on screen
+        float const projectedSize = CalculateProjectedSize(instance.bounds_min, instance.bounds_max, view);
+        uint32_t    interval      = settings_.hidden_interval;
+        if (IsBoundsInFrustum(instance.bounds_min, instance.bounds_max, frustum))
+        {
+            interval = projectedSize >= settings_.min_projected_size
+                         ? 1U
+                         : std::max(settings_.reduced_interval, 1U);
+        }
+        if (interval == 0 || state.frames_since_update < interval)
+        {
+            continue;
+        }
+        // Instances that have previously been deferred are given a higher priority
+        candidates_.push_back({i, projectedSize * static_cast<float>(state.frames_deferred + 1)});
+    }
+
+    // Apply the budget to the instances being updated
+    auto updateCount = static_cast<uint32_t>(candidates_.size());
+    if (settings_.refit_budget > 0 && updateCount > settings_.refit_budget)
+    {
+        std::ranges::sort(candidates_, [](Candidate const &left, Candidate const &right) {
+            return left.priority != right.priority ? left.priority > right.priority
+                                                   : left.index < right.index;
+        });
+        updateCount = settings_.refit_budget;
+    }
+    for (uint32_t candidate = 0; candidate < static_cast<uint32_t>(candidates_.size()); ++candidate)
+    {
+        uint32_t const       index    = candidates_[candidate].index;
+        InstanceInput const &instance = instances[index];
+        InstanceState       &state    = states_[index];
+        if (candidate >= updateCount)
+        {
+            // Skipping the vertices as well keeps them in sync with the acceleration structure, the instance
+            // remains due so is reconsidered next frame
+            ++state.frames_deferred;
+            ++statistics_.deferred;
+            continue;
+        }
+        state.frames_since_update = 0;
+        state.frames_deferred     = 0;
+        float const area          = SurfaceArea(instance.bounds_min, instance.bounds_max);
+        if (state.refit_count >= settings_.max_refit_count
+            || (settings_.max_refit_growth > 0.0F && area > state.build_area * settings_.max_refit_growth))
+        {
+            actions_[index]   = Action::Rebuild;
+            state.refit_count = 0;
+            state.build_area  = area;
+        }
+        else
+        {
+            actions_[index] = Action::Refit;
+            ++state.refit_count;
+        }
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (!instances[i].animated)
+        {
+            continue;
+        }
+        switch (actions_[i])
+        {
+        case Action::Skip: ++statistics_.skipped; break;
+        case Action::Refit: ++statistics_.refitted; break;
+        case Action::Rebuild: ++statistics_.rebuilt; break;
+        }
+    }
+}
+
+AnimationScheduler::Action AnimationScheduler::getAction(uint32_t const index) const noexcept
+{
+    return index < actions_.size() ? actions_[index] : Action::Skip;
+}
+
+AnimationScheduler::Statistics const &AnimationScheduler::getStatistics() const noexcept
+{
+    return statistics_;
+}
+
+float AnimationScheduler::CalculateProjectedSize(
+    glm::vec3 const &boundsMin, glm::vec3 const &boundsMax, View const &view) noexcept
+{
+    glm::vec3 const center   = 0.5F * (boundsMin + boundsMax);
+    float const     radius   = 0.5F * length(boundsMax - boundsMin);
+    float const     distance = length(center - glm::vec3(view.position));
+    if (distance <= radius)
+    {
+        // The camera is inside the bounds
+        return 1.0F;
+    }
+    return radius / (distance * std::max(view.tan_half_fov_y, 1e-6F));
+}
+
+void AnimationScheduler::reset() noexcept
+{
+    states_.clear();
+    actions_.clear();
+    candidates_.clear();
+    statistics_ = {};
+}
+} // namespace Capsaicin
@@ -0,0 +1,159 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Decides, per animated instance, how often its vertices are re-skinned and its ray tracing acceleration
+ * structure is refit.
+ * Instances that are large on screen are updated every frame, small instances at a reduced rate and
+ * instances outside the view frustum at a (possibly zero) hidden rate. The number of updates per frame can
+ * be limited by a budget, in which case the largest and most out of date instances are updated first and
+ * the remainder are deferred to a later frame. The vertices and acceleration structure of an instance are
+ * always updated together so that rasterised and ray traced geometry match. Refit quality degrades as the
+ * geometry moves away from the pose it was built with, so a full rebuild is forced after a number of refits
+ * or when the bounds have grown too much since the last build.
+ */
+class AnimationScheduler
+{
+public:
+    /** The work to perform for an instance during the current frame. */
+    enum class Action : uint8_t
+    {
+        Skip,    /**< Keep the previous vertices and acceleration structure */
+        Refit,   /**< Update the vertices and refit the acceleration structure */
+        Rebuild, /**< Update the vertices and rebuild the acceleration structure */
+    };
+
+    struct Settings
+    {
+        float min_projected_size =
+            0.05F; /**< Projected size (fraction of screen height) below which the reduced rate is used */
+        uint32_t reduced_interval = 4; /**< Number of frames between updates of small instances */
+        uint32_t hidden_interval =
+            8; /**< Number of frames between updates of instances outside the view frustum (0=never) */
+        uint32_t refit_budget     = 0;  /**< Maximum number of updated instances per frame (0=unlimited) */
+        uint32_t max_refit_count  = 64; /**< Number of consecutive refits after which a rebuild is forced */
+        float    max_refit_growth = 2.0F; /**< Growth of the bounds surface area since the last rebuild above
+                                             which a rebuild is forced */
+    };
+
+    /** Per instance input for a frame. */
+    struct InstanceInput
+    {
+        glm::vec3 bounds_min {0.0F}; /**< World space bounds minimum of the animated geometry */
+        glm::vec3 bounds_max {0.0F}; /**< World space bounds maximum of the animated geometry */
+        bool      animated = false;  /**< False if the instance has no vertex animation (always skipped) */
+    };
+
+    /** The camera used to evaluate visibility. */
+    struct View
+    {
+        float4x4 view_projection {1.0F};
+        float3   position {0.0F};
+        float    tan_half_fov_y = 1.0F; /**< Tangent of half the vertical field of view */
+    };
+
+    /** Number of animated instances per action during the last scheduled frame. */
+    struct Statistics
+    {
+        uint32_t refitted = 0; /**< Number of instances re-skinned and refit */
+        uint32_t rebuilt  = 0; /**< Number of instances re-skinned and rebuilt */
+        uint32_t deferred = 0; /**< Number of instances due for an update but skipped due to the budget */
+        uint32_t skipped  = 0; /**< Number of instances left untouched (including any deferred) */
+    };
+
+    /**
+     * Sets the scheduling settings.
+     * @param settings The new settings.
+     */
+    void setSettings(Settings const &settings) noexcept;
+
+    /**
+     * Gets the scheduling settings.
+     * @return The current settings.
+     */
+    [[nodiscard]] Settings const &getSettings() const noexcept;
+
+    /**
+     * Choose the action of each instance for a new frame.
+     * @param instances  The instance inputs, indexes must refer to the same instances across frames.
+     * @param view       The camera of the frame.
+     * @param rebuildAll True if all acceleration structures are being rebuilt this frame (e.g. after a scene
+     *                   change), in which case all animated instances are updated.
+     */
+    void schedule(std::vector<InstanceInput> const &instances, View const &view, bool rebuildAll) noexcept;
+
+    /**
+     * Gets the action for an instance in the last scheduled frame.
+     * @param index The index of the instance within the scheduled inputs.
+     * @return The action (Skip if out of range).
+     */
+    [[nodiscard]] Action getAction(uint32_t index) const noexcept;
+
+    /**
+     * Gets the action counts of the last scheduled frame.
+     * @return The statistics.
+     */
+    [[nodiscard]] Statistics const &getStatistics() const noexcept;
+
+    /**
+     * Calculates the size of a bounding box projected on screen.
+     * @param boundsMin The minimum corner of the box.
+     * @param boundsMax The maximum corner of the box.
+     * @param view      The camera.
+     * @return The approximate size of the box as a fraction of the screen height.
+     */
+    [[nodiscard]] static float CalculateProjectedSize(
+        glm::vec3 const &boundsMin, glm::vec3 const &boundsMax, View const &view) noexcept;
+
+    /** Forget the history of all instances. */
+    void reset() noexcept;
+
+private:
+    struct InstanceState
+    {
+        uint32_t frames_since_update = 0;    /**< Number of frames since the vertices were last updated */
+        uint32_t frames_deferred     = 0;    /**< Number of frames the update was deferred by the budget */
+        uint32_t refit_count         = 0;    /**< Number of refits since the last rebuild */
+        float    build_area          = 0.0F; /**< Bounds surface area when last rebuilt */
+        bool     built               = false;
+    };
+
+    struct Candidate
+    {
+        uint32_t index;
+        float    priority;
+    };
+
+    Settings                   settings_;
+    std::vector<InstanceState> states_;
+    std::vector<Action>        actions_;
+    std::vector<Candidate>     candidates_; /**< Instances due for an update in the current frame */
+    Statistics                 statistics_;
+};
+} // namespace Capsaicin
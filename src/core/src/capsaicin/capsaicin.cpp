@@ -308,6 +308,15 @@ void SetFixedFrameTime(double const fixed_frame_time) noexcept
     }
 }
 
+double GetFixedFrameTime() noexcept
+{
+    if (g_renderer != nullptr)
+    {
+        return g_renderer->getFixedFrameTime();
+    }
+    return 0.0;
+}
+
 bool GetFixedFrameRate() noexcept
 {
     if (g_renderer != nullptr)
@@ -489,6 +498,22 @@ void SetRenderDimensionsScale(float const scale) noexcept
     }
 }
 
+void SetOffscreenDimensions(uint32_t const width, uint32_t const height) noexcept
+{
+    if (g_renderer != nullptr)
+    {
+        g_renderer->setOffscreenDimensions(uint2(width, height));
+    }
+}
+
+void SetTextureCacheDirectory(std::filesystem::path const &directory) noexcept
+{
+    if (g_renderer != nullptr)
+    {
+        g_renderer->setTextureCacheDirectory(directory);
+    }
+}
+
 RenderOptionList &GetOptions() noexcept
 {
     if (g_renderer != nullptr)
@@ -538,4 +563,13 @@ std::vector<NodeTimestamps> GetProfiling() noexcept
     return {};
 }
 
+std::vector<NodeStatistics> GetStatistics() noexcept
+{
+    if (g_renderer != nullptr)
+    {
+        return g_renderer->getStatistics();
+    }
+    return {};
+}
+
 } // namespace Capsaicin
@@ -24,12 +24,12 @@ THE SOFTWARE.
 #include "common_functions.inl"
 #include "components/light_builder/light_builder.h"
 #include "render_technique.h"
+#include "task_scheduler.h"
 
 #include <chrono>
 #include <filesystem>
 #include <gfx_imgui.h>
 #include <imgui_stdlib.h>
-#include <ppl.h>
 #include <ranges>
 
 using namespace std;
@@ -79,6 +79,81 @@ void CapsaicinInternal::setRenderDimensionsScale(float const scale) noexcept
     render_dimensions_             = newRenderDimensions;
 }
 
+void CapsaicinInternal::setOffscreenDimensions(uint2 const &dimensions) noexcept
+{
+    display_output_.setOffscreenDimensions(dimensions);
+    if (auto const currentWindow = getOutputDimensions(); currentWindow != window_dimensions_)
+    {
+        // Apply immediately so that any scene or render technique set up before the next frame uses the
+        // correct resolution
+        window_dimensions_         = currentWindow;
+        window_dimensions_updated_ = true;
+        setRenderDimensionsScale(render_scale_);
+    }
+}
+
+bool CapsaicinInternal::getOffscreen() const noexcept
+{
+    return display_output_.getOffscreen();
+}
+
+void CapsaicinInternal::setTextureCacheDirectory(filesystem::path const &directory) noexcept
+{
+    texture_cache_.setDirectory(directory);
+}
+
+filesystem::path const &CapsaicinInternal::getTextureCacheDirectory() const noexcept
+{
+    return texture_cache_.getDirectory();
+}
+
+bool CapsaicinInternal::addProgramToCacheKey(char const *file_name, TextureCacheKey &key) const noexcept
+{
+    vector<filesystem::path> include_paths;
+    for (auto const &shader_path : getShaderPaths())
+    {
+        include_paths.emplace_back(shader_path);
+    }
+
+    // gfx looks for each shader stage using the program name
+    bool found = false;
+    for (char const *extension : {".vert", ".frag", ".comp"})
+    {
+        error_code             ec;
+        filesystem::path const file_path = shader_path_ + file_name + extension;
+        if (!filesystem::exists(file_path, ec))
+        {
+            continue;
+        }
+        if (!key.addShaderFile(file_path, include_paths))
+        {
+            return false;
+        }
+        found = true;
+    }
+    return found;
+}
+
+bool CapsaicinInternal::loadCachedTexture(
+    string_view const name, uint64_t const key, GfxTexture const &texture) const noexcept
+{
+    return key != 0 && texture_cache_.load(name, key, texture);
+}
+
+void CapsaicinInternal::saveCachedTexture(
+    string_view const name, uint64_t const key, GfxTexture const &texture) const noexcept
+{
+    if (key != 0)
+    {
+        texture_cache_.save(name, key, texture);
+    }
+}
+
+uint2 CapsaicinInternal::getOutputDimensions() const noexcept
+{
+    return display_output_.getDimensions();
+}
+
 uint32_t CapsaicinInternal::getFrameIndex() const noexcept
 {
     return frame_index_;
@@ -119,6 +194,11 @@ void CapsaicinInternal::setFixedFrameTime(double const fixed_frame_time) noexcep
     play_fixed_frame_time_ = fixed_frame_time;
 }
 
+double CapsaicinInternal::getFixedFrameTime() const noexcept
+{
+    return play_fixed_frame_time_;
+}
+
 bool CapsaicinInternal::getFixedFrameRate() const noexcept
 {
     return play_fixed_framerate_;
@@ -231,6 +311,22 @@ bool CapsaicinInternal::getEnvironmentMapUpdated() const noexcept
     return environment_map_updated_;
 }
 
+bool CapsaicinInternal::getEnvironmentContentsUpdated() const noexcept
+{
+    return environment_map_updated_ || environment_map_changed_;
+}
+
+void CapsaicinInternal::invalidateEnvironmentMap() noexcept
+{
+    environment_map_pending_ = true;
+    environment_map_key_     = 0; // Contents no longer match the environment map file
+}
+
+uint64_t CapsaicinInternal::getEnvironmentMapKey() const noexcept
+{
+    return environment_map_key_;
+}
+
 vector<string_view> CapsaicinInternal::getSharedTextures() const noexcept
 {
     vector<string_view> textures;
@@ -549,6 +645,11 @@ vector<uint32_t> const &CapsaicinInternal::getInstanceIdData() const
     return instance_id_data_;
 }
 
+GfxBuffer CapsaicinInternal::getInstanceBoundsBuffer() const
+{
+    return instance_bounds_buffer_;
+}
+
 GfxBuffer CapsaicinInternal::getTransformBuffer() const
 {
     return transform_buffer_;
@@ -619,6 +720,16 @@ GfxBuffer CapsaicinInternal::getMorphWeightBuffer() const
     return morph_weight_buffer_;
 }
 
+GfxBuffer CapsaicinInternal::getMorphOffsetBuffer() const
+{
+    return morph_offset_buffer_;
+}
+
+GfxBuffer CapsaicinInternal::getMorphDeltaBuffer() const
+{
+    return morph_delta_buffer_;
+}
+
 uint32_t CapsaicinInternal::getVertexDataIndex() const
 {
     return vertex_data_index_;
@@ -664,31 +775,7 @@ pair<float3, float3> CapsaicinInternal::getSceneBounds() const
 
 GfxBuffer CapsaicinInternal::allocateConstantBuffer(uint64_t const size)
 {
-    GfxBuffer     &constant_buffer_pool        = constant_buffer_pools_[gfxGetBackBufferIndex(gfx_)];
-    uint64_t const constant_buffer_pool_cursor = GFX_ALIGN(constant_buffer_pool_cursor_ + size, 256);
-
-    if (constant_buffer_pool_cursor >= constant_buffer_pool.getSize())
-    {
-        gfxDestroyBuffer(gfx_, constant_buffer_pool);
-
-        uint64_t constant_buffer_pool_size = constant_buffer_pool_cursor;
-        constant_buffer_pool_size += (constant_buffer_pool_size + 2) >> 1;
-        constant_buffer_pool_size = GFX_ALIGN(constant_buffer_pool_size, 65536);
-
-        constant_buffer_pool = gfxCreateBuffer(gfx_, constant_buffer_pool_size, nullptr, kGfxCpuAccess_Write);
-
-        char buffer[256];
-        GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_ConstantBufferPool%u", gfxGetBackBufferIndex(gfx_));
-
-        constant_buffer_pool.setName(buffer);
-    }
-
-    GfxBuffer const constant_buffer =
-        gfxCreateBufferRange(gfx_, constant_buffer_pool, constant_buffer_pool_cursor_, size);
-
-    constant_buffer_pool_cursor_ = constant_buffer_pool_cursor;
-
-    return constant_buffer;
+    return upload_ring_.allocate(size);
 }
 
 GfxTexture CapsaicinInternal::createRenderTexture(
@@ -829,14 +916,16 @@ void CapsaicinInternal::initialize(GfxContext const &gfx, ImGuiContext *imgui_co
     sbt_stride_in_entries_[kGfxShaderGroupType_Callable] = 1;
 
     gfx_ = gfx;
+    upload_ring_.initialise(gfx);
+    texture_cache_.initialise(gfx);
 
     blit_program_ = createProgram("capsaicin/blit");
-    blit_kernel_  = gfxCreateGraphicsKernel(gfx, blit_program_);
+    display_output_.initialise(gfx, blit_program_);
 
     generate_animated_vertices_program_ = createProgram("capsaicin/generate_animated_vertices");
     generate_animated_vertices_kernel_  = gfxCreateComputeKernel(gfx, generate_animated_vertices_program_);
 
-    window_dimensions_ = uint2(gfxGetBackBufferWidth(gfx), gfxGetBackBufferHeight(gfx));
+    window_dimensions_ = getOutputDimensions();
     setRenderDimensionsScale(render_scale_);
 
     ImGui::SetCurrentContext(imgui_context);
@@ -852,8 +941,9 @@ void CapsaicinInternal::render()
     frame_time_   = current_time_ - previousTime;
 
     // Check if manual frame increment/decrement has been applied
-    if (bool const manual_play = play_time_ != play_time_old_;
-        !render_paused_ || manual_play || frame_index_ == numeric_limits<uint32_t>::max())
+    bool const new_frame = !render_paused_ || play_time_ != play_time_old_
+                        || frame_index_ == numeric_limits<uint32_t>::max();
+    if (new_frame)
     {
         // Start a new frame
         ++frame_index_;
@@ -866,12 +956,12 @@ void CapsaicinInternal::render()
 
         frameGraph.addValue(frame_time_);
 
-        constant_buffer_pool_cursor_ = 0;
-        auto const currentWindow     = uint2(gfxGetBackBufferWidth(gfx_), gfxGetBackBufferHeight(gfx_));
-        window_dimensions_updated_   = window_dimensions_ != currentWindow;
-        window_dimensions_           = currentWindow;
-        if (window_dimensions_updated_)
+        upload_ring_.beginFrame();
+        // Window dimensions may also have already been updated by setting the offscreen dimensions
+        if (auto const currentWindow = getOutputDimensions(); window_dimensions_ != currentWindow)
         {
+            window_dimensions_updated_ = true;
+            window_dimensions_         = currentWindow;
             // Update render dimensions
             setRenderDimensionsScale(render_scale_);
         }
@@ -925,6 +1015,15 @@ void CapsaicinInternal::render()
             }
         }
 
+        // Apply any change to the worker count, which is only allowed once the scene update job has completed
+        waitForSceneUpdate();
+        uint32_t worker_count = getOption<uint32_t>("capsaicin_worker_count");
+        worker_count          = worker_count > 0 ? worker_count : TaskScheduler::GetDefaultWorkerCount();
+        if (worker_count != TaskScheduler::Get().getWorkerCount())
+        {
+            TaskScheduler::Get().setWorkerCount(worker_count);
+        }
+
         // Update the scene state
         updateScene();
 
@@ -957,6 +1056,7 @@ void CapsaicinInternal::render()
         mesh_updated_              = false;
         transform_updated_         = false;
         environment_map_updated_   = false;
+        environment_map_changed_   = false;
         scene_updated_             = false;
         camera_changed_            = false;
         camera_updated_            = false;
@@ -1030,17 +1130,11 @@ void CapsaicinInternal::render()
             currentView = getSharedTexture("Debug");
         }
     }
+    if (!getOffscreen())
     {
         // Display the current view to back buffer
         GfxCommandEvent const command_event(gfx_, "Display");
-
-        gfxProgramSetTexture(gfx_, blit_program_, "g_InputBuffer", currentView);
-        uint2 const inputResolution = uint2(currentView.getWidth(), currentView.getHeight());
-        gfxProgramSetParameter(gfx_, blit_program_, "g_InputResolution", inputResolution);
-        gfxProgramSetParameter(gfx_, blit_program_, "g_Scale",
-            static_cast<float2>(inputResolution) / static_cast<float2>(window_dimensions_));
-        gfxCommandBindKernel(gfx_, blit_kernel_);
-        gfxCommandDraw(gfx_, 3);
+        display_output_.present(currentView);
     }
 
     // Dump buffers for past dump requests (takes X frames to be become available)
@@ -1058,7 +1152,7 @@ void CapsaicinInternal::render()
     }
 
     // Write out each available buffer in parallel
-    concurrency::parallel_for(0U, dump_available_buffer_count, 1U, [&](uint32_t const buffer_index) {
+    ParallelFor(0U, dump_available_buffer_count, 1U, [&](uint32_t const buffer_index) {
         auto const &buffer = dump_in_flight_buffers_[buffer_index];
         saveImage(get<0>(buffer), get<1>(buffer), get<2>(buffer), get<3>(buffer), get<4>(buffer));
     });
@@ -1069,6 +1163,15 @@ void CapsaicinInternal::render()
         gfxDestroyBuffer(gfx_, get<0>(dump_in_flight_buffers_.front()));
         dump_in_flight_buffers_.pop_front();
     }
+
+    // Write any generated textures whose readback has completed to the texture cache
+    texture_cache_.update();
+
+    // Evaluate the scene for the next frame while the GPU processes this one
+    if (new_frame && render_options.capsaicin_pipelined_scene_update && !play_paused_ && hasAnimation())
+    {
+        beginSceneUpdate();
+    }
 }
 
 void CapsaicinInternal::renderGUI(bool const readOnly)
@@ -1320,11 +1423,15 @@ void CapsaicinInternal::renderGUI(bool const readOnly)
 
 void CapsaicinInternal::terminate() noexcept
 {
+    waitForSceneUpdate();
+    scene_snapshot_pending_ = nullptr;
+    gfxDestroyScene(animation_scene_.scene);
+    animation_scene_ = {};
     if (gfxContextIsValid(gfx_))
     {
         gfxFinish(gfx_);
         // Dump remaining buffers, they are all available after gfxFinish
-        concurrency::parallel_for(
+        ParallelFor(
             0U, static_cast<uint32_t>(dump_in_flight_buffers_.size()), 1U, [&](uint32_t const buffer_index) {
                 auto const &buffer = dump_in_flight_buffers_[buffer_index];
                 saveImage(
@@ -1336,13 +1443,16 @@ void CapsaicinInternal::terminate() noexcept
             gfxDestroyBuffer(gfx_, get<0>(dump_in_flight_buffers_.front()));
             dump_in_flight_buffers_.pop_front();
         }
+
+        // Write any remaining cached textures
+        texture_cache_.flush();
     }
 
     render_techniques_.clear();
     components_.clear();
     renderer_ = nullptr;
 
-    gfxDestroyKernel(gfx_, blit_kernel_);
+    display_output_.release();
     gfxDestroyProgram(gfx_, blit_program_);
     gfxDestroyKernel(gfx_, debug_depth_kernel_);
     gfxDestroyProgram(gfx_, debug_depth_program_);
@@ -1358,8 +1468,11 @@ void CapsaicinInternal::terminate() noexcept
     gfxDestroyBuffer(gfx_, material_buffer_);
     gfxDestroyBuffer(gfx_, transform_buffer_);
     gfxDestroyBuffer(gfx_, instance_id_buffer_);
+    gfxDestroyBuffer(gfx_, instance_bounds_buffer_);
     gfxDestroyBuffer(gfx_, prev_transform_buffer_);
     gfxDestroyBuffer(gfx_, morph_weight_buffer_);
+    gfxDestroyBuffer(gfx_, morph_offset_buffer_);
+    gfxDestroyBuffer(gfx_, morph_delta_buffer_);
     gfxDestroyBuffer(gfx_, joint_buffer_);
     gfxDestroyBuffer(gfx_, joint_matrices_buffer_);
 
@@ -1394,11 +1507,8 @@ void CapsaicinInternal::terminate() noexcept
     }
     texture_atlas_.clear();
 
-    for (GfxBuffer const &constant_buffer_pool : constant_buffer_pools_)
-    {
-        gfxDestroyBuffer(gfx_, constant_buffer_pool);
-    }
-    memset(constant_buffer_pools_, 0, sizeof(constant_buffer_pools_));
+    upload_ring_.clear();
+    texture_cache_.clear();
 
     gfxDestroyScene(scene_);
     scene_ = {};
@@ -1450,6 +1560,13 @@ RenderOptionList CapsaicinInternal::getStockRenderOptions() noexcept
     newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_lod_offset, render_options));
     newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_lod_aggressive, render_options));
     newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_mirror_roughness_threshold, render_options));
+    newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_worker_count, render_options));
+    newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_pipelined_scene_update, render_options));
+    newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_animation_scheduling, render_options));
+    newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_animation_min_projected_size, render_options));
+    newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_animation_reduced_interval, render_options));
+    newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_animation_hidden_interval, render_options));
+    newOptions.emplace(RENDER_OPTION_MAKE(capsaicin_animation_refit_budget, render_options));
     return newOptions;
 }
 
@@ -1460,6 +1577,13 @@ CapsaicinInternal::RenderOptions CapsaicinInternal::convertOptions(RenderOptionL
     RENDER_OPTION_GET(capsaicin_lod_offset, newOptions, options)
     RENDER_OPTION_GET(capsaicin_lod_aggressive, newOptions, options)
     RENDER_OPTION_GET(capsaicin_mirror_roughness_threshold, newOptions, options)
+    RENDER_OPTION_GET(capsaicin_worker_count, newOptions, options)
+    RENDER_OPTION_GET(capsaicin_pipelined_scene_update, newOptions, options)
+    RENDER_OPTION_GET(capsaicin_animation_scheduling, newOptions, options)
+    RENDER_OPTION_GET(capsaicin_animation_min_projected_size, newOptions, options)
+    RENDER_OPTION_GET(capsaicin_animation_reduced_interval, newOptions, options)
+    RENDER_OPTION_GET(capsaicin_animation_hidden_interval, newOptions, options)
+    RENDER_OPTION_GET(capsaicin_animation_refit_budget, newOptions, options)
     return newOptions;
 }
 
@@ -2763,6 +2887,8 @@ void CapsaicinInternal::resetEvents() noexcept
     mesh_updated_              = false;
     transform_updated_         = false;
     environment_map_updated_   = false;
+    environment_map_changed_   = false;
+    environment_map_pending_   = false;
     scene_updated_             = false;
     camera_changed_            = false;
     camera_updated_            = false;
@@ -21,10 +21,15 @@ THE SOFTWARE.
 ********************************************************************/
 #pragma once
 
+#include "animation_scheduler.h"
 #include "capsaicin.h"
 #include "gpu_shared.h"
 #include "graph.h"
 #include "renderer.h"
+#include "task_scheduler.h"
+#include "utilities/display_output.h"
+#include "utilities/gpu_upload_ring.h"
+#include "utilities/texture_cache.h"
 
 #include <deque>
 #include <filesystem>
@@ -80,6 +85,62 @@ class CapsaicinInternal
      */
     void setRenderDimensionsScale(float scale) noexcept;
 
+    /**
+     * Set a fixed output resolution used instead of the back buffer when rendering headless.
+     * When set the final output is not copied to the back buffer.
+     * @param dimensions The output width and height (0 to return to using the back buffer).
+     */
+    void setOffscreenDimensions(uint2 const &dimensions) noexcept;
+
+    /**
+     * Check if rendering headless to offscreen targets.
+     * @return True if offscreen dimensions have been set.
+     */
+    [[nodiscard]] bool getOffscreen() const noexcept;
+
+    /**
+     * Set the directory used to cache generated textures between runs.
+     * @note Must be set before the renderer and scene are loaded for their textures to be cached.
+     * @param directory The cache directory (empty to disable caching).
+     */
+    void setTextureCacheDirectory(std::filesystem::path const &directory) noexcept;
+
+    /**
+     * Gets the directory used to cache generated textures between runs.
+     * @return The cache directory (empty if caching is disabled).
+     */
+    [[nodiscard]] std::filesystem::path const &getTextureCacheDirectory() const noexcept;
+
+    /**
+     * Add the source of a program to a texture cache key.
+     * All the shader stages of the program are added along with the files they include, so that editing a
+     * generating shader invalidates the textures previously cached from it.
+     * @param       file_name Name of the program (as passed to createProgram).
+     * @param [out] key       The key to update.
+     * @return False if the sources could not be read, in which case the key should not be used.
+     */
+    bool addProgramToCacheKey(char const *file_name, TextureCacheKey &key) const noexcept;
+
+    /**
+     * Load a generated texture from the texture cache.
+     * @param name    Name of the texture.
+     * @param key     Key identifying everything the texture contents were generated from (0 if the texture
+     *                cannot be cached).
+     * @param texture The texture to upload the cached contents to.
+     * @return True if the texture was found in the cache, False if it must be generated.
+     */
+    bool loadCachedTexture(std::string_view name, uint64_t key, GfxTexture const &texture) const noexcept;
+
+    /**
+     * Store a generated texture in the texture cache.
+     * @note The contents are read back after all previously recorded commands have completed.
+     * @param name    Name of the texture.
+     * @param key     Key identifying everything the texture contents were generated from (0 if the texture
+     *                cannot be cached).
+     * @param texture The texture to store.
+     */
+    void saveCachedTexture(std::string_view name, uint64_t key, GfxTexture const &texture) const noexcept;
+
     /**
      * Get the index of the most recent frame (starts at zero).
      * @return The index of the current/last frame rendered.
@@ -129,6 +190,12 @@ class CapsaicinInternal
      */
     void setFixedFrameTime(double fixed_frame_time) noexcept;
 
+    /**
+     * Get the current fixed rate frame time.
+     * @return A duration in seconds.
+     */
+    [[nodiscard]] double getFixedFrameTime() const noexcept;
+
     /**
      * Get current playback mode.
      * @return True if using fixed frame rate, False is using real-time.
@@ -255,10 +322,34 @@ class CapsaicinInternal
 
     /**
      * Check if the environment map was changed this frame.
+     * @note This only covers the environment buffer being loaded, swapped or resized. Temporal effects use it
+     * to reset so it does not include changes made with invalidateEnvironmentMap().
      * @return True if environment map has changed.
      */
     [[nodiscard]] bool getEnvironmentMapUpdated() const noexcept;
 
+    /**
+     * Check if the contents of the environment buffer changed this frame.
+     * @note Unlike getEnvironmentMapUpdated() this includes changes made with invalidateEnvironmentMap(), it
+     * should be used by anything derived from the environment map contents (e.g. prefiltered maps).
+     * @return True if environment contents have changed.
+     */
+    [[nodiscard]] bool getEnvironmentContentsUpdated() const noexcept;
+
+    /**
+     * Mark the contents of the environment buffer as changed.
+     * @note This is used by render techniques that write to the environment buffer. As techniques run after
+     * all components the change is reported by getEnvironmentContentsUpdated() during the following frame.
+     */
+    void invalidateEnvironmentMap() noexcept;
+
+    /**
+     * Gets the texture cache key of the current environment buffer contents.
+     * @return The key, 0 if the contents were not generated from an environment map file (e.g. they were
+     * written by a render technique).
+     */
+    [[nodiscard]] uint64_t getEnvironmentMapKey() const noexcept;
+
     /**
      * Gets the list of currently available shared textures.
      * @return The shared texture list.
@@ -657,6 +748,7 @@ class CapsaicinInternal
     [[nodiscard]] std::vector<Instance> const &getInstanceData() const;
     [[nodiscard]] GfxBuffer                    getInstanceIdBuffer() const;
     [[nodiscard]] std::vector<uint32_t> const &getInstanceIdData() const;
+    [[nodiscard]] GfxBuffer                    getInstanceBoundsBuffer() const;
 
     [[nodiscard]] GfxBuffer getTransformBuffer() const;
     [[nodiscard]] GfxBuffer getPrevTransformBuffer() const;
@@ -675,6 +767,8 @@ class CapsaicinInternal
     [[nodiscard]] GfxBuffer getJointBuffer() const;
     [[nodiscard]] GfxBuffer getJointMatricesBuffer() const;
     [[nodiscard]] GfxBuffer getMorphWeightBuffer() const;
+    [[nodiscard]] GfxBuffer getMorphOffsetBuffer() const;
+    [[nodiscard]] GfxBuffer getMorphDeltaBuffer() const;
 
     [[nodiscard]] uint32_t getVertexDataIndex() const;
     [[nodiscard]] uint32_t getPrevVertexDataIndex() const;
@@ -691,12 +785,31 @@ class CapsaicinInternal
      */
     [[nodiscard]] std::pair<float3, float3> getSceneBounds() const;
 
+    /**
+     * Allocate a temporary buffer from the per-frame upload ring.
+     * @note The buffer is only valid for the current frame and should be destroyed once used.
+     * @tparam TYPE Type of each element.
+     * @param element_count (Optional) The number of elements.
+     * @return The new CPU writable buffer.
+     */
     template<typename TYPE>
     [[nodiscard]] GfxBuffer allocateConstantBuffer(uint32_t const element_count = 1)
     {
-        GfxBuffer constant_buffer = allocateConstantBuffer(element_count * sizeof(TYPE));
-        constant_buffer.setStride(static_cast<uint32_t>(sizeof(TYPE)));
-        return constant_buffer;
+        return upload_ring_.allocate<TYPE>(element_count);
+    }
+
+    /**
+     * Allocate a temporary buffer from the per-frame upload ring and fill it with data.
+     * @note The buffer is only valid for the current frame and should be destroyed once used.
+     * @tparam TYPE Type of each element.
+     * @param data          The data to copy into the buffer.
+     * @param element_count The number of elements.
+     * @return The new CPU writable buffer.
+     */
+    template<typename TYPE>
+    [[nodiscard]] GfxBuffer allocateConstantBuffer(TYPE const *data, uint32_t const element_count)
+    {
+        return upload_ring_.allocate<TYPE>(data, element_count);
     }
 
     [[nodiscard]] GfxBuffer allocateConstantBuffer(uint64_t size);
@@ -819,6 +932,12 @@ class CapsaicinInternal
      */
     std::vector<NodeTimestamps> getProfiling() noexcept;
 
+    /**
+     * Gets the statistics reported by each render technique for the current frame.
+     * @returns Statistics for each render technique (see NodeStatistics for details).
+     */
+    [[nodiscard]] std::vector<NodeStatistics> getStatistics() const noexcept;
+
 private:
     /*
      * Gets configuration options specific to capsaicin itself.
@@ -834,6 +953,19 @@ class CapsaicinInternal
                                                   mesh size but with potential to destroy mesh topology) */
         float capsaicin_mirror_roughness_threshold =
             0.1f; /**< The threshold below which to force mirror reflections */
+        uint32_t capsaicin_worker_count = 0; /**< Number of task scheduler worker threads (0=automatic) */
+        bool capsaicin_pipelined_scene_update =
+            false; /**< Evaluate the next frame's animations and transforms on a worker thread while the
+                      current frame completes (animation uses the previous frame time) */
+        bool capsaicin_animation_scheduling = false; /**< Skin and refit animated instances based on their
+                                                        visibility, projected size and a refit budget */
+        float capsaicin_animation_min_projected_size =
+            0.05F; /**< Projected size (fraction of screen height) below which the reduced rate is used */
+        uint32_t capsaicin_animation_reduced_interval = 4; /**< Frames between updates of small instances */
+        uint32_t capsaicin_animation_hidden_interval =
+            8; /**< Frames between updates of instances outside the view frustum (0=never) */
+        uint32_t capsaicin_animation_refit_budget =
+            0; /**< Maximum animated instances skinned and refit/rebuilt per frame (0=unlimited) */
     };
 
     /**
@@ -947,11 +1079,25 @@ class CapsaicinInternal
      */
     void updateSceneAnimations() noexcept;
 
+    /**
+     * Apply all scene animations at a given playback position.
+     * @param scene    The scene to animate.
+     * @param playTime The absolute playback position (s).
+     * @return True if the scene contains animations, False otherwise.
+     */
+    static bool ApplySceneAnimations(GfxScene const &scene, double playTime) noexcept;
+
     /**
      * Generate camera matrices based on currently active scene camera.
      */
     void updateSceneCameraMatrices() noexcept;
 
+    /**
+     * Gets the resolution of the output, either the back buffer or the offscreen dimensions if set.
+     * @return The output width and height.
+     */
+    [[nodiscard]] uint2 getOutputDimensions() const noexcept;
+
     /**
      * Update geometry buffers based on current scene settings.
      */
@@ -978,6 +1124,12 @@ class CapsaicinInternal
      */
     [[nodiscard]] bool updateSceneAnimatedGeometry() noexcept;
 
+    /**
+     * Select the skinning and acceleration structure update of each animated instance for this frame.
+     * @param rebuildAll True if the acceleration structure is going to be fully rebuilt.
+     */
+    void scheduleSceneAnimatedGeometry(bool rebuildAll) noexcept;
+
     /**
      * Update acceleration structures based on current scene settings.
      */
@@ -993,6 +1145,73 @@ class CapsaicinInternal
     void dumpCamera(CameraMatrices const &cameraMatrices, float cameraJitterX, float cameraJitterY,
         std::filesystem::path const &filePath) const;
 
+    /**
+     * Scene state evaluated ahead of the frame that consumes it when using pipelined scene updates.
+     * A snapshot is only written by the scene update job, is immutable once collected and is applied to the
+     * scene by the render thread at the start of the next frame.
+     */
+    struct SceneSnapshot
+    {
+        std::vector<std::filesystem::path> scene_files; /**< Scene files the animations were evaluated on */
+        double base_play_time = 0.0;   /**< Playback position when the snapshot was requested (s) */
+        double play_time      = 0.0;   /**< Playback position the animations were evaluated at (s) */
+        bool   evaluated      = false; /**< False if the scene files could not be loaded by the job */
+        size_t transform_hash = 0;     /**< Hash of all instance transforms */
+        std::vector<glm::mat4>              transforms;     /**< World transform of each scene instance */
+        std::vector<std::vector<float>>     weights;        /**< Morph target weights of each instance */
+        std::vector<std::vector<glm::mat4>> joint_matrices; /**< Joint matrices of each scene skin */
+        std::vector<std::pair<uint32_t, GfxCamera>> cameras; /**< Scene cameras moved by the animations */
+        std::vector<std::pair<uint32_t, GfxLight>>  lights;  /**< Scene lights moved by the animations */
+        std::vector<std::pair<glm::vec3, glm::vec3>>
+            bounds; /**< World space bounds of each scene instance (indexed by scene object index) */
+    };
+
+    /**
+     * Private copy of the scene files that the scene update job evaluates the animations on, so that the job
+     * never accesses the rendered scene.
+     */
+    struct AnimationScene
+    {
+        std::vector<std::filesystem::path> scene_files;    /**< Files to load into the scene */
+        GfxScene                           scene;          /**< Created and destroyed on the render thread */
+        bool                               loaded = false; /**< True once the job has imported the files */
+        bool                               valid  = false; /**< True if the files were imported */
+        std::vector<GfxCamera>             rest_cameras;   /**< Cameras before any animation was applied */
+        std::vector<GfxLight>              rest_lights;    /**< Lights before any animation was applied */
+    };
+
+    /**
+     * Start the job that evaluates the scene for the next frame.
+     * @note The job only accesses the animation scene and the pending snapshot, the rendered scene remains
+     *  available to the render thread and the application.
+     */
+    void beginSceneUpdate() noexcept;
+
+    /**
+     * Wait for any in flight scene update job.
+     */
+    void waitForSceneUpdate() noexcept;
+
+    /**
+     * Take ownership of the snapshot produced by the last scene update job.
+     * @return The snapshot (nullptr if no job was started).
+     */
+    [[nodiscard]] std::unique_ptr<SceneSnapshot const> collectSceneUpdate() noexcept;
+
+    /**
+     * Copy the animated state of a snapshot into the scene.
+     * @param snapshot The snapshot to apply, must match the current scene objects.
+     */
+    void applySceneSnapshot(SceneSnapshot const &snapshot) noexcept;
+
+    /**
+     * Evaluate the scene animations, transforms and bounds. Runs on a worker thread.
+     * @param [in,out] animationScene The animation scene, the scene files are imported on first use.
+     * @param [in,out] snapshot       The snapshot to fill, its scene files and playback positions must
+     *  already be set.
+     */
+    static void PrepareSceneSnapshot(AnimationScene &animationScene, SceneSnapshot &snapshot) noexcept;
+
     struct InstanceSourceInfo
     {
         uint32_t vertex_source_offset_idx;
@@ -1009,6 +1228,8 @@ class CapsaicinInternal
     bool   mesh_updated_              = true;
     bool   transform_updated_         = true;
     bool   environment_map_updated_   = true;
+    bool   environment_map_changed_   = false; /**< Environment contents were changed by a technique */
+    bool   environment_map_pending_   = false; /**< Environment change to report during the next frame */
     bool   scene_updated_             = true;
     bool   camera_changed_            = true;
     bool   camera_updated_            = true;
@@ -1030,6 +1251,7 @@ class CapsaicinInternal
     std::vector<std::filesystem::path> scene_files_;
     std::filesystem::path              environment_map_file_;
     uint2 environment_map_source_dimensions_ {}; /** Original size of source envMap */
+    uint64_t environment_map_key_ = 0; /**< Texture cache key of the environment buffer (0 if not cached) */
 
     uint32_t frame_index_ =
         std::numeric_limits<uint32_t>::max(); /**< Current frame number (incremented each render call) */
@@ -1067,7 +1289,6 @@ class CapsaicinInternal
                                                "None" or empty for default behaviour) */
     GfxTexture currentView;        /**< Current view being displayed */
 
-    GfxKernel  blit_kernel_;  /**< The kernel to blit the color buffer to the back buffer. */
     GfxProgram blit_program_; /**< The program to blit the color buffer to the back buffer. */
     GfxKernel  debug_depth_kernel_;
     GfxProgram debug_depth_program_;
@@ -1082,13 +1303,23 @@ class CapsaicinInternal
     using SharedBuffersList = std::vector<std::pair<std::string_view, GfxBuffer>>;
     SharedBuffersList shared_buffers_;       /**< The list of buffers populated by the render techniques. */
     TextureClearList  clear_shared_buffers_; /**< List of shared buffers to clear each frame */
-    GfxBuffer         constant_buffer_pools_[kGfxConstant_BackBufferCount];
-    uint64_t          constant_buffer_pool_cursor_ = 0;
+    GPUUploadRing     upload_ring_;          /**< Per-frame ring used for constants and small uploads */
+    DisplayOutput     display_output_;       /**< The back buffer or the headless output resolution */
+    mutable TextureCache texture_cache_; /**< On-disk cache of generated textures */
+    AnimationScheduler animation_scheduler_; /**< Selects when animated instances are skinned and refit */
+
+    TaskGroup      scene_update_group_; /**< The in flight scene update job (if any) */
+    AnimationScene animation_scene_;    /**< Owned by the scene update job while it is in flight */
+    std::unique_ptr<SceneSnapshot>
+        scene_snapshot_pending_; /**< Snapshot being written, owned by the scene update job until collected */
+    std::unique_ptr<SceneSnapshot const>
+        scene_snapshot_; /**< Snapshot used by the scene update of the current frame (nullptr if none) */
 
     GfxBuffer             camera_matrices_buffer_[2]; /**< Un-jittered and jittered camera matrices */
     std::vector<Instance> instance_data_;
     GfxBuffer             instance_buffer_;
     std::vector<std::pair<glm::vec3, glm::vec3>> instance_bounds_;
+    GfxBuffer                                    instance_bounds_buffer_;
     std::vector<uint32_t>                        instance_id_data_;
     GfxBuffer                                    instance_id_buffer_;
     GfxBuffer                                    transform_buffer_;
@@ -1106,6 +1337,10 @@ class CapsaicinInternal
     uint32_t  prev_vertex_data_index_ = 0; /**< Animated vertices data frame index for the previous frame. */
     GfxBuffer vertex_source_buffer_;       /**< The buffer storing vertices source data for animation. */
     GfxBuffer morph_weight_buffer_;        /**< The buffer storing weights for morph targets animation. */
+    GfxBuffer morph_offset_buffer_;        /**< The buffer storing per vertex ranges of morph deltas. */
+    GfxBuffer morph_delta_buffer_;         /**< The buffer storing sparse quantised morph target deltas. */
+    size_t    morph_dense_bytes_  = 0;     /**< Size the morph targets would use if stored per vertex. */
+    size_t    morph_sparse_bytes_ = 0;     /**< Size of the sparse morph target storage. */
     GfxBuffer joint_buffer_;               /**< The buffer storing per vertex joint indices and weights. */
     std::vector<uint32_t>           joint_matrices_offsets_;
     GfxBuffer                       joint_matrices_buffer_; /**< The buffer storing joint matrices. */
@@ -1113,16 +1348,18 @@ class CapsaicinInternal
 
     struct MeshInfo
     {
-        uint vertex_offset_idx[2];
-        uint index_offset_idx;
-        uint index_count;
-        uint vertex_source_offset_idx;
-        uint joints_offset;
-        uint targets_count;
-        uint vertex_count;
-        uint meshlet_count;      /**< Number of meshlets in mesh */
-        uint meshlet_offset_idx; /**< Absolute offset into Meshlet buffer for first meshlet */
-        bool is_animated;
+        uint   vertex_offset_idx[2];
+        uint   index_offset_idx;
+        uint   index_count;
+        uint   vertex_source_offset_idx;
+        uint   joints_offset;
+        uint   targets_count;
+        uint   morph_offset_idx; /**< Offset into morph offset buffer for first vertex (~0u if no targets) */
+        float2 morph_scale;      /**< Quantisation scale of the morph position (x) and normal (y) deltas */
+        uint   vertex_count;
+        uint   meshlet_count;      /**< Number of meshlets in mesh */
+        uint   meshlet_offset_idx; /**< Absolute offset into Meshlet buffer for first meshlet */
+        bool   is_animated;
     };
 
     std::vector<MeshInfo>               mesh_infos_;
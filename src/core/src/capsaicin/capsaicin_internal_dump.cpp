@@ -246,6 +246,57 @@ std::vector<NodeTimestamps> CapsaicinInternal::getProfiling() noexcept
     return timestamps;
 }
 
+std::vector<NodeStatistics> CapsaicinInternal::getStatistics() const noexcept
+{
+    std::vector<NodeStatistics> statistics;
+    {
+        auto const &uploadStatistics = upload_ring_.getStatistics();
+        statistics.emplace_back("Upload Ring",
+            std::vector<Statistic> {
+                {"Bytes Used", static_cast<double>(uploadStatistics.bytes_used)},
+                {"Capacity", static_cast<double>(uploadStatistics.capacity)},
+                {"Allocations", static_cast<double>(uploadStatistics.allocations)},
+                {"Buffers Created", static_cast<double>(uploadStatistics.buffers_created)},
+            });
+    }
+    if (morph_dense_bytes_ > 0)
+    {
+        statistics.emplace_back("Morph Targets",
+            std::vector<Statistic> {
+                {"Dense Bytes", static_cast<double>(morph_dense_bytes_)},
+                {"Sparse Bytes", static_cast<double>(morph_sparse_bytes_)},
+            });
+    }
+    if (render_options.capsaicin_animation_scheduling)
+    {
+        auto const &animationStatistics = animation_scheduler_.getStatistics();
+        statistics.emplace_back("Animation Scheduler",
+            std::vector<Statistic> {
+                {"Refitted", static_cast<double>(animationStatistics.refitted)},
+                {"Rebuilt", static_cast<double>(animationStatistics.rebuilt)},
+                {"Deferred", static_cast<double>(animationStatistics.deferred)},
+                {"Skipped", static_cast<double>(animationStatistics.skipped)},
+            });
+    }
+    for (auto const &render_technique : render_techniques_)
+    {
+        StatisticList const techniqueStatistics = render_technique->getStatistics();
+        if (techniqueStatistics.empty())
+        {
+            continue;
+        }
+
+        std::vector<Statistic> nodeStatistics;
+        nodeStatistics.reserve(techniqueStatistics.size());
+        for (auto const &[name, value] : techniqueStatistics)
+        {
+            nodeStatistics.emplace_back(name, value);
+        }
+        statistics.emplace_back(render_technique->getName(), std::move(nodeStatistics));
+    }
+    return statistics;
+}
+
 void CapsaicinInternal::dumpTexture(std::filesystem::path const &filePath, GfxTexture const &texture)
 {
     // Check if we can actually dump the buffer to the chosen format
@@ -276,10 +327,9 @@ void CapsaicinInternal::dumpTexture(std::filesystem::path const &filePath, GfxTe
         }
     }
 
-    uint32_t const dumpBufferWidth =
-        texture.getWidth() > 0 ? texture.getWidth() : gfxGetBackBufferWidth(gfx_);
-    uint32_t const dumpBufferHeight =
-        texture.getHeight() > 0 ? texture.getHeight() : gfxGetBackBufferHeight(gfx_);
+    uint2 const    outputDimensions = getOutputDimensions();
+    uint32_t const dumpBufferWidth  = texture.getWidth() > 0 ? texture.getWidth() : outputDimensions.x;
+    uint32_t const dumpBufferHeight = texture.getHeight() > 0 ? texture.getHeight() : outputDimensions.y;
     uint32_t       dump_buffer_size = dumpBufferWidth * dumpBufferHeight;
     uint32_t const bytesPerPixel    = GetBitsPerPixel(texture.getFormat()) / 8;
     GFX_ASSERT(bytesPerPixel != 0);
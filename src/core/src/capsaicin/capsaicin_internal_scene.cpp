@@ -23,6 +23,8 @@ THE SOFTWARE.
 #include "capsaicin_internal.h"
 #include "common_functions.inl"
 #include "hash_reduce.h"
+#include "morph_targets.h"
+#include "task_scheduler.h"
 
 #include <cmath>
 #include <filesystem>
@@ -199,8 +201,8 @@ bool CapsaicinInternal::setSceneCamera(std::string_view const &name) noexcept
         return false;
     }
     auto const camera = gfxSceneGetCameraHandle(scene_, static_cast<uint32_t>(cameraIndex - cameras.begin()));
-    camera->aspect =
-        static_cast<float>(gfxGetBackBufferWidth(gfx_)) / static_cast<float>(gfxGetBackBufferHeight(gfx_));
+    auto const outputDimensions = getOutputDimensions();
+    camera->aspect = static_cast<float>(outputDimensions.x) / static_cast<float>(outputDimensions.y);
     if (gfxSceneSetActiveCamera(scene_, camera) != kGfxResult_NoError)
     {
         return false;
@@ -361,8 +363,8 @@ bool CapsaicinInternal::loadSceneFile(std::filesystem::path const &fileName, boo
             userCamera->up           = defaultCamera->up;
         }
         auto const camera = gfxSceneGetCameraHandle(scene_, cameraIndex);
-        camera->aspect    = static_cast<float>(gfxGetBackBufferWidth(gfx_))
-                       / static_cast<float>(gfxGetBackBufferHeight(gfx_));
+        auto const outputDimensions = getOutputDimensions();
+        camera->aspect = static_cast<float>(outputDimensions.x) / static_cast<float>(outputDimensions.y);
         if (gfxSceneSetActiveCamera(scene_, camera) != kGfxResult_NoError)
         {
             return false;
@@ -503,6 +505,7 @@ bool CapsaicinInternal::generateEnvironmentMap(std::filesystem::path const &file
             environment_buffer_      = {};
             environment_map_updated_ = true;
         }
+        environment_map_key_ = 0;
         return true;
     }
 
@@ -527,6 +530,50 @@ bool CapsaicinInternal::generateEnvironmentMap(std::filesystem::path const &file
         }
     }
 
+    // Check if the environment cube map was previously generated at the requested size
+    uint64_t environment_map_key = 0;
+    if (texture_cache_.isEnabled())
+    {
+        if (TextureCacheKey key;
+            key.addFile(fileName) && addProgramToCacheKey("capsaicin/convolve_ibl", key))
+        {
+            environment_map_key = key.add(environmentSize).getValue();
+        }
+
+        // Only create the texture once the cached header matches what would otherwise be generated
+        TextureCacheData cached_data;
+        if (environment_map_key != 0
+            && texture_cache_.read("EnvironmentMap", environment_map_key, cached_data) && cached_data.is_cube
+            && cached_data.format == DXGI_FORMAT_R16G16B16A16_FLOAT && cached_data.width > 0
+            && cached_data.width <= environmentSize && cached_data.height == cached_data.width
+            && cached_data.mip_levels == gfxCalculateMipCount(cached_data.width)
+            && cached_data.data.size()
+                   == CalculateTextureCacheSize(8, cached_data.width, cached_data.height,
+                       cached_data.mip_levels, true)
+            && cached_data.user_data[0] > 0 && cached_data.user_data[1] > 0)
+        {
+            GfxTexture const cached_buffer = gfxCreateTextureCube(gfx_, cached_data.width,
+                DXGI_FORMAT_R16G16B16A16_FLOAT, cached_data.mip_levels, nullptr,
+                D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS | D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET);
+            if (texture_cache_.upload(cached_data, cached_buffer))
+            {
+                if (!!environment_buffer_)
+                {
+                    gfxDestroyTexture(gfx_, environment_buffer_);
+                }
+                environment_buffer_ = cached_buffer;
+                environment_buffer_.setName("Capsaicin_EnvironmentBuffer");
+                environment_map_updated_ = true;
+                environment_map_file_    = fileName;
+                environment_map_source_dimensions_ =
+                    uint2(cached_data.user_data[0], cached_data.user_data[1]);
+                environment_map_key_ = environment_map_key;
+                return true;
+            }
+            gfxDestroyTexture(gfx_, cached_buffer);
+        }
+    }
+
     // Load in the environment map
     std::string const fileNameString = fileName.string();
     if (gfxSceneImport(scene_, fileNameString.c_str()) != kGfxResult_NoError)
@@ -649,13 +696,42 @@ bool CapsaicinInternal::generateEnvironmentMap(std::filesystem::path const &file
     auto const handle = gfxSceneGetImageHandle(scene_, environmentMap.getIndex());
     gfxSceneDestroyImage(scene_, handle);
     gfxDestroyTexture(gfx_, environment_map);
+
+    // Store the generated cube map along with the source dimensions needed to handle later resizes
+    environment_map_key_ = environment_map_key;
+    if (environment_map_key != 0)
+    {
+        texture_cache_.save("EnvironmentMap", environment_map_key, environment_buffer_,
+            {environment_map_width, environment_map_height, 0, 0});
+    }
     return true;
 }
 
 void CapsaicinInternal::updateScene() noexcept
 {
+    // Collect the snapshot prepared during the previous frame. It is only usable if playback has not been
+    // modified and the scene has not changed since it was requested, otherwise the animations are
+    // re-evaluated below.
+    scene_snapshot_ = collectSceneUpdate();
+    if (scene_snapshot_
+        && (!scene_snapshot_->evaluated || play_paused_ || scene_snapshot_->base_play_time != play_time_
+            || scene_snapshot_->scene_files != scene_files_
+            || scene_snapshot_->transforms.size() != gfxSceneGetObjectCount<GfxInstance>(scene_)
+            || scene_snapshot_->joint_matrices.size() != gfxSceneGetObjectCount<GfxSkin>(scene_)))
+    {
+        scene_snapshot_ = nullptr;
+        play_time_old_  = -1.0; // Force the scene animations to be re-applied
+    }
+
     // Run the animations
-    if (!play_paused_ || (play_time_ != play_time_old_))
+    if (scene_snapshot_)
+    {
+        applySceneSnapshot(*scene_snapshot_);
+        play_time_         = scene_snapshot_->play_time;
+        play_time_old_     = play_time_;
+        animation_updated_ = true;
+    }
+    else if (!play_paused_ || (play_time_ != play_time_old_))
     {
         if (!play_paused_)
         {
@@ -686,6 +762,10 @@ void CapsaicinInternal::updateScene() noexcept
         }
     }
 
+    // Report any changes made to the environment map contents during the previous frame
+    environment_map_changed_ = environment_map_pending_;
+    environment_map_pending_ = false;
+
     // Update the scene history
     {
         prev_vertex_data_index_ = vertex_data_index_;
@@ -718,21 +798,198 @@ void CapsaicinInternal::updateScene() noexcept
 
     // Update Ray Tracing acceleration structure
     updateSceneBVH(animationGPUUpdated);
+    if (animationGPUUpdated && render_options.capsaicin_animation_scheduling)
+    {
+        // Report the deferred vertex animation update (see updateSceneAnimatedGeometry())
+        mesh_updated_ = true;
+    }
+
+    // The snapshot has been fully consumed
+    scene_snapshot_ = nullptr;
 }
 
 void CapsaicinInternal::updateSceneAnimations() noexcept
 {
-    uint32_t const animation_count = gfxSceneGetAnimationCount(scene_);
+    animation_updated_ = ApplySceneAnimations(scene_, play_time_);
+}
+
+bool CapsaicinInternal::ApplySceneAnimations(GfxScene const &scene, double const playTime) noexcept
+{
+    // Animations are applied serially as different animations may update the same scene nodes
+    uint32_t const animation_count = gfxSceneGetAnimationCount(scene);
     for (uint32_t animation_index = 0; animation_index < animation_count; ++animation_index)
     {
-        GfxConstRef const animation_ref    = gfxSceneGetAnimationHandle(scene_, animation_index);
-        float const       animation_length = gfxSceneGetAnimationLength(scene_, animation_ref);
-        auto time_in_seconds = static_cast<float>(fmod(play_time_, static_cast<double>(animation_length)));
+        GfxConstRef const animation_ref    = gfxSceneGetAnimationHandle(scene, animation_index);
+        float const       animation_length = gfxSceneGetAnimationLength(scene, animation_ref);
+        auto time_in_seconds = static_cast<float>(fmod(playTime, static_cast<double>(animation_length)));
         // Handle negative playback times
         time_in_seconds = (time_in_seconds >= 0.0F) ? time_in_seconds : animation_length + time_in_seconds;
-        gfxSceneApplyAnimation(scene_, animation_ref, time_in_seconds);
+        gfxSceneApplyAnimation(scene, animation_ref, time_in_seconds);
+    }
+    return animation_count > 0;
+}
+
+void CapsaicinInternal::beginSceneUpdate() noexcept
+{
+    waitForSceneUpdate();
+    if (animation_scene_.scene_files != scene_files_)
+    {
+        // Scenes are only created and destroyed on the render thread, the job imports the scene files
+        gfxDestroyScene(animation_scene_.scene);
+        animation_scene_             = {};
+        animation_scene_.scene_files = scene_files_;
+        animation_scene_.scene       = gfxCreateScene();
+    }
+
+    // The next frame time is not yet known so the current one is used as a prediction
+    double const frame_time = play_fixed_framerate_ ? play_fixed_frame_time_ : frame_time_;
+    scene_snapshot_pending_ = std::make_unique<SceneSnapshot>();
+    scene_snapshot_pending_->scene_files    = scene_files_;
+    scene_snapshot_pending_->base_play_time = play_time_;
+    scene_snapshot_pending_->play_time =
+        play_time_ + frame_time * play_speed_ * (!play_rewind_ ? 1.0 : -1.0);
+
+    // Only the job may access the animation scene and the snapshot until the snapshot has been collected
+    scene_update_group_.run([animation_scene = &animation_scene_, snapshot = scene_snapshot_pending_.get()] {
+        PrepareSceneSnapshot(*animation_scene, *snapshot);
+    });
+}
+
+void CapsaicinInternal::waitForSceneUpdate() noexcept
+{
+    scene_update_group_.wait();
+}
+
+std::unique_ptr<CapsaicinInternal::SceneSnapshot const> CapsaicinInternal::collectSceneUpdate() noexcept
+{
+    waitForSceneUpdate();
+    return std::move(scene_snapshot_pending_);
+}
+
+void CapsaicinInternal::applySceneSnapshot(SceneSnapshot const &snapshot) noexcept
+{
+    ParallelFor(0U, gfxSceneGetObjectCount<GfxInstance>(scene_), [&](uint32_t const i) {
+        GfxRef const instance = gfxSceneGetObjectHandle<GfxInstance>(scene_, i);
+        instance->transform   = snapshot.transforms[i];
+        instance->weights     = snapshot.weights[i];
+    });
+    ParallelFor(0U, gfxSceneGetObjectCount<GfxSkin>(scene_), [&](uint32_t const i) {
+        GfxRef const skin    = gfxSceneGetObjectHandle<GfxSkin>(scene_, i);
+        skin->joint_matrices = snapshot.joint_matrices[i];
+    });
+
+    // Only the animated parts of cameras and lights are copied as the rest may have been changed since
+    for (auto const &[camera_index, animated_camera] : snapshot.cameras)
+    {
+        if (camera_index < gfxSceneGetCameraCount(scene_))
+        {
+            GfxRef const camera = gfxSceneGetCameraHandle(scene_, camera_index);
+            camera->eye         = animated_camera.eye;
+            camera->center      = animated_camera.center;
+            camera->up          = animated_camera.up;
+        }
+    }
+    for (auto const &[light_index, animated_light] : snapshot.lights)
+    {
+        if (light_index < gfxSceneGetObjectCount<GfxLight>(scene_))
+        {
+            GfxRef const light = gfxSceneGetObjectHandle<GfxLight>(scene_, light_index);
+            light->position    = animated_light.position;
+            light->direction   = animated_light.direction;
+        }
     }
-    animation_updated_ = animation_count > 0;
+}
+
+void CapsaicinInternal::PrepareSceneSnapshot(AnimationScene &animationScene, SceneSnapshot &snapshot) noexcept
+{
+    GfxScene const &scene = animationScene.scene;
+    if (!animationScene.loaded)
+    {
+        // Mirror the object order of the rendered scene, which starts with the user camera
+        animationScene.loaded = true;
+        animationScene.valid  = !!gfxSceneCreateCamera(scene);
+        for (auto const &file : animationScene.scene_files)
+        {
+            if (animationScene.valid && gfxSceneImport(scene, file.string().c_str()) != kGfxResult_NoError)
+            {
+                GFX_PRINT_ERROR(kGfxResult_InternalError, "Failed to import animated scene '%s'",
+                    file.string().c_str());
+                animationScene.valid = false;
+            }
+        }
+
+        // Only the animated objects are needed, so release the images and vertex data
+        while (gfxSceneGetObjectCount<GfxImage>(scene) > 0)
+        {
+            gfxSceneDestroyImage(scene, gfxSceneGetImageHandle(scene, 0));
+        }
+        for (uint32_t i = 0; i < gfxSceneGetObjectCount<GfxMesh>(scene); ++i)
+        {
+            GfxRef const mesh   = gfxSceneGetObjectHandle<GfxMesh>(scene, i);
+            mesh->vertices      = {};
+            mesh->indices       = {};
+            mesh->morph_targets = {};
+        }
+
+        for (uint32_t i = 0; i < gfxSceneGetCameraCount(scene); ++i)
+        {
+            animationScene.rest_cameras.push_back(*gfxSceneGetCameraHandle(scene, i));
+        }
+        GfxLight const *lights = gfxSceneGetObjects<GfxLight>(scene);
+        animationScene.rest_lights.assign(lights, lights + gfxSceneGetObjectCount<GfxLight>(scene));
+    }
+    if (!animationScene.valid)
+    {
+        return;
+    }
+
+    ApplySceneAnimations(scene, snapshot.play_time);
+
+    // Copy the animated state along with the data otherwise calculated by updateSceneTransforms()
+    GfxInstance const *instances      = gfxSceneGetObjects<GfxInstance>(scene);
+    uint32_t const     instance_count = gfxSceneGetObjectCount<GfxInstance>(scene);
+    snapshot.transforms.resize(instance_count);
+    snapshot.weights.resize(instance_count);
+    snapshot.bounds.resize(instance_count);
+    ParallelFor(0U, instance_count, [&](uint32_t const i) {
+        snapshot.transforms[i] = instances[i].transform;
+        snapshot.weights[i]    = instances[i].weights;
+        if (instances[i].mesh)
+        {
+            GfxMesh const &mesh = *instances[i].mesh;
+            CalculateTransformedBounds(mesh.bounds_min, mesh.bounds_max, instances[i].transform,
+                snapshot.bounds[i].first, snapshot.bounds[i].second);
+        }
+    });
+    // Mesh and material changes are reported separately so only the transforms are hashed
+    snapshot.transform_hash = HashReduce(snapshot.transforms.data(), instance_count);
+
+    GfxSkin const *skins      = gfxSceneGetObjects<GfxSkin>(scene);
+    uint32_t const skin_count = gfxSceneGetObjectCount<GfxSkin>(scene);
+    snapshot.joint_matrices.resize(skin_count);
+    ParallelFor(0U, skin_count,
+        [&](uint32_t const i) { snapshot.joint_matrices[i] = skins[i].joint_matrices; });
+
+    // Cameras and lights are only reported once animated so that unanimated ones can be freely modified
+    for (uint32_t i = 1; i < static_cast<uint32_t>(animationScene.rest_cameras.size()); ++i)
+    {
+        GfxConstRef const camera = gfxSceneGetCameraHandle(scene, i);
+        if (GfxCamera const &rest = animationScene.rest_cameras[i];
+            camera->eye != rest.eye || camera->center != rest.center || camera->up != rest.up)
+        {
+            snapshot.cameras.emplace_back(i, *camera);
+        }
+    }
+    GfxLight const *lights = gfxSceneGetObjects<GfxLight>(scene);
+    for (uint32_t i = 0; i < static_cast<uint32_t>(animationScene.rest_lights.size()); ++i)
+    {
+        if (GfxLight const &rest = animationScene.rest_lights[i];
+            lights[i].position != rest.position || lights[i].direction != rest.direction)
+        {
+            snapshot.lights.emplace_back(i, lights[i]);
+        }
+    }
+    snapshot.evaluated = true;
 }
 
 void CapsaicinInternal::updateSceneCameraMatrices() noexcept
@@ -740,7 +997,7 @@ void CapsaicinInternal::updateSceneCameraMatrices() noexcept
     uint32_t const jitter_index = jitter_frame_index_ != ~0U ? jitter_frame_index_ : frame_index_;
     if (render_dimensions_updated_)
     {
-        auto const currentWindow = uint2(gfxGetBackBufferWidth(gfx_), gfxGetBackBufferHeight(gfx_));
+        auto const currentWindow = getOutputDimensions();
         gfxSceneGetActiveCamera(scene_)->aspect =
             static_cast<float>(currentWindow.x) / static_cast<float>(currentWindow.y);
     }
@@ -953,6 +1210,10 @@ void CapsaicinInternal::updateSceneMeshes() noexcept
         mesh_updated_      = true;
         instances_updated_ = true;
     }
+    if (old_options.capsaicin_animation_scheduling != render_options.capsaicin_animation_scheduling)
+    {
+        animation_scheduler_.reset();
+    }
 
     if (mesh_updated_)
     {
@@ -977,7 +1238,10 @@ void CapsaicinInternal::updateSceneMeshes() noexcept
         std::vector<uint32_t>    index_data;
         std::vector<Vertex>      vertex_data;
         std::vector<Vertex>      vertex_source_data;
+        std::vector<uint32_t>    morph_offset_data;
+        std::vector<MorphDelta>  morph_delta_data;
         std::vector<Joint>       joint_data;
+        morph_dense_bytes_ = 0;
 
         // Prepare mesh data for loading to GPU. Perform copy for indices and skinning data when
         // needed; copy vertex data to vertex buffer for static meshes or to vertex source buffer for
@@ -1067,7 +1331,9 @@ void CapsaicinInternal::updateSceneMeshes() noexcept
                 mesh.vertex_source_offset_idx = static_cast<uint32_t>(vertex_source_data.size());
                 mesh.joints_offset            = static_cast<uint32_t>(joint_data.size());
                 mesh.targets_count = static_cast<uint32_t>(morphVertices.size() / meshVertices.size());
-                mesh.vertex_count  = static_cast<uint32_t>(meshVertices.size());
+                mesh.morph_offset_idx = ~0U;
+                mesh.morph_scale      = float2(0.0F);
+                mesh.vertex_count     = static_cast<uint32_t>(meshVertices.size());
                 mesh.is_animated   = !joints.empty() || !morphVertices.empty();
 
                 // Add mesh vertices. If the mesh has skinning/morphs then it is added to a secondary vertex
@@ -1095,26 +1361,28 @@ void CapsaicinInternal::updateSceneMeshes() noexcept
                     mesh.vertex_offset_idx[1] = static_cast<uint32_t>(vertex_data.size());
                     vertex_data.resize(vertex_data.size() + mesh.vertex_count);
 
-                    vertex_source_data.reserve(
-                        vertex_source_data.size()
-                        + (static_cast<size_t>(mesh.vertex_count) * mesh.targets_count));
-                    for (size_t j = 0; j < mesh.vertex_count; ++j)
+                    vertex_source_data.reserve(vertex_source_data.size() + mesh.vertex_count);
+                    for (auto const &[vertPosition, vertNormal, vertUV] : meshVertices)
                     {
                         Vertex vertex       = {};
-                        vertex.position_uvx = float4(meshVertices[j].position, meshVertices[j].uv.x);
-                        vertex.normal_uvy   = float4(meshVertices[j].normal, meshVertices[j].uv.y);
+                        vertex.position_uvx = float4(vertPosition, vertUV.x);
+                        vertex.normal_uvy   = float4(vertNormal, vertUV.y);
                         vertex_source_data.push_back(vertex);
-                        for (uint32_t k = 0; k < mesh.targets_count; ++k)
+                    }
+
+                    // Morph targets are stored separately as sparse quantised deltas
+                    if (mesh.targets_count > 0)
+                    {
+                        std::vector<MorphTargets::Delta> deltas;
+                        deltas.reserve(morphVertices.size());
+                        for (auto const &[vertPosition, vertNormal, vertUV] : morphVertices)
                         {
-                            Vertex target_vertex = {};
-                            target_vertex.position_uvx =
-                                float4(morphVertices[j * mesh.targets_count + k].position,
-                                    morphVertices[j * mesh.targets_count + k].uv.x);
-                            target_vertex.normal_uvy =
-                                float4(morphVertices[j * mesh.targets_count + k].normal,
-                                    morphVertices[j * mesh.targets_count + k].uv.y);
-                            vertex_source_data.push_back(target_vertex);
+                            deltas.push_back({vertPosition, vertNormal, vertUV});
                         }
+                        mesh.morph_offset_idx = static_cast<uint32_t>(morph_offset_data.size());
+                        mesh.morph_scale      = MorphTargets::Compress(deltas, mesh.vertex_count,
+                            mesh.targets_count, morph_offset_data, morph_delta_data);
+                        morph_dense_bytes_ += morphVertices.size() * sizeof(Vertex);
                     }
                 }
 
@@ -1345,6 +1613,16 @@ void CapsaicinInternal::updateSceneMeshes() noexcept
         vertex_source_buffer_ = gfxCreateBuffer<Vertex>(
             gfx_, static_cast<uint32_t>(vertex_source_data.size()), vertex_source_data.data());
         vertex_source_buffer_.setName("VertexSourceBuffer");
+        gfxDestroyBuffer(gfx_, morph_offset_buffer_);
+        morph_offset_buffer_ = gfxCreateBuffer<uint32_t>(
+            gfx_, static_cast<uint32_t>(morph_offset_data.size()), morph_offset_data.data());
+        morph_offset_buffer_.setName("MorphOffsetBuffer");
+        gfxDestroyBuffer(gfx_, morph_delta_buffer_);
+        morph_delta_buffer_ = gfxCreateBuffer<MorphDelta>(
+            gfx_, static_cast<uint32_t>(morph_delta_data.size()), morph_delta_data.data());
+        morph_delta_buffer_.setName("MorphDeltaBuffer");
+        morph_sparse_bytes_ =
+            morph_offset_data.size() * sizeof(uint32_t) + morph_delta_data.size() * sizeof(MorphDelta);
         gfxDestroyBuffer(gfx_, joint_buffer_);
         joint_buffer_ =
             gfxCreateBuffer<Joint>(gfx_, static_cast<uint32_t>(joint_data.size()), joint_data.data());
@@ -1496,7 +1774,8 @@ void CapsaicinInternal::updateSceneTransforms() noexcept
     size_t const transform_hash = transform_hash_;
     if (frame_index_ == 0 || animation_updated_)
     {
-        transform_hash_ = HashReduce(instances, instance_count);
+        transform_hash_ =
+            scene_snapshot_ ? scene_snapshot_->transform_hash : HashReduce(instances, instance_count);
     }
     transform_updated_ = transform_hash != transform_hash_;
 
@@ -1531,8 +1810,15 @@ void CapsaicinInternal::updateSceneTransforms() noexcept
                 GfxMesh const &mesh = *instances[i].mesh;
 
                 auto &instanceBounds = instance_bounds_[instance_index];
-                CalculateTransformedBounds(mesh.bounds_min, mesh.bounds_max, instances[i].transform,
-                    instanceBounds.first, instanceBounds.second);
+                if (scene_snapshot_)
+                {
+                    instanceBounds = scene_snapshot_->bounds[i];
+                }
+                else
+                {
+                    CalculateTransformedBounds(mesh.bounds_min, mesh.bounds_max, instances[i].transform,
+                        instanceBounds.first, instanceBounds.second);
+                }
             }
         }
 
@@ -1555,6 +1841,19 @@ void CapsaicinInternal::updateSceneTransforms() noexcept
             prev_transform_buffer_.setName("PrevTransformBuffer");
             gfxCommandCopyBuffer(gfx_, prev_transform_buffer_, transform_buffer_);
         }
+
+        // Update the instance bounds buffer (stored as consecutive min, max pairs)
+        std::vector<glm::vec4> bounds_data;
+        bounds_data.reserve(instance_bounds_.size() * 2);
+        for (auto const &[boundsMin, boundsMax] : instance_bounds_)
+        {
+            bounds_data.emplace_back(boundsMin, 0.0F);
+            bounds_data.emplace_back(boundsMax, 0.0F);
+        }
+        gfxDestroyBuffer(gfx_, instance_bounds_buffer_);
+        instance_bounds_buffer_ = gfxCreateBuffer<glm::vec4>(
+            gfx_, static_cast<uint32_t>(bounds_data.size()), bounds_data.data());
+        instance_bounds_buffer_.setName("InstanceBoundsBuffer");
         transform_updated_last_frame = true;
     }
     else if (transform_updated_last_frame)
@@ -1689,44 +1988,61 @@ bool CapsaicinInternal::updateSceneAnimatedGeometry() noexcept
     {
         GfxInstance const *instances      = gfxSceneGetObjects<GfxInstance>(scene_);
         uint32_t const     instance_count = gfxSceneGetObjectCount<GfxInstance>(scene_);
-
-        // Update skinning joint matrices
-        uint32_t const         skin_count = gfxSceneGetObjectCount<GfxSkin>(scene_);
-        std::vector<glm::mat4> joint_matrices_data(joint_matrices_buffer_.getCount());
-        for (uint32_t i = 0; i < skin_count; ++i)
+        bool const         scheduling     = render_options.capsaicin_animation_scheduling;
+        if (scheduling)
         {
-            GfxConstRef const skin_ref = gfxSceneGetObjectHandle<GfxSkin>(scene_, i);
-            memcpy(joint_matrices_data.data() + joint_matrices_offsets_[i], skin_ref->joint_matrices.data(),
-                skin_ref->joint_matrices.size() * sizeof(glm::mat4));
+            scheduleSceneAnimatedGeometry(mesh_updated_ || !acceleration_structure_ || instances_updated_);
         }
 
-        if (!joint_matrices_data.empty())
+        // Update skinning joint matrices, these are written by each skin directly into upload memory
+        if (uint32_t const joint_matrix_count = joint_matrices_buffer_.getCount(); joint_matrix_count > 0)
         {
-            // Load joint matrices to GPU buffer
             GfxCommandEvent const command_event(gfx_, "UpdateJointMatrices");
-            gfxDestroyBuffer(gfx_, joint_matrices_buffer_);
-            joint_matrices_buffer_ = gfxCreateBuffer<glm::mat4>(
-                gfx_, static_cast<uint32_t>(joint_matrices_data.size()), joint_matrices_data.data());
+            GfxBuffer const       upload_buffer = allocateConstantBuffer<glm::mat4>(joint_matrix_count);
+            auto *const joint_matrices_data = static_cast<glm::mat4 *>(gfxBufferGetData(gfx_, upload_buffer));
+            uint32_t const skin_count       = gfxSceneGetObjectCount<GfxSkin>(scene_);
+            ParallelFor(0U, skin_count, [&](uint32_t const i) {
+                // Upload memory is recycled so any part of a skin's range it does not write is cleared
+                GfxConstRef const skin_ref = gfxSceneGetObjectHandle<GfxSkin>(scene_, i);
+                uint32_t const    offset   = joint_matrices_offsets_[i];
+                uint32_t const    range =
+                    (i + 1 < skin_count ? joint_matrices_offsets_[i + 1] : joint_matrix_count) - offset;
+                size_t const      count =
+                    glm::min(skin_ref->joint_matrices.size(), static_cast<size_t>(range));
+                memcpy(
+                    joint_matrices_data + offset, skin_ref->joint_matrices.data(), count * sizeof(glm::mat4));
+                memset(joint_matrices_data + offset + count, 0, (range - count) * sizeof(glm::mat4));
+            });
+            gfxCommandCopyBuffer(gfx_, joint_matrices_buffer_, upload_buffer);
+            gfxDestroyBuffer(gfx_, upload_buffer);
         }
 
         // Update morph weights
-        std::vector<float> morph_weight_data(morph_weight_buffer_.getCount());
-        for (uint32_t i = 0; i < instance_count; ++i)
+        if (uint32_t const morph_weight_count = morph_weight_buffer_.getCount(); morph_weight_count > 0)
         {
-            memcpy(morph_weight_data.data() + instance_source_info_data_[i].weights_offset,
-                instances[i].weights.data(), instance_source_info_data_[i].targets_count * sizeof(float));
+            GfxCommandEvent const command_event(gfx_, "UpdateMorphWeights");
+            GfxBuffer const       upload_buffer = allocateConstantBuffer<float>(morph_weight_count);
+            auto *const morph_weight_data = static_cast<float *>(gfxBufferGetData(gfx_, upload_buffer));
+            // Upload memory is recycled so clear it first, ranges are not guaranteed to cover every weight
+            // (e.g. instances with more weights than their mesh has targets)
+            memset(morph_weight_data, 0, morph_weight_count * sizeof(float));
+            ParallelFor(0U, instance_count, [&](uint32_t const i) {
+                auto const  &source_info = instance_source_info_data_[i];
+                size_t const count =
+                    glm::min(instances[i].weights.size(), static_cast<size_t>(source_info.targets_count));
+                memcpy(morph_weight_data + source_info.weights_offset, instances[i].weights.data(),
+                    count * sizeof(float));
+            });
+            gfxCommandCopyBuffer(gfx_, morph_weight_buffer_, upload_buffer);
+            gfxDestroyBuffer(gfx_, upload_buffer);
         }
 
-        if (!morph_weight_data.empty())
+        // Vertex animation is reported as a mesh update. When scheduling this is deferred until after the
+        // acceleration structure update so that it does not force a complete rebuild.
+        if (!scheduling)
         {
-            // Load morph weights to GPU buffer
-            GfxCommandEvent const command_event(gfx_, "UpdateMorphWeights");
-            gfxDestroyBuffer(gfx_, morph_weight_buffer_);
-            morph_weight_buffer_ = gfxCreateBuffer<float>(
-                gfx_, static_cast<uint32_t>(morph_weight_data.size()), morph_weight_data.data());
+            mesh_updated_ = true;
         }
-
-        mesh_updated_ = true;
         {
             // Updated GPU vertex buffer with new vertex positions after animation.
             GfxCommandEvent const command_event(gfx_, "GenerateAnimatedVertices");
@@ -1754,6 +2070,16 @@ bool CapsaicinInternal::updateSceneAnimatedGeometry() noexcept
                 ret                         = true;
                 uint32_t const vertex_count = mesh_info.vertex_count;
 
+                if (scheduling && animation_scheduler_.getAction(i) == AnimationScheduler::Action::Skip)
+                {
+                    // Carry the previous vertices over to the current frame's vertex data
+                    gfxCommandCopyBuffer(gfx_, vertex_buffer_,
+                        instance.vertex_offset_idx[vertex_data_index_] * sizeof(Vertex), vertex_buffer_,
+                        instance.vertex_offset_idx[vertex_data_index_ ^ 1] * sizeof(Vertex),
+                        vertex_count * sizeof(Vertex));
+                    continue;
+                }
+
                 // Bind the shader parameters
                 gfxProgramSetParameter(
                     gfx_, generate_animated_vertices_program_, "g_VertexCount", vertex_count);
@@ -1765,8 +2091,13 @@ bool CapsaicinInternal::updateSceneAnimatedGeometry() noexcept
                     gfx_, generate_animated_vertices_program_, "g_JointOffset", source_info.joints_offset);
                 gfxProgramSetParameter(
                     gfx_, generate_animated_vertices_program_, "g_WeightsOffset", source_info.weights_offset);
+                // Morphing is skipped entirely when none of the instance's targets are in use
+                auto const &weights       = instances[i].weights;
+                bool const  morph_enabled = std::ranges::any_of(weights, [](float w) { return w != 0.0F; });
+                gfxProgramSetParameter(gfx_, generate_animated_vertices_program_, "g_MorphOffset",
+                    morph_enabled ? mesh_info.morph_offset_idx : ~0U);
                 gfxProgramSetParameter(
-                    gfx_, generate_animated_vertices_program_, "g_TargetsCount", source_info.targets_count);
+                    gfx_, generate_animated_vertices_program_, "g_MorphScale", mesh_info.morph_scale);
                 gfxProgramSetParameter(gfx_, generate_animated_vertices_program_, "g_JointMatrixOffset",
                     skin_ref ? joint_matrices_offsets_[skin_ref.getIndex()] : ~0U);
                 gfxProgramSetParameter(gfx_, generate_animated_vertices_program_,
@@ -1781,6 +2112,10 @@ bool CapsaicinInternal::updateSceneAnimatedGeometry() noexcept
                     gfx_, generate_animated_vertices_program_, "g_JointBuffer", getJointBuffer());
                 gfxProgramSetParameter(
                     gfx_, generate_animated_vertices_program_, "g_MorphWeightBuffer", getMorphWeightBuffer());
+                gfxProgramSetParameter(
+                    gfx_, generate_animated_vertices_program_, "g_MorphOffsetBuffer", getMorphOffsetBuffer());
+                gfxProgramSetParameter(
+                    gfx_, generate_animated_vertices_program_, "g_MorphDeltaBuffer", getMorphDeltaBuffer());
 
                 uint32_t const *num_threads =
                     gfxKernelGetNumThreads(gfx_, generate_animated_vertices_kernel_);
@@ -1794,6 +2129,63 @@ bool CapsaicinInternal::updateSceneAnimatedGeometry() noexcept
     return ret;
 }
 
+void CapsaicinInternal::scheduleSceneAnimatedGeometry(bool const rebuildAll) noexcept
+{
+    AnimationScheduler::Settings settings = animation_scheduler_.getSettings();
+    settings.min_projected_size           = render_options.capsaicin_animation_min_projected_size;
+    settings.reduced_interval             = render_options.capsaicin_animation_reduced_interval;
+    settings.hidden_interval              = render_options.capsaicin_animation_hidden_interval;
+    settings.refit_budget                 = render_options.capsaicin_animation_refit_budget;
+    animation_scheduler_.setSettings(settings);
+
+    GfxInstance const *instances      = gfxSceneGetObjects<GfxInstance>(scene_);
+    uint32_t const     instance_count = gfxSceneGetObjectCount<GfxInstance>(scene_);
+    std::vector<AnimationScheduler::InstanceInput> inputs(instance_count);
+    ParallelFor(0U, instance_count, [&](uint32_t const i) {
+        uint32_t const instance_index = gfxSceneGetObjectHandle<GfxInstance>(scene_, i);
+        if (instance_index >= instance_data_.size() || !instances[i].mesh)
+        {
+            return;
+        }
+        Instance const &instance = instance_data_[instance_index];
+        auto           &input    = inputs[i];
+        input.animated           = instance.vertex_offset_idx[0] != instance.vertex_offset_idx[1];
+        if (!input.animated)
+        {
+            return;
+        }
+        if (auto const &skin_ref = instances[i].skin; skin_ref && !skin_ref->joint_matrices.empty())
+        {
+            // Skinned vertices can be moved anywhere by their joints so bound the mesh under each joint
+            GfxMesh const &mesh = *instances[i].mesh;
+            input.bounds_min    = glm::vec3(std::numeric_limits<float>::max());
+            input.bounds_max    = glm::vec3(std::numeric_limits<float>::lowest());
+            for (auto const &joint_matrix : skin_ref->joint_matrices)
+            {
+                glm::vec3 joint_min;
+                glm::vec3 joint_max;
+                CalculateTransformedBounds(
+                    mesh.bounds_min, mesh.bounds_max, joint_matrix, joint_min, joint_max);
+                input.bounds_min = min(input.bounds_min, joint_min);
+                input.bounds_max = max(input.bounds_max, joint_max);
+            }
+        }
+        else
+        {
+            input.bounds_min = instance_bounds_[instance_index].first;
+            input.bounds_max = instance_bounds_[instance_index].second;
+        }
+    });
+
+    GfxCamera const         &camera = getCamera();
+    AnimationScheduler::View view;
+    // Un-jittered matrices of the current frame, these use reversed depth which the frustum planes support
+    view.view_projection = camera_matrices_[0].view_projection;
+    view.position        = camera.eye;
+    view.tan_half_fov_y  = std::tan(0.5F * camera.fovY);
+    animation_scheduler_.schedule(inputs, view, rebuildAll);
+}
+
 void CapsaicinInternal::updateSceneBVH(bool const animationGPUUpdated) noexcept
 {
     if (animationGPUUpdated || mesh_updated_ || transform_updated_ || instances_updated_)
@@ -1811,6 +2203,16 @@ void CapsaicinInternal::updateSceneBVH(bool const animationGPUUpdated) noexcept
             acceleration_structure_.setName("AccelerationStructure");
         }
 
+        // The mesh is set as opaque based on the alpha mode flag, we also check if it actually has any valid
+        // alpha sources and set to opaque if not as an optimisation for incorrect input files
+        auto const getBuildFlags = [](GfxConstRef<GfxMaterial> const &material_ref) -> uint32_t {
+            bool const noAlpha =
+                (material_ref ? (material_ref->albedo.w >= 1.0F && !material_ref->albedo_map) : false);
+            return !material_ref || noAlpha || material_ref->alpha_mode == GfxMaterialAlphaMode_Opaque
+                     ? kGfxBuildRaytracingPrimitiveFlag_Opaque
+                     : 0;
+        };
+
         std::unordered_map<uint32_t, uint32_t> mesh_data; /**< Cache of used meshes. Allows us not to
                                                              duplicate meshes and create instances instead.*/
         for (uint32_t i = 0; i < instance_count; ++i)
@@ -1874,18 +2276,8 @@ void CapsaicinInternal::updateSceneBVH(bool const animationGPUUpdated) noexcept
                 GfxBuffer const vertex_buffer = gfxCreateBufferRange<Vertex>(gfx_, vertex_buffer_,
                     instance.vertex_offset_idx[vertex_data_index_], mesh_info.vertex_count);
 
-                GfxConstRef<GfxMaterial> const material_ref = instances[i].material;
-                // The mesh is set as opaque based on the alpha mode flag, we also check if it actually has
-                // any valid alpha sources and set to opaque if not as an optimisation for incorrect input
-                // files
-                bool const noAlpha =
-                    (material_ref ? (material_ref->albedo.w >= 1.0F && !material_ref->albedo_map) : false);
-                uint32_t const opaqueFlag =
-                    !material_ref || noAlpha || material_ref->alpha_mode == GfxMaterialAlphaMode_Opaque
-                        ? kGfxBuildRaytracingPrimitiveFlag_Opaque
-                        : 0;
-
-                gfxRaytracingPrimitiveBuild(gfx_, rt_mesh, index_buffer, vertex_buffer, 0, opaqueFlag);
+                gfxRaytracingPrimitiveBuild(
+                    gfx_, rt_mesh, index_buffer, vertex_buffer, 0, getBuildFlags(instances[i].material));
 
                 gfxDestroyBuffer(gfx_, index_buffer);
                 gfxDestroyBuffer(gfx_, vertex_buffer);
@@ -1898,7 +2290,15 @@ void CapsaicinInternal::updateSceneBVH(bool const animationGPUUpdated) noexcept
                     gfx_, raytracing_primitives_[instance_index], &row_major_transform[0][0]);
 
                 // Just perform an update on existing RT primitives
-                if (mesh_info.is_animated)
+                auto action = AnimationScheduler::Action::Refit;
+                if (render_options.capsaicin_animation_scheduling)
+                {
+                    action = animationGPUUpdated ? animation_scheduler_.getAction(i)
+                                                 : AnimationScheduler::Action::Skip;
+                }
+                if (mesh_info.is_animated
+                    && (action == AnimationScheduler::Action::Refit
+                        || action == AnimationScheduler::Action::Rebuild))
                 {
                     // Need to update the acceleration structure with the animated vertex changes
                     GfxRaytracingPrimitive const &rt_mesh = raytracing_primitives_[instance_index];
@@ -1911,7 +2311,16 @@ void CapsaicinInternal::updateSceneBVH(bool const animationGPUUpdated) noexcept
                     GfxBuffer const vertex_buffer = gfxCreateBufferRange<Vertex>(gfx_, vertex_buffer_,
                         instance.vertex_offset_idx[vertex_data_index_], mesh_info.vertex_count);
 
-                    gfxRaytracingPrimitiveUpdate(gfx_, rt_mesh, index_buffer, vertex_buffer, sizeof(Vertex));
+                    if (action == AnimationScheduler::Action::Rebuild)
+                    {
+                        gfxRaytracingPrimitiveBuild(gfx_, rt_mesh, index_buffer, vertex_buffer, 0,
+                            getBuildFlags(instances[i].material));
+                    }
+                    else
+                    {
+                        gfxRaytracingPrimitiveUpdate(
+                            gfx_, rt_mesh, index_buffer, vertex_buffer, sizeof(Vertex));
+                    }
 
                     gfxDestroyBuffer(gfx_, index_buffer);
                     gfxDestroyBuffer(gfx_, vertex_buffer);
@@ -132,6 +132,9 @@ using SharedTextureList = std::vector<SharedTexture>;
 
 using DebugViewList = std::vector<std::string_view>;
 
+/** List of named per-frame counters reported by a render technique (e.g. for benchmarking). */
+using StatisticList = std::vector<std::pair<std::string_view, double>>;
+
 /**
  * Type used to pass information about requested shared buffers between capsaicin and render techniques.
  */
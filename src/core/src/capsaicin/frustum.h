@@ -0,0 +1,72 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+namespace Capsaicin
+{
+/**
+ * Calculates the normalised view frustum planes of a view projection matrix.
+ * @param       viewProjection The view projection matrix (with a [0, 1] depth range, which may be reversed).
+ * @param [out] frustum        The left, right, bottom, top, near and far planes (normals pointing inside the
+ *                             frustum).
+ */
+inline void CalculateFrustumPlanes(float4x4 const &viewProjection, float4 (&frustum)[6]) noexcept
+{
+    auto const vp = transpose(viewProjection);
+    frustum[0]    = vp[3] + vp[0]; // left
+    frustum[1]    = vp[3] - vp[0]; // right
+    frustum[2]    = vp[3] + vp[1]; // bottom
+    frustum[3]    = vp[3] - vp[1]; // top
+    frustum[4]    = vp[2];         // near (far when using reversed depth)
+    frustum[5]    = vp[3] - vp[2]; // far (near when using reversed depth)
+    for (auto &plane : frustum)
+    {
+        plane /= length(float3(plane));
+    }
+}
+
+/**
+ * Checks if an axis aligned bounding box is at least partially inside a view frustum.
+ * @note Equivalent to 'isBoundsInFrustum' in 'visibility_buffer_culling.hlsl'.
+ * @param boundsMin The minimum corner of the box.
+ * @param boundsMax The maximum corner of the box.
+ * @param frustum   The normalised frustum planes (as returned by CalculateFrustumPlanes).
+ * @return True if visible.
+ */
+[[nodiscard]] inline bool IsBoundsInFrustum(
+    float3 const &boundsMin, float3 const &boundsMax, float4 const (&frustum)[6]) noexcept
+{
+    for (auto const &plane : frustum)
+    {
+        // Only the corner furthest along the plane normal needs to be tested
+        float3 const corner(plane.x >= 0.0F ? boundsMax.x : boundsMin.x,
+            plane.y >= 0.0F ? boundsMax.y : boundsMin.y, plane.z >= 0.0F ? boundsMax.z : boundsMin.z);
+        if (dot(corner, float3(plane)) + plane.w < 0.0F)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace Capsaicin
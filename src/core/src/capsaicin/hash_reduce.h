@@ -22,8 +22,7 @@ THE SOFTWARE.
 #pragma once
 
 #include "capsaicin_internal.h"
-
-#include <ppl.h>
+#include "task_scheduler.h"
 
 namespace Capsaicin
 {
@@ -36,7 +35,7 @@ size_t HashCombine(size_t seed, TYPE const &value)
 template<typename TYPE>
 size_t HashReduce(TYPE const *values, uint32_t count)
 {
-    size_t const result = concurrency::parallel_reduce(
+    size_t const result = ParallelReduce(
         values, values + count, static_cast<size_t>(0x12345678U),
         [](TYPE const *start, TYPE const *end, size_t hash) -> size_t {
             for (auto j = start; j < end; ++j)
@@ -0,0 +1,169 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "morph_targets.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Capsaicin
+{
+namespace
+{
+constexpr float kQuantisationRange = 32767.0F;
+
+uint32_t Quantise(float const value, float const inverseScale) noexcept
+{
+    float const quantised =
+        std::clamp(std::round(value * inverseScale), -kQuantisationRange, kQuantisationRange);
+    return static_cast<uint16_t>(static_cast<int16_t>(quantised));
+}
+
+uint32_t Pack(float const low, float const high, float const inverseScale) noexcept
+{
+    return Quantise(low, inverseScale) | (Quantise(high, inverseScale) << 16);
+}
+
+float UnpackLow(uint32_t const value, float const scale) noexcept
+{
+    return static_cast<float>(static_cast<int16_t>(value & 0xFFFFU)) * scale;
+}
+
+float UnpackHigh(uint32_t const value, float const scale) noexcept
+{
+    return static_cast<float>(static_cast<int16_t>(value >> 16)) * scale;
+}
+
+bool IsZero(MorphTargets::Delta const &delta) noexcept
+{
+    return delta.position == float3(0.0F) && delta.normal == float3(0.0F) && delta.uv == float2(0.0F);
+}
+
+void Accumulate(MorphTargets::Delta &result, MorphTargets::Delta const &delta, float const weight) noexcept
+{
+    result.position += weight * delta.position;
+    result.normal += weight * delta.normal;
+    result.uv += weight * delta.uv;
+}
+} // namespace
+
+float2 MorphTargets::Compress(std::vector<Delta> const &deltas, uint32_t const vertexCount,
+    uint32_t const targetsCount, std::vector<uint32_t> &offsets, std::vector<MorphDelta> &compressed) noexcept
+{
+    // Find the quantisation range of the mesh
+    float2 maxAbs(0.0F);
+    size_t nonZero = 0;
+    for (auto const &delta : deltas)
+    {
+        maxAbs.x = glm::max(maxAbs.x, glm::compMax(glm::abs(glm::vec3(delta.position))));
+        maxAbs.y = glm::max(maxAbs.y, glm::compMax(glm::abs(glm::vec3(delta.normal))));
+        nonZero += IsZero(delta) ? 0 : 1;
+    }
+    float2 const scale = maxAbs / kQuantisationRange;
+    float2 const inverseScale(
+        scale.x > 0.0F ? 1.0F / scale.x : 0.0F, scale.y > 0.0F ? 1.0F / scale.y : 0.0F);
+
+    // Store only the non-zero deltas of each vertex
+    offsets.reserve(offsets.size() + vertexCount + 1);
+    compressed.reserve(compressed.size() + nonZero);
+    for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        offsets.push_back(static_cast<uint32_t>(compressed.size()));
+        for (uint32_t target = 0; target < targetsCount; ++target)
+        {
+            Delta const &delta = deltas[static_cast<size_t>(target) * vertexCount + vertex];
+            if (IsZero(delta))
+            {
+                continue;
+            }
+            MorphDelta packed = {};
+            packed.target     = target;
+            packed.delta.x    = Pack(delta.position.x, delta.position.y, inverseScale.x);
+            packed.delta.y    = Quantise(delta.position.z, inverseScale.x);
+            packed.delta.y |= Quantise(delta.normal.x, inverseScale.y) << 16;
+            packed.delta.z = Pack(delta.normal.y, delta.normal.z, inverseScale.y);
+            packed.delta.w = glm::packHalf2x16(glm::vec2(delta.uv));
+            compressed.push_back(packed);
+        }
+    }
+    offsets.push_back(static_cast<uint32_t>(compressed.size()));
+    return scale;
+}
+
+MorphTargets::Delta MorphTargets::DecodeDelta(MorphDelta const &delta, float2 const scale) noexcept
+{
+    Delta ret;
+    ret.position = float3(UnpackLow(delta.delta.x, scale.x), UnpackHigh(delta.delta.x, scale.x),
+        UnpackLow(delta.delta.y, scale.x));
+    ret.normal   = float3(UnpackHigh(delta.delta.y, scale.y), UnpackLow(delta.delta.z, scale.y),
+        UnpackHigh(delta.delta.z, scale.y));
+    ret.uv       = float2(glm::unpackHalf2x16(delta.delta.w));
+    return ret;
+}
+
+MorphTargets::Delta MorphTargets::EvaluateDense(std::vector<Delta> const &deltas,
+    uint32_t const vertexCount, uint32_t const targetsCount, std::vector<float> const &weights,
+    uint32_t const vertex) noexcept
+{
+    Delta ret;
+    for (uint32_t target = 0; target < targetsCount; ++target)
+    {
+        Accumulate(ret, deltas[static_cast<size_t>(target) * vertexCount + vertex], weights[target]);
+    }
+    return ret;
+}
+
+MorphTargets::Delta MorphTargets::EvaluateSparse(std::vector<uint32_t> const &offsets,
+    std::vector<MorphDelta> const &compressed, uint32_t const offset, float2 const scale,
+    std::vector<float> const &weights, uint32_t const vertex) noexcept
+{
+    Delta          ret;
+    uint32_t const end = offsets[offset + vertex + 1];
+    for (uint32_t i = offsets[offset + vertex]; i < end; ++i)
+    {
+        float const weight = weights[compressed[i].target];
+        if (weight == 0.0F)
+        {
+            continue;
+        }
+        Accumulate(ret, DecodeDelta(compressed[i], scale), weight);
+    }
+    return ret;
+}
+
+MorphTargets::Delta MorphTargets::CalculateMaxError(std::vector<Delta> const &deltas,
+    uint32_t const vertexCount, uint32_t const targetsCount, std::vector<uint32_t> const &offsets,
+    std::vector<MorphDelta> const &compressed, uint32_t const offset, float2 const scale,
+    std::vector<float> const &weights) noexcept
+{
+    Delta ret;
+    for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        Delta const dense  = EvaluateDense(deltas, vertexCount, targetsCount, weights, vertex);
+        Delta const sparse = EvaluateSparse(offsets, compressed, offset, scale, weights, vertex);
+        ret.position       = glm::max(ret.position, glm::abs(dense.position - sparse.position));
+        ret.normal         = glm::max(ret.normal, glm::abs(dense.normal - sparse.normal));
+        ret.uv             = glm::max(ret.uv, glm::abs(dense.uv - sparse.uv));
+    }
+    return ret;
+}
+} // namespace Capsaicin
@@ -0,0 +1,117 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Sparse storage of morph target deltas.
+ * Morph targets typically only move a small part of a mesh (e.g. facial blend shapes), so instead of storing
+ * every target for every vertex only the non-zero deltas are kept. These are stored vertex major (instead of
+ * the target major layout of the source data) so that each vertex can gather its own deltas without any
+ * synchronisation: the offsets list holds for every vertex the range of entries within the delta list.
+ * Position and normal deltas are quantised to 16bit using a per mesh scale and uv deltas are stored at half
+ * precision.
+ * The evaluation functions mirror 'generate_animated_vertices.comp' and allow validating the compressed
+ * data against the uncompressed deltas on the CPU.
+ */
+class MorphTargets
+{
+public:
+    /** An uncompressed morph target delta. */
+    struct Delta
+    {
+        float3 position {0.0F};
+        float3 normal {0.0F};
+        float2 uv {0.0F};
+    };
+
+    /**
+     * Compress the morph targets of a mesh.
+     * @param deltas       The dense deltas stored target major (i.e. target * vertexCount + vertex).
+     * @param vertexCount  Number of vertices in the mesh.
+     * @param targetsCount Number of morph targets in the mesh.
+     * @param [in,out] offsets    The list to append the vertexCount + 1 delta offsets of the mesh to. The
+     *                            offsets are absolute indexes into 'compressed'.
+     * @param [in,out] compressed The list to append the non-zero compressed deltas to.
+     * @return The quantisation scale of the position (x) and normal (y) deltas.
+     */
+    static float2 Compress(std::vector<Delta> const &deltas, uint32_t vertexCount, uint32_t targetsCount,
+        std::vector<uint32_t> &offsets, std::vector<MorphDelta> &compressed) noexcept;
+
+    /**
+     * Decode a compressed delta, equivalent to 'decodeMorphDelta'.
+     * @param delta The compressed delta.
+     * @param scale The quantisation scale returned by Compress.
+     * @return The decoded delta.
+     */
+    [[nodiscard]] static Delta DecodeDelta(MorphDelta const &delta, float2 scale) noexcept;
+
+    /**
+     * Evaluate the morphed offsets of a vertex using dense deltas.
+     * @param deltas       The dense deltas stored target major.
+     * @param vertexCount  Number of vertices in the mesh.
+     * @param targetsCount Number of morph targets in the mesh.
+     * @param weights      The weight of each morph target.
+     * @param vertex       The index of the vertex to evaluate.
+     * @return The sum of the weighted deltas.
+     */
+    [[nodiscard]] static Delta EvaluateDense(std::vector<Delta> const &deltas, uint32_t vertexCount,
+        uint32_t targetsCount, std::vector<float> const &weights, uint32_t vertex) noexcept;
+
+    /**
+     * Evaluate the morphed offsets of a vertex using compressed deltas, equivalent to
+     * 'generate_animated_vertices.comp'. Targets with a zero weight are not evaluated.
+     * @param offsets    The delta offsets.
+     * @param compressed The compressed deltas.
+     * @param offset     Index of the mesh's first vertex within 'offsets'.
+     * @param scale      The quantisation scale returned by Compress.
+     * @param weights    The weight of each morph target.
+     * @param vertex     The index of the vertex to evaluate.
+     * @return The sum of the weighted deltas.
+     */
+    [[nodiscard]] static Delta EvaluateSparse(std::vector<uint32_t> const &offsets,
+        std::vector<MorphDelta> const &compressed, uint32_t offset, float2 scale,
+        std::vector<float> const &weights, uint32_t vertex) noexcept;
+
+    /**
+     * Calculates the largest difference between the dense and compressed evaluation of a mesh.
+     * @param deltas       The dense deltas stored target major.
+     * @param vertexCount  Number of vertices in the mesh.
+     * @param targetsCount Number of morph targets in the mesh.
+     * @param offsets      The delta offsets.
+     * @param compressed   The compressed deltas.
+     * @param offset       Index of the mesh's first vertex within 'offsets'.
+     * @param scale        The quantisation scale returned by Compress.
+     * @param weights      The weight of each morph target.
+     * @return The largest absolute error of each delta component.
+     */
+    [[nodiscard]] static Delta CalculateMaxError(std::vector<Delta> const &deltas, uint32_t vertexCount,
+        uint32_t targetsCount, std::vector<uint32_t> const &offsets,
+        std::vector<MorphDelta> const &compressed, uint32_t offset, float2 scale,
+        std::vector<float> const &weights) noexcept;
+};
+} // namespace Capsaicin
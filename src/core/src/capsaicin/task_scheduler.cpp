@@ -0,0 +1,318 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "task_scheduler.h"
+
+#include <chrono>
+#include <limits>
+
+namespace Capsaicin
+{
+namespace
+{
+constexpr uint32_t kInvalidWorker = std::numeric_limits<uint32_t>::max();
+
+/** The scheduler owning the current thread (if the thread is a worker). */
+thread_local TaskScheduler const *current_scheduler = nullptr;
+/** Index of the current thread within its scheduler. */
+thread_local uint32_t current_worker = kInvalidWorker;
+} // namespace
+
+TaskScheduler::TaskScheduler(uint32_t const workerCount) noexcept
+{
+    startWorkers(workerCount);
+}
+
+TaskScheduler::~TaskScheduler() noexcept
+{
+    stopWorkers();
+}
+
+TaskScheduler &TaskScheduler::Get() noexcept
+{
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+uint32_t TaskScheduler::GetDefaultWorkerCount() noexcept
+{
+    uint32_t const threadCount = std::thread::hardware_concurrency();
+    return threadCount > 1 ? threadCount - 1 : 1;
+}
+
+void TaskScheduler::setWorkerCount(uint32_t const workerCount) noexcept
+{
+    if (workerCount == getWorkerCount())
+    {
+        return;
+    }
+    stopWorkers();
+    startWorkers(workerCount);
+}
+
+uint32_t TaskScheduler::getWorkerCount() const noexcept
+{
+    return static_cast<uint32_t>(workers_.size());
+}
+
+void TaskScheduler::submit(Task task) noexcept
+{
+    // Counted before being queued, otherwise another thread could pop the task and decrement the count first
+    // making it wrap around
+    ++queued_task_count_;
+    if (current_scheduler == this)
+    {
+        // Tasks spawned by a worker are kept local so that they are likely run while data is still in cache
+        Worker &worker = *workers_[current_worker];
+        std::scoped_lock const lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    else
+    {
+        std::scoped_lock const lock(shared_mutex_);
+        shared_tasks_.push_back(std::move(task));
+    }
+    {
+        // Taking the lock ensures a worker cannot miss the notification between checking for work and waiting
+        std::scoped_lock const lock(sleep_mutex_);
+    }
+    sleep_condition_.notify_one();
+}
+
+bool TaskScheduler::runPendingTask() noexcept
+{
+    Task task;
+    if (!popTask(current_scheduler == this ? current_worker : kInvalidWorker, task))
+    {
+        return false;
+    }
+    task();
+    return true;
+}
+
+void TaskScheduler::startWorkers(uint32_t const workerCount) noexcept
+{
+    stopping_ = false;
+    workers_.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i)
+    {
+        workers_.emplace_back(std::make_unique<Worker>());
+    }
+    // Threads are only started once all workers exist as they may immediately try to steal from each other
+    for (uint32_t i = 0; i < workerCount; ++i)
+    {
+        workers_[i]->thread = std::thread(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+void TaskScheduler::stopWorkers() noexcept
+{
+    {
+        std::scoped_lock const lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    sleep_condition_.notify_all();
+    for (auto const &worker : workers_)
+    {
+        worker->thread.join();
+    }
+    // Any task left behind is moved to the shared queue so that it can still be executed
+    std::scoped_lock const lock(shared_mutex_);
+    for (auto const &worker : workers_)
+    {
+        for (auto &task : worker->tasks)
+        {
+            shared_tasks_.push_back(std::move(task));
+        }
+    }
+    workers_.clear();
+}
+
+void TaskScheduler::workerLoop(uint32_t const workerIndex) noexcept
+{
+    current_scheduler = this;
+    current_worker    = workerIndex;
+    while (true)
+    {
+        if (Task task; popTask(workerIndex, task))
+        {
+            task();
+            continue;
+        }
+        std::unique_lock lock(sleep_mutex_);
+        sleep_condition_.wait(lock, [this] { return stopping_ || queued_task_count_ > 0; });
+        if (stopping_)
+        {
+            break;
+        }
+    }
+    current_scheduler = nullptr;
+    current_worker    = kInvalidWorker;
+}
+
+bool TaskScheduler::popTask(uint32_t const workerIndex, Task &task) noexcept
+{
+    if (queued_task_count_ == 0)
+    {
+        return false;
+    }
+    auto const workerCount = static_cast<uint32_t>(workers_.size());
+    if (workerIndex != kInvalidWorker)
+    {
+        // Newest local task first
+        Worker                &worker = *workers_[workerIndex];
+        std::scoped_lock const lock(worker.mutex);
+        if (!worker.tasks.empty())
+        {
+            task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+            --queued_task_count_;
+            return true;
+        }
+    }
+    {
+        std::scoped_lock const lock(shared_mutex_);
+        if (!shared_tasks_.empty())
+        {
+            task = std::move(shared_tasks_.front());
+            shared_tasks_.pop_front();
+            --queued_task_count_;
+            return true;
+        }
+    }
+    // Steal the oldest task of another worker, starting with the next one to spread contention
+    uint32_t const firstVictim = workerIndex != kInvalidWorker ? workerIndex + 1 : 0;
+    for (uint32_t i = 0; i < workerCount; ++i)
+    {
+        uint32_t const victimIndex = (firstVictim + i) % workerCount;
+        if (victimIndex == workerIndex)
+        {
+            continue;
+        }
+        Worker                &victim = *workers_[victimIndex];
+        std::scoped_lock const lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            --queued_task_count_;
+            return true;
+        }
+    }
+    return false;
+}
+
+TaskGroup::TaskGroup(TaskScheduler &scheduler) noexcept
+    : scheduler_(scheduler)
+{}
+
+TaskGroup::~TaskGroup() noexcept
+{
+    wait();
+}
+
+void TaskGroup::run(TaskScheduler::Task task) noexcept
+{
+    {
+        std::scoped_lock const lock(mutex_);
+        ++pending_count_;
+    }
+    scheduler_.submit([this, task = std::move(task)] {
+        task();
+        complete();
+    });
+}
+
+void TaskGroup::then(TaskScheduler::Task continuation) noexcept
+{
+    {
+        std::scoped_lock const lock(mutex_);
+        if (pending_count_ > 0)
+        {
+            if (continuation_)
+            {
+                // Chain with the existing continuation
+                continuation_ = [first = std::move(continuation_), second = std::move(continuation)] {
+                    first();
+                    second();
+                };
+            }
+            else
+            {
+                continuation_ = std::move(continuation);
+            }
+            return;
+        }
+    }
+    // Nothing to wait for so it can be scheduled straight away
+    run(std::move(continuation));
+}
+
+void TaskGroup::wait() noexcept
+{
+    while (true)
+    {
+        {
+            std::scoped_lock const lock(mutex_);
+            if (pending_count_ == 0)
+            {
+                return;
+            }
+        }
+        if (!scheduler_.runPendingTask())
+        {
+            // Remaining tasks are being run by other threads, but they may still spawn new tasks to help with
+            std::unique_lock lock(mutex_);
+            condition_.wait_for(lock, std::chrono::microseconds(100), [this] { return pending_count_ == 0; });
+        }
+    }
+}
+
+void TaskGroup::complete() noexcept
+{
+    TaskScheduler::Task continuation;
+    {
+        std::scoped_lock const lock(mutex_);
+        if (--pending_count_ == 0)
+        {
+            if (continuation_)
+            {
+                // The continuation keeps the group pending until it has also completed
+                continuation = std::move(continuation_);
+                continuation_ = nullptr;
+                ++pending_count_;
+            }
+            else
+            {
+                // Notify while holding the lock as the group may be destroyed as soon as it is released
+                condition_.notify_all();
+            }
+        }
+    }
+    if (continuation)
+    {
+        scheduler_.submit([this, continuation = std::move(continuation)] {
+            continuation();
+            complete();
+        });
+    }
+}
+} // namespace Capsaicin
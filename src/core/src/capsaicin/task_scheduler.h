@@ -0,0 +1,272 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * A work-stealing scheduler used to run CPU tasks in parallel.
+ * Each worker thread owns a queue, tasks spawned by a worker are pushed to and popped from the back of its
+ * own queue (for cache locality) while idle workers steal from the front of the other queues. Tasks
+ * submitted by any other thread go to a shared queue. Threads waiting on a TaskGroup help execute pending
+ * tasks so nested parallelism cannot dead lock.
+ */
+class TaskScheduler
+{
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * Constructor.
+     * @param workerCount The number of worker threads (0 runs all tasks on the threads waiting for them).
+     */
+    explicit TaskScheduler(uint32_t workerCount = GetDefaultWorkerCount()) noexcept;
+
+    /** Destructor. */
+    ~TaskScheduler() noexcept;
+
+    TaskScheduler(TaskScheduler const &other)                = delete;
+    TaskScheduler(TaskScheduler &&other) noexcept            = delete;
+    TaskScheduler &operator=(TaskScheduler const &other)     = delete;
+    TaskScheduler &operator=(TaskScheduler &&other) noexcept = delete;
+
+    /**
+     * Gets the scheduler shared by the framework.
+     * @return The global scheduler.
+     */
+    [[nodiscard]] static TaskScheduler &Get() noexcept;
+
+    /**
+     * Gets the default number of worker threads (one less than the hardware thread count as the thread
+     * waiting for the tasks also executes them).
+     * @return The default worker count.
+     */
+    [[nodiscard]] static uint32_t GetDefaultWorkerCount() noexcept;
+
+    /**
+     * Sets the number of worker threads.
+     * @note Must not be called while any task is in flight.
+     * @param workerCount The new worker count (0 runs all tasks on the threads waiting for them).
+     */
+    void setWorkerCount(uint32_t workerCount) noexcept;
+
+    /**
+     * Gets the number of worker threads.
+     * @return The worker count.
+     */
+    [[nodiscard]] uint32_t getWorkerCount() const noexcept;
+
+    /**
+     * Queue a task for execution.
+     * @param task The task to run.
+     */
+    void submit(Task task) noexcept;
+
+    /**
+     * Execute a single pending task on the calling thread.
+     * @return True if a task was run, False if there was nothing to run.
+     */
+    bool runPendingTask() noexcept;
+
+private:
+    struct Worker
+    {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+        std::thread      thread;
+    };
+
+    void startWorkers(uint32_t workerCount) noexcept;
+    void stopWorkers() noexcept;
+    void workerLoop(uint32_t workerIndex) noexcept;
+
+    /**
+     * Take the next task to execute.
+     * @param       workerIndex Index of the calling worker (UINT32_MAX if not a worker).
+     * @param [out] task        The task to execute.
+     * @return True if a task was found.
+     */
+    bool popTask(uint32_t workerIndex, Task &task) noexcept;
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::mutex                           shared_mutex_;
+    std::deque<Task>                     shared_tasks_; /**< Tasks submitted by non worker threads */
+    std::mutex                           sleep_mutex_;
+    std::condition_variable              sleep_condition_;
+    std::atomic<uint32_t>                queued_task_count_ = 0; /**< Number of tasks waiting in any queue */
+    bool                                 stopping_          = false;
+};
+
+/**
+ * A group of tasks that can be waited on together.
+ * A continuation can be attached that is scheduled once all tasks in the group have completed.
+ */
+class TaskGroup
+{
+public:
+    /**
+     * Constructor.
+     * @param scheduler (Optional) The scheduler used to run the tasks.
+     */
+    explicit TaskGroup(TaskScheduler &scheduler = TaskScheduler::Get()) noexcept;
+
+    /** Destructor, waits for all remaining tasks. */
+    ~TaskGroup() noexcept;
+
+    TaskGroup(TaskGroup const &other)                = delete;
+    TaskGroup(TaskGroup &&other) noexcept            = delete;
+    TaskGroup &operator=(TaskGroup const &other)     = delete;
+    TaskGroup &operator=(TaskGroup &&other) noexcept = delete;
+
+    /**
+     * Add a task to the group.
+     * @param task The task to run.
+     */
+    void run(TaskScheduler::Task task) noexcept;
+
+    /**
+     * Add a continuation that runs once all tasks currently in the group have completed.
+     * @note The continuation is part of the group so wait() also waits for it, it may itself add new tasks.
+     * @param continuation The task to run.
+     */
+    void then(TaskScheduler::Task continuation) noexcept;
+
+    /** Wait for all tasks in the group (and any continuation) to complete, helping to execute them. */
+    void wait() noexcept;
+
+private:
+    /** Called when a task of the group has finished. */
+    void complete() noexcept;
+
+    TaskScheduler          &scheduler_;
+    std::mutex              mutex_;
+    std::condition_variable condition_;
+    uint32_t                pending_count_ = 0; /**< Number of tasks not yet completed */
+    TaskScheduler::Task     continuation_;
+};
+
+/**
+ * Execute a function for each index of a range in parallel.
+ * @param begin    The first index.
+ * @param end      One past the last index.
+ * @param grain    The number of consecutive indices processed by each task.
+ * @param function The function to call with each index.
+ */
+template<typename INDEX, typename FUNCTION>
+void ParallelFor(INDEX const begin, INDEX const end, INDEX grain, FUNCTION const &function) noexcept
+{
+    grain = std::max(grain, static_cast<INDEX>(1));
+    if (end <= begin)
+    {
+        return;
+    }
+    TaskGroup group;
+    INDEX     start = begin;
+    while (end - start > grain)
+    {
+        INDEX const stop = start + grain;
+        group.run([&function, start, stop] {
+            for (INDEX index = start; index < stop; ++index)
+            {
+                function(index);
+            }
+        });
+        start = stop;
+    }
+    // The last chunk is run directly by the calling thread
+    for (INDEX index = start; index < end; ++index)
+    {
+        function(index);
+    }
+    group.wait();
+}
+
+/**
+ * Execute a function for each index of a range in parallel, using an automatically selected grain size.
+ * @param begin    The first index.
+ * @param end      One past the last index.
+ * @param function The function to call with each index.
+ */
+template<typename INDEX, typename FUNCTION>
+void ParallelFor(INDEX const begin, INDEX const end, FUNCTION const &function) noexcept
+{
+    if (end <= begin)
+    {
+        return;
+    }
+    // Create a few tasks per thread so that work can be balanced by stealing
+    auto const taskCount = static_cast<INDEX>(4 * (TaskScheduler::Get().getWorkerCount() + 1));
+    ParallelFor(begin, end, static_cast<INDEX>((end - begin + taskCount - 1) / taskCount), function);
+}
+
+/**
+ * Reduce a range of values in parallel.
+ * @note The range is split into chunks of 'grain' values independently of the number of threads, so the
+ * result is deterministic even when 'combine' is not associative.
+ * @param first    The first value.
+ * @param last     One past the last value.
+ * @param identity The initial value of each chunk.
+ * @param reduce   Function reducing a chunk: RESULT(TYPE const *start, TYPE const *end, RESULT init).
+ * @param combine  Function combining 2 chunk results (in order): RESULT(RESULT left, RESULT right).
+ * @param grain    (Optional) The number of values in each chunk.
+ * @return The reduced value.
+ */
+template<typename TYPE, typename RESULT, typename REDUCE, typename COMBINE>
+RESULT ParallelReduce(TYPE const *first, TYPE const *last, RESULT const &identity, REDUCE const &reduce,
+    COMBINE const &combine, size_t grain = 1024) noexcept
+{
+    grain                   = std::max(grain, static_cast<size_t>(1));
+    size_t const count      = last > first ? static_cast<size_t>(last - first) : 0;
+    size_t const chunkCount = (count + grain - 1) / grain;
+    if (chunkCount <= 1)
+    {
+        return reduce(first, last, identity);
+    }
+    // Wrapped so that each chunk result is a separate object (avoids std::vector<bool> packing)
+    struct Partial
+    {
+        RESULT value;
+    };
+    std::vector<Partial> partials(chunkCount, Partial {identity});
+    ParallelFor(static_cast<size_t>(0), chunkCount, static_cast<size_t>(1), [&](size_t const chunk) {
+        TYPE const *start     = first + chunk * grain;
+        TYPE const *end       = start + std::min(grain, count - chunk * grain);
+        partials[chunk].value = reduce(start, end, identity);
+    });
+    RESULT result = partials[0].value;
+    for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+    {
+        result = combine(result, partials[chunk].value);
+    }
+    return result;
+}
+} // namespace Capsaicin
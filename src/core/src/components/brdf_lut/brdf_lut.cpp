@@ -41,6 +41,17 @@ bool BrdfLut::init(CapsaicinInternal const &capsaicin) noexcept
         nullptr, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
     brdf_lut_buffer_.setName("BrdfLut_LutBuffer");
 
+    // The LUT only depends on its kernel, size and sample count so can be reused from a previous run
+    uint64_t key = 0;
+    if (TextureCacheKey cache_key; capsaicin.addProgramToCacheKey("components/brdf_lut/brdf_lut", cache_key))
+    {
+        key = cache_key.add(brdf_lut_size_).add(brdf_lut_sample_size_).getValue();
+    }
+    if (capsaicin.loadCachedTexture(Name, key, brdf_lut_buffer_))
+    {
+        return true;
+    }
+
     GfxProgram const brdf_lut_program = capsaicin.createProgram("components/brdf_lut/brdf_lut");
     GfxKernel const  brdf_lut_kernel  = gfxCreateComputeKernel(gfx_, brdf_lut_program, "ComputeBrdfLut");
 
@@ -58,6 +69,8 @@ bool BrdfLut::init(CapsaicinInternal const &capsaicin) noexcept
     gfxDestroyKernel(gfx_, brdf_lut_kernel);
     gfxDestroyProgram(gfx_, brdf_lut_program);
 
+    capsaicin.saveCachedTexture(Name, key, brdf_lut_buffer_);
+
     return true;
 }
 
@@ -97,7 +97,8 @@ bool LightBuilder::init(CapsaicinInternal const &capsaicin) noexcept
     // Setup initial light counts for current scene
     auto const scene = capsaicin.getScene();
     lightHash = HashReduce(gfxSceneGetObjects<GfxLight>(scene), gfxSceneGetObjectCount<GfxLight>(scene));
-    uint const deltaLightCount = (options.delta_light_enable) ? gfxSceneGetObjectCount<GfxLight>(scene) : 0;
+    sceneLightTotal            = gfxSceneGetObjectCount<GfxLight>(scene);
+    uint const deltaLightCount = (options.delta_light_enable) ? sceneLightTotal : 0;
     GfxLight const *lights     = gfxSceneGetObjects<GfxLight>(scene);
     directionalLightCount      = 0;
     pointLightCount            = 0;
@@ -161,8 +162,8 @@ void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
     uint const oldDeltaLightCount     = pointLightCount + spotLightCount + directionalLightCount;
     uint const oldAreaLightCount      = areaLightCount;
     uint const oldEnvironmentMapCount = environmentMapCount;
-    uint const deltaLightCount =
-        (optionsNew.delta_light_enable) ? gfxSceneGetObjectCount<GfxLight>(scene) : 0;
+    sceneLightTotal            = gfxSceneGetObjectCount<GfxLight>(scene);
+    uint const deltaLightCount = (optionsNew.delta_light_enable) ? sceneLightTotal : 0;
     areaLightCount      = (optionsNew.area_light_enable) ? areaLightTotal : 0;
     environmentMapCount = (optionsNew.environment_light_enable && !!environmentMap) ? 1 : 0;
 
@@ -181,7 +182,7 @@ void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
     bool const deltaLightUpdated =
         optionsNew.delta_light_enable && (oldLightHash != lightHash || capsaicin.getFrameIndex() == 0);
     bool const envMapUpdated = optionsNew.environment_light_enable
-                            && (capsaicin.getEnvironmentMapUpdated() || capsaicin.getFrameIndex() == 0);
+                            && (capsaicin.getEnvironmentContentsUpdated() || capsaicin.getFrameIndex() == 0);
     if (deltaLightUpdated || envMapUpdated || areaLightUpdated || lightIndexesChanged)
     {
         lightsUpdated = true;
@@ -324,8 +325,8 @@ void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
             if (!allLightData.empty())
             {
                 // Copy delta lights to start of buffer (after any environment maps)
-                GfxBuffer const upload_buffer = gfxCreateBuffer<Light>(gfx_,
-                    static_cast<uint32_t>(allLightData.size()), allLightData.data(), kGfxCpuAccess_Write);
+                GfxBuffer const upload_buffer = capsaicin.allocateConstantBuffer<Light>(
+                    allLightData.data(), static_cast<uint32_t>(allLightData.size()));
                 gfxCommandCopyBuffer(
                     gfx_, lightBuffer, 0, upload_buffer, 0, allLightData.size() * sizeof(Light));
                 gfxDestroyBuffer(gfx_, upload_buffer);
@@ -461,7 +462,8 @@ void LightBuilder::renderGUI(CapsaicinInternal &capsaicin) const noexcept
         }
     }
 
-    if (gfxSceneGetObjectCount<GfxLight>(capsaicin.getScene()) > 0)
+    // Uses the count from the last update as the scene may be in use by the scene update job
+    if (sceneLightTotal > 0)
     {
         auto enableDeltaLights = capsaicin.getOption<bool>("delta_light_enable");
         if (ImGui::Checkbox("Enable Delta Lights", &enableDeltaLights))
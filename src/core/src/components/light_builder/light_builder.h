@@ -200,6 +200,7 @@ class LightBuilder final
 
     size_t   lightHash       = 0;
     uint32_t areaLightTotal  = std::numeric_limits<uint32_t>::max(); /**< Number of area lights in meshes */
+    uint32_t sceneLightTotal = 0; /**< Number of delta lights in scene (even when disabled) */
     uint32_t areaLightCount  = 0;       /**< Number of area lights in light buffer */
     uint32_t pointLightCount = 0;       /**< Number of point lights in light buffer */
     uint32_t spotLightCount  = 0;       /**< Number of spot-lights in light buffer */
@@ -143,7 +143,7 @@ void LightSamplerGridCDF::run(CapsaicinInternal &capsaicin) noexcept
         config.sceneExtent = sceneExtent;
 
         GfxBuffer const uploadBuffer =
-            gfxCreateBuffer<LightSamplingConfiguration>(gfx_, 1, &config, kGfxCpuAccess_Write);
+            capsaicin.allocateConstantBuffer<LightSamplingConfiguration>(&config, 1);
         gfxCommandCopyBuffer(gfx_, configBuffer, uploadBuffer);
         gfxDestroyBuffer(gfx_, uploadBuffer);
     }
@@ -309,12 +309,12 @@ void LightSamplerGridStream::update(CapsaicinInternal &capsaicin, Timeable *pare
             {
                 // Copy to last element boundsMinBuffer and boundsMaxBuffer
                 GfxBuffer const uploadMinBuffer =
-                    gfxCreateBuffer<float>(gfx_, 3, &newBounds.first, kGfxCpuAccess_Write);
+                    capsaicin.allocateConstantBuffer<float>(&newBounds.first.x, 3);
                 gfxCommandCopyBuffer(gfx_, boundsMinBuffer,
                     (static_cast<size_t>(boundsMaxLength) - 1) * sizeof(float) * 3, uploadMinBuffer, 0,
                     sizeof(float) * 3);
                 GfxBuffer const uploadMaxBuffer =
-                    gfxCreateBuffer<float>(gfx_, 3, &newBounds.second, kGfxCpuAccess_Write);
+                    capsaicin.allocateConstantBuffer<float>(&newBounds.second.x, 3);
                 gfxCommandCopyBuffer(gfx_, boundsMaxBuffer,
                     (static_cast<size_t>(boundsMaxLength) - 1) * sizeof(float) * 3, uploadMaxBuffer, 0,
                     sizeof(float) * 3);
@@ -324,10 +324,10 @@ void LightSamplerGridStream::update(CapsaicinInternal &capsaicin, Timeable *pare
             else
             {
                 GfxBuffer const uploadMinBuffer =
-                    gfxCreateBuffer<float>(gfx_, 3, &newBounds.first, kGfxCpuAccess_Write);
+                    capsaicin.allocateConstantBuffer<float>(&newBounds.first.x, 3);
                 gfxCommandCopyBuffer(gfx_, boundsMinBuffer, 0, uploadMinBuffer, 0, sizeof(float) * 3);
                 GfxBuffer const uploadMaxBuffer =
-                    gfxCreateBuffer<float>(gfx_, 3, &newBounds.second, kGfxCpuAccess_Write);
+                    capsaicin.allocateConstantBuffer<float>(&newBounds.second.x, 3);
                 gfxCommandCopyBuffer(gfx_, boundsMaxBuffer, 0, uploadMaxBuffer, 0, sizeof(float) * 3);
                 gfxDestroyBuffer(gfx_, uploadMinBuffer);
                 gfxDestroyBuffer(gfx_, uploadMaxBuffer);
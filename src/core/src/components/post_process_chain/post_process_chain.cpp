@@ -0,0 +1,217 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "post_process_chain.h"
+
+#include "capsaicin_internal.h"
+
+using namespace std;
+
+namespace Capsaicin
+{
+namespace
+{
+/** Defines used to enable each operator within the fused kernel (indexed by slot). */
+constexpr array<char const *, static_cast<size_t>(PostProcessChain::Slot::Count)> kSlotDefines = {
+    "TONE_MAPPING_STAGE", "COLOR_GRADING_STAGE", "LENS_STAGE"};
+
+constexpr uint32_t GetSlotMask(PostProcessChain::Slot const slot) noexcept
+{
+    return 1U << static_cast<uint32_t>(slot);
+}
+} // namespace
+
+PostProcessChain::PostProcessChain() noexcept
+    : Component(Name)
+{}
+
+PostProcessChain::~PostProcessChain() noexcept
+{
+    terminate();
+}
+
+RenderOptionList PostProcessChain::getRenderOptions() noexcept
+{
+    RenderOptionList newOptions;
+    newOptions.emplace(RENDER_OPTION_MAKE(post_process_fusion_enable, options));
+    return newOptions;
+}
+
+PostProcessChain::RenderOptions PostProcessChain::convertOptions(RenderOptionList const &options) noexcept
+{
+    RenderOptions newOptions;
+    RENDER_OPTION_GET(post_process_fusion_enable, newOptions, options)
+    return newOptions;
+}
+
+bool PostProcessChain::init(CapsaicinInternal const &capsaicin) noexcept
+{
+    options = convertOptions(capsaicin.getOptions());
+
+    // Stages are registered again by each technique once it is initialised
+    registeredSlots = 0;
+    reportedSlots   = 0;
+    queuedStages.clear();
+
+    fusedProgram = capsaicin.createProgram("components/post_process_chain/post_process_chain");
+    return !!fusedProgram;
+}
+
+void PostProcessChain::run(CapsaicinInternal &capsaicin) noexcept
+{
+    options = convertOptions(capsaicin.getOptions());
+
+    // Stages are only queued within a single frame
+    reportedSlots = 0;
+    queuedStages.clear();
+}
+
+void PostProcessChain::terminate() noexcept
+{
+    for (auto const &kernel : fusedKernels)
+    {
+        if (kernel.second)
+        {
+            gfxDestroyKernel(gfx_, kernel.second);
+        }
+    }
+    fusedKernels.clear();
+    gfxDestroyProgram(gfx_, fusedProgram);
+    fusedProgram = {};
+
+    registeredSlots = 0;
+    reportedSlots   = 0;
+    queuedStages.clear();
+}
+
+void PostProcessChain::registerStage(Slot const slot) noexcept
+{
+    registeredSlots |= GetSlotMask(slot);
+}
+
+bool PostProcessChain::fuse(CapsaicinInternal &capsaicin, Stage stage) noexcept
+{
+    bool const canFuse = options.post_process_fusion_enable && !stage.readsNeighbours && !!fusedProgram;
+    if (!queuedStages.empty())
+    {
+        // The fused kernel applies operators in slot order and to a single buffer, anything else must be
+        // split into separate dispatches
+        auto const &last = queuedStages.back();
+        if (!canFuse || last.slot >= stage.slot || last.buffer != stage.buffer
+            || any(notEqual(last.dimensions, stage.dimensions)))
+        {
+            flush(capsaicin);
+        }
+    }
+    Slot const slot  = stage.slot;
+    bool       fused = false;
+    if (canFuse)
+    {
+        // Build the permutation up front so that a stage that fails to compile into the fused kernel falls
+        // back to its own dispatch instead of being dropped
+        queuedStages.push_back(std::move(stage));
+        fused = !!getKernel();
+        if (!fused)
+        {
+            queuedStages.pop_back();
+            flush(capsaicin);
+        }
+    }
+    report(capsaicin, slot);
+    return fused;
+}
+
+void PostProcessChain::skip(CapsaicinInternal &capsaicin, Slot const slot) noexcept
+{
+    report(capsaicin, slot);
+}
+
+void PostProcessChain::flush(CapsaicinInternal &capsaicin) noexcept
+{
+    if (queuedStages.empty())
+    {
+        return;
+    }
+
+    // The permutation of the queued stages was already built by fuse
+    if (GfxKernel const kernel = getKernel(); kernel)
+    {
+        for (auto const &stage : queuedStages)
+        {
+            stage.bind(capsaicin, fusedProgram);
+        }
+        auto const &buffer           = capsaicin.getSharedTexture(queuedStages.front().buffer);
+        auto const  bufferDimensions = queuedStages.front().dimensions;
+        gfxProgramSetParameter(gfx_, fusedProgram, "g_BufferDimensions", bufferDimensions);
+        gfxProgramSetParameter(gfx_, fusedProgram, "g_InputBuffer", buffer);
+        gfxProgramSetParameter(gfx_, fusedProgram, "g_OutputBuffer", buffer);
+
+        TimedSection const timed_section(*this, "FusedPostProcess");
+        uint32_t const    *numThreads = gfxKernelGetNumThreads(gfx_, kernel);
+        uint32_t const     numGroupsX = (bufferDimensions.x + numThreads[0] - 1) / numThreads[0];
+        uint32_t const     numGroupsY = (bufferDimensions.y + numThreads[1] - 1) / numThreads[1];
+        gfxCommandBindKernel(gfx_, kernel);
+        gfxCommandDispatch(gfx_, numGroupsX, numGroupsY, 1);
+    }
+    queuedStages.clear();
+}
+
+void PostProcessChain::report(CapsaicinInternal &capsaicin, Slot const slot) noexcept
+{
+    reportedSlots |= GetSlotMask(slot);
+    if ((reportedSlots & registeredSlots) == registeredSlots)
+    {
+        flush(capsaicin);
+    }
+}
+
+GfxKernel PostProcessChain::getKernel() noexcept
+{
+    vector<char const *> defines;
+    for (auto const &stage : queuedStages)
+    {
+        defines.push_back(kSlotDefines[static_cast<size_t>(stage.slot)]);
+        defines.insert(defines.end(), stage.defines.cbegin(), stage.defines.cend());
+    }
+
+    // Each unique set of defines is a separate permutation of the fused kernel
+    string key;
+    for (auto const *define : defines)
+    {
+        key += define;
+        key += ' ';
+    }
+    if (auto const kernel = fusedKernels.find(key); kernel != fusedKernels.end())
+    {
+        return kernel->second;
+    }
+    // Failed permutations are also stored so that they are not compiled again every frame
+    GfxKernel const kernel = gfxCreateComputeKernel(
+        gfx_, fusedProgram, "Apply", defines.data(), static_cast<uint32_t>(defines.size()));
+    if (!kernel)
+    {
+        GFX_PRINTLN("Failed to create fused post-process kernel: %s", key.c_str());
+    }
+    fusedKernels.emplace(std::move(key), kernel);
+    return kernel;
+}
+} // namespace Capsaicin
@@ -0,0 +1,171 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "components/component.h"
+
+#include <functional>
+#include <unordered_map>
+
+namespace Capsaicin
+{
+/**
+ * Fuses the per-pixel post-processing operators of consecutive render techniques into a single kernel.
+ * Each participating technique registers its stage during initialisation and then reports it every frame,
+ * either by handing over the defines and parameters of its operator or by skipping it. Stages are queued
+ * until the last registered stage has reported at which point a single kernel permutation containing all
+ * queued operators is dispatched. Stages that read neighbouring pixels cannot be fused and instead flush
+ * any queued stages before the technique dispatches its own kernel.
+ */
+class PostProcessChain final
+    : public Component
+    , ComponentFactory::Registrar<PostProcessChain>
+{
+public:
+    static constexpr std::string_view Name = "PostProcessChain";
+
+    /** Constructor. */
+    PostProcessChain() noexcept;
+
+    /** Destructor. */
+    ~PostProcessChain() noexcept override;
+
+    PostProcessChain(PostProcessChain const &other)                = delete;
+    PostProcessChain(PostProcessChain &&other) noexcept            = delete;
+    PostProcessChain &operator=(PostProcessChain const &other)     = delete;
+    PostProcessChain &operator=(PostProcessChain &&other) noexcept = delete;
+
+    /*
+     * Gets configuration options for current technique.
+     * @return A list of all valid configuration options.
+     */
+    RenderOptionList getRenderOptions() noexcept override;
+
+    struct RenderOptions
+    {
+        bool post_process_fusion_enable = true; /**< Fuse consecutive per-pixel operators into one kernel */
+    };
+
+    /**
+     * Convert render options to internal options format.
+     * @param options Current render options.
+     * @return The options converted.
+     */
+    static RenderOptions convertOptions(RenderOptionList const &options) noexcept;
+
+    /**
+     * Initialise any internal data or state.
+     * @note This is automatically called by the framework after construction and should be used to create
+     * any required CPU|GPU resources.
+     * @param capsaicin Current framework context.
+     * @return True if initialisation succeeded, False otherwise.
+     */
+    bool init(CapsaicinInternal const &capsaicin) noexcept override;
+
+    /**
+     * Run internal operations.
+     * @param [in,out] capsaicin Current framework context.
+     */
+    void run(CapsaicinInternal &capsaicin) noexcept override;
+
+    /**
+     * Destroy any used internal resources and shutdown.
+     */
+    void terminate() noexcept override;
+
+    /** The operators that can be fused, in the order they are applied within the fused kernel. */
+    enum class Slot : uint8_t
+    {
+        ToneMapping,
+        ColorGrading,
+        Lens,
+        Count
+    };
+
+    /** Description of the operator of a single stage for the current frame. */
+    struct Stage
+    {
+        using BindFunction = std::function<void(CapsaicinInternal const &, GfxProgram const &)>;
+
+        Slot                      slot = Slot::Count;    /**< The operator this stage represents */
+        std::string_view          buffer;                /**< Shared texture that is processed in place */
+        uint2                     dimensions = uint2(0); /**< Dimensions of the processed region */
+        std::vector<char const *> defines;               /**< Operator defines (must be string literals) */
+        BindFunction              bind;                  /**< Sets operator parameters on fused program */
+        bool                      readsNeighbours = false; /**< Samples other pixels so cannot be fused */
+    };
+
+    /**
+     * Register a stage with the chain.
+     * @note Stages must be registered in the order they are rendered (i.e. from the technique init).
+     * @param slot The operator of the stage.
+     */
+    void registerStage(Slot slot) noexcept;
+
+    /**
+     * Report a stage and queue its operator into the fused kernel.
+     * @param [in,out] capsaicin Current framework context.
+     * @param stage              The stage operator for the current frame.
+     * @return True if the operator was queued, False if the caller must dispatch its own kernel (fusion is
+     * disabled, the operator reads neighbouring pixels or the fused permutation failed to compile).
+     */
+    bool fuse(CapsaicinInternal &capsaicin, Stage stage) noexcept;
+
+    /**
+     * Report a stage that performs no fusable work in the current frame.
+     * @note Techniques that run an unfused kernel (e.g. when writing to a debug view) must call flush
+     * before dispatching and then skip their stage.
+     * @param [in,out] capsaicin Current framework context.
+     * @param slot               The operator of the stage.
+     */
+    void skip(CapsaicinInternal &capsaicin, Slot slot) noexcept;
+
+    /**
+     * Dispatch any queued stages.
+     * @param [in,out] capsaicin Current framework context.
+     */
+    void flush(CapsaicinInternal &capsaicin) noexcept;
+
+private:
+    /**
+     * Mark a stage as reported and dispatch the queued stages once all registered stages have reported.
+     * @param [in,out] capsaicin Current framework context.
+     * @param slot               The operator of the stage.
+     */
+    void report(CapsaicinInternal &capsaicin, Slot slot) noexcept;
+
+    /**
+     * Get the fused kernel for the currently queued stages, compiling it if required.
+     * @return The kernel, invalid if the permutation failed to compile.
+     */
+    GfxKernel getKernel() noexcept;
+
+    RenderOptions options;
+
+    uint32_t           registeredSlots = 0; /**< Bit mask of all registered stages */
+    uint32_t           reportedSlots   = 0; /**< Bit mask of stages reported in the current frame */
+    std::vector<Stage> queuedStages;        /**< Stages waiting to be dispatched in slot order */
+
+    GfxProgram                                 fusedProgram;
+    std::unordered_map<std::string, GfxKernel> fusedKernels; /**< Kernel permutations keyed by defines */
+};
+} // namespace Capsaicin
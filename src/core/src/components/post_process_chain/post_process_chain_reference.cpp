@@ -0,0 +1,356 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "post_process_chain_reference.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace Capsaicin
+{
+namespace
+{
+using Matrix3 = std::array<float, 9>;
+
+/** Multiply a vector by a matrix stored by rows (mirrors HLSL 'mul(matrix, vector)'). */
+float3 Multiply(Matrix3 const &matrix, float3 const &vector) noexcept
+{
+    return {matrix[0] * vector.x + matrix[1] * vector.y + matrix[2] * vector.z,
+        matrix[3] * vector.x + matrix[4] * vector.y + matrix[5] * vector.z,
+        matrix[6] * vector.x + matrix[7] * vector.y + matrix[8] * vector.z};
+}
+
+/** Mirrors HLSL 'saturate' which returns 0 for NaN inputs. */
+float Saturate(float const value) noexcept
+{
+    return value > 0.0F ? (value < 1.0F ? value : 1.0F) : 0.0F;
+}
+
+float3 Apply(float3 const &value, float (*function)(float)) noexcept
+{
+    return {function(value.x), function(value.y), function(value.z)};
+}
+
+float Luminance(float3 const &color) noexcept
+{
+    return dot(color, float3(0.2126F, 0.7152F, 0.0722F));
+}
+
+float3 ToneMapACES(float3 color) noexcept
+{
+    constexpr Matrix3 rgbToAP1RRT = {0.5972001553F, 0.3545784056F, 0.04822144285F, 0.07600115985F,
+        0.9083440304F, 0.01565481164F, 0.02840936743F, 0.133846432F, 0.8377441764F};
+    color                         = Multiply(rgbToAP1RRT, color);
+
+    // Apply SSTS curve using the pre-calculated SDR values
+    constexpr std::array cLow     = {-1.69896996F, -1.69896996F, -0.8658960462F, 0.1757616997F, 1.186720729F};
+    constexpr std::array cHigh    = {0.05282130092F, 1.30966115F, 1.856749415F, 2.0F, 2.0F};
+    constexpr float      logMinX  = -2.92438364F;
+    constexpr float      logMidX  = -0.9676886797F;
+    constexpr float      logMaxX  = 1.464904547F;
+    auto const           evaluate = [](std::array<float, 5> const &c, float const knot) {
+        auto const  j  = static_cast<uint32_t>(knot);
+        float const t  = knot - static_cast<float>(j);
+        float const c0 = c[j];
+        float const c1 = c[j + 1];
+        float const c2 = c[j + 2];
+        // Equivalent to dot(float3(t * t, t, 1), mul(M1, cf))
+        return t * t * (0.5F * c0 - c1 + 0.5F * c2) + t * (c1 - c0) + (0.5F * c0 + 0.5F * c1);
+    };
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        float const logX = std::log10(std::max(color[i], std::numeric_limits<float>::min()));
+        float       logY;
+        if (logX <= logMinX)
+        {
+            logY = -1.69896996F;
+        }
+        else if (logX < logMidX)
+        {
+            logY = evaluate(cLow, 3.0F * (logX - logMinX) / (logMidX - logMinX));
+        }
+        else if (logX < logMaxX)
+        {
+            logY = evaluate(cHigh, 3.0F * (logX - logMidX) / (logMaxX - logMidX));
+        }
+        else
+        {
+            logY = 2.0F;
+        }
+        color[i] = std::pow(10.0F, logY);
+    }
+
+    // Apply linear luminance scale
+    constexpr float maxLuminance = 100.0F;
+    constexpr float minLuminance = 0.02F;
+    color                        = (color - minLuminance) / (maxLuminance - minLuminance);
+
+    constexpr Matrix3 ap1ToRGBODT = {1.604716778F, -0.5310570002F, -0.07365974039F, -0.1020826399F,
+        1.108128428F, -0.006045801099F, -0.003273871494F, -0.07277934998F, 1.076053262F};
+    return Multiply(ap1ToRGBODT, color);
+}
+
+float3 ToneMapPBRNeutral(float3 color) noexcept
+{
+    constexpr float f90 = 0.04F;
+    constexpr float ks  = 0.8F - f90;
+    constexpr float kd  = 0.15F;
+
+    float const x      = std::min(std::min(color.x, color.y), color.z);
+    float const offset = x < (2.0F * f90) ? x - (1.0F / (4.0F * f90)) * x * x : 0.04F;
+    color -= float3(offset);
+
+    float const p = std::max(std::max(color.x, color.y), color.z);
+    if (p <= ks)
+    {
+        return color;
+    }
+    constexpr float d  = 1.0F - ks;
+    float const     pn = 1.0F - d * d / (p + d - ks);
+    float const     g  = 1.0F / (kd * (p - pn) + 1.0F);
+    return mix(float3(pn), color * (pn / p), g);
+}
+
+float3 ToneMapAgx(float3 color, bool const fitted) noexcept
+{
+    constexpr Matrix3 rgbToAgx = {0.8566271663F, 0.09512124211F, 0.04825160652F, 0.1373189688F,
+        0.7612419724F, 0.1014390364F, 0.1118982136F, 0.07679941505F, 0.8113023639F};
+    color                      = Multiply(rgbToAgx, color);
+
+    // Convert to log2 space
+    constexpr float minEV = -10.0F;
+    constexpr float maxEV = 6.5F;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        color[i] = Saturate((std::log2(color[i]) - minEV) / (maxEV - minEV));
+    }
+
+    // Apply sigmoid curve
+    if (fitted)
+    {
+        float3 const colorX2 = color * color;
+        float3 const colorX4 = colorX2 * colorX2;
+        color = 15.5F * colorX4 * colorX2 - 40.14F * colorX4 * color + 31.96F * colorX4
+              - 6.868F * colorX2 * color + 0.4298F * colorX2 + 0.1191F * color - 0.00232F;
+    }
+    else
+    {
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            float const offset    = color[i] - 0.6060606241F;
+            float const numerator = 2.0F * offset;
+            // The shader compiler expands pow with an integer exponent so negative bases are valid
+            color[i]              = offset >= 0.0F
+                                      ? numerator / std::pow(1.0F + 69.86278914F * std::pow(offset, 3.25F),
+                                            0.3076923192F)
+                                      : numerator / std::pow(1.0F - 59.507875F * offset * offset * offset,
+                                            0.3333333433F);
+            color[i] += 0.5F;
+        }
+    }
+
+    constexpr Matrix3 agxToRGB = {1.127100587F, -0.1106066406F, -0.01649393886F, -0.1413297653F, 1.157823682F,
+        -0.01649393886F, -0.1413297653F, -0.1106066406F, 1.251936436F};
+    color                      = Multiply(agxToRGB, color);
+
+    // Linearise color
+    return Apply(color, [](float const value) { return std::pow(value, 2.2F); });
+}
+
+float3 SampleLUT(
+    std::vector<float3> const &lut, uint32_t const size, uint32_t const x, uint32_t const y, uint32_t const z)
+{
+    // LUT is stored in an 8bit UNORM texture
+    float3 const value = lut[(static_cast<size_t>(z) * size + y) * size + x];
+    return Apply(value, [](float const channel) { return std::round(Saturate(channel) * 255.0F) / 255.0F; });
+}
+
+uint3 PCG3D16(uint3 value) noexcept
+{
+    value = value * 12829U + 47989U;
+    value.x += value.y * value.z;
+    value.y += value.z * value.x;
+    value.z += value.x * value.y;
+    value.x += value.y * value.z;
+    value.y += value.z * value.x;
+    value.z += value.x * value.y;
+    return value >> 16U;
+}
+
+float2 Simplex(float2 const &position) noexcept
+{
+    auto const   f2     = static_cast<float>((std::numbers::sqrt3 - 1.0) / 2.0);
+    auto const   g2     = static_cast<float>((3.0 - std::numbers::sqrt3) / 6.0);
+    float const  u      = (position.x + position.y) * f2;
+    // HLSL round uses round half to even
+    float2 const skewed = float2(std::nearbyint(position.x + u), std::nearbyint(position.y + u));
+    float const  v      = (skewed.x + skewed.y) * g2;
+    return position - (skewed - v);
+}
+} // namespace
+
+float3 PostProcessChainReference::ToneMap(float3 const &color, Settings const &settings) noexcept
+{
+    float3 value = color * settings.exposure;
+    switch (settings.tonemap_operator)
+    {
+    case ToneMapOperator::ReinhardSimple:    value = value / (value + 1.0F); break;
+    case ToneMapOperator::ReinhardLuminance: value = value / (1.0F + Luminance(value)); break;
+    case ToneMapOperator::ACESFast:
+        value *= 0.6F;
+        value = (value * (value * 2.51F + 0.03F)) / (value * (value * 2.43F + 0.59F) + 0.14F);
+        break;
+    case ToneMapOperator::ACESFitted:
+    {
+        constexpr Matrix3 rgbToACES = {
+            0.59719F, 0.35458F, 0.04823F, 0.07600F, 0.90834F, 0.01566F, 0.02840F, 0.13383F, 0.83777F};
+        constexpr Matrix3 acesToRGB = {
+            1.60475F, -0.53108F, -0.07367F, -0.10208F, 1.10813F, -0.00605F, -0.00327F, -0.07276F, 1.07602F};
+        value          = Multiply(rgbToACES, value);
+        float3 const a = value * (value + 0.0245786F) - 0.000090537F;
+        float3 const b = value * (0.983729F * value + 0.4329510F) + 0.238081F;
+        value          = Multiply(acesToRGB, a / b);
+        break;
+    }
+    case ToneMapOperator::ACES:       value = ToneMapACES(value); break;
+    case ToneMapOperator::PBRNeutral: value = ToneMapPBRNeutral(value); break;
+    case ToneMapOperator::Uncharted2:
+    {
+        constexpr float a     = 0.15F;
+        constexpr float b     = 0.50F;
+        constexpr float c     = 0.10F;
+        constexpr float d     = 0.20F;
+        constexpr float e     = 0.02F;
+        constexpr float f     = 0.30F;
+        constexpr float white = 11.2F;
+        value *= 2.0F;
+        value = ((value * (a * value + c * b) + d * e) / (value * (a * value + b) + d * f)) - e / f;
+        // Matches operator precedence of the shader
+        constexpr float whiteScale =
+            1.0F / ((white * (a * white + c * b) + d * e) / (white * (a * white + b) + d * f)) - e / f;
+        value *= whiteScale;
+        break;
+    }
+    case ToneMapOperator::AgxFitted: value = ToneMapAgx(value, true); break;
+    case ToneMapOperator::Agx:       value = ToneMapAgx(value, false); break;
+    default:                         break;
+    }
+
+    // Apply sRGB EOTF
+    return Apply(value, [](float const channel) {
+        return channel < 0.003041282560128F ? 12.92F * channel
+                                            : 1.055010718947587F * std::pow(channel, 1.0F / 2.4F)
+                                                  - 0.055010718947587F;
+    });
+}
+
+float3 PostProcessChainReference::ColorGrade(float3 const &color, Settings const &settings) noexcept
+{
+    // Trilinear filtering with clamped addressing
+    uint32_t const size     = settings.lut_size;
+    auto const     maxCoord = static_cast<float>(size - 1);
+    float3 const   texel    = clamp(color * static_cast<float>(size) - 0.5F, float3(0.0F), float3(maxCoord));
+    auto const     x0       = static_cast<uint32_t>(texel.x);
+    auto const     y0       = static_cast<uint32_t>(texel.y);
+    auto const     z0       = static_cast<uint32_t>(texel.z);
+    uint32_t const x1       = std::min(x0 + 1, size - 1);
+    uint32_t const y1       = std::min(y0 + 1, size - 1);
+    uint32_t const z1       = std::min(z0 + 1, size - 1);
+    float3 const   weight =
+        texel - float3(static_cast<float>(x0), static_cast<float>(y0), static_cast<float>(z0));
+    auto const &lut       = settings.lut;
+    auto const  sampleRow = [&](uint32_t const y, uint32_t const z) {
+        return mix(SampleLUT(lut, size, x0, y, z), SampleLUT(lut, size, x1, y, z), weight.x);
+    };
+    float3 const front = mix(sampleRow(y0, z0), sampleRow(y1, z0), weight.y);
+    float3 const back  = mix(sampleRow(y0, z1), sampleRow(y1, z1), weight.y);
+    return mix(front, back, weight.z);
+}
+
+float3 PostProcessChainReference::LensApply(
+    uint2 const &pixel, float3 const &color, Settings const &settings) noexcept
+{
+    float3 value = color;
+    if (settings.vignette_enable)
+    {
+        int2 const   center          = int2(settings.dimensions / 2U);
+        float2 const coordFromCenter = float2(abs(int2(pixel) - center)) / float2(center);
+        constexpr float piOver4 = std::numbers::pi_v<float> * 0.25F;
+        float2 const    angle   = coordFromCenter * settings.vignette_intensity * piOver4;
+        float2       vignetteMask = float2(std::cos(angle.x), std::cos(angle.y));
+        vignetteMask              = vignetteMask * vignetteMask;
+        vignetteMask              = vignetteMask * vignetteMask;
+        value *= std::clamp(vignetteMask.x * vignetteMask.y, 0.0F, 1.0F);
+    }
+    if (settings.film_grain_enable)
+    {
+        float2 const position = float2(pixel);
+        float2 const scaled   = position / (settings.grain_scale / 8.0F);
+        uint3 const  random   = PCG3D16(uint3(static_cast<uint32_t>(scaled.x),
+              static_cast<uint32_t>(scaled.y), settings.grain_seed));
+        float2 const randomFine =
+            float2(static_cast<float>(random.x), static_cast<float>(random.y)) * (1.0F / 65536.0F) - 0.5F;
+        float2 const simplex    = Simplex(position / settings.grain_scale + randomFine);
+        constexpr float grainShape = 3.0F;
+        float const     grain      = 1.0F - 2.0F * std::exp2(-length(simplex) * grainShape);
+        value += grain * min(value, 1.0F - value) * settings.grain_amount;
+    }
+    return value;
+}
+
+float3 PostProcessChainReference::Evaluate(
+    uint2 const &pixel, float3 const &color, Settings const &settings) noexcept
+{
+    float3 value = color;
+    if (settings.tonemap_enable)
+    {
+        value = ToneMap(value, settings);
+    }
+    if (settings.lut_size > 0)
+    {
+        value = ColorGrade(value, settings);
+    }
+    if (settings.vignette_enable || settings.film_grain_enable)
+    {
+        value = LensApply(pixel, value, settings);
+    }
+    return value;
+}
+
+std::vector<float3> PostProcessChainReference::Evaluate(
+    std::vector<float3> const &image, Settings const &settings) noexcept
+{
+    std::vector<float3> output(image.size());
+    for (uint32_t y = 0; y < settings.dimensions.y; ++y)
+    {
+        for (uint32_t x = 0; x < settings.dimensions.x; ++x)
+        {
+            size_t const index = static_cast<size_t>(y) * settings.dimensions.x + x;
+            output[index]      = Evaluate(uint2(x, y), image[index], settings);
+        }
+    }
+    return output;
+}
+} // namespace Capsaicin
@@ -0,0 +1,120 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * CPU evaluation of the fused post-processing kernel.
+ * The functions here mirror 'post_process_chain.comp' (and the operator includes of the tone mapping,
+ * colour grading and lens techniques) for SDR sRGB output so that GPU output can be compared against known
+ * good values. Dithering is not evaluated as it depends on the blue noise sequence, comparisons against 8bit
+ * output should therefore allow for an error of up to 1/255.
+ */
+class PostProcessChainReference
+{
+public:
+    /** Tone mapping operators, these match 'ToneMapping::RenderOptions::TonemapOperator'. */
+    enum class ToneMapOperator : uint8_t
+    {
+        None,
+        ReinhardSimple,
+        ReinhardLuminance,
+        ACESFast,
+        ACESFitted,
+        ACES,
+        PBRNeutral,
+        Uncharted2,
+        AgxFitted,
+        Agx
+    };
+
+    /** The operators to apply and their parameters. */
+    struct Settings
+    {
+        uint2 dimensions = uint2(0); /**< Dimensions of the processed image */
+
+        bool            tonemap_enable   = true;                 /**< Apply tone mapping */
+        ToneMapOperator tonemap_operator = ToneMapOperator::ACES; /**< Tone mapping operator */
+        float           exposure         = 1.0F;                 /**< Exposure value read from 'Exposure' */
+
+        uint32_t            lut_size = 0; /**< Size of each axis of the colour grading LUT (0 disables) */
+        std::vector<float3> lut;          /**< Colour grading LUT with red stored in the fastest axis */
+
+        bool     vignette_enable    = false; /**< Apply vignette */
+        float    vignette_intensity = 0.3F;  /**< Vignette intensity */
+        bool     film_grain_enable  = false; /**< Apply film grain */
+        float    grain_scale        = 0.01F; /**< Film grain size */
+        float    grain_amount       = 0.25F; /**< Film grain amount */
+        uint32_t grain_seed         = 0;     /**< Film grain seed */
+    };
+
+    /**
+     * Apply exposure, a tone mapping operator and the sRGB EOTF to a colour value.
+     * @param color    Input HDR colour value.
+     * @param settings The operator settings.
+     * @return The tone mapped colour.
+     */
+    [[nodiscard]] static float3 ToneMap(float3 const &color, Settings const &settings) noexcept;
+
+    /**
+     * Apply the colour grading LUT using trilinear filtering of the 8bit LUT texture.
+     * @param color    Input display referred colour value.
+     * @param settings The operator settings.
+     * @return The graded colour.
+     */
+    [[nodiscard]] static float3 ColorGrade(float3 const &color, Settings const &settings) noexcept;
+
+    /**
+     * Apply vignette and film grain to a colour value.
+     * @param pixel    Pixel coordinate of the colour value.
+     * @param color    Input colour value.
+     * @param settings The operator settings.
+     * @return The colour with lens effects applied.
+     */
+    [[nodiscard]] static float3 LensApply(
+        uint2 const &pixel, float3 const &color, Settings const &settings) noexcept;
+
+    /**
+     * Apply all enabled operators to a single pixel.
+     * @param pixel    Pixel coordinate of the colour value.
+     * @param color    Input HDR colour value.
+     * @param settings The operator settings.
+     * @return The final output colour.
+     */
+    [[nodiscard]] static float3 Evaluate(
+        uint2 const &pixel, float3 const &color, Settings const &settings) noexcept;
+
+    /**
+     * Apply all enabled operators to an image.
+     * @param image    Input HDR image stored in row major order (must match settings dimensions).
+     * @param settings The operator settings.
+     * @return The output image.
+     */
+    [[nodiscard]] static std::vector<float3> Evaluate(
+        std::vector<float3> const &image, Settings const &settings) noexcept;
+};
+} // namespace Capsaicin
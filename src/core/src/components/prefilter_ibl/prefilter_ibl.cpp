@@ -23,9 +23,10 @@ THE SOFTWARE.
 #include "prefilter_ibl.h"
 
 #include "capsaicin_internal.h"
+#include "prefilter_ibl_reference.h"
 
 #include <algorithm>
-#include <numbers>
+#include <cmath>
 
 namespace Capsaicin
 {
@@ -42,21 +43,48 @@ bool PrefilterIBL::init(CapsaicinInternal const &capsaicin) noexcept
 {
     prefilter_ibl_buffer_ =
         gfxCreateTextureCube(gfx_, prefilter_ibl_buffer_size_, DXGI_FORMAT_R16G16B16A16_FLOAT,
-            prefilter_ibl_buffer_mips_, nullptr, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET);
+            prefilter_ibl_buffer_mips_, nullptr, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
     prefilter_ibl_buffer_.setName("PrefilterIBL_PrefilterIBLBuffer");
 
     prefilter_ibl_program_ = capsaicin.createProgram("components/prefilter_ibl/prefilter_ibl");
+    prefilter_ibl_kernel_  = gfxCreateComputeKernel(gfx_, prefilter_ibl_program_, "PrefilterIBL");
+
+    // The sample directions only depend on the roughness of each mip level so are generated once
+    std::vector<float4> samples;
+    prefilter_ibl_sample_ranges_.clear();
+    for (uint32_t mip_level = 0; mip_level < prefilter_ibl_buffer_mips_; ++mip_level)
+    {
+        std::vector<float4> const mip_samples = PrefilterIBLReference::GenerateSamples(
+            PrefilterIBLReference::CalculateAlpha(mip_level, prefilter_ibl_buffer_mips_),
+            prefilter_ibl_sample_size_);
+        prefilter_ibl_sample_ranges_.emplace_back(
+            static_cast<uint32_t>(samples.size()), static_cast<uint32_t>(mip_samples.size()));
+        samples.insert(samples.end(), mip_samples.cbegin(), mip_samples.cend());
+    }
+    prefilter_ibl_sample_buffer_ =
+        gfxCreateBuffer<float4>(gfx_, static_cast<uint32_t>(samples.size()), samples.data());
+    prefilter_ibl_sample_buffer_.setName("PrefilterIBL_SampleBuffer");
+
+    // The prefiltered result also depends on everything used to generate it besides the environment
+    prefilter_ibl_key_ = 0;
+    if (TextureCacheKey key; capsaicin.addProgramToCacheKey("components/prefilter_ibl/prefilter_ibl", key))
+    {
+        prefilter_ibl_key_ = key.add(prefilter_ibl_buffer_size_)
+                                 .add(prefilter_ibl_buffer_mips_)
+                                 .add(samples.data(), samples.size() * sizeof(float4))
+                                 .getValue();
+    }
 
     // init prefiltered IBL
     prefilterIBL(capsaicin);
 
-    return true;
+    return !!prefilter_ibl_program_;
 }
 
 void PrefilterIBL::run(CapsaicinInternal &capsaicin) noexcept
 {
     // update prefiltered IBL
-    if (capsaicin.getEnvironmentMapUpdated())
+    if (capsaicin.getEnvironmentContentsUpdated())
     {
         prefilterIBL(capsaicin);
     }
@@ -64,8 +92,10 @@ void PrefilterIBL::run(CapsaicinInternal &capsaicin) noexcept
 
 void PrefilterIBL::terminate() noexcept
 {
+    gfxDestroyKernel(gfx_, prefilter_ibl_kernel_);
     gfxDestroyProgram(gfx_, prefilter_ibl_program_);
     gfxDestroyTexture(gfx_, prefilter_ibl_buffer_);
+    gfxDestroyBuffer(gfx_, prefilter_ibl_sample_buffer_);
 }
 
 void PrefilterIBL::addProgramParameters(
@@ -76,50 +106,58 @@ void PrefilterIBL::addProgramParameters(
 
 void PrefilterIBL::prefilterIBL(CapsaicinInternal const &capsaicin) const noexcept
 {
-    constexpr std::array forward_vectors = {glm::dvec3(-1.0, 0.0, 0.0), glm::dvec3(1.0, 0.0, 0.0),
-        glm::dvec3(0.0, 1.0, 0.0), glm::dvec3(0.0, -1.0, 0.0), glm::dvec3(0.0, 0.0, -1.0),
-        glm::dvec3(0.0, 0.0, 1.0)};
-
-    constexpr std::array up_vectors = {glm::dvec3(0.0, -1.0, 0.0), glm::dvec3(0.0, -1.0, 0.0),
-        glm::dvec3(0.0, 0.0, -1.0), glm::dvec3(0.0, 0.0, 1.0), glm::dvec3(0.0, -1.0, 0.0),
-        glm::dvec3(0.0, -1.0, 0.0)};
+    GfxTexture const environment_buffer = capsaicin.getEnvironmentBuffer();
+    if (!environment_buffer)
+    {
+        return; // no environment buffer was created
+    }
 
-    for (uint32_t mip_level = 0; mip_level < prefilter_ibl_buffer_mips_; ++mip_level)
+    // Environments generated from a file can reuse the result of a previous run
+    uint64_t key = 0;
+    if (uint64_t const environment_key = capsaicin.getEnvironmentMapKey();
+        environment_key != 0 && prefilter_ibl_key_ != 0)
     {
-        for (uint32_t cubemap_face = 0; cubemap_face < 6; ++cubemap_face)
+        key = TextureCacheKey().add(environment_key).add(prefilter_ibl_key_).getValue();
+        if (capsaicin.loadCachedTexture(Name, key, prefilter_ibl_buffer_))
         {
-            GfxDrawState const draw_sky_state = {};
-            gfxDrawStateSetColorTarget(draw_sky_state, 0, prefilter_ibl_buffer_.getFormat());
-
-            GfxKernel const prefilter_ibl_kernel =
-                gfxCreateGraphicsKernel(gfx_, prefilter_ibl_program_, draw_sky_state, "PrefilterIBL");
-
-            uint2 const buffer_dimensions = {std::max(prefilter_ibl_buffer_size_ >> mip_level, 1U),
-                std::max(prefilter_ibl_buffer_size_ >> mip_level, 1U)};
-
-            glm::dmat4 const view =
-                lookAt(glm::dvec3(0.0), forward_vectors[cubemap_face], up_vectors[cubemap_face]);
-            glm::dmat4 const proj = glm::perspective(std::numbers::pi_v<double> / 2.0, 1.0, 0.1, 1e4);
-            auto const       view_proj_inv = glm::mat4(inverse(proj * view));
+            return;
+        }
+    }
 
-            float const roughness =
-                static_cast<float>(mip_level) / static_cast<float>(prefilter_ibl_buffer_mips_ - 1);
+    // Samples read from the environment mip level matching their solid angle, offset by its size
+    auto const environment_size = static_cast<float>(environment_buffer.getWidth());
+    gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_EnvironmentLod", std::log2(environment_size));
+    gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_EnvironmentBuffer", environment_buffer);
+    gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_SampleBuffer", prefilter_ibl_sample_buffer_);
+    gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_LinearSampler", capsaicin.getLinearSampler());
 
-            gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_BufferDimensions", buffer_dimensions);
-            gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_ViewProjectionInverse", view_proj_inv);
-            gfxProgramSetParameter(
-                gfx_, prefilter_ibl_program_, "g_EnvironmentBuffer", capsaicin.getEnvironmentBuffer());
-            gfxProgramSetParameter(
-                gfx_, prefilter_ibl_program_, "g_LinearSampler", capsaicin.getLinearSampler());
-            gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_Roughness", roughness);
-            gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_SampleSize", prefilter_ibl_sample_size_);
+    uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, prefilter_ibl_kernel_);
+    gfxCommandBindKernel(gfx_, prefilter_ibl_kernel_);
 
-            gfxCommandBindColorTarget(gfx_, 0, prefilter_ibl_buffer_, mip_level, cubemap_face);
-            gfxCommandBindKernel(gfx_, prefilter_ibl_kernel);
-            gfxCommandDraw(gfx_, 3);
+    // Filter all faces of a mip level in a single dispatch
+    for (uint32_t mip_level = 0; mip_level < prefilter_ibl_buffer_mips_; ++mip_level)
+    {
+        uint32_t const buffer_size = std::max(prefilter_ibl_buffer_size_ >> mip_level, 1U);
+        float const    footprint_lod =
+            std::max(std::log2(environment_size / static_cast<float>(buffer_size)), 0.0F);
+
+        gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_BufferSize", buffer_size);
+        gfxProgramSetParameter(
+            gfx_, prefilter_ibl_program_, "g_SampleOffset", prefilter_ibl_sample_ranges_[mip_level].x);
+        gfxProgramSetParameter(
+            gfx_, prefilter_ibl_program_, "g_SampleCount", prefilter_ibl_sample_ranges_[mip_level].y);
+        gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_FootprintLod", footprint_lod);
+        gfxProgramSetParameter(
+            gfx_, prefilter_ibl_program_, "g_OutPrefilteredBuffer", prefilter_ibl_buffer_, mip_level);
+
+        uint32_t const num_groups_x = (buffer_size + num_threads[0] - 1) / num_threads[0];
+        uint32_t const num_groups_y = (buffer_size + num_threads[1] - 1) / num_threads[1];
+        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 6);
+    }
 
-            gfxDestroyKernel(gfx_, prefilter_ibl_kernel);
-        }
+    if (key != 0)
+    {
+        capsaicin.saveCachedTexture(Name, key, prefilter_ibl_buffer_);
     }
 }
 
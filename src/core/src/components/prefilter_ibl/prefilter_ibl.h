@@ -74,10 +74,15 @@ class PrefilterIBL final
     void prefilterIBL(CapsaicinInternal const &capsaicin) const noexcept;
 
     GfxProgram prefilter_ibl_program_;
+    GfxKernel  prefilter_ibl_kernel_;
     GfxTexture prefilter_ibl_buffer_;
+    GfxBuffer  prefilter_ibl_sample_buffer_; /**< Importance sampled directions of all mip levels */
+
+    std::vector<uint2> prefilter_ibl_sample_ranges_; /**< Offset and count of the samples of each mip level */
+    uint64_t           prefilter_ibl_key_ = 0; /**< Cache key of the kernel, sizes and sample tables */
 
     uint32_t prefilter_ibl_buffer_size_ = 1024;
     uint32_t prefilter_ibl_buffer_mips_ = 5;
-    uint32_t prefilter_ibl_sample_size_ = 1024;
+    uint32_t prefilter_ibl_sample_size_ = 64;
 };
 } // namespace Capsaicin
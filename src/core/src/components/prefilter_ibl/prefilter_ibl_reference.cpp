@@ -0,0 +1,295 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "prefilter_ibl_reference.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace Capsaicin
+{
+namespace
+{
+constexpr float kPi = std::numbers::pi_v<float>;
+
+float2 Hammersley2D(uint32_t const index, uint32_t const count) noexcept
+{
+    uint32_t bits = (index << 16U) | (index >> 16U);
+    bits          = ((bits & 0x55555555U) << 1U) | ((bits & 0xAAAAAAAAU) >> 1U);
+    bits          = ((bits & 0x33333333U) << 2U) | ((bits & 0xCCCCCCCCU) >> 2U);
+    bits          = ((bits & 0x0F0F0F0FU) << 4U) | ((bits & 0xF0F0F0F0U) >> 4U);
+    bits          = ((bits & 0x00FF00FFU) << 8U) | ((bits & 0xFF00FF00U) >> 8U);
+    return {static_cast<float>(index) / static_cast<float>(count),
+        static_cast<float>(bits) * 2.3283064365386963e-10F};
+}
+
+void GetOrthoVectors(float3 const &normal, float3 &tangent, float3 &bitangent) noexcept
+{
+    // Mirrors 'GetOrthoVectors' in 'math/sampling.hlsl'
+    bool const   select = std::abs(normal.z) > 0.0F;
+    float3 const p2     = select ? normal : float3(normal.z, normal.y, normal.x);
+    float const  k      = 1.0F / std::sqrt(p2.z * p2.z + normal.y * normal.y);
+    tangent             = float3(0.0F, -p2.z * k, normal.y * k);
+    tangent             = select ? tangent : float3(tangent.z, tangent.y, tangent.x);
+    bitangent           = cross(normal, tangent);
+}
+
+float3 SampleFace(
+    std::vector<float3> const &mip, uint32_t const size, uint32_t const face, float2 const &uv) noexcept
+{
+    float2 const   texel  = clamp(uv * static_cast<float>(size) - 0.5F, float2(0.0F),
+                           float2(static_cast<float>(size - 1)));
+    auto const     x0     = static_cast<uint32_t>(texel.x);
+    auto const     y0     = static_cast<uint32_t>(texel.y);
+    uint32_t const x1     = std::min(x0 + 1, size - 1);
+    uint32_t const y1     = std::min(y0 + 1, size - 1);
+    float2 const   weight = texel - float2(static_cast<float>(x0), static_cast<float>(y0));
+    size_t const   offset = static_cast<size_t>(face) * size * size;
+    float3 const   top    = mix(mip[offset + y0 * size + x0], mip[offset + y0 * size + x1], weight.x);
+    float3 const   bottom = mix(mip[offset + y1 * size + x0], mip[offset + y1 * size + x1], weight.x);
+    return mix(top, bottom, weight.y);
+}
+} // namespace
+
+float PrefilterIBLReference::CalculateAlpha(uint32_t const mipLevel, uint32_t const mipCount) noexcept
+{
+    float const roughness = static_cast<float>(mipLevel) / static_cast<float>(std::max(mipCount, 2U) - 1);
+    return roughness * roughness * roughness * roughness;
+}
+
+std::vector<float4> PrefilterIBLReference::GenerateSamples(
+    float const alpha, uint32_t const sampleCount) noexcept
+{
+    if (alpha <= 0.0F)
+    {
+        // A perfect mirror only needs the direction itself at the resolution of the output
+        return {float4(0.0F, 0.0F, 1.0F, -32.0F)};
+    }
+
+    // Solid angle covered by a texel of an environment with faces of size 1
+    constexpr float texelSolidAngle = 4.0F * kPi / 6.0F;
+
+    float const         alpha2 = alpha * alpha;
+    std::vector<float4> samples;
+    samples.reserve(sampleCount);
+    for (uint32_t i = 0; i < sampleCount; ++i)
+    {
+        // Sample the half vector using the GGX distribution, with the view direction equal to the normal
+        float2 const xi       = Hammersley2D(i, sampleCount);
+        float const  cosTheta = std::sqrt((1.0F - xi.x) / (1.0F + (alpha2 - 1.0F) * xi.x));
+        float const  sinTheta = std::sqrt(std::max(1.0F - cosTheta * cosTheta, 0.0F));
+        float const  phi      = 2.0F * kPi * xi.y;
+        float3 const half(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+        float3 const light = 2.0F * cosTheta * half - float3(0.0F, 0.0F, 1.0F);
+        if (light.z <= 0.0F)
+        {
+            continue;
+        }
+
+        // Select the environment mip level whose texels cover the same solid angle as the sample
+        float const d           = cosTheta * cosTheta * (alpha2 - 1.0F) + 1.0F;
+        float const pdf         = alpha2 / (kPi * d * d) / 4.0F;
+        float const solidAngle  = 1.0F / (static_cast<float>(sampleCount) * pdf);
+        float const lod         = 0.5F * std::log2(solidAngle / texelSolidAngle) + 1.0F;
+        samples.emplace_back(light, lod);
+    }
+    return samples;
+}
+
+float3 PrefilterIBLReference::GetCubeDirection(uint32_t const face, float2 const &uv) noexcept
+{
+    float2 const p = uv * 2.0F - 1.0F;
+    switch (face)
+    {
+    case 0: return {1.0F, -p.y, -p.x};
+    case 1: return {-1.0F, -p.y, p.x};
+    case 2: return {p.x, 1.0F, p.y};
+    case 3: return {p.x, -1.0F, -p.y};
+    case 4: return {p.x, -p.y, 1.0F};
+    default: return {-p.x, -p.y, -1.0F};
+    }
+}
+
+PrefilterIBLReference::CubeMap PrefilterIBLReference::CreateCubeMap(
+    uint32_t const size, std::function<float3(float3 const &)> const &function) noexcept
+{
+    CubeMap cubeMap;
+    cubeMap.size = size;
+    cubeMap.mips.emplace_back(static_cast<size_t>(size) * size * 6);
+    for (uint32_t face = 0; face < 6; ++face)
+    {
+        for (uint32_t y = 0; y < size; ++y)
+        {
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                float2 const uv = (float2(static_cast<float>(x), static_cast<float>(y)) + 0.5F)
+                                / static_cast<float>(size);
+                cubeMap.mips[0][(static_cast<size_t>(face) * size + y) * size + x] =
+                    function(normalize(GetCubeDirection(face, uv)));
+            }
+        }
+    }
+
+    // Box filter the mip chain, matching the 'BlurSky' kernel used when loading environment maps
+    for (uint32_t mipSize = size >> 1; mipSize > 0; mipSize >>= 1)
+    {
+        std::vector<float3> const &previous = cubeMap.mips.back();
+        std::vector<float3>        mip(static_cast<size_t>(mipSize) * mipSize * 6);
+        for (uint32_t face = 0; face < 6; ++face)
+        {
+            size_t const inOffset  = static_cast<size_t>(face) * mipSize * mipSize * 4;
+            size_t const outOffset = static_cast<size_t>(face) * mipSize * mipSize;
+            for (uint32_t y = 0; y < mipSize; ++y)
+            {
+                for (uint32_t x = 0; x < mipSize; ++x)
+                {
+                    size_t const in = inOffset + static_cast<size_t>(y) * 4 * mipSize + x * 2;
+                    mip[outOffset + y * mipSize + x] =
+                        (previous[in] + previous[in + 1] + previous[in + mipSize * 2]
+                            + previous[in + mipSize * 2 + 1])
+                        * 0.25F;
+                }
+            }
+        }
+        cubeMap.mips.push_back(std::move(mip));
+    }
+    return cubeMap;
+}
+
+float3 PrefilterIBLReference::SampleCubeMap(
+    CubeMap const &cubeMap, float3 const &direction, float const lod) noexcept
+{
+    // Find the face and position on the face
+    float3 const absolute = abs(direction);
+    uint32_t     face     = 0;
+    float2       p;
+    if (absolute.x >= absolute.y && absolute.x >= absolute.z)
+    {
+        face = direction.x > 0.0F ? 0 : 1;
+        p    = float2(direction.x > 0.0F ? -direction.z : direction.z, -direction.y) / absolute.x;
+    }
+    else if (absolute.y >= absolute.z)
+    {
+        face = direction.y > 0.0F ? 2 : 3;
+        p    = float2(direction.x, direction.y > 0.0F ? direction.z : -direction.z) / absolute.y;
+    }
+    else
+    {
+        face = direction.z > 0.0F ? 4 : 5;
+        p    = float2(direction.z > 0.0F ? direction.x : -direction.x, -direction.y) / absolute.z;
+    }
+    float2 const uv = p * 0.5F + 0.5F;
+
+    // Trilinear filtering between the 2 closest mip levels
+    float const    level  = std::clamp(lod, 0.0F, static_cast<float>(cubeMap.mips.size() - 1));
+    auto const     level0 = static_cast<uint32_t>(level);
+    uint32_t const level1 = std::min(level0 + 1, static_cast<uint32_t>(cubeMap.mips.size() - 1));
+    float3 const   color0 = SampleFace(cubeMap.mips[level0], std::max(cubeMap.size >> level0, 1U), face, uv);
+    float3 const   color1 = SampleFace(cubeMap.mips[level1], std::max(cubeMap.size >> level1, 1U), face, uv);
+    return mix(color0, color1, level - static_cast<float>(level0));
+}
+
+float3 PrefilterIBLReference::Prefilter(CubeMap const &cubeMap, float3 const &normal,
+    std::vector<float4> const &samples, uint32_t const outputSize) noexcept
+{
+    float3 tangent;
+    float3 bitangent;
+    GetOrthoVectors(normal, tangent, bitangent);
+    float const environmentLod = std::log2(static_cast<float>(cubeMap.size));
+    float const footprintLod =
+        std::max(std::log2(static_cast<float>(cubeMap.size) / static_cast<float>(outputSize)), 0.0F);
+    float3 color(0.0F);
+    float  totalWeight = 0.0F;
+    for (auto const &sample : samples)
+    {
+        float3 const direction = sample.x * tangent + sample.y * bitangent + sample.z * normal;
+        float const  lod       = std::max(sample.w + environmentLod, footprintLod);
+        color                 += sample.z * SampleCubeMap(cubeMap, normalize(direction), lod);
+        totalWeight           += sample.z;
+    }
+    return color / totalWeight;
+}
+
+float3 PrefilterIBLReference::IntegratePrefilter(
+    CubeMap const &cubeMap, float3 const &normal, float const alpha, uint32_t const sampleCount) noexcept
+{
+    float3 tangent;
+    float3 bitangent;
+    GetOrthoVectors(normal, tangent, bitangent);
+    float3 color(0.0F);
+    float  totalWeight = 0.0F;
+    for (auto const &sample : GenerateSamples(alpha, sampleCount))
+    {
+        float3 const direction = sample.x * tangent + sample.y * bitangent + sample.z * normal;
+        color                 += sample.z * SampleCubeMap(cubeMap, normalize(direction), 0.0F);
+        totalWeight           += sample.z;
+    }
+    return color / totalWeight;
+}
+
+float PrefilterIBLReference::CalculateMaxError(
+    uint32_t const outputSize, uint32_t const mipCount, uint32_t const sampleCount) noexcept
+{
+    float3 const  sunDirection = normalize(float3(0.3F, 0.6F, 0.5F));
+    CubeMap const cubeMap      = CreateCubeMap(128, [&sunDirection](float3 const &direction) {
+        float3 const sky = float3(0.3F, 0.5F, 1.0F) * std::max(direction.y, 0.0F) + 0.05F;
+        return sky + float3(100.0F) * std::pow(std::max(dot(direction, sunDirection), 0.0F), 1000.0F);
+    });
+
+    // Compare a grid of directions on every face as well as the directions around the sun
+    std::vector<float3> directions;
+    for (uint32_t face = 0; face < 6; ++face)
+    {
+        for (uint32_t y = 0; y < 4; ++y)
+        {
+            for (uint32_t x = 0; x < 4; ++x)
+            {
+                float2 const uv = (float2(static_cast<float>(x), static_cast<float>(y)) + 0.5F) / 4.0F;
+                directions.push_back(normalize(GetCubeDirection(face, uv)));
+            }
+        }
+    }
+    for (float const offset : {0.0F, 0.05F, 0.1F, 0.2F, 0.4F})
+    {
+        directions.push_back(normalize(sunDirection + float3(offset, 0.0F, 0.0F)));
+    }
+
+    float maxError = 0.0F;
+    for (uint32_t mipLevel = 0; mipLevel < mipCount; ++mipLevel)
+    {
+        float const               alpha   = CalculateAlpha(mipLevel, mipCount);
+        std::vector<float4> const samples = GenerateSamples(alpha, sampleCount);
+        float                     maxRadiance = 0.0F;
+        float                     maxMipError = 0.0F;
+        for (auto const &direction : directions)
+        {
+            float3 const reference = IntegratePrefilter(cubeMap, direction, alpha, 32768);
+            float3 const evaluated =
+                Prefilter(cubeMap, direction, samples, std::max(outputSize >> mipLevel, 1U));
+            maxRadiance            = std::max(maxRadiance, compMax(reference));
+            maxMipError            = std::max(maxMipError, compMax(abs(evaluated - reference)));
+        }
+        maxError = std::max(maxError, maxRadiance > 0.0F ? maxMipError / maxRadiance : 0.0F);
+    }
+    return maxError;
+}
+} // namespace Capsaicin
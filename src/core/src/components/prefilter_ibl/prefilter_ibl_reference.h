@@ -0,0 +1,127 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <functional>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * CPU evaluation of the prefiltered environment map.
+ * Each mip level of the prefiltered environment is the environment convolved with a GGX lobe (assuming the
+ * view direction equals the normal). Instead of taking many samples from the full resolution environment,
+ * the GPU uses a fixed table of importance sampled directions per mip level and reads each sample from the
+ * environment mip level matching the solid angle it covers (filtered importance sampling).
+ * The functions here mirror 'prefilter_ibl.comp' so that the table based evaluation can be validated
+ * against a brute force integration of the GGX lobe.
+ */
+class PrefilterIBLReference
+{
+public:
+    /** A cube map with all 6 faces of a mip level stored consecutively (in D3D face order). */
+    struct CubeMap
+    {
+        uint32_t                         size = 0; /**< Width and height of each face in mip level 0 */
+        std::vector<std::vector<float3>> mips;     /**< The texels of each mip level */
+    };
+
+    /**
+     * Calculates the GGX roughness used to prefilter a mip level.
+     * @param mipLevel The mip level.
+     * @param mipCount Number of mip levels of the prefiltered environment.
+     * @return The GGX roughness alpha.
+     */
+    [[nodiscard]] static float CalculateAlpha(uint32_t mipLevel, uint32_t mipCount) noexcept;
+
+    /**
+     * Generate the importance sampled directions used to prefilter a mip level.
+     * @param alpha       The GGX roughness alpha.
+     * @param sampleCount Number of samples to generate, samples below the horizon are discarded.
+     * @return The sample list, xyz holds the direction in the local space of the normal and w holds the
+     *         environment mip level the sample should be read from, relative to an environment of size 1.
+     */
+    [[nodiscard]] static std::vector<float4> GenerateSamples(float alpha, uint32_t sampleCount) noexcept;
+
+    /**
+     * Gets the (non-normalised) direction of a position on a cube map face.
+     * @param face The cube map face.
+     * @param uv   The position on the face (range [0, 1]).
+     * @return The direction.
+     */
+    [[nodiscard]] static float3 GetCubeDirection(uint32_t face, float2 const &uv) noexcept;
+
+    /**
+     * Create a cube map with its full mip chain.
+     * @param size     Width and height of each face.
+     * @param function Function returning the radiance for a given normalised direction.
+     * @return The new cube map.
+     */
+    [[nodiscard]] static CubeMap CreateCubeMap(
+        uint32_t size, std::function<float3(float3 const &)> const &function) noexcept;
+
+    /**
+     * Sample a cube map using trilinear filtering.
+     * @param cubeMap   The cube map.
+     * @param direction The normalised sampling direction.
+     * @param lod       The mip level to sample.
+     * @return The filtered radiance.
+     */
+    [[nodiscard]] static float3 SampleCubeMap(
+        CubeMap const &cubeMap, float3 const &direction, float lod) noexcept;
+
+    /**
+     * Prefilter a direction using a sample table.
+     * @param cubeMap    The environment.
+     * @param normal     The normalised direction to prefilter.
+     * @param samples    The sample table returned by GenerateSamples.
+     * @param outputSize Width and height of the mip level being prefiltered.
+     * @return The prefiltered radiance.
+     */
+    [[nodiscard]] static float3 Prefilter(CubeMap const &cubeMap, float3 const &normal,
+        std::vector<float4> const &samples, uint32_t outputSize) noexcept;
+
+    /**
+     * Prefilter a direction by brute force integration of the GGX lobe over the full resolution environment.
+     * @param cubeMap     The environment.
+     * @param normal      The normalised direction to prefilter.
+     * @param alpha       The GGX roughness alpha.
+     * @param sampleCount Number of samples to take.
+     * @return The prefiltered radiance.
+     */
+    [[nodiscard]] static float3 IntegratePrefilter(
+        CubeMap const &cubeMap, float3 const &normal, float alpha, uint32_t sampleCount) noexcept;
+
+    /**
+     * Calculates the largest difference between the table based and the brute force prefiltering of a
+     * synthetic environment containing a sky gradient and a small bright sun.
+     * @param outputSize  Width and height of the first mip level of the prefiltered environment.
+     * @param mipCount    Number of mip levels of the prefiltered environment.
+     * @param sampleCount Number of samples per mip level of the sample tables.
+     * @return The largest error relative to the brightest prefiltered radiance of the mip level.
+     */
+    [[nodiscard]] static float CalculateMaxError(
+        uint32_t outputSize, uint32_t mipCount, uint32_t sampleCount) noexcept;
+};
+} // namespace Capsaicin
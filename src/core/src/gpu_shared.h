@@ -165,6 +165,13 @@ struct Joint
     float4 weights;
 };
 
+struct MorphDelta
+{
+    uint  target; /**< Index of the morph target within the mesh */
+    uint4 delta;  /**< Packed deltas: .x = position.xy, .y = position.z/normal.x, .z = normal.yz (16bit snorm
+                     scaled by the mesh position/normal scale) and .w = uv.xy (2x half) */
+};
+
 struct Meshlet
 {
     uint16_t vertex_count;     /**< Number of vertices in the meshlet */
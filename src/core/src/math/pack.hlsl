@@ -321,7 +321,7 @@ uint packSnorm1x16(float value)
 uint packSnorm2x16(float2 value)
 {
     int2 packedValue = int2(clamp(value, -1.0f, 1.0f) * 32767.0f + (0.5f * sign(value))) & 0xFFFF;
-    return packedValue.x | (packedValue.y << 8);
+    return packedValue.x | (packedValue.y << 16);
 }
 
 /**
@@ -557,6 +557,73 @@ float3 unpackFloat3(uint packed)
     return float3(x, y, z);
 }
 
+/**
+ * Pack signed float3 values to a single uint using a shared exponent.
+ * @note Each channel stores a sign bit and an 8bit mantissa, the shared 5bit exponent is stored in the
+ *  high bits. Magnitudes are clamped to 65280 and the precision of each channel is relative to the largest.
+ * @param value Input float values to pack.
+ * @return The packed values.
+ */
+uint packSignedFloat3(float3 value)
+{
+    float3 magnitude = min(abs(value), 65280.0f);
+    float  max_value = max(magnitude.x, max(magnitude.y, magnitude.z));
+    int    exponent  = int(floor(log2(max(max_value, 1.0f / 65536.0f)))) + 16;
+    if (floor(max_value * exp2(float(23 - exponent)) + 0.5f) >= 256.0f)
+    {
+        ++exponent; // rounding overflowed the mantissa
+    }
+    uint3 mantissa = uint3(floor(magnitude * exp2(float(23 - exponent)) + 0.5f));
+    uint3 signs    = uint3(value < 0.0f) & min(mantissa, 1u); // no negative zero
+    uint3 channels = mantissa | (signs << 8);
+    return channels.x | (channels.y << 9) | (channels.z << 18) | (uint(exponent) << 27);
+}
+
+/**
+ * UnPack signed float3 values created by \p packSignedFloat3.
+ * @param packed Input packed value.
+ * @return The unpacked values.
+ */
+float3 unpackSignedFloat3(uint packed)
+{
+    uint3  channels = uint3(packed, packed >> 9, packed >> 18);
+    float3 mantissa = float3(channels & 0xFFu);
+    float3 signs    = 1.0f - 2.0f * float3((channels >> 8) & 1u);
+    return signs * mantissa * exp2(float(int(packed >> 27) - 23));
+}
+
+/**
+ * Pack a direction vector to 16bit snorm values using an octahedral mapping.
+ * @param direction Input direction to pack (must be normalised).
+ * @return Packed 16bit snorms.
+ */
+uint packOctahedral(float3 direction)
+{
+    // Project the sphere onto the octahedron, and then onto the xy plane
+    float2 p = direction.xy * (1.0f / (abs(direction.x) + abs(direction.y) + abs(direction.z)));
+    if (direction.z < 0.0f)
+    {
+        // Reflect the folds of the lower hemisphere over the diagonals
+        p = (1.0f - abs(p.yx)) * float2(p.x >= 0.0f ? 1.0f : -1.0f, p.y >= 0.0f ? 1.0f : -1.0f);
+    }
+    return packSnorm2x16(p);
+}
+
+/**
+ * UnPack a direction vector created by \p packOctahedral.
+ * @param packed Input packed value.
+ * @return The unpacked normalised direction.
+ */
+float3 unpackOctahedral(uint packed)
+{
+    float2 p         = unpackSnorm2x16(packed);
+    float3 direction = float3(p, 1.0f - abs(p.x) - abs(p.y));
+    float  fold      = saturate(-direction.z);
+    direction.x += (direction.x >= 0.0f ? -fold : fold);
+    direction.y += (direction.y >= 0.0f ? -fold : fold);
+    return normalize(direction);
+}
+
 
 /**
  * Load 2 elements from the buffer.
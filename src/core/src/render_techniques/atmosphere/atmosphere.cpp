@@ -21,8 +21,11 @@ THE SOFTWARE.
 ********************************************************************/
 #include "atmosphere.h"
 
+#include "atmosphere_reference.h"
 #include "capsaicin_internal.h"
 
+#include <algorithm>
+#include <cmath>
 #include <numbers>
 
 namespace Capsaicin
@@ -40,6 +43,9 @@ RenderOptionList Atmosphere::getRenderOptions() noexcept
 {
     RenderOptionList newOptions;
     newOptions.emplace(RENDER_OPTION_MAKE(atmosphere_enable, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(atmosphere_sun_animate, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(atmosphere_sun_elevation, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(atmosphere_sun_azimuth, options));
     return newOptions;
 }
 
@@ -47,22 +53,92 @@ Atmosphere::RenderOptions Atmosphere::convertOptions(RenderOptionList const &opt
 {
     RenderOptions newOptions;
     RENDER_OPTION_GET(atmosphere_enable, newOptions, options)
+    RENDER_OPTION_GET(atmosphere_sun_animate, newOptions, options)
+    RENDER_OPTION_GET(atmosphere_sun_elevation, newOptions, options)
+    RENDER_OPTION_GET(atmosphere_sun_azimuth, newOptions, options)
     return newOptions;
 }
 
 bool Atmosphere::init(CapsaicinInternal const &capsaicin) noexcept
 {
-    atmosphere_program_       = capsaicin.createProgram("render_techniques/atmosphere/atmosphere");
-    draw_atmosphere_kernel_   = gfxCreateComputeKernel(gfx_, atmosphere_program_, "DrawAtmosphere");
-    filter_atmosphere_kernel_ = gfxCreateComputeKernel(gfx_, atmosphere_program_, "FilterAtmosphere");
+    atmosphere_program_ = capsaicin.createProgram("render_techniques/atmosphere/atmosphere");
+    compute_transmittance_lut_kernel_ =
+        gfxCreateComputeKernel(gfx_, atmosphere_program_, "ComputeTransmittanceLut");
+    compute_multi_scattering_lut_kernel_ =
+        gfxCreateComputeKernel(gfx_, atmosphere_program_, "ComputeMultiScatteringLut");
+    compute_sky_view_lut_kernel_ = gfxCreateComputeKernel(gfx_, atmosphere_program_, "ComputeSkyViewLut");
+    draw_atmosphere_kernel_      = gfxCreateComputeKernel(gfx_, atmosphere_program_, "DrawAtmosphere");
+    filter_atmosphere_kernel_    = gfxCreateComputeKernel(gfx_, atmosphere_program_, "FilterAtmosphere");
+
+    constexpr uint2 transmittance_size    = AtmosphereReference::kTransmittanceLutSize;
+    constexpr uint2 multi_scattering_size = AtmosphereReference::kMultiScatteringLutSize;
+    constexpr uint2 sky_view_size         = AtmosphereReference::kSkyViewLutSize;
+    transmittance_lut_ = gfxCreateTexture2D(gfx_, transmittance_size.x, transmittance_size.y,
+        DXGI_FORMAT_R16G16B16A16_FLOAT, 1, nullptr, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
+    transmittance_lut_.setName("Atmosphere_TransmittanceLut");
+    multi_scattering_lut_ = gfxCreateTexture2D(gfx_, multi_scattering_size.x, multi_scattering_size.y,
+        DXGI_FORMAT_R16G16B16A16_FLOAT, 1, nullptr, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
+    multi_scattering_lut_.setName("Atmosphere_MultiScatteringLut");
+    sky_view_lut_ = gfxCreateTexture2D(gfx_, sky_view_size.x, sky_view_size.y, DXGI_FORMAT_R16G16B16A16_FLOAT,
+        1, nullptr, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
+    sky_view_lut_.setName("Atmosphere_SkyViewLut");
+
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_LinearSampler", capsaicin.getLinearSampler());
+
+    // The transmittance and multi-scattering only depend on the atmosphere so are computed once
+    {
+        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, compute_transmittance_lut_kernel_);
+        gfxProgramSetParameter(gfx_, atmosphere_program_, "g_OutLut", transmittance_lut_);
+        gfxCommandBindKernel(gfx_, compute_transmittance_lut_kernel_);
+        gfxCommandDispatch(gfx_, (transmittance_size.x + num_threads[0] - 1) / num_threads[0],
+            (transmittance_size.y + num_threads[1] - 1) / num_threads[1], 1);
+    }
+    {
+        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, compute_multi_scattering_lut_kernel_);
+        gfxProgramSetParameter(gfx_, atmosphere_program_, "g_TransmittanceLut", transmittance_lut_);
+        gfxProgramSetParameter(gfx_, atmosphere_program_, "g_OutLut", multi_scattering_lut_);
+        gfxCommandBindKernel(gfx_, compute_multi_scattering_lut_kernel_);
+        gfxCommandDispatch(gfx_, (multi_scattering_size.x + num_threads[0] - 1) / num_threads[0],
+            (multi_scattering_size.y + num_threads[1] - 1) / num_threads[1], 1);
+    }
+
+    parameters_ = {};
     return !!atmosphere_program_;
 }
 
+Atmosphere::Parameters Atmosphere::getParameters(CapsaicinInternal const &capsaicin) const noexcept
+{
+    Parameters parameters;
+    if (options.atmosphere_sun_animate)
+    {
+        float const t = static_cast<float>(capsaicin.getFrameIndex()) / 360.0F;
+        float       m = std::cos(2.0F * t);
+        m             = 20.0F * m * m * glm::sign(m);
+        parameters.sun_direction = normalize(float3(m * std::sin(t), 1.0F, m * std::cos(t)));
+    }
+    else
+    {
+        float const elevation    = glm::radians(options.atmosphere_sun_elevation);
+        float const azimuth      = glm::radians(options.atmosphere_sun_azimuth);
+        parameters.sun_direction = float3(std::cos(elevation) * std::sin(azimuth), std::sin(elevation),
+            std::cos(elevation) * std::cos(azimuth));
+    }
+
+    // The sky only changes noticeably over large height differences, so small camera movements are ignored
+    constexpr float height_step = 10.0F;
+    float const     height      = std::clamp(
+        capsaicin.getCamera().eye.y, 1.0F, AtmosphereReference::kAtmosphereHeight - height_step);
+    parameters.view_radius =
+        AtmosphereReference::kPlanetRadius + std::round(height / height_step) * height_step;
+    return parameters;
+}
+
 void Atmosphere::render(CapsaicinInternal &capsaicin) noexcept
 {
     options = convertOptions(capsaicin.getOptions());
     if (!options.atmosphere_enable)
     {
+        parameters_ = {};
         return;
     }
 
@@ -72,12 +148,39 @@ void Atmosphere::render(CapsaicinInternal &capsaicin) noexcept
         return; // no environment buffer was created
     }
 
-    auto const buffer_dimensions = uint2 {environment_buffer.getWidth(), environment_buffer.getHeight()};
+    Parameters const parameters = getParameters(capsaicin);
+    if (parameters == parameters_ && !capsaicin.getEnvironmentMapUpdated())
+    {
+        return; // the sky is unchanged
+    }
+    parameters_ = parameters;
+
+    // The sun is dimmed as it sets so that the sky fades out at night, the constant 20 is the sky exposure
+    float3 const sun_color         = (parameters.sun_direction.y * float3(1.0F) + 0.1F) * 20.0F;
+    auto const   buffer_dimensions = uint2 {environment_buffer.getWidth(), environment_buffer.getHeight()};
 
-    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_Eye", capsaicin.getCamera().eye);
-    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_FrameIndex", capsaicin.getFrameIndex());
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_SunDirection", parameters.sun_direction);
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_SunColor", sun_color);
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_ViewRadius", parameters.view_radius);
     gfxProgramSetParameter(gfx_, atmosphere_program_, "g_BufferDimensions", buffer_dimensions);
 
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_TransmittanceLut", transmittance_lut_);
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_MultiScatteringLut", multi_scattering_lut_);
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_LinearSampler", capsaicin.getLinearSampler());
+
+    // Compute the sky-view table
+    {
+        TimedSection const timed_section(*this, "ComputeSkyViewLut");
+
+        constexpr uint2 sky_view_size = AtmosphereReference::kSkyViewLutSize;
+        uint32_t const *num_threads   = gfxKernelGetNumThreads(gfx_, compute_sky_view_lut_kernel_);
+        gfxProgramSetParameter(gfx_, atmosphere_program_, "g_OutLut", sky_view_lut_);
+        gfxCommandBindKernel(gfx_, compute_sky_view_lut_kernel_);
+        gfxCommandDispatch(gfx_, (sky_view_size.x + num_threads[0] - 1) / num_threads[0],
+            (sky_view_size.y + num_threads[1] - 1) / num_threads[1], 1);
+    }
+
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_SkyViewLut", sky_view_lut_);
     gfxProgramSetParameter(gfx_, atmosphere_program_, "g_OutEnvironmentBuffer", environment_buffer);
 
     // Draw the atmosphere
@@ -143,12 +246,47 @@ void Atmosphere::render(CapsaicinInternal &capsaicin) noexcept
             gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, num_groups_z);
         }
     }
+
+    // Let the components consuming the environment map (e.g. the prefiltered IBL) know about the new sky
+    capsaicin.invalidateEnvironmentMap();
 }
 
 void Atmosphere::terminate() noexcept
 {
     gfxDestroyProgram(gfx_, atmosphere_program_);
+    gfxDestroyKernel(gfx_, compute_transmittance_lut_kernel_);
+    gfxDestroyKernel(gfx_, compute_multi_scattering_lut_kernel_);
+    gfxDestroyKernel(gfx_, compute_sky_view_lut_kernel_);
     gfxDestroyKernel(gfx_, draw_atmosphere_kernel_);
     gfxDestroyKernel(gfx_, filter_atmosphere_kernel_);
+    gfxDestroyTexture(gfx_, transmittance_lut_);
+    gfxDestroyTexture(gfx_, multi_scattering_lut_);
+    gfxDestroyTexture(gfx_, sky_view_lut_);
+}
+
+void Atmosphere::renderGUI(CapsaicinInternal &capsaicin) const noexcept
+{
+    if (!capsaicin.getOption<bool>("atmosphere_enable"))
+    {
+        return;
+    }
+    bool animate = capsaicin.getOption<bool>("atmosphere_sun_animate");
+    if (ImGui::Checkbox("Animate Sun", &animate))
+    {
+        capsaicin.setOption("atmosphere_sun_animate", animate);
+    }
+    if (!animate)
+    {
+        float elevation = capsaicin.getOption<float>("atmosphere_sun_elevation");
+        if (ImGui::DragFloat("Sun Elevation", &elevation, 0.1F, -10.0F, 90.0F))
+        {
+            capsaicin.setOption("atmosphere_sun_elevation", elevation);
+        }
+        float azimuth = capsaicin.getOption<float>("atmosphere_sun_azimuth");
+        if (ImGui::DragFloat("Sun Azimuth", &azimuth, 0.5F, -180.0F, 180.0F))
+        {
+            capsaicin.setOption("atmosphere_sun_azimuth", azimuth);
+        }
+    }
 }
 } // namespace Capsaicin
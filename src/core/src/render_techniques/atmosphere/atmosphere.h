@@ -44,7 +44,10 @@ class Atmosphere final : public RenderTechnique
 
     struct RenderOptions
     {
-        bool atmosphere_enable = false; /**< Maximum number of bounces each path can take */
+        bool  atmosphere_enable        = false; /**< Draw the sky into the environment map */
+        bool  atmosphere_sun_animate   = false; /**< Move the sun across the sky every frame */
+        float atmosphere_sun_elevation = 2.86F; /**< Angle of the sun above the horizon (degrees) */
+        float atmosphere_sun_azimuth   = 0.0F;  /**< Angle of the sun around the up axis from +Z (degrees) */
     };
 
     /**
@@ -74,10 +77,39 @@ class Atmosphere final : public RenderTechnique
      */
     void terminate() noexcept override;
 
+    /**
+     * Render GUI options.
+     * @param [in,out] capsaicin The current capsaicin context.
+     */
+    void renderGUI(CapsaicinInternal &capsaicin) const noexcept override;
+
 protected:
+    /** The values the sky depends on, the environment map is only redrawn when any of them change. */
+    struct Parameters
+    {
+        float3 sun_direction = float3(0.0F); /**< Normalised direction towards the sun */
+        float  view_radius   = 0.0F;         /**< Quantised distance of the camera from the planet centre */
+
+        bool operator==(Parameters const &other) const noexcept = default;
+    };
+
+    /**
+     * Gets the sky parameters for the current frame.
+     * @param capsaicin Current framework context.
+     * @return The parameters.
+     */
+    [[nodiscard]] Parameters getParameters(CapsaicinInternal const &capsaicin) const noexcept;
+
     RenderOptions options;
+    Parameters    parameters_; /**< Parameters of the sky currently stored in the environment map */
     GfxProgram    atmosphere_program_;
+    GfxKernel     compute_transmittance_lut_kernel_;
+    GfxKernel     compute_multi_scattering_lut_kernel_;
+    GfxKernel     compute_sky_view_lut_kernel_;
     GfxKernel     draw_atmosphere_kernel_;
     GfxKernel     filter_atmosphere_kernel_;
+    GfxTexture    transmittance_lut_;
+    GfxTexture    multi_scattering_lut_;
+    GfxTexture    sky_view_lut_;
 };
 } // namespace Capsaicin
@@ -0,0 +1,323 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#ifndef ATMOSPHERE_LUT_HLSL
+#define ATMOSPHERE_LUT_HLSL
+
+// Table based evaluation of the scattering model in 'atmosphere.hlsl'.
+// The transmittance and multi-scattering tables only depend on the atmosphere itself and are computed once,
+// the sky-view table depends on the view height and the sun elevation and is recomputed whenever they change.
+// The functions are mirrored on the CPU in 'atmosphere_reference.cpp'.
+
+#include "atmosphere.hlsl"
+
+#define TRANSMITTANCE_LUT_SIZE         uint2(256, 64)
+#define MULTISCATTERING_LUT_SIZE       uint2(32, 32)
+#define SKYVIEW_LUT_SIZE               uint2(192, 108)
+#define TRANSMITTANCE_STEPS            40
+#define MULTISCATTERING_STEPS          20
+#define MULTISCATTERING_DIRECTIONS     8
+#define SKYVIEW_STEPS                  32
+
+static const float kPlanetRadius     = PLANET_RADIUS;
+static const float kAtmosphereRadius = PLANET_RADIUS + ATMOSPHERE_HEIGHT;
+
+float3 Extinction(float3 density)
+{
+    return (density.x * C_RAYLEIGH + density.y * C_MIE * 1.1 + density.z * C_OZONE) * ATMOSPHERE_DENSITY;
+}
+
+float DistanceToTop(float radius, float cosZenith)
+{
+    float discriminant =
+        radius * radius * (cosZenith * cosZenith - 1.0f) + kAtmosphereRadius * kAtmosphereRadius;
+    return max(0.0f, -radius * cosZenith + sqrt(max(discriminant, 0.0f)));
+}
+
+float DistanceToGround(float radius, float cosZenith)
+{
+    float discriminant = radius * radius * (cosZenith * cosZenith - 1.0f) + kPlanetRadius * kPlanetRadius;
+    return max(0.0f, -radius * cosZenith - sqrt(max(discriminant, 0.0f)));
+}
+
+bool IntersectsGround(float radius, float cosZenith)
+{
+    return cosZenith < 0.0f
+        && radius * radius * (cosZenith * cosZenith - 1.0f) + kPlanetRadius * kPlanetRadius >= 0.0f;
+}
+
+float GetTextureCoordFromUnitRange(float x, uint size)
+{
+    return 0.5f / size + x * (1.0f - 1.0f / size);
+}
+
+float GetUnitRangeFromTextureCoord(float u, uint size)
+{
+    return (u - 0.5f / size) / (1.0f - 1.0f / size);
+}
+
+// Transmittance table: x maps the distance to the top of the atmosphere and y the view height.
+float2 TransmittanceLutToParameters(float2 uv)
+{
+    float x_mu = GetUnitRangeFromTextureCoord(uv.x, TRANSMITTANCE_LUT_SIZE.x);
+    float x_r  = GetUnitRangeFromTextureCoord(uv.y, TRANSMITTANCE_LUT_SIZE.y);
+    float h    = sqrt(kAtmosphereRadius * kAtmosphereRadius - kPlanetRadius * kPlanetRadius);
+    float rho  = h * x_r;
+    float r    = sqrt(rho * rho + kPlanetRadius * kPlanetRadius);
+    float dMin = kAtmosphereRadius - r;
+    float dMax = rho + h;
+    float d    = dMin + x_mu * (dMax - dMin);
+    float mu   = d == 0.0f ? 1.0f : (h * h - rho * rho - d * d) / (2.0f * r * d);
+    return float2(r, clamp(mu, -1.0f, 1.0f));
+}
+
+float2 TransmittanceParametersToLut(float radius, float cosZenith)
+{
+    float h    = sqrt(kAtmosphereRadius * kAtmosphereRadius - kPlanetRadius * kPlanetRadius);
+    float rho  = sqrt(max(radius * radius - kPlanetRadius * kPlanetRadius, 0.0f));
+    float d    = DistanceToTop(radius, cosZenith);
+    float dMin = kAtmosphereRadius - radius;
+    float dMax = rho + h;
+    float x_mu = (d - dMin) / (dMax - dMin);
+    float x_r  = rho / h;
+    return float2(GetTextureCoordFromUnitRange(x_mu, TRANSMITTANCE_LUT_SIZE.x),
+        GetTextureCoordFromUnitRange(x_r, TRANSMITTANCE_LUT_SIZE.y));
+}
+
+// Multi-scattering table: x maps the sun elevation and y the view height.
+float2 MultiScatteringLutToParameters(float2 uv)
+{
+    float x_mu = GetUnitRangeFromTextureCoord(uv.x, MULTISCATTERING_LUT_SIZE.x);
+    float x_r  = GetUnitRangeFromTextureCoord(uv.y, MULTISCATTERING_LUT_SIZE.y);
+    return float2(kPlanetRadius + x_r * ATMOSPHERE_HEIGHT, x_mu * 2.0f - 1.0f);
+}
+
+float2 MultiScatteringParametersToLut(float radius, float sunCosZenith)
+{
+    float x_mu = saturate(sunCosZenith * 0.5f + 0.5f);
+    float x_r  = saturate((radius - kPlanetRadius) / ATMOSPHERE_HEIGHT);
+    return float2(GetTextureCoordFromUnitRange(x_mu, MULTISCATTERING_LUT_SIZE.x),
+        GetTextureCoordFromUnitRange(x_r, MULTISCATTERING_LUT_SIZE.y));
+}
+
+// Sky-view table: x maps the azimuth relative to the sun and y the view elevation, using a non-linear mapping
+// that concentrates the texels around the horizon. The horizon lies exactly on the centre line of the table.
+float2 SkyViewLutToParameters(float radius, float2 uv)
+{
+    float horizon       = sqrt(max(radius * radius - kPlanetRadius * kPlanetRadius, 0.0f));
+    float beta          = acos(horizon / radius);
+    float zenithHorizon = PI - beta;
+    float viewCosZenith;
+    if (uv.y < 0.5f)
+    {
+        float coord   = 1.0f - 2.0f * uv.y;
+        coord         = 1.0f - coord * coord;
+        viewCosZenith = cos(zenithHorizon * coord);
+    }
+    else
+    {
+        float coord   = uv.y * 2.0f - 1.0f;
+        coord        *= coord;
+        viewCosZenith = cos(zenithHorizon + beta * coord);
+    }
+    float coord = uv.x * uv.x;
+    return float2(viewCosZenith, -(coord * 2.0f - 1.0f));
+}
+
+float2 SkyViewParametersToLut(float radius, float viewCosZenith, float lightViewCos)
+{
+    float  horizon       = sqrt(max(radius * radius - kPlanetRadius * kPlanetRadius, 0.0f));
+    float  beta          = acos(horizon / radius);
+    float  zenithHorizon = PI - beta;
+    float  angle         = acos(clamp(viewCosZenith, -1.0f, 1.0f));
+    float2 uv;
+    if (angle < zenithHorizon)
+    {
+        float coord = sqrt(max(1.0f - angle / zenithHorizon, 0.0f));
+        uv.y        = 0.5f * (1.0f - coord);
+    }
+    else
+    {
+        float coord = sqrt(max((angle - zenithHorizon) / beta, 0.0f));
+        uv.y        = 0.5f + 0.5f * coord;
+    }
+    uv.x = sqrt(saturate(-lightViewCos * 0.5f + 0.5f));
+    return uv;
+}
+
+float3 SampleSunTransmittance(Texture2D<float4> transmittanceLut, SamplerState linearSampler, float radius,
+    float sunCosZenith)
+{
+    if (IntersectsGround(radius, sunCosZenith))
+    {
+        return 0.0f;
+    }
+    float2 uv = TransmittanceParametersToLut(radius, sunCosZenith);
+    return transmittanceLut.SampleLevel(linearSampler, uv, 0.0f).xyz;
+}
+
+/**
+ * Integrate the transmittance between a point and the top of the atmosphere.
+ * @param radius    Distance from the planet centre.
+ * @param cosZenith Cosine of the angle between the ray and the local up vector.
+ * @return The transmittance (not accounting for occlusion by the planet).
+ */
+float3 IntegrateTransmittance(float radius, float cosZenith)
+{
+    float  stepSize  = DistanceToTop(radius, cosZenith) / TRANSMITTANCE_STEPS;
+    float3 direction = float3(sqrt(max(1.0f - cosZenith * cosZenith, 0.0f)), cosZenith, 0.0f);
+    float3 opticalDepth = 0.0f;
+    for (uint i = 0; i < TRANSMITTANCE_STEPS; ++i)
+    {
+        float3 position  = float3(0.0f, radius, 0.0f) + direction * ((i + 0.5f) * stepSize);
+        opticalDepth    += AtmosphereDensity(length(position) - kPlanetRadius) * stepSize;
+    }
+    return Absorb(opticalDepth);
+}
+
+/**
+ * Integrate the isotropic multiple scattering contribution at a point.
+ * Uses the approximation of Hillaire 2020, "A Scalable and Production Ready Sky and Atmosphere Rendering
+ * Technique", where the second order scattering is integrated over the sphere and higher orders are
+ * accounted for using a geometric series of the transfer factor.
+ * @param transmittanceLut The transmittance table.
+ * @param linearSampler    Linear sampler clamping to the table edges.
+ * @param radius           Distance from the planet centre.
+ * @param sunCosZenith     Cosine of the angle between the sun and the local up vector.
+ * @return The multiple scattering transfer for a sun of unit intensity.
+ */
+float3 IntegrateMultiScattering(Texture2D<float4> transmittanceLut, SamplerState linearSampler, float radius,
+    float sunCosZenith)
+{
+    float3 sunDirection = float3(sqrt(max(1.0f - sunCosZenith * sunCosZenith, 0.0f)), sunCosZenith, 0.0f);
+    float3 luminance    = 0.0f;
+    float3 transfer     = 0.0f;
+    for (uint i = 0; i < MULTISCATTERING_DIRECTIONS; ++i)
+    {
+        float cosZenith = 1.0f - 2.0f * (i + 0.5f) / MULTISCATTERING_DIRECTIONS;
+        float sinZenith = sqrt(max(1.0f - cosZenith * cosZenith, 0.0f));
+        float rayLength = IntersectsGround(radius, cosZenith) ? DistanceToGround(radius, cosZenith)
+                                                              : DistanceToTop(radius, cosZenith);
+        float stepSize  = rayLength / MULTISCATTERING_STEPS;
+        for (uint j = 0; j < MULTISCATTERING_DIRECTIONS; ++j)
+        {
+            float  azimuth    = 2.0f * PI * (j + 0.5f) / MULTISCATTERING_DIRECTIONS;
+            float3 direction  = float3(sinZenith * cos(azimuth), cosZenith, sinZenith * sin(azimuth));
+            float3 throughput = 1.0f;
+            for (uint k = 0; k < MULTISCATTERING_STEPS; ++k)
+            {
+                float3 position            = float3(0.0f, radius, 0.0f) + direction * ((k + 0.5f) * stepSize);
+                float  sampleRadius        = length(position);
+                float3 density             = AtmosphereDensity(sampleRadius - kPlanetRadius);
+                float3 scattering          = density.x * C_RAYLEIGH + density.y * C_MIE;
+                float3 extinction          = Extinction(density);
+                float3 sampleTransmittance = exp(-extinction * stepSize);
+                float3 integral            = (1.0f - sampleTransmittance) / extinction;
+                float3 sunTransmittance    = SampleSunTransmittance(transmittanceLut, linearSampler,
+                    sampleRadius, dot(position, sunDirection) / sampleRadius);
+                luminance  += throughput * scattering * sunTransmittance * integral / (4.0f * PI);
+                transfer   += throughput * scattering * integral;
+                throughput *= sampleTransmittance;
+            }
+        }
+    }
+    luminance /= MULTISCATTERING_DIRECTIONS * MULTISCATTERING_DIRECTIONS;
+    transfer  /= MULTISCATTERING_DIRECTIONS * MULTISCATTERING_DIRECTIONS;
+    return luminance / (1.0f - transfer);
+}
+
+/**
+ * Integrate the scattering along a view ray using the transmittance and multi-scattering tables.
+ * @param transmittanceLut   The transmittance table.
+ * @param multiScatteringLut The multi-scattering table.
+ * @param linearSampler      Linear sampler clamping to the table edges.
+ * @param radius             Distance of the view point from the planet centre.
+ * @param viewCosZenith      Cosine of the angle between the view ray and the local up vector.
+ * @param lightViewCos       Cosine of the azimuth between the view ray and the sun.
+ * @param sunCosZenith       Cosine of the angle between the sun and the local up vector.
+ * @return The scattered radiance for a sun of unit intensity.
+ */
+float3 IntegrateSkyView(Texture2D<float4> transmittanceLut, Texture2D<float4> multiScatteringLut,
+    SamplerState linearSampler, float radius, float viewCosZenith, float lightViewCos, float sunCosZenith)
+{
+    float  viewSinZenith = sqrt(max(1.0f - viewCosZenith * viewCosZenith, 0.0f));
+    float3 direction     = float3(viewSinZenith * lightViewCos, viewCosZenith,
+        viewSinZenith * sqrt(max(1.0f - lightViewCos * lightViewCos, 0.0f)));
+    float3 sunDirection  = float3(sqrt(max(1.0f - sunCosZenith * sunCosZenith, 0.0f)), sunCosZenith, 0.0f);
+    float  rayLength     = IntersectsGround(radius, viewCosZenith) ? DistanceToGround(radius, viewCosZenith)
+                                                                   : DistanceToTop(radius, viewCosZenith);
+    float  costh  = dot(direction, sunDirection);
+    float  phaseR = PhaseRayleigh(costh);
+    float  phaseM = PhaseMie(costh);
+
+    float3 luminance   = 0.0f;
+    float3 throughput  = 1.0f;
+    float  prevRayTime = 0.0f;
+    for (uint i = 0; i < SKYVIEW_STEPS; ++i)
+    {
+        // Samples are spaced quadratically closer to the view point where the density is highest
+        float rayTime  = (i + 1.0f) / SKYVIEW_STEPS;
+        rayTime       *= rayTime * rayLength;
+        float  stepSize            = rayTime - prevRayTime;
+        float3 position            = float3(0.0f, radius, 0.0f) + direction * (prevRayTime + 0.5f * stepSize);
+        float  sampleRadius        = length(position);
+        float  sampleSunCos        = dot(position, sunDirection) / sampleRadius;
+        float3 density             = AtmosphereDensity(sampleRadius - kPlanetRadius);
+        float3 rayleigh            = density.x * C_RAYLEIGH;
+        float3 mie                 = density.y * C_MIE;
+        float3 extinction          = Extinction(density);
+        float3 sampleTransmittance = exp(-extinction * stepSize);
+        float3 integral            = (1.0f - sampleTransmittance) / extinction;
+        float3 sunTransmittance    =
+            SampleSunTransmittance(transmittanceLut, linearSampler, sampleRadius, sampleSunCos);
+        float3 scattering          = (rayleigh * phaseR + mie * phaseM) * sunTransmittance;
+        scattering += (rayleigh + mie)
+                    * multiScatteringLut.SampleLevel(linearSampler,
+                          MultiScatteringParametersToLut(sampleRadius, sampleSunCos), 0.0f).xyz;
+        luminance   += throughput * scattering * integral;
+        throughput  *= sampleTransmittance;
+        prevRayTime  = rayTime;
+    }
+    return luminance;
+}
+
+/**
+ * Evaluate the sky radiance in a given direction by sampling the sky-view table.
+ * @param skyViewLut    The sky-view table.
+ * @param linearSampler Linear sampler clamping to the table edges.
+ * @param radius        Distance of the view point from the planet centre.
+ * @param direction     The normalised view direction.
+ * @param sunDirection  The normalised direction towards the sun.
+ * @return The scattered radiance for a sun of unit intensity.
+ */
+float3 EvaluateSky(Texture2D<float4> skyViewLut, SamplerState linearSampler, float radius, float3 direction,
+    float3 sunDirection)
+{
+    float2 viewHorizontal = direction.xz;
+    float2 sunHorizontal  = sunDirection.xz;
+    float  lengths        = length(viewHorizontal) * length(sunHorizontal);
+    float  lightViewCos   = lengths > 0.0f ? dot(viewHorizontal, sunHorizontal) / lengths : 1.0f;
+    float2 uv             = SkyViewParametersToLut(radius, direction.y, lightViewCos);
+    return skyViewLut.SampleLevel(linearSampler, uv, 0.0f).xyz;
+}
+
+#endif // ATMOSPHERE_LUT_HLSL
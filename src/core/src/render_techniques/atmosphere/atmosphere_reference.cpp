@@ -0,0 +1,487 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "atmosphere_reference.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace Capsaicin
+{
+namespace
+{
+constexpr float kPlanetRadius     = AtmosphereReference::kPlanetRadius;
+constexpr float kAtmosphereHeight = AtmosphereReference::kAtmosphereHeight;
+constexpr float kAtmosphereRadius = kPlanetRadius + kAtmosphereHeight;
+constexpr float kRayleighHeight   = kAtmosphereHeight * 0.08F;
+constexpr float kMieHeight        = kAtmosphereHeight * 0.012F;
+constexpr float kPi               = std::numbers::pi_v<float>;
+
+float3 const kRayleigh = float3(5.802F, 13.558F, 33.100F) * 1e-6F;
+float3 const kMie      = float3(3.996F, 3.996F, 3.996F) * 1e-6F;
+float3 const kOzone    = float3(0.650F, 1.881F, 0.085F) * 1e-6F;
+
+constexpr uint32_t kTransmittanceSteps       = 40;
+constexpr uint32_t kMultiScatteringSteps     = 20;
+constexpr uint32_t kMultiScatteringDirection = 8; /**< Number of directions along each axis of the sphere */
+constexpr uint32_t kSkyViewSteps             = 32;
+
+float3 AtmosphereDensity(float const height) noexcept
+{
+    return {std::exp(-std::max(0.0F, height / kRayleighHeight)),
+        std::exp(-std::max(0.0F, height / kMieHeight)),
+        std::max(0.0F, 1.0F - std::abs(height - 25000.0F) / 15000.0F)};
+}
+
+float3 Extinction(float3 const &density) noexcept
+{
+    return density.x * kRayleigh + density.y * kMie * 1.1F + density.z * kOzone;
+}
+
+float PhaseRayleigh(float const cosTheta) noexcept
+{
+    return 3.0F * (1.0F + cosTheta * cosTheta) / (16.0F * kPi);
+}
+
+float PhaseMie(float const cosTheta) noexcept
+{
+    constexpr float g = 0.85F;
+    constexpr float k = 1.55F * g - 0.55F * g * g * g;
+    float const     d = 1.0F - k * cosTheta;
+    return (1.0F - k * k) / (4.0F * kPi * d * d);
+}
+
+float3 Absorb(float3 const &opticalDepth) noexcept
+{
+    return exp(-Extinction(opticalDepth));
+}
+
+float2 SphereIntersection(float3 rayStart, float3 const &rayDir, float const sphereRadius) noexcept
+{
+    rayStart -= float3(0.0F, -kPlanetRadius, 0.0F);
+    float const b = 2.0F * dot(rayStart, rayDir);
+    float const c = dot(rayStart, rayStart) - sphereRadius * sphereRadius;
+    float       d = b * b - 4.0F * c;
+    if (d < 0.0F)
+    {
+        return float2(-1.0F);
+    }
+    d = std::sqrt(d);
+    return float2(-b - d, -b + d) * 0.5F;
+}
+
+float AtmosphereHeight(float3 const &position) noexcept
+{
+    return distance(position, float3(0.0F, -kPlanetRadius, 0.0F)) - kPlanetRadius;
+}
+
+float3 IntegrateOpticalDepth(
+    float3 const &rayStart, float3 const &rayDir, uint32_t const sampleCount) noexcept
+{
+    float const rayLength = SphereIntersection(rayStart, rayDir, kAtmosphereRadius).y;
+    float const stepSize  = rayLength / static_cast<float>(sampleCount);
+    float3      opticalDepth(0.0F);
+    for (uint32_t i = 0; i < sampleCount; ++i)
+    {
+        float3 const position = rayStart + rayDir * ((static_cast<float>(i) + 0.5F) * stepSize);
+        opticalDepth += AtmosphereDensity(AtmosphereHeight(position)) * stepSize;
+    }
+    return opticalDepth;
+}
+
+float DistanceToTop(float const radius, float const cosZenith) noexcept
+{
+    float const discriminant =
+        radius * radius * (cosZenith * cosZenith - 1.0F) + kAtmosphereRadius * kAtmosphereRadius;
+    return std::max(0.0F, -radius * cosZenith + std::sqrt(std::max(discriminant, 0.0F)));
+}
+
+float DistanceToGround(float const radius, float const cosZenith) noexcept
+{
+    float const discriminant =
+        radius * radius * (cosZenith * cosZenith - 1.0F) + kPlanetRadius * kPlanetRadius;
+    return std::max(0.0F, -radius * cosZenith - std::sqrt(std::max(discriminant, 0.0F)));
+}
+
+bool IntersectsGround(float const radius, float const cosZenith) noexcept
+{
+    return cosZenith < 0.0F
+        && radius * radius * (cosZenith * cosZenith - 1.0F) + kPlanetRadius * kPlanetRadius >= 0.0F;
+}
+
+float3 DirectionFromCosZenith(float const cosZenith) noexcept
+{
+    return {std::sqrt(std::max(1.0F - cosZenith * cosZenith, 0.0F)), cosZenith, 0.0F};
+}
+
+float GetTextureCoordFromUnitRange(float const x, uint32_t const size) noexcept
+{
+    return 0.5F / static_cast<float>(size) + x * (1.0F - 1.0F / static_cast<float>(size));
+}
+
+float GetUnitRangeFromTextureCoord(float const u, uint32_t const size) noexcept
+{
+    return (u - 0.5F / static_cast<float>(size)) / (1.0F - 1.0F / static_cast<float>(size));
+}
+
+float2 TransmittanceLutToParameters(float2 const &uv) noexcept
+{
+    float const x_mu = GetUnitRangeFromTextureCoord(uv.x, AtmosphereReference::kTransmittanceLutSize.x);
+    float const x_r  = GetUnitRangeFromTextureCoord(uv.y, AtmosphereReference::kTransmittanceLutSize.y);
+    float const h    = std::sqrt(kAtmosphereRadius * kAtmosphereRadius - kPlanetRadius * kPlanetRadius);
+    float const rho  = h * x_r;
+    float const r    = std::sqrt(rho * rho + kPlanetRadius * kPlanetRadius);
+    float const dMin = kAtmosphereRadius - r;
+    float const dMax = rho + h;
+    float const d    = dMin + x_mu * (dMax - dMin);
+    float const mu   = d == 0.0F ? 1.0F : (h * h - rho * rho - d * d) / (2.0F * r * d);
+    return {r, std::clamp(mu, -1.0F, 1.0F)};
+}
+
+float2 TransmittanceParametersToLut(float const radius, float const cosZenith) noexcept
+{
+    float const h    = std::sqrt(kAtmosphereRadius * kAtmosphereRadius - kPlanetRadius * kPlanetRadius);
+    float const rho  = std::sqrt(std::max(radius * radius - kPlanetRadius * kPlanetRadius, 0.0F));
+    float const d    = DistanceToTop(radius, cosZenith);
+    float const dMin = kAtmosphereRadius - radius;
+    float const dMax = rho + h;
+    float const x_mu = (d - dMin) / (dMax - dMin);
+    float const x_r  = rho / h;
+    return {GetTextureCoordFromUnitRange(x_mu, AtmosphereReference::kTransmittanceLutSize.x),
+        GetTextureCoordFromUnitRange(x_r, AtmosphereReference::kTransmittanceLutSize.y)};
+}
+
+float2 MultiScatteringLutToParameters(float2 const &uv) noexcept
+{
+    float const x_mu = GetUnitRangeFromTextureCoord(uv.x, AtmosphereReference::kMultiScatteringLutSize.x);
+    float const x_r  = GetUnitRangeFromTextureCoord(uv.y, AtmosphereReference::kMultiScatteringLutSize.y);
+    return {kPlanetRadius + x_r * kAtmosphereHeight, x_mu * 2.0F - 1.0F};
+}
+
+float2 MultiScatteringParametersToLut(float const radius, float const sunCosZenith) noexcept
+{
+    float const x_mu = std::clamp(sunCosZenith * 0.5F + 0.5F, 0.0F, 1.0F);
+    float const x_r  = std::clamp((radius - kPlanetRadius) / kAtmosphereHeight, 0.0F, 1.0F);
+    return {GetTextureCoordFromUnitRange(x_mu, AtmosphereReference::kMultiScatteringLutSize.x),
+        GetTextureCoordFromUnitRange(x_r, AtmosphereReference::kMultiScatteringLutSize.y)};
+}
+
+float2 SkyViewLutToParameters(float const radius, float2 const &uv) noexcept
+{
+    float const horizon        = std::sqrt(std::max(radius * radius - kPlanetRadius * kPlanetRadius, 0.0F));
+    float const beta           = std::acos(horizon / radius);
+    float const zenithHorizon  = kPi - beta;
+    float       viewCosZenith  = 0.0F;
+    if (uv.y < 0.5F)
+    {
+        float coord   = 1.0F - 2.0F * uv.y;
+        coord         = 1.0F - coord * coord;
+        viewCosZenith = std::cos(zenithHorizon * coord);
+    }
+    else
+    {
+        float coord   = uv.y * 2.0F - 1.0F;
+        coord        *= coord;
+        viewCosZenith = std::cos(zenithHorizon + beta * coord);
+    }
+    float const coord = uv.x * uv.x;
+    return {viewCosZenith, -(coord * 2.0F - 1.0F)};
+}
+
+float2 SkyViewParametersToLut(
+    float const radius, float const viewCosZenith, float const lightViewCos) noexcept
+{
+    float const horizon       = std::sqrt(std::max(radius * radius - kPlanetRadius * kPlanetRadius, 0.0F));
+    float const beta          = std::acos(horizon / radius);
+    float const zenithHorizon = kPi - beta;
+    float const angle         = std::acos(std::clamp(viewCosZenith, -1.0F, 1.0F));
+    float2      uv;
+    if (angle < zenithHorizon)
+    {
+        float const coord = std::sqrt(std::max(1.0F - angle / zenithHorizon, 0.0F));
+        uv.y              = 0.5F * (1.0F - coord);
+    }
+    else
+    {
+        float const coord = std::sqrt(std::max((angle - zenithHorizon) / beta, 0.0F));
+        uv.y              = 0.5F + 0.5F * coord;
+    }
+    uv.x = std::sqrt(std::clamp(-lightViewCos * 0.5F + 0.5F, 0.0F, 1.0F));
+    return uv;
+}
+
+float3 SampleLut(std::vector<float3> const &lut, uint2 const &size, float2 const &uv) noexcept
+{
+    // Bilinear filtering clamped to the table edges, matching the linear sampler used on the GPU
+    float2 const   texel  = clamp(uv * float2(size) - 0.5F, float2(0.0F), float2(size - 1U));
+    auto const     x0     = static_cast<uint32_t>(texel.x);
+    auto const     y0     = static_cast<uint32_t>(texel.y);
+    uint32_t const x1     = std::min(x0 + 1, size.x - 1);
+    uint32_t const y1     = std::min(y0 + 1, size.y - 1);
+    float2 const   weight = texel - float2(static_cast<float>(x0), static_cast<float>(y0));
+    float3 const   top    = mix(lut[y0 * size.x + x0], lut[y0 * size.x + x1], weight.x);
+    float3 const   bottom = mix(lut[y1 * size.x + x0], lut[y1 * size.x + x1], weight.x);
+    return mix(top, bottom, weight.y);
+}
+
+float3 SampleSunTransmittance(
+    std::vector<float3> const &transmittanceLut, float const radius, float const sunCosZenith) noexcept
+{
+    if (IntersectsGround(radius, sunCosZenith))
+    {
+        return float3(0.0F);
+    }
+    return SampleLut(transmittanceLut, AtmosphereReference::kTransmittanceLutSize,
+        TransmittanceParametersToLut(radius, sunCosZenith));
+}
+
+template<typename Function>
+std::vector<float3> GenerateLut(uint2 const &size, Function const &function) noexcept
+{
+    std::vector<float3> lut(static_cast<size_t>(size.x) * size.y);
+    for (uint32_t y = 0; y < size.y; ++y)
+    {
+        for (uint32_t x = 0; x < size.x; ++x)
+        {
+            float2 const uv = (float2(static_cast<float>(x), static_cast<float>(y)) + 0.5F) / float2(size);
+            lut[y * size.x + x] = function(uv);
+        }
+    }
+    return lut;
+}
+} // namespace
+
+float3 AtmosphereReference::IntegrateScattering(float3 const &rayStart, float3 const &rayDir,
+    float3 const &lightDir, uint32_t const sampleCount, uint32_t const opticalDepthSampleCount) noexcept
+{
+    float const rayHeight = AtmosphereHeight(rayStart);
+    float const sampleDistributionExponent =
+        1.0F + std::clamp(1.0F - rayHeight / kAtmosphereHeight, 0.0F, 1.0F) * 8.0F;
+
+    float2 const intersection = SphereIntersection(rayStart, rayDir, kAtmosphereRadius);
+    float3       start        = rayStart;
+    float        rayLength    = std::min(1e9F, intersection.y);
+    if (intersection.x > 0.0F)
+    {
+        start     += rayDir * intersection.x;
+        rayLength -= intersection.x;
+    }
+
+    float const cosTheta = dot(rayDir, lightDir);
+    float const phaseR   = PhaseRayleigh(cosTheta);
+    float const phaseM   = PhaseMie(cosTheta);
+
+    float3 opticalDepth(0.0F);
+    float3 rayleigh(0.0F);
+    float3 mie(0.0F);
+    float  prevRayTime = 0.0F;
+    for (uint32_t i = 0; i < sampleCount; ++i)
+    {
+        float const rayTime =
+            std::pow(static_cast<float>(i) / static_cast<float>(sampleCount), sampleDistributionExponent)
+            * rayLength;
+        float const  stepSize = rayTime - prevRayTime;
+        float3 const position = start + rayDir * rayTime;
+        float3 const density  = AtmosphereDensity(AtmosphereHeight(position));
+        opticalDepth         += density * stepSize;
+        float3 const viewTransmittance = Absorb(opticalDepth);
+        float3 const lightTransmittance =
+            Absorb(IntegrateOpticalDepth(position, lightDir, opticalDepthSampleCount));
+        rayleigh    += viewTransmittance * lightTransmittance * phaseR * density.x * stepSize;
+        mie         += viewTransmittance * lightTransmittance * phaseM * density.y * stepSize;
+        prevRayTime  = rayTime;
+    }
+    return rayleigh * kRayleigh + mie * kMie;
+}
+
+float3 AtmosphereReference::IntegrateTransmittance(float const radius, float const cosZenith) noexcept
+{
+    float const  stepSize  = DistanceToTop(radius, cosZenith) / static_cast<float>(kTransmittanceSteps);
+    float3 const direction = DirectionFromCosZenith(cosZenith);
+    float3       opticalDepth(0.0F);
+    for (uint32_t i = 0; i < kTransmittanceSteps; ++i)
+    {
+        float3 const position =
+            float3(0.0F, radius, 0.0F) + direction * ((static_cast<float>(i) + 0.5F) * stepSize);
+        opticalDepth += AtmosphereDensity(length(position) - kPlanetRadius) * stepSize;
+    }
+    return Absorb(opticalDepth);
+}
+
+float3 AtmosphereReference::IntegrateMultiScattering(
+    std::vector<float3> const &transmittanceLut, float const radius, float const sunCosZenith) noexcept
+{
+    float3 const sunDirection = DirectionFromCosZenith(sunCosZenith);
+    float3       luminance(0.0F);
+    float3       transfer(0.0F);
+    for (uint32_t i = 0; i < kMultiScatteringDirection; ++i)
+    {
+        float const cosZenith =
+            1.0F - 2.0F * (static_cast<float>(i) + 0.5F) / static_cast<float>(kMultiScatteringDirection);
+        float const sinZenith = std::sqrt(std::max(1.0F - cosZenith * cosZenith, 0.0F));
+        float const rayLength = IntersectsGround(radius, cosZenith) ? DistanceToGround(radius, cosZenith)
+                                                                    : DistanceToTop(radius, cosZenith);
+        float const stepSize  = rayLength / static_cast<float>(kMultiScatteringSteps);
+        for (uint32_t j = 0; j < kMultiScatteringDirection; ++j)
+        {
+            float const azimuth =
+                2.0F * kPi * (static_cast<float>(j) + 0.5F) / static_cast<float>(kMultiScatteringDirection);
+            float3 const direction(sinZenith * std::cos(azimuth), cosZenith, sinZenith * std::sin(azimuth));
+            float3       throughput(1.0F);
+            for (uint32_t k = 0; k < kMultiScatteringSteps; ++k)
+            {
+                float3 const position =
+                    float3(0.0F, radius, 0.0F) + direction * ((static_cast<float>(k) + 0.5F) * stepSize);
+                float const  sampleRadius = length(position);
+                float3 const density      = AtmosphereDensity(sampleRadius - kPlanetRadius);
+                float3 const scattering   = density.x * kRayleigh + density.y * kMie;
+                float3 const extinction   = Extinction(density);
+                float3 const sampleTransmittance = exp(-extinction * stepSize);
+                float3 const integral            = (1.0F - sampleTransmittance) / extinction;
+                float3 const sunTransmittance    = SampleSunTransmittance(
+                    transmittanceLut, sampleRadius, dot(position, sunDirection) / sampleRadius);
+                luminance  += throughput * scattering * sunTransmittance * integral / (4.0F * kPi);
+                transfer   += throughput * scattering * integral;
+                throughput *= sampleTransmittance;
+            }
+        }
+    }
+    constexpr auto directionCount = static_cast<float>(kMultiScatteringDirection * kMultiScatteringDirection);
+    luminance /= directionCount;
+    transfer  /= directionCount;
+    return luminance / (1.0F - transfer);
+}
+
+float3 AtmosphereReference::IntegrateSkyView(std::vector<float3> const &transmittanceLut,
+    std::vector<float3> const &multiScatteringLut, float const radius, float const viewCosZenith,
+    float const lightViewCos, float const sunCosZenith) noexcept
+{
+    float const  viewSinZenith = std::sqrt(std::max(1.0F - viewCosZenith * viewCosZenith, 0.0F));
+    float3 const direction(viewSinZenith * lightViewCos, viewCosZenith,
+        viewSinZenith * std::sqrt(std::max(1.0F - lightViewCos * lightViewCos, 0.0F)));
+    float3 const sunDirection = DirectionFromCosZenith(sunCosZenith);
+    float const  rayLength = IntersectsGround(radius, viewCosZenith) ? DistanceToGround(radius, viewCosZenith)
+                                                                     : DistanceToTop(radius, viewCosZenith);
+    float const  cosTheta  = dot(direction, sunDirection);
+    float const  phaseR    = PhaseRayleigh(cosTheta);
+    float const  phaseM    = PhaseMie(cosTheta);
+
+    float3 luminance(0.0F);
+    float3 throughput(1.0F);
+    float  prevRayTime = 0.0F;
+    for (uint32_t i = 0; i < kSkyViewSteps; ++i)
+    {
+        // Samples are spaced quadratically closer to the view point where the density is highest
+        float rayTime  = (static_cast<float>(i) + 1.0F) / static_cast<float>(kSkyViewSteps);
+        rayTime       *= rayTime * rayLength;
+        float const  stepSize     = rayTime - prevRayTime;
+        float3 const position     = float3(0.0F, radius, 0.0F) + direction * (prevRayTime + 0.5F * stepSize);
+        float const  sampleRadius = length(position);
+        float const  sampleSunCos = dot(position, sunDirection) / sampleRadius;
+        float3 const density      = AtmosphereDensity(sampleRadius - kPlanetRadius);
+        float3 const rayleigh     = density.x * kRayleigh;
+        float3 const mie          = density.y * kMie;
+        float3 const extinction   = Extinction(density);
+        float3 const sampleTransmittance = exp(-extinction * stepSize);
+        float3 const integral            = (1.0F - sampleTransmittance) / extinction;
+        float3 scattering = (rayleigh * phaseR + mie * phaseM)
+                          * SampleSunTransmittance(transmittanceLut, sampleRadius, sampleSunCos);
+        if (!multiScatteringLut.empty())
+        {
+            scattering += (rayleigh + mie)
+                        * SampleLut(multiScatteringLut, kMultiScatteringLutSize,
+                            MultiScatteringParametersToLut(sampleRadius, sampleSunCos));
+        }
+        luminance   += throughput * scattering * integral;
+        throughput  *= sampleTransmittance;
+        prevRayTime  = rayTime;
+    }
+    return luminance;
+}
+
+std::vector<float3> AtmosphereReference::GenerateTransmittanceLut() noexcept
+{
+    return GenerateLut(kTransmittanceLutSize, [](float2 const &uv) {
+        float2 const parameters = TransmittanceLutToParameters(uv);
+        return IntegrateTransmittance(parameters.x, parameters.y);
+    });
+}
+
+std::vector<float3> AtmosphereReference::GenerateMultiScatteringLut(
+    std::vector<float3> const &transmittanceLut) noexcept
+{
+    return GenerateLut(kMultiScatteringLutSize, [&transmittanceLut](float2 const &uv) {
+        float2 const parameters = MultiScatteringLutToParameters(uv);
+        return IntegrateMultiScattering(transmittanceLut, parameters.x, parameters.y);
+    });
+}
+
+std::vector<float3> AtmosphereReference::GenerateSkyViewLut(std::vector<float3> const &transmittanceLut,
+    std::vector<float3> const &multiScatteringLut, float const radius, float const sunCosZenith) noexcept
+{
+    return GenerateLut(kSkyViewLutSize, [&](float2 const &uv) {
+        float2 const parameters = SkyViewLutToParameters(radius, uv);
+        return IntegrateSkyView(
+            transmittanceLut, multiScatteringLut, radius, parameters.x, parameters.y, sunCosZenith);
+    });
+}
+
+float3 AtmosphereReference::EvaluateSky(std::vector<float3> const &skyViewLut, float const radius,
+    float3 const &direction, float3 const &sunDirection) noexcept
+{
+    float2 const viewHorizontal(direction.x, direction.z);
+    float2 const sunHorizontal(sunDirection.x, sunDirection.z);
+    float const  lengths      = length(viewHorizontal) * length(sunHorizontal);
+    float const  lightViewCos = lengths > 0.0F ? dot(viewHorizontal, sunHorizontal) / lengths : 1.0F;
+    return SampleLut(skyViewLut, kSkyViewLutSize, SkyViewParametersToLut(radius, direction.y, lightViewCos));
+}
+
+float AtmosphereReference::CalculateMaxError(float const height, float3 const &sunDirection) noexcept
+{
+    float const               radius           = kPlanetRadius + height;
+    std::vector<float3> const transmittanceLut = GenerateTransmittanceLut();
+    std::vector<float3> const skyViewLut = GenerateSkyViewLut(transmittanceLut, {}, radius, sunDirection.y);
+
+    // Compare all directions above the horizon, the analytic model does not handle rays hitting the ground
+    constexpr uint32_t elevationCount = 8;
+    constexpr uint32_t azimuthCount   = 8;
+    float3 const       luminance(0.2126F, 0.7152F, 0.0722F);
+    float              maxRadiance = 0.0F;
+    float              maxError    = 0.0F;
+    for (uint32_t i = 0; i < elevationCount; ++i)
+    {
+        float const cosZenith = (static_cast<float>(i) + 0.5F) / static_cast<float>(elevationCount);
+        float const sinZenith = std::sqrt(1.0F - cosZenith * cosZenith);
+        for (uint32_t j = 0; j < azimuthCount; ++j)
+        {
+            float const azimuth = 2.0F * kPi * static_cast<float>(j) / static_cast<float>(azimuthCount);
+            float3 const direction(sinZenith * std::cos(azimuth), cosZenith, sinZenith * std::sin(azimuth));
+            float3 const reference =
+                IntegrateScattering(float3(0.0F, height, 0.0F), direction, sunDirection, 512, 64);
+            float3 const evaluated = EvaluateSky(skyViewLut, radius, direction, sunDirection);
+            maxRadiance            = std::max(maxRadiance, dot(reference, luminance));
+            maxError               = std::max(maxError, std::abs(dot(evaluated - reference, luminance)));
+        }
+    }
+    return maxRadiance > 0.0F ? maxError / maxRadiance : 0.0F;
+}
+} // namespace Capsaicin
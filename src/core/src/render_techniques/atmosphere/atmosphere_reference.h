@@ -0,0 +1,136 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * CPU evaluation of the atmosphere scattering model.
+ * The sky is evaluated on the GPU using precomputed look-up tables (transmittance, multi-scattering and
+ * sky-view) instead of integrating the scattering along every ray of every environment map texel. The
+ * functions here mirror 'atmosphere.hlsl' and 'atmosphere_lut.hlsl' so that the table based evaluation can be
+ * validated against the analytic single scattering model it replaces.
+ * All distances are in metres, the planet centre is located below the origin and positions passed to the
+ * table functions are given as the distance to the planet centre.
+ */
+class AtmosphereReference
+{
+public:
+    static constexpr float kPlanetRadius           = 6371000.0F; /**< Radius of the planet */
+    static constexpr float kAtmosphereHeight       = 100000.0F;  /**< Height of the top of the atmosphere */
+    static constexpr uint2 kTransmittanceLutSize   = {256, 64};  /**< Size of transmittance table */
+    static constexpr uint2 kMultiScatteringLutSize = {32, 32};   /**< Size of multi-scattering table */
+    static constexpr uint2 kSkyViewLutSize         = {192, 108}; /**< Size of sky-view table */
+
+    /**
+     * Integrate the single scattering along a view ray using the analytic model.
+     * @param rayStart                The ray origin.
+     * @param rayDir                  The normalised ray direction.
+     * @param lightDir                The normalised direction towards the sun.
+     * @param sampleCount             Number of samples taken along the view ray.
+     * @param opticalDepthSampleCount Number of samples taken along each ray towards the sun.
+     * @return The scattered radiance for a sun of unit intensity.
+     */
+    [[nodiscard]] static float3 IntegrateScattering(float3 const &rayStart, float3 const &rayDir,
+        float3 const &lightDir, uint32_t sampleCount, uint32_t opticalDepthSampleCount) noexcept;
+
+    /**
+     * Integrate the transmittance between a point and the top of the atmosphere.
+     * @param radius    Distance from the planet centre.
+     * @param cosZenith Cosine of the angle between the ray and the local up vector.
+     * @return The transmittance (not accounting for occlusion by the planet).
+     */
+    [[nodiscard]] static float3 IntegrateTransmittance(float radius, float cosZenith) noexcept;
+
+    /**
+     * Integrate the isotropic multiple scattering contribution at a point.
+     * @param transmittanceLut The transmittance table.
+     * @param radius           Distance from the planet centre.
+     * @param sunCosZenith     Cosine of the angle between the sun and the local up vector.
+     * @return The multiple scattering transfer for a sun of unit intensity.
+     */
+    [[nodiscard]] static float3 IntegrateMultiScattering(
+        std::vector<float3> const &transmittanceLut, float radius, float sunCosZenith) noexcept;
+
+    /**
+     * Integrate the scattering along a view ray using the transmittance and multi-scattering tables.
+     * @param transmittanceLut   The transmittance table.
+     * @param multiScatteringLut The multi-scattering table, if empty only single scattering is evaluated.
+     * @param radius             Distance of the view point from the planet centre.
+     * @param viewCosZenith      Cosine of the angle between the view ray and the local up vector.
+     * @param lightViewCos       Cosine of the azimuth between the view ray and the sun.
+     * @param sunCosZenith       Cosine of the angle between the sun and the local up vector.
+     * @return The scattered radiance for a sun of unit intensity.
+     */
+    [[nodiscard]] static float3 IntegrateSkyView(std::vector<float3> const &transmittanceLut,
+        std::vector<float3> const &multiScatteringLut, float radius, float viewCosZenith, float lightViewCos,
+        float sunCosZenith) noexcept;
+
+    /**
+     * Generate the transmittance table.
+     * @return The table texels stored row major.
+     */
+    [[nodiscard]] static std::vector<float3> GenerateTransmittanceLut() noexcept;
+
+    /**
+     * Generate the multi-scattering table.
+     * @param transmittanceLut The transmittance table.
+     * @return The table texels stored row major.
+     */
+    [[nodiscard]] static std::vector<float3> GenerateMultiScatteringLut(
+        std::vector<float3> const &transmittanceLut) noexcept;
+
+    /**
+     * Generate the sky-view table for a given view height and sun direction.
+     * @param transmittanceLut   The transmittance table.
+     * @param multiScatteringLut The multi-scattering table, if empty only single scattering is evaluated.
+     * @param radius             Distance of the view point from the planet centre.
+     * @param sunCosZenith       Cosine of the angle between the sun and the local up vector.
+     * @return The table texels stored row major.
+     */
+    [[nodiscard]] static std::vector<float3> GenerateSkyViewLut(std::vector<float3> const &transmittanceLut,
+        std::vector<float3> const &multiScatteringLut, float radius, float sunCosZenith) noexcept;
+
+    /**
+     * Evaluate the sky radiance in a given direction by sampling the sky-view table.
+     * @param skyViewLut   The sky-view table.
+     * @param radius       Distance of the view point from the planet centre.
+     * @param direction    The normalised view direction.
+     * @param sunDirection The normalised direction towards the sun.
+     * @return The scattered radiance for a sun of unit intensity.
+     */
+    [[nodiscard]] static float3 EvaluateSky(std::vector<float3> const &skyViewLut, float radius,
+        float3 const &direction, float3 const &sunDirection) noexcept;
+
+    /**
+     * Calculates the largest difference between the analytic and table based single scattering.
+     * @param height       The height of the view point above the planet surface.
+     * @param sunDirection The normalised direction towards the sun, must be above the horizon.
+     * @return The largest error relative to the brightest sky radiance, for all directions above the horizon.
+     */
+    [[nodiscard]] static float CalculateMaxError(float height, float3 const &sunDirection) noexcept;
+};
+} // namespace Capsaicin
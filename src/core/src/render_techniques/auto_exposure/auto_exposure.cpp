@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include "../../components/blue_noise_sampler/blue_noise_sampler.h"
 #include "capsaicin_internal.h"
+#include "color_pyramid/color_pyramid.h"
 
 namespace Capsaicin
 {
@@ -67,6 +68,7 @@ SharedTextureList AutoExposure::getSharedTextures() const noexcept
     SharedTextureList textures;
     textures.push_back({"Color", SharedTexture::Access::Read});
     textures.push_back({"Debug", SharedTexture::Access::Read});
+    textures.push_back({"ColorPyramid", SharedTexture::Access::Read, SharedTexture::Flags::Optional});
     return textures;
 }
 
@@ -118,7 +120,9 @@ void AutoExposure::render(CapsaicinInternal &capsaicin) noexcept
 
     if (options.auto_exposure_enable)
     {
-        GfxTexture input = capsaicin.getSharedTexture("Color");
+        GfxTexture input            = capsaicin.getSharedTexture("Color");
+        uint32_t   inputLevel       = 0;
+        auto       bufferDimensions = capsaicin.getRenderDimensions();
         if (auto const debugView = capsaicin.getCurrentDebugView(); !debugView.empty() && debugView != "None")
         {
             // Operate on the debug buffer if we are using a debug view
@@ -138,11 +142,20 @@ void AutoExposure::render(CapsaicinInternal &capsaicin) noexcept
                 input = capsaicin.getSharedTexture("Debug");
             }
         }
+        else if (capsaicin.hasSharedTexture("ColorPyramid")
+                 && capsaicin.getSharedTexture("ColorPyramid").getMipLevels() > ColorPyramid::kExposureLevel)
+        {
+            // Histogram a low level of the shared pyramid instead of every pixel. Box filtering removes
+            // isolated outliers so the key luminance is slightly biased towards the local mean, which is
+            // well below the precision of the 64 bin histogram for typical scenes
+            input            = capsaicin.getSharedTexture("ColorPyramid");
+            inputLevel       = ColorPyramid::kExposureLevel;
+            bufferDimensions = glm::max(bufferDimensions >> inputLevel, uint2(1));
+        }
 
-        auto const  bufferDimensions = capsaicin.getRenderDimensions();
-        auto const &exposureBuffer   = capsaicin.getSharedBuffer("Exposure");
+        auto const &exposureBuffer = capsaicin.getSharedBuffer("Exposure");
         gfxProgramSetParameter(gfx_, exposureProgram, "g_BufferDimensions", bufferDimensions);
-        gfxProgramSetParameter(gfx_, exposureProgram, "g_InputBuffer", input);
+        gfxProgramSetTexture(gfx_, exposureProgram, "g_InputBuffer", input, inputLevel);
         gfxProgramSetParameter(gfx_, exposureProgram, "g_Exposure", exposureBuffer);
 
         // Calculate scene key luminance
@@ -194,8 +207,7 @@ void AutoExposure::render(CapsaicinInternal &capsaicin) noexcept
         TimedSection const timed_section(*this, "ExposureUpload");
         float              combinedExposure = options.auto_exposure_value;
         combinedExposure                    = glm::max(combinedExposure, 0.0001F);
-        GfxBuffer const uploadBuffer =
-            gfxCreateBuffer<float>(gfx_, 1, &combinedExposure, kGfxCpuAccess_Write);
+        GfxBuffer const uploadBuffer = capsaicin.allocateConstantBuffer<float>(&combinedExposure, 1);
         gfxCommandCopyBuffer(gfx_, capsaicin.getSharedBuffer("Exposure"), uploadBuffer);
         gfxDestroyBuffer(gfx_, uploadBuffer);
     }
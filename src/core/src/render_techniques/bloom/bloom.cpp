@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include "bloom.h"
 
 #include "capsaicin_internal.h"
+#include "color_pyramid/color_pyramid.h"
 #include "components/blue_noise_sampler/blue_noise_sampler.h"
 #define FFX_CPU
 #include <FidelityFX/gpu/blur/ffx_blur.h>
@@ -71,6 +72,7 @@ SharedTextureList Bloom::getSharedTextures() const noexcept
     textures.push_back({.name = "ColorScaled",
         .access               = SharedTexture::Access::ReadWrite,
         .flags                = SharedTexture::Flags::OptionalDiscard});
+    textures.push_back({.name = "ColorPyramid", .flags = SharedTexture::Flags::Optional});
     return textures;
 }
 
@@ -174,7 +176,18 @@ void Bloom::render(CapsaicinInternal &capsaicin) noexcept
         gfxProgramSetParameter(gfx_, blurProgram, "g_BufferDimensions", blurDimensions);
         gfxProgramSetParameter(gfx_, blurProgram, "g_InvBufferDimensions",
             float2(1.0F, 1.0F) / static_cast<float2>(blurDimensions));
-        gfxProgramSetTexture(gfx_, blurProgram, "g_InputBuffer", input);
+        if (!usesScaling && capsaicin.hasSharedTexture("ColorPyramid")
+            && capsaicin.getSharedTexture("ColorPyramid").getMipLevels() > ColorPyramid::kExposureLevel)
+        {
+            // The shared pyramid already holds the half resolution input filtered identically to sampling
+            // the full resolution image, so read it instead to avoid fetching the full image again
+            gfxProgramSetTexture(gfx_, blurProgram, "g_InputBuffer",
+                capsaicin.getSharedTexture("ColorPyramid"), ColorPyramid::kBloomLevel);
+        }
+        else
+        {
+            gfxProgramSetTexture(gfx_, blurProgram, "g_InputBuffer", input);
+        }
         gfxProgramSetTexture(gfx_, blurProgram, "g_OutputBuffer", bloomTexture, 0);
         gfxProgramSetParameter(gfx_, blurProgram, "g_LinearClampSampler", capsaicin.getLinearSampler());
         gfxProgramSetParameter(gfx_, blurProgram, "g_Exposure", capsaicin.getSharedBuffer("Exposure"));
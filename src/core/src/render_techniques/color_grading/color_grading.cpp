@@ -21,6 +21,7 @@ THE SOFTWARE.
 ********************************************************************/
 #include "color_grading.h"
 
+#include "../../components/post_process_chain/post_process_chain.h"
 #include "capsaicin_internal.h"
 
 #include <fstream>
@@ -128,6 +129,13 @@ ColorGrading::RenderOptions ColorGrading::convertOptions(RenderOptionList const
     return newOptions;
 }
 
+ComponentList ColorGrading::getComponents() const noexcept
+{
+    ComponentList components;
+    components.emplace_back(COMPONENT_MAKE(PostProcessChain));
+    return components;
+}
+
 SharedTextureList ColorGrading::getSharedTextures() const noexcept
 {
     SharedTextureList textures;
@@ -140,6 +148,8 @@ SharedTextureList ColorGrading::getSharedTextures() const noexcept
 
 bool ColorGrading::init(CapsaicinInternal const &capsaicin) noexcept
 {
+    capsaicin.getComponent<PostProcessChain>()->registerStage(PostProcessChain::Slot::ColorGrading);
+
     options_ = convertOptions(capsaicin.getOptions());
     if (options_.color_grading_enable)
     {
@@ -165,7 +175,8 @@ bool ColorGrading::init(CapsaicinInternal const &capsaicin) noexcept
 
 void ColorGrading::render(CapsaicinInternal &capsaicin) noexcept
 {
-    auto options = convertOptions(capsaicin.getOptions());
+    auto       options            = convertOptions(capsaicin.getOptions());
+    auto const post_process_chain = capsaicin.getComponent<PostProcessChain>();
 
     if (!options.color_grading_enable)
     {
@@ -180,6 +191,7 @@ void ColorGrading::render(CapsaicinInternal &capsaicin) noexcept
             }
         }
         options_ = options;
+        post_process_chain->skip(capsaicin, PostProcessChain::Slot::ColorGrading);
         return;
     }
 
@@ -260,6 +272,7 @@ void ColorGrading::render(CapsaicinInternal &capsaicin) noexcept
 
     if (!lut_buffer_)
     {
+        post_process_chain->skip(capsaicin, PostProcessChain::Slot::ColorGrading);
         return;
     }
 
@@ -270,6 +283,7 @@ void ColorGrading::render(CapsaicinInternal &capsaicin) noexcept
         {
             lut_buffer_user_selected = false;
             terminate();
+            post_process_chain->skip(capsaicin, PostProcessChain::Slot::ColorGrading);
             return;
         }
     }
@@ -278,15 +292,26 @@ void ColorGrading::render(CapsaicinInternal &capsaicin) noexcept
                           && capsaicin.hasOption<bool>("taa_enable")
                           && capsaicin.getOption<bool>("taa_enable");
 
-    GfxTexture const &color_buffer =
-        !usesScaling ? capsaicin.getSharedTexture("Color") : capsaicin.getSharedTexture("ColorScaled");
     auto const bufferDimensions =
         !usesScaling ? capsaicin.getRenderDimensions() : capsaicin.getWindowDimensions();
 
-    gfxProgramSetParameter(gfx_, color_grading_program_, "g_ColorBuffer", color_buffer);
+    // Try and fuse with any neighbouring post-processing operators
+    PostProcessChain::Stage stage {.slot = PostProcessChain::Slot::ColorGrading,
+        .buffer                          = !usesScaling ? "Color" : "ColorScaled",
+        .dimensions                      = bufferDimensions,
+        .bind = [this](CapsaicinInternal const &context, GfxProgram const &program) {
+            addProgramParameters(context, program);
+        }};
+    if (post_process_chain->fuse(capsaicin, std::move(stage)))
+    {
+        return;
+    }
+
+    GfxTexture const &color_buffer =
+        !usesScaling ? capsaicin.getSharedTexture("Color") : capsaicin.getSharedTexture("ColorScaled");
 
-    gfxProgramSetParameter(gfx_, color_grading_program_, "g_LutBuffer", lut_buffer_);
-    gfxProgramSetParameter(gfx_, color_grading_program_, "g_LutSampler", capsaicin.getLinearSampler());
+    gfxProgramSetParameter(gfx_, color_grading_program_, "g_ColorBuffer", color_buffer);
+    addProgramParameters(capsaicin, color_grading_program_);
 
     uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, apply_kernel_);
     uint32_t const  num_groups_x = (bufferDimensions.x + num_threads[0] - 1) / num_threads[0];
@@ -296,6 +321,13 @@ void ColorGrading::render(CapsaicinInternal &capsaicin) noexcept
     gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
 }
 
+void ColorGrading::addProgramParameters(
+    CapsaicinInternal const &capsaicin, GfxProgram const &program) const noexcept
+{
+    gfxProgramSetParameter(gfx_, program, "g_LutBuffer", lut_buffer_);
+    gfxProgramSetParameter(gfx_, program, "g_LutSampler", capsaicin.getLinearSampler());
+}
+
 void ColorGrading::renderGUI(CapsaicinInternal &capsaicin) const noexcept
 {
     bool &enabled = capsaicin.getOption<bool>("color_grading_enable");
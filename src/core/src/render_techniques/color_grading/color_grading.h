@@ -55,6 +55,12 @@ class ColorGrading final : public RenderTechnique
      */
     static RenderOptions convertOptions(RenderOptionList const &options) noexcept;
 
+    /**
+     * Gets a list of any shared components used by the current render technique.
+     * @return A list of all supported components.
+     */
+    [[nodiscard]] ComponentList getComponents() const noexcept override;
+
     /**
      * Gets the required list of shared textures needed for the current render technique.
      * @return A list of all required shared textures.
@@ -103,6 +109,13 @@ class ColorGrading final : public RenderTechnique
      */
     [[nodiscard]] static std::string getSceneLUTFile(CapsaicinInternal const &capsaicin) noexcept;
 
+    /**
+     * Add the colour grading parameters to a program.
+     * @param capsaicin Current framework context.
+     * @param program   The shader program to bind parameters to.
+     */
+    void addProgramParameters(CapsaicinInternal const &capsaicin, GfxProgram const &program) const noexcept;
+
     RenderOptions options_;    //
     GfxTexture    lut_buffer_; //
     bool          lut_buffer_user_selected = true;
@@ -20,7 +20,20 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 ********************************************************************/
 
-float4 PrefilterIBL(in uint idx : SV_VertexID) : SV_Position
+#ifndef COLOR_GRADING_HLSL
+#define COLOR_GRADING_HLSL
+
+Texture3D    g_LutBuffer;
+SamplerState g_LutSampler;
+
+/**
+ * Apply the colour grading LUT to a colour value.
+ * @param color Input display referred colour value.
+ * @return The graded colour.
+ */
+float3 ColorGrade(float3 color)
 {
-    return 1.0f - float4(4.0f * (idx & 1), 4.0f * (idx >> 1), 1.0f, 0.0f);
+    return g_LutBuffer.SampleLevel(g_LutSampler, color, 0.0f).xyz;
 }
+
+#endif // COLOR_GRADING_HLSL
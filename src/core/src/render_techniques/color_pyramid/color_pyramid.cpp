@@ -0,0 +1,105 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "color_pyramid.h"
+
+#include "capsaicin_internal.h"
+
+namespace Capsaicin
+{
+ColorPyramid::ColorPyramid()
+    : RenderTechnique("Color Pyramid")
+{}
+
+ColorPyramid::~ColorPyramid()
+{
+    ColorPyramid::terminate();
+}
+
+SharedTextureList ColorPyramid::getSharedTextures() const noexcept
+{
+    SharedTextureList textures;
+    textures.push_back({.name = "Color", .access = SharedTexture::Access::Read});
+    textures.push_back({.name = "ColorPyramid",
+        .access               = SharedTexture::Access::Write,
+        .format               = DXGI_FORMAT_R16G16B16A16_FLOAT,
+        .mips                 = true});
+    return textures;
+}
+
+bool ColorPyramid::init(CapsaicinInternal const &capsaicin) noexcept
+{
+    pyramidProgram   = capsaicin.createProgram("render_techniques/color_pyramid/color_pyramid");
+    downsampleKernel = gfxCreateComputeKernel(gfx_, pyramidProgram, "DownsampleTwoLevels");
+    return !!downsampleKernel;
+}
+
+void ColorPyramid::render(CapsaicinInternal &capsaicin) noexcept
+{
+    // Only build the pyramid when one of its consumers is active, bloom falls back to its own input when
+    // operating on the upscaled output
+    bool const usesScaling = capsaicin.hasSharedTexture("ColorScaled")
+                          && capsaicin.hasOption<bool>("taa_enable")
+                          && capsaicin.getOption<bool>("taa_enable");
+    bool const bloom = capsaicin.hasOption<bool>("bloom_enable") && capsaicin.getOption<bool>("bloom_enable")
+                    && !usesScaling;
+    bool const exposure = capsaicin.hasOption<bool>("auto_exposure_enable")
+                       && capsaicin.getOption<bool>("auto_exposure_enable");
+    if (!bloom && !exposure)
+    {
+        return;
+    }
+
+    auto const &pyramid = capsaicin.getSharedTexture("ColorPyramid");
+    if (pyramid.getMipLevels() <= kExposureLevel)
+    {
+        // Render resolution is too small to hold the required levels
+        return;
+    }
+
+    auto const renderDimensions = capsaicin.getRenderDimensions();
+    auto const levelDimensions  = glm::max(renderDimensions >> kBloomLevel, uint2(1));
+
+    TimedSection const timed_section(*this, "BuildPyramid");
+    gfxProgramSetParameter(gfx_, pyramidProgram, "g_BufferDimensions", levelDimensions);
+    gfxProgramSetParameter(gfx_, pyramidProgram, "g_InvBufferDimensions",
+        float2(1.0F, 1.0F) / static_cast<float2>(levelDimensions));
+    gfxProgramSetTexture(gfx_, pyramidProgram, "g_InputBuffer", capsaicin.getSharedTexture("Color"));
+    gfxProgramSetTexture(gfx_, pyramidProgram, "g_OutputBuffer", pyramid, kBloomLevel);
+    gfxProgramSetTexture(gfx_, pyramidProgram, "g_OutputBuffer2", pyramid, kExposureLevel);
+    gfxProgramSetParameter(gfx_, pyramidProgram, "g_LinearClampSampler", capsaicin.getLinearSampler());
+
+    uint32_t const *numThreads = gfxKernelGetNumThreads(gfx_, downsampleKernel);
+    uint32_t const  numGroupsX = (levelDimensions.x + numThreads[0] - 1) / numThreads[0];
+    uint32_t const  numGroupsY = (levelDimensions.y + numThreads[1] - 1) / numThreads[1];
+    gfxCommandBindKernel(gfx_, downsampleKernel);
+    gfxCommandDispatch(gfx_, numGroupsX, numGroupsY, 1);
+}
+
+void ColorPyramid::terminate() noexcept
+{
+    gfxDestroyKernel(gfx_, downsampleKernel);
+    downsampleKernel = {};
+    gfxDestroyProgram(gfx_, pyramidProgram);
+    pyramidProgram = {};
+}
+} // namespace Capsaicin
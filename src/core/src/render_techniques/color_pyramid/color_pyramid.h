@@ -0,0 +1,83 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#pragma once
+
+#include "render_technique.h"
+
+namespace Capsaicin
+{
+/**
+ * Builds a downsampled HDR pyramid of the current frame colour that is shared between post-processing
+ * techniques. Mip 1 is a 2x2 box filter of 'Color' and mip 2 is a 2x2 box filter of mip 1, both are generated
+ * in a single pass so that the full resolution image is only read once.
+ * Shared textures with mips always hold the full chain, but only mips 1 (kBloomLevel) and 2 (kExposureLevel)
+ * ever contain valid data. Mip 0 and mips 3+ are never written as consumers read 'Color' directly and bloom
+ * builds its deeper levels itself. Mips 1 and 2 are only written in frames where bloom (without TAA writing
+ * to 'ColorScaled') or auto exposure is enabled and the render resolution has at least 3 mips, in any other
+ * frame the pyramid holds stale data and must not be read.
+ */
+class ColorPyramid final : public RenderTechnique
+{
+public:
+    ColorPyramid();
+    ~ColorPyramid() override;
+
+    ColorPyramid(ColorPyramid const &other)                = delete;
+    ColorPyramid(ColorPyramid &&other) noexcept            = delete;
+    ColorPyramid &operator=(ColorPyramid const &other)     = delete;
+    ColorPyramid &operator=(ColorPyramid &&other) noexcept = delete;
+
+    static constexpr uint32_t kBloomLevel    = 1; /**< Pyramid level read by the first bloom blur pass */
+    static constexpr uint32_t kExposureLevel = 2; /**< Pyramid level histogrammed by auto exposure */
+
+    /**
+     * Gets the required list of shared textures needed for the current render technique.
+     * @return A list of all required shared textures.
+     */
+    [[nodiscard]] SharedTextureList getSharedTextures() const noexcept override;
+
+    /**
+     * Initialise any internal data or state.
+     * @note This is automatically called by the framework after construction and should be used to create
+     * any required CPU|GPU resources.
+     * @param capsaicin Current framework context.
+     * @return True if initialisation succeeded, False otherwise.
+     */
+    bool init(CapsaicinInternal const &capsaicin) noexcept override;
+
+    /**
+     * Perform render operations.
+     * @param [in,out] capsaicin The current capsaicin context.
+     */
+    void render(CapsaicinInternal &capsaicin) noexcept override;
+
+    /**
+     * Destroy any used internal resources and shutdown.
+     */
+    void terminate() noexcept override;
+
+protected:
+    GfxProgram pyramidProgram;
+    GfxKernel  downsampleKernel;
+};
+} // namespace Capsaicin
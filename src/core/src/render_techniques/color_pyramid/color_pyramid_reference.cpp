@@ -0,0 +1,128 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "color_pyramid_reference.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Capsaicin
+{
+namespace
+{
+float3 Load(
+    std::vector<float3> const &image, uint2 const &dimensions, int32_t const x, int32_t const y) noexcept
+{
+    // Clamp to edge to match the linear clamp sampler
+    auto const clampedX = static_cast<uint32_t>(std::clamp(x, 0, static_cast<int32_t>(dimensions.x) - 1));
+    auto const clampedY = static_cast<uint32_t>(std::clamp(y, 0, static_cast<int32_t>(dimensions.y) - 1));
+    return image[static_cast<size_t>(clampedY) * dimensions.x + clampedX];
+}
+
+float3 SampleBilinear(std::vector<float3> const &image, uint2 const &dimensions, float2 const &uv) noexcept
+{
+    float const   x  = uv.x * static_cast<float>(dimensions.x) - 0.5F;
+    float const   y  = uv.y * static_cast<float>(dimensions.y) - 0.5F;
+    float const   fx = std::floor(x);
+    float const   fy = std::floor(y);
+    float const   wx = x - fx;
+    float const   wy = y - fy;
+    int32_t const ix = static_cast<int32_t>(fx);
+    int32_t const iy = static_cast<int32_t>(fy);
+    float3 const  top =
+        Load(image, dimensions, ix, iy) * (1.0F - wx) + Load(image, dimensions, ix + 1, iy) * wx;
+    float3 const bottom =
+        Load(image, dimensions, ix, iy + 1) * (1.0F - wx) + Load(image, dimensions, ix + 1, iy + 1) * wx;
+    return top * (1.0F - wy) + bottom * wy;
+}
+} // namespace
+
+std::vector<float3> ColorPyramidReference::Downsample(
+    std::vector<float3> const &image, uint2 const &dimensions) noexcept
+{
+    uint2 const         outDimensions = LevelDimensions(dimensions, 1);
+    float2 const        invDimensions = float2(1.0F, 1.0F) / static_cast<float2>(outDimensions);
+    std::vector<float3> ret(static_cast<size_t>(outDimensions.x) * outDimensions.y);
+    for (uint32_t y = 0; y < outDimensions.y; ++y)
+    {
+        for (uint32_t x = 0; x < outDimensions.x; ++x)
+        {
+            float2 const uv = (float2(static_cast<float>(x), static_cast<float>(y)) + 0.5F) * invDimensions;
+            ret[static_cast<size_t>(y) * outDimensions.x + x] = SampleBilinear(image, dimensions, uv);
+        }
+    }
+    return ret;
+}
+
+std::vector<float3> ColorPyramidReference::BoxDownsample(
+    std::vector<float3> const &image, uint2 const &dimensions) noexcept
+{
+    uint2 const         outDimensions = LevelDimensions(dimensions, 1);
+    std::vector<float3> ret(static_cast<size_t>(outDimensions.x) * outDimensions.y);
+    for (uint32_t y = 0; y < outDimensions.y; ++y)
+    {
+        for (uint32_t x = 0; x < outDimensions.x; ++x)
+        {
+            auto const sx = static_cast<int32_t>(x * 2);
+            auto const sy = static_cast<int32_t>(y * 2);
+            ret[static_cast<size_t>(y) * outDimensions.x + x] =
+                0.25F
+                * (Load(image, dimensions, sx, sy) + Load(image, dimensions, sx + 1, sy)
+                    + Load(image, dimensions, sx, sy + 1) + Load(image, dimensions, sx + 1, sy + 1));
+        }
+    }
+    return ret;
+}
+
+std::vector<std::vector<float3>> ColorPyramidReference::Generate(
+    std::vector<float3> const &image, uint2 const &dimensions) noexcept
+{
+    std::vector<std::vector<float3>> levels;
+    levels.push_back(image);
+    levels.push_back(Downsample(image, dimensions));
+    levels.push_back(BoxDownsample(levels[1], LevelDimensions(dimensions, 1)));
+    return levels;
+}
+
+float3 ColorPyramidReference::AreaAverage(std::vector<float3> const &image, uint2 const &dimensions,
+    uint32_t const level, uint2 const &coord) noexcept
+{
+    uint32_t const footprint = 1U << level;
+    uint2 const    start     = glm::min(coord * footprint, dimensions - 1U);
+    uint2 const    end       = glm::min(start + footprint, dimensions);
+    float3         sum(0.0F);
+    for (uint32_t y = start.y; y < end.y; ++y)
+    {
+        for (uint32_t x = start.x; x < end.x; ++x)
+        {
+            sum += image[static_cast<size_t>(y) * dimensions.x + x];
+        }
+    }
+    uint2 const count = end - start;
+    return sum / static_cast<float>(count.x * count.y);
+}
+
+uint2 ColorPyramidReference::LevelDimensions(uint2 const &dimensions, uint32_t const level) noexcept
+{
+    return glm::max(uint2(dimensions.x >> level, dimensions.y >> level), uint2(1));
+}
+} // namespace Capsaicin
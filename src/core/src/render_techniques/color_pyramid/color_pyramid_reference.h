@@ -0,0 +1,87 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * CPU evaluation of the shared colour pyramid.
+ * The functions here mirror the filtering performed by 'color_pyramid.comp' (a bilinear fetch at the corner
+ * shared by 4 texels followed by a 2x2 average of the result) so that the generated levels can be compared
+ * against an exact area average of the full resolution image.
+ * All images are stored row major with a single float3 per pixel.
+ */
+class ColorPyramidReference
+{
+public:
+    /**
+     * Downsample an image to half resolution using the same bilinear fetch as the GPU kernel.
+     * @param image      The source image.
+     * @param dimensions The source image dimensions.
+     * @return The downsampled image with dimensions max(dimensions / 2, 1).
+     */
+    [[nodiscard]] static std::vector<float3> Downsample(
+        std::vector<float3> const &image, uint2 const &dimensions) noexcept;
+
+    /**
+     * Downsample an image to half resolution by averaging each 2x2 quad of texels.
+     * @param image      The source image.
+     * @param dimensions The source image dimensions.
+     * @return The downsampled image with dimensions max(dimensions / 2, 1).
+     */
+    [[nodiscard]] static std::vector<float3> BoxDownsample(
+        std::vector<float3> const &image, uint2 const &dimensions) noexcept;
+
+    /**
+     * Generate the pyramid levels written on the GPU.
+     * @param image      The full resolution image.
+     * @param dimensions The full resolution image dimensions.
+     * @return The list of levels, level 0 is a copy of the input image.
+     */
+    [[nodiscard]] static std::vector<std::vector<float3>> Generate(
+        std::vector<float3> const &image, uint2 const &dimensions) noexcept;
+
+    /**
+     * Calculate the exact average of all full resolution pixels covered by a pyramid texel.
+     * @param image      The full resolution image.
+     * @param dimensions The full resolution image dimensions.
+     * @param level      The pyramid level.
+     * @param coord      The texel coordinate within the pyramid level.
+     * @return The area average, matches the generated pyramid for power of 2 image dimensions.
+     */
+    [[nodiscard]] static float3 AreaAverage(std::vector<float3> const &image, uint2 const &dimensions,
+        uint32_t level, uint2 const &coord) noexcept;
+
+    /**
+     * Get the dimensions of a pyramid level.
+     * @param dimensions The full resolution image dimensions.
+     * @param level      The pyramid level.
+     * @return The level dimensions.
+     */
+    [[nodiscard]] static uint2 LevelDimensions(uint2 const &dimensions, uint32_t level) noexcept;
+};
+} // namespace Capsaicin
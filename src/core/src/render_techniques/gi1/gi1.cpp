@@ -28,6 +28,10 @@ THE SOFTWARE.
 #include "components/light_sampler_grid_stream/light_sampler_grid_stream.h"
 #include "components/prefilter_ibl/prefilter_ibl.h"
 #include "components/random_number_generator/random_number_generator.h"
+#include "hash_reduce.h"
+
+#include <algorithm>
+#include <bit>
 
 namespace Capsaicin
 {
@@ -85,9 +89,14 @@ GI1::ScreenProbes::~ScreenProbes()
     }
     gfxDestroyBuffer(gfx_, probe_spawn_scan_buffer_);
     gfxDestroyBuffer(gfx_, probe_spawn_index_buffer_);
+    gfxDestroyBuffer(gfx_, probe_spawn_extra_scan_buffer_);
+    gfxDestroyBuffer(gfx_, probe_spawn_extra_index_buffer_);
     gfxDestroyBuffer(gfx_, probe_spawn_probe_buffer_);
     gfxDestroyBuffer(gfx_, probe_spawn_sample_buffer_);
     gfxDestroyBuffer(gfx_, probe_spawn_radiance_buffer_);
+    gfxDestroyBuffer(gfx_, probe_ray_key_buffer_);
+    gfxDestroyBuffer(gfx_, probe_ray_index_buffer_);
+    gfxDestroyBuffer(gfx_, probe_ray_count_buffer_);
     gfxDestroyBuffer(gfx_, probe_empty_tile_buffer_);
     gfxDestroyBuffer(gfx_, probe_empty_tile_count_buffer_);
     gfxDestroyBuffer(gfx_, probe_override_tile_buffer_);
@@ -108,6 +117,10 @@ GI1::ScreenProbes::~ScreenProbes()
     gfxDestroyBuffer(gfx_, probe_cached_tile_list_index_buffer_);
     gfxDestroyBuffer(gfx_, probe_cached_tile_list_element_buffer_);
     gfxDestroyBuffer(gfx_, probe_cached_tile_list_element_count_buffer_);
+    for (GfxBuffer const &probe_spawn_count_readback_buffer : probe_spawn_count_readback_buffers_)
+    {
+        gfxDestroyBuffer(gfx_, probe_spawn_count_readback_buffer);
+    }
 }
 
 void GI1::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsaicin)
@@ -184,7 +197,11 @@ void GI1::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsaic
         }
     }
 
-    if (probe_sh_buffers_->getCount() != 9 * max_probe_count)
+    // Packed storage keeps each SH coefficient in a single uint using a shared exponent
+    uint32_t const probe_sh_stride =
+        self.options_.gi1_use_packed_storage ? sizeof(uint32_t) : static_cast<uint32_t>(sizeof(uint2));
+    if (probe_sh_buffers_->getCount() != 9 * max_probe_count
+        || probe_sh_buffers_->getStride() != probe_sh_stride)
     {
         for (GfxBuffer const &probe_sh_buffer : probe_sh_buffers_)
         {
@@ -196,7 +213,9 @@ void GI1::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsaic
             char buffer[64];
             GFX_SNPRINTF(buffer, sizeof(buffer), "GI1_ProbeSHBuffer%u", i);
 
-            probe_sh_buffers_[i] = gfxCreateBuffer<uint2>(gfx_, 9 * max_probe_count);
+            probe_sh_buffers_[i] = self.options_.gi1_use_packed_storage
+                                     ? gfxCreateBuffer<uint32_t>(gfx_, 9 * max_probe_count)
+                                     : gfxCreateBuffer<uint2>(gfx_, 9 * max_probe_count);
             probe_sh_buffers_[i].setName(buffer);
         }
     }
@@ -209,9 +228,13 @@ void GI1::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsaic
         }
         gfxDestroyBuffer(gfx_, probe_spawn_scan_buffer_);
         gfxDestroyBuffer(gfx_, probe_spawn_index_buffer_);
+        gfxDestroyBuffer(gfx_, probe_spawn_extra_scan_buffer_);
+        gfxDestroyBuffer(gfx_, probe_spawn_extra_index_buffer_);
         gfxDestroyBuffer(gfx_, probe_spawn_probe_buffer_);
         gfxDestroyBuffer(gfx_, probe_spawn_sample_buffer_);
         gfxDestroyBuffer(gfx_, probe_spawn_radiance_buffer_);
+        gfxDestroyBuffer(gfx_, probe_ray_key_buffer_);
+        gfxDestroyBuffer(gfx_, probe_ray_index_buffer_);
         gfxDestroyBuffer(gfx_, probe_override_tile_buffer_);
 
         for (uint32_t i = 0; i < ARRAYSIZE(probe_spawn_buffers_); ++i)
@@ -229,6 +252,12 @@ void GI1::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsaic
         probe_spawn_index_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_probe_spawn_count);
         probe_spawn_index_buffer_.setName("GI1_ProbeSpawnIndexBuffer");
 
+        probe_spawn_extra_scan_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_probe_spawn_count);
+        probe_spawn_extra_scan_buffer_.setName("GI1_ProbeSpawnExtraScanBuffer");
+
+        probe_spawn_extra_index_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_probe_spawn_count);
+        probe_spawn_extra_index_buffer_.setName("GI1_ProbeSpawnExtraIndexBuffer");
+
         probe_spawn_probe_buffer_ = gfxCreateBuffer<uint2>(gfx_, max_probe_spawn_count);
         probe_spawn_probe_buffer_.setName("GI1_ProbeSpawnProbeBuffer");
 
@@ -238,10 +267,22 @@ void GI1::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsaic
         probe_spawn_radiance_buffer_ = gfxCreateBuffer<uint2>(gfx_, max_ray_count);
         probe_spawn_radiance_buffer_.setName("GI1_ProbeSpawnRadianceBuffer");
 
+        probe_ray_key_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_ray_count);
+        probe_ray_key_buffer_.setName("GI1_ProbeRayKeyBuffer");
+
+        probe_ray_index_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_ray_count);
+        probe_ray_index_buffer_.setName("GI1_ProbeRayIndexBuffer");
+
         probe_override_tile_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_probe_spawn_count);
         probe_override_tile_buffer_.setName("GI1_ProbeOverrideTileBuffer");
     }
 
+    if (!probe_ray_count_buffer_)
+    {
+        probe_ray_count_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, 1);
+        probe_ray_count_buffer_.setName("GI1_ProbeRayCountBuffer");
+    }
+
     if (probe_empty_tile_buffer_.getCount() != max_probe_count)
     {
         gfxDestroyBuffer(gfx_, probe_empty_tile_buffer_);
@@ -266,6 +307,21 @@ void GI1::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsaic
         probe_override_tile_count_buffer_.setName("GI1_ProbeOverrideTileCountBuffer");
     }
 
+    if (!probe_spawn_count_readback_buffers_->getCount())
+    {
+        for (uint32_t i = 0; i < ARRAYSIZE(probe_spawn_count_readback_buffers_); ++i)
+        {
+            char buffer[64];
+            GFX_SNPRINTF(buffer, sizeof(buffer), "GI1_ProbeSpawnCountReadbackBuffer%u", i);
+
+            // Base and extra probe scan totals, each one being stored as the last scan and index values
+            probe_spawn_count_readback_buffers_[i] =
+                gfxCreateBuffer<uint32_t>(gfx_, 4, nullptr, kGfxCpuAccess_Read);
+            probe_spawn_count_readback_buffers_[i].setName(buffer);
+            probe_spawn_count_readback_is_pending_[i] = false;
+        }
+    }
+
     if (probe_cached_tile_buffer_.getWidth() != probe_buffer_width
         || probe_cached_tile_buffer_.getHeight() != probe_buffer_height)
     {
@@ -479,6 +535,7 @@ void GI1::HashGridCache::ensureMemoryIsAllocated(
         radiance_cache_decay_tile_buffer_.setName("GI1_RadianceCache_DecayTileBuffer");
 
         gfxCommandClearBuffer(gfx_, radiance_cache_hash_buffer_); // clear the radiance cache
+        needs_file_load_ = true;
     }
 
     debug_total_memory_size_in_bytes += radiance_cache_hash_buffer_.getSize();
@@ -704,7 +761,7 @@ void GI1::HashGridCache::ensureMemoryIsAllocated(
         radiance_cache_multibounce_info_buffer_ = {};
     }
 
-    if (options.gi1_hash_grid_cache_debug_stats)
+    if (options.gi1_hash_grid_cache_debug_stats || options.gi1_hash_grid_cache_auto_size)
     {
         if (!radiance_cache_debug_stats_free_bucket_buffer_)
         {
@@ -839,6 +896,142 @@ void GI1::HashGridCache::ensureMemoryIsAllocated(
     debug_total_memory_size_in_bytes_      = debug_total_memory_size_in_bytes;
 }
 
+HashGridCacheFile::Layout GI1::HashGridCache::getFileLayout(
+    CapsaicinInternal const &capsaicin, RenderOptions const &options) const
+{
+    // Tile keys are world-space positions, so only reuse a cache for the same geometry and materials
+    GfxScene const scene = capsaicin.getScene();
+    size_t const   mesh_hash =
+        HashReduce(gfxSceneGetObjects<GfxMesh>(scene), gfxSceneGetObjectCount<GfxMesh>(scene));
+    size_t const material_hash =
+        HashReduce(gfxSceneGetObjects<GfxMaterial>(scene), gfxSceneGetObjectCount<GfxMaterial>(scene));
+
+    HashGridCacheFile::Layout layout = {};
+    layout.scene_hash                = HashCombine(mesh_hash, material_hash);
+    layout.num_buckets               = num_buckets_;
+    layout.num_tiles_per_bucket      = num_tiles_per_bucket_;
+    layout.num_cells_per_tile        = num_cells_per_tile_;
+    layout.flags                     = 0;
+    if (options.gi1_use_multibounce)
+    {
+        layout.flags |= HashGridCacheFile::kFlag_UseMultibounce;
+    }
+    if (options.gi1_hash_grid_cache_use_cuckoo_hashing)
+    {
+        layout.flags |= HashGridCacheFile::kFlag_UseCuckooHashing;
+    }
+    // Use the resolution independent grid parameters, the actual cell size also depends on the camera field
+    // of view and the render resolution which must not invalidate the file
+    layout.cell_size       = options.gi1_hash_grid_cache_cell_size;
+    layout.min_cell_size   = options.gi1_hash_grid_cache_min_cell_size;
+    layout.tile_cell_ratio = options.gi1_hash_grid_cache_tile_cell_ratio;
+    return layout;
+}
+
+std::filesystem::path GI1::HashGridCache::GetFilePath(
+    CapsaicinInternal const &capsaicin, HashGridCacheFile::Layout const &layout)
+{
+    auto const &scenes = capsaicin.getCurrentScenes();
+    if (scenes.empty())
+    {
+        return {};
+    }
+    char scene_hash[17];
+    GFX_SNPRINTF(
+        scene_hash, sizeof(scene_hash), "%016llx", static_cast<unsigned long long>(layout.scene_hash));
+    auto file_path = scenes[0];
+    file_path.replace_filename(file_path.stem().string() + '_' + scene_hash + ".gi1cache");
+    return file_path;
+}
+
+bool GI1::HashGridCache::saveToFile(
+    std::filesystem::path const &file_path, HashGridCacheFile::Layout const &layout) const
+{
+    if (file_path.empty() || !radiance_cache_hash_buffer_)
+    {
+        return false;
+    }
+
+    bool const      use_multibounce = (layout.flags & HashGridCacheFile::kFlag_UseMultibounce) != 0;
+    GfxBuffer const hash_readback_buffer =
+        gfxCreateBuffer<uint32_t>(gfx_, num_tiles_, nullptr, kGfxCpuAccess_Read);
+    GfxBuffer const value_readback_buffer =
+        gfxCreateBuffer<uint2>(gfx_, num_cells_, nullptr, kGfxCpuAccess_Read);
+    GfxBuffer indirect_value_readback_buffer;
+    gfxCommandCopyBuffer(gfx_, hash_readback_buffer, radiance_cache_hash_buffer_);
+    gfxCommandCopyBuffer(gfx_, value_readback_buffer, radiance_cache_value_buffer_);
+    if (use_multibounce)
+    {
+        indirect_value_readback_buffer =
+            gfxCreateBuffer<uint2>(gfx_, num_cells_, nullptr, kGfxCpuAccess_Read);
+        gfxCommandCopyBuffer(gfx_, indirect_value_readback_buffer, radiance_cache_value_indirect_buffer_);
+    }
+    gfxFinish(gfx_); // flush & sync
+
+    // The packed radiance of each cell is a 'uint2', i.e., 2 consecutive words
+    auto const *indirect_value_data =
+        use_multibounce
+            ? static_cast<uint32_t const *>(gfxBufferGetData(gfx_, indirect_value_readback_buffer))
+            : nullptr;
+    HashGridCacheFile::Contents contents;
+    HashGridCacheFile::Compact(layout, gfxBufferGetData<uint32_t>(gfx_, hash_readback_buffer),
+        static_cast<uint32_t const *>(gfxBufferGetData(gfx_, value_readback_buffer)), indirect_value_data,
+        contents);
+
+    gfxDestroyBuffer(gfx_, hash_readback_buffer);
+    gfxDestroyBuffer(gfx_, value_readback_buffer);
+    gfxDestroyBuffer(gfx_, indirect_value_readback_buffer);
+
+    return HashGridCacheFile::Save(file_path, contents);
+}
+
+bool GI1::HashGridCache::loadFromFile(std::filesystem::path const &file_path,
+    HashGridCacheFile::Layout const &layout, uint32_t const frame_index) const
+{
+    HashGridCacheFile::Contents contents;
+    if (file_path.empty() || !radiance_cache_hash_buffer_ || !HashGridCacheFile::Load(file_path, contents)
+        || contents.layout != layout)
+    {
+        return false; // missing, stale or created using different settings
+    }
+
+    std::vector<uint32_t> hash_data;
+    std::vector<uint32_t> value_data;
+    std::vector<uint32_t> indirect_value_data;
+    HashGridCacheFile::Expand(contents, hash_data, value_data, indirect_value_data);
+
+    // Loaded tiles are considered touched this frame and form the previous frame's packed tile list, so
+    // that they get purged as usual if they are not used again
+    std::vector<uint32_t> const decay_tile_data(num_tiles_, frame_index);
+    std::vector<uint32_t>       packed_tile_index_data(num_tiles_, 0);
+    std::copy(contents.tile_indices.begin(), contents.tile_indices.end(), packed_tile_index_data.begin());
+    std::vector<uint32_t> const packed_tile_count_data(
+        1, static_cast<uint32_t>(contents.tile_indices.size()));
+    GfxBuffer const previous_packed_tile_count_buffer =
+        (radiance_cache_hash_buffer_ping_pong_ != 0 ? radiance_cache_packed_tile_count_buffer0_
+                                                    : radiance_cache_packed_tile_count_buffer1_);
+    GfxBuffer const previous_packed_tile_index_buffer =
+        (radiance_cache_hash_buffer_ping_pong_ != 0 ? radiance_cache_packed_tile_index_buffer0_
+                                                    : radiance_cache_packed_tile_index_buffer1_);
+
+    auto const upload = [this](GfxBuffer const &buffer, std::vector<uint32_t> const &data) {
+        GfxBuffer const upload_buffer = gfxCreateBuffer<uint32_t>(
+            gfx_, static_cast<uint32_t>(data.size()), data.data(), kGfxCpuAccess_Write);
+        gfxCommandCopyBuffer(gfx_, buffer, upload_buffer);
+        gfxDestroyBuffer(gfx_, upload_buffer);
+    };
+    upload(radiance_cache_hash_buffer_, hash_data);
+    upload(radiance_cache_decay_tile_buffer_, decay_tile_data);
+    upload(radiance_cache_value_buffer_, value_data);
+    if (!indirect_value_data.empty())
+    {
+        upload(radiance_cache_value_indirect_buffer_, indirect_value_data);
+    }
+    upload(previous_packed_tile_index_buffer, packed_tile_index_data);
+    upload(previous_packed_tile_count_buffer, packed_tile_count_data);
+    return true;
+}
+
 GI1::WorldSpaceReSTIR::WorldSpaceReSTIR(GI1 &gi1)
     : Base(gi1)
 {}
@@ -949,8 +1142,13 @@ void GI1::WorldSpaceReSTIR::ensureMemoryIsAllocated()
         reservoir_hash_list_count_buffer_.setName("GI1_Reservoir_HashListCountBuffer");
     }
 
+    // Packed storage encodes the hit position as an octahedral direction and a half precision distance
+    uint32_t const indirect_sample_stride = self.options_.gi1_use_packed_storage
+                                              ? static_cast<uint32_t>(3 * sizeof(uint32_t))
+                                              : static_cast<uint32_t>(sizeof(float4));
     if (uint32_t const max_combined_ray_count = self.hash_grid_cache_.max_combined_ray_count_;
-        reservoir_indirect_sample_buffer_.getCount() < max_combined_ray_count)
+        reservoir_indirect_sample_buffer_.getCount() < max_combined_ray_count
+        || reservoir_indirect_sample_buffer_.getStride() != indirect_sample_stride)
     {
         gfxDestroyBuffer(gfx_, reservoir_indirect_sample_buffer_);
         for (GfxBuffer const &reservoir_indirect_sample_normal_buffer :
@@ -965,7 +1163,9 @@ void GI1::WorldSpaceReSTIR::ensureMemoryIsAllocated()
             gfxDestroyBuffer(gfx_, reservoir_indirect_sample_reservoir_buffer);
         }
 
-        reservoir_indirect_sample_buffer_ = gfxCreateBuffer<float4>(gfx_, max_combined_ray_count);
+        reservoir_indirect_sample_buffer_ =
+            gfxCreateBuffer(gfx_, static_cast<uint64_t>(indirect_sample_stride) * max_combined_ray_count);
+        reservoir_indirect_sample_buffer_.setStride(indirect_sample_stride);
         reservoir_indirect_sample_buffer_.setName("GI1_Reservoir_IndirectSampleBuffer");
 
         for (uint32_t i = 0; i < ARRAYSIZE(reservoir_indirect_sample_normal_buffers_); ++i)
@@ -1017,6 +1217,7 @@ GI1::GlossyReflections::~GlossyReflections()
         gfxDestroyTexture(gfx_, texture);
     }
     gfxDestroyBuffer(gfx_, rt_sample_buffer_);
+    gfxDestroyBuffer(gfx_, rt_sample_key_buffer_);
     gfxDestroyBuffer(gfx_, rt_sample_count_buffer_);
 }
 
@@ -1058,9 +1259,13 @@ void GI1::GlossyReflections::ensureMemoryIsAllocated(CapsaicinInternal const &ca
     if (!rt_sample_buffer_ || rt_sample_buffer_.getCount() != half_buffer_width * half_buffer_height)
     {
         gfxDestroyBuffer(gfx_, rt_sample_buffer_);
+        gfxDestroyBuffer(gfx_, rt_sample_key_buffer_);
 
         rt_sample_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, half_buffer_width * half_buffer_height);
         rt_sample_buffer_.setName("RtSampleBuffer");
+
+        rt_sample_key_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, half_buffer_width * half_buffer_height);
+        rt_sample_key_buffer_.setName("RtSampleKeyBuffer");
     }
 
     if (!rt_sample_count_buffer_)
@@ -1251,11 +1456,17 @@ RenderOptionList GI1::getRenderOptions() noexcept
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_use_multibounce, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_disable_albedo_textures, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_disable_specular_materials, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_use_variable_rate_probes, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_variable_rate_probes_low_threshold, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_variable_rate_probes_high_threshold, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_use_ray_binning, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_use_packed_storage, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_cell_size, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_min_cell_size, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_tile_cell_ratio, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_num_buckets, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_num_tiles_per_bucket, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_use_cuckoo_hashing, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_max_sample_count, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_discard_multibounce_ray_probability, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_max_multibounce_sample_count, options_));
@@ -1264,6 +1475,10 @@ RenderOptionList GI1::getRenderOptions() noexcept
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_debug_max_cell_decay, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_debug_stats, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_debug_max_bucket_overflow, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_auto_size, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_auto_size_interval, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_persistent, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi1_hash_grid_cache_save, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_reservoir_cache_cell_size, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_glossy_reflections_halfres, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi1_glossy_reflections_denoiser_mode, options_));
@@ -1301,11 +1516,17 @@ GI1::RenderOptions GI1::convertOptions(RenderOptionList const &options) noexcept
     RENDER_OPTION_GET(gi1_use_multibounce, newOptions, options)
     RENDER_OPTION_GET(gi1_disable_albedo_textures, newOptions, options)
     RENDER_OPTION_GET(gi1_disable_specular_materials, newOptions, options)
+    RENDER_OPTION_GET(gi1_use_variable_rate_probes, newOptions, options)
+    RENDER_OPTION_GET(gi1_variable_rate_probes_low_threshold, newOptions, options)
+    RENDER_OPTION_GET(gi1_variable_rate_probes_high_threshold, newOptions, options)
+    RENDER_OPTION_GET(gi1_use_ray_binning, newOptions, options)
+    RENDER_OPTION_GET(gi1_use_packed_storage, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_cell_size, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_min_cell_size, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_tile_cell_ratio, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_num_buckets, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_num_tiles_per_bucket, newOptions, options)
+    RENDER_OPTION_GET(gi1_hash_grid_cache_use_cuckoo_hashing, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_max_sample_count, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_discard_multibounce_ray_probability, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_max_multibounce_sample_count, newOptions, options)
@@ -1314,6 +1535,10 @@ GI1::RenderOptions GI1::convertOptions(RenderOptionList const &options) noexcept
     RENDER_OPTION_GET(gi1_hash_grid_cache_debug_max_cell_decay, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_debug_stats, newOptions, options)
     RENDER_OPTION_GET(gi1_hash_grid_cache_debug_max_bucket_overflow, newOptions, options)
+    RENDER_OPTION_GET(gi1_hash_grid_cache_auto_size, newOptions, options)
+    RENDER_OPTION_GET(gi1_hash_grid_cache_auto_size_interval, newOptions, options)
+    RENDER_OPTION_GET(gi1_hash_grid_cache_persistent, newOptions, options)
+    RENDER_OPTION_GET(gi1_hash_grid_cache_save, newOptions, options)
     RENDER_OPTION_GET(gi1_reservoir_cache_cell_size, newOptions, options)
     RENDER_OPTION_GET(gi1_glossy_reflections_halfres, newOptions, options)
     RENDER_OPTION_GET(gi1_glossy_reflections_denoiser_mode, newOptions, options)
@@ -1395,6 +1620,20 @@ DebugViewList GI1::getDebugViews() const noexcept
     return views;
 }
 
+StatisticList GI1::getStatistics() const noexcept
+{
+    // Recorded along with the image metrics so that the saving can be weighed against the quality loss
+    StatisticList statistics;
+    if (options_.gi1_use_variable_rate_probes)
+    {
+        auto const &allocation = screen_probes_.debug_allocation_;
+        statistics.emplace_back("Spawned Probes", static_cast<double>(allocation.getProbeCount()));
+        statistics.emplace_back("Dropped Probes", static_cast<double>(allocation.dropped_count));
+        statistics.emplace_back("Ray Budget Saved", static_cast<double>(allocation.getRayBudgetSaved()));
+    }
+    return statistics;
+}
+
 bool GI1::init(CapsaicinInternal const &capsaicin) noexcept
 {
     draw_command_buffer_ = gfxCreateBuffer<uint4>(gfx_, 1);
@@ -1425,6 +1664,22 @@ bool GI1::init(CapsaicinInternal const &capsaicin) noexcept
     {
         base_defines.push_back("USE_MULTI_BOUNCE");
     }
+    if (options_.gi1_hash_grid_cache_use_cuckoo_hashing)
+    {
+        base_defines.push_back("USE_CUCKOO_HASHING");
+    }
+    if (options_.gi1_use_variable_rate_probes)
+    {
+        base_defines.push_back("USE_VARIABLE_RATE_PROBES");
+    }
+    if (options_.gi1_use_ray_binning)
+    {
+        base_defines.push_back("USE_RAY_BINNING");
+    }
+    if (options_.gi1_use_packed_storage)
+    {
+        base_defines.push_back("USE_PACKED_STORAGE");
+    }
     auto const base_define_count = static_cast<uint32_t>(base_defines.size());
 
     std::vector<char const *> resampling_defines = base_defines;
@@ -1439,7 +1694,7 @@ bool GI1::init(CapsaicinInternal const &capsaicin) noexcept
     {
         debug_hash_cells_defines.push_back("DEBUG_HASH_CELLS");
     }
-    if (options_.gi1_hash_grid_cache_debug_stats)
+    if (options_.gi1_hash_grid_cache_debug_stats || options_.gi1_hash_grid_cache_auto_size)
     {
         debug_hash_cells_defines.push_back("DEBUG_HASH_STATS");
     }
@@ -1514,6 +1769,14 @@ bool GI1::init(CapsaicinInternal const &capsaicin) noexcept
         gfx_, gi1_program_, "PatchScreenProbes", base_defines.data(), base_define_count);
     sample_screen_probes_kernel_ = gfxCreateComputeKernel(
         gfx_, gi1_program_, "SampleScreenProbes", base_defines.data(), base_define_count);
+    bin_screen_probe_rays_kernel_ = gfxCreateComputeKernel(
+        gfx_, gi1_program_, "BinScreenProbeRays", base_defines.data(), base_define_count);
+    bin_reflection_rays_kernel_ = gfxCreateComputeKernel(
+        gfx_, gi1_program_, "BinReflectionRays", base_defines.data(), base_define_count);
+    if (options_.gi1_use_ray_binning)
+    {
+        ray_sorter_.initialise(capsaicin, GPUSort::Type::UInt, GPUSort::Operation::Ascending);
+    }
     if (options_.gi1_use_dxr10)
     {
         std::vector<char const *> base_subobjects;
@@ -1638,7 +1901,7 @@ bool GI1::init(CapsaicinInternal const &capsaicin) noexcept
     resolve_cells_kernel_ =
         gfxCreateComputeKernel(gfx_, gi1_program_, "ResolveCells", base_defines.data(), base_define_count);
 
-    if (options_.gi1_hash_grid_cache_debug_stats)
+    if (options_.gi1_hash_grid_cache_debug_stats || options_.gi1_hash_grid_cache_auto_size)
     {
         clear_bucket_overflow_count_kernel_ = gfxCreateComputeKernel(gfx_, gi1_program_,
             "ClearBucketOverflowCount", debug_hash_cells_defines.data(), debug_hash_cells_define_count);
@@ -1700,7 +1963,9 @@ bool GI1::init(CapsaicinInternal const &capsaicin) noexcept
 
     // Ensure our fullscreen render target is allocated
     depth_buffer_      = capsaicin.createRenderTexture(DXGI_FORMAT_D32_FLOAT, "GI_DepthBuffer");
-    irradiance_buffer_ = capsaicin.createRenderTexture(DXGI_FORMAT_R16G16B16A16_FLOAT, "GI_IrradianceBuffer");
+    irradiance_buffer_ = capsaicin.createRenderTexture(
+        options_.gi1_use_packed_storage ? DXGI_FORMAT_R11G11B10_FLOAT : DXGI_FORMAT_R16G16B16A16_FLOAT,
+        "GI_IrradianceBuffer");
 
     // Reserve position values with light bounds sampler
     light_sampler->reserveBoundsValues(
@@ -1729,17 +1994,31 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
         || options.gi1_disable_alpha_testing != options_.gi1_disable_alpha_testing
         || options.gi1_disable_specular_materials != options_.gi1_disable_specular_materials
         || options.gi1_use_multibounce != options_.gi1_use_multibounce
+        || options.gi1_use_variable_rate_probes != options_.gi1_use_variable_rate_probes
+        || options.gi1_use_ray_binning != options_.gi1_use_ray_binning
+        || options.gi1_use_packed_storage != options_.gi1_use_packed_storage
         || light_sampler->needsRecompile(capsaicin) || needs_debug_view
         || options_.gi1_use_dxr10 != options.gi1_use_dxr10
-        || options_.gi1_hash_grid_cache_debug_stats != options.gi1_hash_grid_cache_debug_stats;
+        || options_.gi1_hash_grid_cache_debug_stats != options.gi1_hash_grid_cache_debug_stats
+        || options_.gi1_hash_grid_cache_auto_size != options.gi1_hash_grid_cache_auto_size
+        || options_.gi1_hash_grid_cache_use_cuckoo_hashing != options.gi1_hash_grid_cache_use_cuckoo_hashing;
 
     bool const needs_hash_grid_clear =
         options_.gi1_hash_grid_cache_cell_size != options.gi1_hash_grid_cache_cell_size
         || options_.gi1_hash_grid_cache_min_cell_size != options.gi1_hash_grid_cache_min_cell_size
         || options_.gi1_hash_grid_cache_debug_mip_level != options.gi1_hash_grid_cache_debug_mip_level
         || options_.gi1_hash_grid_cache_debug_propagate != options.gi1_hash_grid_cache_debug_propagate
+        || options_.gi1_hash_grid_cache_num_buckets != options.gi1_hash_grid_cache_num_buckets
+        || options_.gi1_hash_grid_cache_num_tiles_per_bucket
+               != options.gi1_hash_grid_cache_num_tiles_per_bucket
+        || options_.gi1_hash_grid_cache_use_cuckoo_hashing != options.gi1_hash_grid_cache_use_cuckoo_hashing
         || options_.gi1_use_multibounce != options.gi1_use_multibounce || capsaicin.getFrameIndex() == 0;
 
+    if (options_.gi1_hash_grid_cache_auto_size != options.gi1_hash_grid_cache_auto_size)
+    {
+        hash_grid_cache_.size_controller_.reset();
+    }
+
     options_    = options;
     debug_view_ = debug_view;
 
@@ -1778,8 +2057,9 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
             gfxCreateGraphicsKernel(gfx_, gi1_program_, debug_reflection_draw_state, "DebugReflection");
     }
 
-    // Clear the hash-grid cache if user's changed the cell size
-    if (needs_hash_grid_clear)
+    // Clear the hash-grid cache if user's changed the cell size, a persistent cache is also reset on scene
+    // loads so that it gets warm-started from the new scene's file
+    if (needs_hash_grid_clear || (options_.gi1_hash_grid_cache_persistent && capsaicin.getSceneUpdated()))
     {
         clearHashGridCache(); // clear the radiance cache
     }
@@ -1798,6 +2078,7 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxFinish(gfx_);
     }
+    debug_total_memory_size_in_bytes_ = calculateTotalMemorySize();
 
     // Allocate and populate our constant data
     GfxBuffer const gi1_constants             = capsaicin.allocateConstantBuffer<GI1Constants>(1);
@@ -1846,6 +2127,10 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
     {
         screen_probes_constant_data.debug_mode = SCREENPROBES_DEBUG_RADIANCE_PER_DIRECTION;
     }
+    screen_probes_constant_data.variable_rate_low_threshold =
+        options_.gi1_variable_rate_probes_low_threshold;
+    screen_probes_constant_data.variable_rate_high_threshold =
+        options_.gi1_variable_rate_probes_high_threshold;
     gfxBufferGetData<ScreenProbesConstants>(gfx_, screen_probes_constants)[0] = screen_probes_constant_data;
 
     uint32_t const         frame_index = capsaicin.getFrameIndex();
@@ -1931,6 +2216,31 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
     gfxBufferGetData<HashGridCacheConstants>(gfx_, hash_grid_cache_constants)[0] =
         hash_grid_cache_constant_data;
 
+    // Warm-start the hash-grid cache from disk whenever it was reset, or save it if requested
+    if ((options_.gi1_hash_grid_cache_persistent && hash_grid_cache_.needs_file_load_)
+        || options_.gi1_hash_grid_cache_save)
+    {
+        HashGridCacheFile::Layout const layout = hash_grid_cache_.getFileLayout(capsaicin, options_);
+        std::filesystem::path const file_path = HashGridCache::GetFilePath(capsaicin, layout);
+        if (options_.gi1_hash_grid_cache_save)
+        {
+            if (!hash_grid_cache_.saveToFile(file_path, layout))
+            {
+                GFX_PRINT_ERROR(kGfxResult_InternalError, "Failed to save hash-grid cache to '%s'",
+                    file_path.string().c_str());
+            }
+            capsaicin.setOption<bool>("gi1_hash_grid_cache_save", false);
+        }
+        else if (hash_grid_cache_.loadFromFile(file_path, layout, frame_index))
+        {
+            GFX_PRINTLN("Loaded hash-grid cache from '%s'", file_path.string().c_str());
+        }
+    }
+    if (options_.gi1_hash_grid_cache_persistent)
+    {
+        hash_grid_cache_.needs_file_load_ = false;
+    }
+
     WorldSpaceReSTIRConstants world_space_restir_constant_data = {};
     world_space_restir_constant_data.cell_size =
         tanf(camera.fovY * options_.gi1_reservoir_cache_cell_size
@@ -2089,12 +2399,22 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
         gfx_, gi1_program_, "g_ScreenProbes_ProbeSpawnScanBuffer", screen_probes_.probe_spawn_scan_buffer_);
     gfxProgramSetParameter(
         gfx_, gi1_program_, "g_ScreenProbes_ProbeSpawnIndexBuffer", screen_probes_.probe_spawn_index_buffer_);
+    gfxProgramSetParameter(gfx_, gi1_program_, "g_ScreenProbes_ProbeSpawnExtraScanBuffer",
+        screen_probes_.probe_spawn_extra_scan_buffer_);
+    gfxProgramSetParameter(gfx_, gi1_program_, "g_ScreenProbes_ProbeSpawnExtraIndexBuffer",
+        screen_probes_.probe_spawn_extra_index_buffer_);
     gfxProgramSetParameter(
         gfx_, gi1_program_, "g_ScreenProbes_ProbeSpawnProbeBuffer", screen_probes_.probe_spawn_probe_buffer_);
     gfxProgramSetParameter(gfx_, gi1_program_, "g_ScreenProbes_ProbeSpawnSampleBuffer",
         screen_probes_.probe_spawn_sample_buffer_);
     gfxProgramSetParameter(gfx_, gi1_program_, "g_ScreenProbes_ProbeSpawnRadianceBuffer",
         screen_probes_.probe_spawn_radiance_buffer_);
+    gfxProgramSetParameter(
+        gfx_, gi1_program_, "g_ScreenProbes_ProbeRayKeyBuffer", screen_probes_.probe_ray_key_buffer_);
+    gfxProgramSetParameter(
+        gfx_, gi1_program_, "g_ScreenProbes_ProbeRayIndexBuffer", screen_probes_.probe_ray_index_buffer_);
+    gfxProgramSetParameter(
+        gfx_, gi1_program_, "g_ScreenProbes_ProbeRayCountBuffer", screen_probes_.probe_ray_count_buffer_);
     gfxProgramSetParameter(gfx_, gi1_program_, "g_ScreenProbes_PreviousProbeSpawnBuffer",
         screen_probes_.probe_spawn_buffers_[1]);
 
@@ -2205,6 +2525,8 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
     gfxProgramSetParameter(
         gfx_, gi1_program_, "g_GlossyReflections_RtSampleBuffer", glossy_reflections_.rt_sample_buffer_);
+    gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflections_RtSampleKeyBuffer",
+        glossy_reflections_.rt_sample_key_buffer_);
     gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflections_RtSampleCountBuffer",
         glossy_reflections_.rt_sample_count_buffer_);
 
@@ -2219,20 +2541,33 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
     gfxProgramSetParameter(gfx_, gi1_program_, "g_GIDenoiser_PreviousColorDeltaBuffer",
         gi_denoiser_.color_delta_buffers_[1 - gi_denoiser_.color_buffer_index_]);
 
+    // Declare the passes along with the resources they access, they are recorded in order once all have been
+    // declared so that their async compute schedule can be analysed (see executePasses())
+    std::vector<RenderPass> passes;
+    bool const              use_hash_grid_stats =
+        options_.gi1_hash_grid_cache_debug_stats || options_.gi1_hash_grid_cache_auto_size;
+
     // Clear bucket overflow count
-    if (options_.gi1_hash_grid_cache_debug_stats)
+    if (use_hash_grid_stats)
     {
-        TimedSection const timed_section(*this, "ClearBucketOverflowCount");
+        passes.push_back({"ClearBucketOverflowCount", {}, {"HashGridCache_Stats"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "ClearBucketOverflowCount");
 
-        uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, clear_bucket_overflow_count_kernel_);
-        uint32_t const  num_groups_x = (hash_grid_cache_.num_buckets_ + num_threads[0] - 1) / num_threads[0];
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, clear_bucket_overflow_count_kernel_);
+            uint32_t const  num_groups_x =
+                (hash_grid_cache_.num_buckets_ + num_threads[0] - 1) / num_threads[0];
 
-        gfxCommandBindKernel(gfx_, clear_bucket_overflow_count_kernel_);
-        gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
+            gfxCommandBindKernel(gfx_, clear_bucket_overflow_count_kernel_);
+            gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
+        };
     }
 
     // Purge the unused tiles (square or cube of cells) within our hash-grid cache
-    {
+    passes.push_back({"PurgeRadianceCache", {}, {"HashGridCache_Tiles", "HashGridCache_Visibility",
+        "HashGridCache_Updates", "Reservoirs", "ScreenProbes_Tiles", "ScreenProbes_Cache",
+        "GlossyReflections"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "PurgeRadianceCache");
 
         GfxBuffer const radiance_cache_packed_tile_count_buffer =
@@ -2247,10 +2582,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
         gfxCommandDispatch(gfx_, 1, 1, 1);
         gfxCommandBindKernel(gfx_, purge_tiles_kernel_);
         gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
-    }
+    };
 
     // Reproject the previous screen probes into the current frame
-    {
+    passes.push_back({"ReprojectScreenProbes", {"GBuffers", "ScreenProbes", "ScreenProbes_Mask",
+        "ScreenProbes_SH"}, {"ScreenProbes", "ScreenProbes_Mask", "ScreenProbes_SH", "ScreenProbes_Tiles"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "ReprojectScreenProbes");
 
         uint32_t const probe_count[] = {
@@ -2265,10 +2602,11 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, reproject_screen_probes_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
-    }
+    };
 
     // Look up our cached probes into the current view space
-    {
+    passes.push_back({"LookupScreenProbes", {"ScreenProbes_Cache"}, {"ScreenProbes_Cache"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "LookupScreenProbes");
 
         uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, count_screen_probes_kernel_);
@@ -2285,10 +2623,13 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
             *gfxKernelGetNumThreads(gfx_, scatter_screen_probes_kernel_));
         gfxCommandBindKernel(gfx_, scatter_screen_probes_kernel_);
         gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
-    }
+    };
 
-    // Spawn our new screen probes
-    {
+    // Spawn our new screen probes (density follows the lighting variance estimated by the denoiser on the
+    // previous frame when using variable rate probes)
+    passes.push_back({"SpawnScreenProbes", {"GBuffers", "ScreenProbes_Mask", "ScreenProbes_Spawn",
+        "GIDenoiser"}, {"ScreenProbes_Spawn", "ScreenProbes_Mask", "ScreenProbes_Tiles"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "SpawnScreenProbes");
 
         uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, spawn_screen_probes_kernel_);
@@ -2300,12 +2641,58 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
         gfxCommandScanSum(gfx_, kGfxDataType_Uint, screen_probes_.probe_spawn_index_buffer_,
             screen_probes_.probe_spawn_scan_buffer_);
+        if (options_.gi1_use_variable_rate_probes)
+        {
+            gfxCommandScanSum(gfx_, kGfxDataType_Uint, screen_probes_.probe_spawn_extra_index_buffer_,
+                screen_probes_.probe_spawn_extra_scan_buffer_);
+        }
         gfxCommandBindKernel(gfx_, compact_screen_probes_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
+    };
+
+    // Read back the number of spawned probes so the saved ray budget can be reported
+    if (options_.gi1_use_variable_rate_probes)
+    {
+        passes.push_back({"ReadbackProbeSpawnCounts", {"ScreenProbes_Spawn"}, {"ScreenProbes_SpawnReadback"},
+            false});
+        passes.back().execute = [&] {
+            uint32_t const copy_index  = frame_index % kGfxConstant_BackBufferCount;
+            uint64_t const last_offset = (screen_probes_.max_probe_spawn_count - 1) * sizeof(uint32_t);
+
+            GfxBuffer const &copy_buffer = screen_probes_.probe_spawn_count_readback_buffers_[copy_index];
+            gfxCommandCopyBuffer(
+                gfx_, copy_buffer, 0, screen_probes_.probe_spawn_scan_buffer_, last_offset, sizeof(uint32_t));
+            gfxCommandCopyBuffer(gfx_, copy_buffer, sizeof(uint32_t),
+                screen_probes_.probe_spawn_index_buffer_, last_offset, sizeof(uint32_t));
+            gfxCommandCopyBuffer(gfx_, copy_buffer, 2 * sizeof(uint32_t),
+                screen_probes_.probe_spawn_extra_scan_buffer_, last_offset, sizeof(uint32_t));
+            gfxCommandCopyBuffer(gfx_, copy_buffer, 3 * sizeof(uint32_t),
+                screen_probes_.probe_spawn_extra_index_buffer_, last_offset, sizeof(uint32_t));
+            screen_probes_.probe_spawn_count_readback_is_pending_[copy_index] = true;
+
+            if (uint32_t const readback_index = (frame_index + 1) % kGfxConstant_BackBufferCount;
+                screen_probes_.probe_spawn_count_readback_is_pending_[readback_index])
+            {
+                uint32_t const *counts = gfxBufferGetData<uint32_t>(
+                    gfx_, screen_probes_.probe_spawn_count_readback_buffers_[readback_index]);
+
+                // Same as 'ScreenProbes_GetSpawnedProbeCount()'
+                auto          &allocation        = screen_probes_.debug_allocation_;
+                uint32_t const extra_probe_count = counts[2] + counts[3];
+                allocation.budget                = screen_probes_.max_probe_spawn_count;
+                allocation.base_probe_count      = GFX_MIN(counts[0] + counts[1], allocation.budget);
+                allocation.extra_probe_count =
+                    GFX_MIN(extra_probe_count, allocation.budget - allocation.base_probe_count);
+                allocation.dropped_count = extra_probe_count - allocation.extra_probe_count;
+                screen_probes_.probe_spawn_count_readback_is_pending_[readback_index] = false;
+            }
+        };
     }
 
     // Stochastically patch the overridable tiles using empty ones (a.k.a., adaptive sampling)
-    {
+    passes.push_back({"PatchScreenProbes", {"GBuffers", "ScreenProbes_Tiles", "ScreenProbes_Spawn"},
+        {"ScreenProbes_Spawn"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "PatchScreenProbes - Stochastically patch the overridable tiles using empty ones (a.k.a., adaptive sampling)");
 
         uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, patch_screen_probes_kernel_);
@@ -2313,10 +2700,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, patch_screen_probes_kernel_);
         gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
-    }
+    };
 
     // Importance sample the spawned probes
-    {
+    passes.push_back({"SampleScreenProbes", {"GBuffers", "ScreenProbes", "ScreenProbes_Mask",
+        "ScreenProbes_Cache", "ScreenProbes_Spawn"}, {"ScreenProbes_Spawn", "ScreenProbes_Cache"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "SampleScreenProbes - Importance sample the spawned probes");
 
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, sample_screen_probes_kernel_);
@@ -2324,10 +2713,34 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, sample_screen_probes_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
+    };
+
+    // Bin the probe rays by direction octant and origin cell so that neighboring lanes traverse similar
+    // parts of the acceleration structure
+    if (options_.gi1_use_ray_binning)
+    {
+        passes.push_back({"BinScreenProbeRays", {"GBuffers", "ScreenProbes_Spawn"}, {"ScreenProbes_Spawn"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "BinScreenProbeRays");
+
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, bin_screen_probe_rays_kernel_);
+            uint32_t const  num_groups_x =
+                (screen_probes_.max_ray_count + num_threads[0] - 1) / num_threads[0];
+
+            gfxCommandBindKernel(gfx_, bin_screen_probe_rays_kernel_);
+            gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
+
+            ray_sorter_.sortIndirectPayload(screen_probes_.probe_ray_key_buffer_,
+                screen_probes_.probe_ray_count_buffer_, screen_probes_.max_ray_count,
+                screen_probes_.probe_ray_index_buffer_);
+        };
     }
 
     // Now we go and populate the newly spawned probes
-    {
+    passes.push_back({"PopulateScreenProbesCells", {"GBuffers", "ScreenProbes_Spawn", "HashGridCache_Values"},
+        {"ScreenProbes_Spawn", "HashGridCache_Tiles", "HashGridCache_Visibility", "HashGridCache_Updates",
+        "LightSampler_Bounds"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "PopulateScreenProbesCells");
 
         if (options.gi1_use_dxr10)
@@ -2354,61 +2767,74 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
             gfxCommandBindKernel(gfx_, populate_screen_probes_kernel_);
             gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
         }
-    }
+    };
 
     // Discover indirect cells we need for multibounce
+    // These rays are never binned: they start from the hash-grid cells hit by the probe rays rather than from
+    // screen pixels, so the screen cell part of the binning key would not group them
     if (options.gi1_use_multibounce)
     {
-        TimedSection const timed_section(*this, "PopulateMultibounceCells");
+        passes.push_back({"PopulateMultibounceCells", {"GBuffers", "ScreenProbes_Spawn",
+            "HashGridCache_Values", "HashGridCache_Visibility"}, {"HashGridCache_Tiles",
+            "HashGridCache_Visibility", "HashGridCache_Updates", "LightSampler_Bounds"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "PopulateMultibounceCells");
 
-        if (options.gi1_use_dxr10)
-        {
-            gfxSbtSetShaderGroup(
-                gfx_, sbt_, kGfxShaderGroupType_Raygen, 0, kPopulateMultibounceCellsRaygenShaderName);
-            gfxSbtSetShaderGroup(
-                gfx_, sbt_, kGfxShaderGroupType_Miss, 0, kPopulateMultibounceCellsMissShaderName);
-            for (uint32_t i = 0; i < capsaicin.getRaytracingPrimitiveCount(); i++)
+            if (options.gi1_use_dxr10)
             {
-                gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Hit,
-                    i * capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit),
-                    kPopulateMultibounceCellsHitGroupName);
+                gfxSbtSetShaderGroup(
+                    gfx_, sbt_, kGfxShaderGroupType_Raygen, 0, kPopulateMultibounceCellsRaygenShaderName);
+                gfxSbtSetShaderGroup(
+                    gfx_, sbt_, kGfxShaderGroupType_Miss, 0, kPopulateMultibounceCellsMissShaderName);
+                for (uint32_t i = 0; i < capsaicin.getRaytracingPrimitiveCount(); i++)
+                {
+                    gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Hit,
+                        i * capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit),
+                        kPopulateMultibounceCellsHitGroupName);
+                }
+
+                generateDispatchRays(hash_grid_cache_.radiance_cache_visibility_count_buffer0_);
+
+                gfxCommandBindKernel(gfx_, populate_multibounce_cells_kernel_);
+                gfxCommandDispatchRaysIndirect(gfx_, sbt_, dispatch_command_buffer_);
             }
+            else
+            {
+                uint32_t const *num_threads =
+                    gfxKernelGetNumThreads(gfx_, populate_multibounce_cells_kernel_);
+                generateDispatch(hash_grid_cache_.radiance_cache_visibility_count_buffer0_, num_threads[0]);
 
-            generateDispatchRays(hash_grid_cache_.radiance_cache_visibility_count_buffer0_);
-
-            gfxCommandBindKernel(gfx_, populate_multibounce_cells_kernel_);
-            gfxCommandDispatchRaysIndirect(gfx_, sbt_, dispatch_command_buffer_);
-        }
-        else
-        {
-            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, populate_multibounce_cells_kernel_);
-            generateDispatch(hash_grid_cache_.radiance_cache_visibility_count_buffer0_, num_threads[0]);
-
-            gfxCommandBindKernel(gfx_, populate_multibounce_cells_kernel_);
-            gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
-        }
+                gfxCommandBindKernel(gfx_, populate_multibounce_cells_kernel_);
+                gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+            }
+        };
     }
 
-    // Update light sampling data structure
-    {
-        light_sampler->update(capsaicin, this);
-    }
+    // Update light sampling data structure from the bounds requested by the populate passes
+    passes.push_back({"UpdateLightSampler", {"LightSampler_Bounds"}, {"LightSampler_Bounds", "LightSampler"},
+        false});
+    passes.back().execute = [&] { light_sampler->update(capsaicin, this); };
 
     // Clear our cache prior to generating new reservoirs
     if (options_.gi1_use_resampling)
     {
-        TimedSection const timed_section(*this, "ClearReservoirs");
+        passes.push_back({"ClearReservoirs", {}, {"Reservoirs"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "ClearReservoirs");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, clear_reservoirs_kernel_);
-        uint32_t const  num_groups_x =
-            (WorldSpaceReSTIR::kConstant_NumEntries + num_threads[0] - 1) / num_threads[0];
+            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, clear_reservoirs_kernel_);
+            uint32_t const  num_groups_x =
+                (WorldSpaceReSTIR::kConstant_NumEntries + num_threads[0] - 1) / num_threads[0];
 
-        gfxCommandBindKernel(gfx_, clear_reservoirs_kernel_);
-        gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
+            gfxCommandBindKernel(gfx_, clear_reservoirs_kernel_);
+            gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
+        };
     }
 
     // Generate reservoirs for our secondary hit points
-    {
+    passes.push_back({"GenerateReservoirs", {"GBuffers", "ScreenProbes_Spawn", "HashGridCache_Visibility",
+        "LightSampler", "Reservoirs"}, {"Reservoirs", "HashGridCache_Visibility", "HashGridCache_Updates"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "GenerateReservoirs");
 
         uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, generate_reservoirs_kernel_);
@@ -2416,50 +2842,62 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, generate_reservoirs_kernel_);
         gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
-    }
+    };
 
     if (options.gi1_use_multibounce)
     {
-        TimedSection const timed_section(*this, "GenerateMultibounceReservoirs");
+        passes.push_back({"GenerateMultibounceReservoirs", {"HashGridCache_Visibility", "LightSampler",
+            "Reservoirs"}, {"Reservoirs", "HashGridCache_Visibility"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "GenerateMultibounceReservoirs");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, generate_multibounce_reservoirs_kernel_);
-        generateDispatch(hash_grid_cache_.radiance_cache_visibility_count_buffer1_, num_threads[0]);
+            uint32_t const *num_threads =
+                gfxKernelGetNumThreads(gfx_, generate_multibounce_reservoirs_kernel_);
+            generateDispatch(hash_grid_cache_.radiance_cache_visibility_count_buffer1_, num_threads[0]);
 
-        gfxCommandBindKernel(gfx_, generate_multibounce_reservoirs_kernel_);
-        gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+            gfxCommandBindKernel(gfx_, generate_multibounce_reservoirs_kernel_);
+            gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+        };
     }
 
     // Compact the reservoir caching structure
     if (options_.gi1_use_resampling)
     {
-        TimedSection const timed_section(*this, "CompactReservoirs");
+        passes.push_back({"CompactReservoirs", {"Reservoirs"}, {"Reservoirs"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "CompactReservoirs");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, compact_reservoirs_kernel_);
-        generateDispatch(world_space_restir_.reservoir_hash_list_count_buffer_, num_threads[0]);
+            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, compact_reservoirs_kernel_);
+            generateDispatch(world_space_restir_.reservoir_hash_list_count_buffer_, num_threads[0]);
 
-        gfxCommandScanSum(gfx_, kGfxDataType_Uint,
-            world_space_restir_
-                .reservoir_hash_index_buffers_[world_space_restir_.reservoir_indirect_sample_buffer_index_],
-            world_space_restir_
-                .reservoir_hash_count_buffers_[world_space_restir_.reservoir_indirect_sample_buffer_index_]);
-        gfxCommandBindKernel(gfx_, compact_reservoirs_kernel_);
-        gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+            uint32_t const buffer_index = world_space_restir_.reservoir_indirect_sample_buffer_index_;
+            gfxCommandScanSum(gfx_, kGfxDataType_Uint,
+                world_space_restir_.reservoir_hash_index_buffers_[buffer_index],
+                world_space_restir_.reservoir_hash_count_buffers_[buffer_index]);
+            gfxCommandBindKernel(gfx_, compact_reservoirs_kernel_);
+            gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+        };
     }
 
     // Perform world-space reservoir reuse if enabled
     if (options_.gi1_use_resampling)
     {
-        TimedSection const timed_section(*this, "ResampleReservoirs");
+        passes.push_back({"ResampleReservoirs", {"Reservoirs", "HashGridCache_Visibility"}, {"Reservoirs"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "ResampleReservoirs");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, resample_reservoirs_kernel_);
-        generateDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_, num_threads[0]);
+            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, resample_reservoirs_kernel_);
+            generateDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_, num_threads[0]);
 
-        gfxCommandBindKernel(gfx_, resample_reservoirs_kernel_);
-        gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+            gfxCommandBindKernel(gfx_, resample_reservoirs_kernel_);
+            gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+        };
     }
 
     // Populate the cells of our world-space hash-grid radiance cache
-    {
+    passes.push_back({"PopulateRadianceCache", {"HashGridCache_Visibility", "Reservoirs"},
+        {"HashGridCache_Updates"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "PopulateRadianceCache");
 
         if (options.gi1_use_dxr10)
@@ -2485,10 +2923,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
             gfxCommandBindKernel(gfx_, populate_cells_kernel_);
             gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
         }
-    }
+    };
 
     // Update our tiles using the result of the raytracing
-    {
+    passes.push_back({"UpdateRadianceCache", {"HashGridCache_Updates"}, {"HashGridCache_Updates",
+        "HashGridCache_Values"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "UpdateRadianceCache");
 
         gfxCommandBindKernel(gfx_, generate_update_tiles_dispatch_kernel_);
@@ -2496,22 +2936,28 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, update_tiles_kernel_);
         gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
-    }
+    };
 
     // Resolve bounce 1 cells into first bounce cells using last frame
     if (options.gi1_use_multibounce)
     {
-        TimedSection const timed_section(*this, "UpdateMultibounceCells");
+        passes.push_back({"UpdateMultibounceCells", {"HashGridCache_Visibility", "HashGridCache_Updates",
+            "HashGridCache_Values"}, {"HashGridCache_Updates"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "UpdateMultibounceCells");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, update_multibounce_cells_kernel_);
-        generateDispatch(hash_grid_cache_.radiance_cache_visibility_count_buffer1_, num_threads[0]);
+            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, update_multibounce_cells_kernel_);
+            generateDispatch(hash_grid_cache_.radiance_cache_visibility_count_buffer1_, num_threads[0]);
 
-        gfxCommandBindKernel(gfx_, update_multibounce_cells_kernel_);
-        gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+            gfxCommandBindKernel(gfx_, update_multibounce_cells_kernel_);
+            gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+        };
     }
 
     // Resolve first bounce cells into screen probes
-    {
+    passes.push_back({"ResolveCells", {"HashGridCache_Visibility", "HashGridCache_Updates",
+        "HashGridCache_Values"}, {"ScreenProbes_Spawn"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "ResolveCells");
 
         uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, resolve_cells_kernel_);
@@ -2522,10 +2968,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, resolve_cells_kernel_);
         gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
-    }
+    };
 
     // Blend the new results into the probe grid
-    {
+    passes.push_back({"BlendScreenProbes", {"GBuffers", "ScreenProbes", "ScreenProbes_Mask",
+        "ScreenProbes_Cache", "ScreenProbes_Spawn"}, {"ScreenProbes", "ScreenProbes_Cache"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "BlendScreenProbes");
 
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, blend_screen_probes_kernel_);
@@ -2535,10 +2983,11 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
         gfxCommandCopyTexture(gfx_, screen_probes_.probe_buffers_[1 - screen_probes_.probe_buffer_index_],
             screen_probes_.probe_buffers_[screen_probes_.probe_buffer_index_]);
-    }
+    };
 
     // Re-order the cached probes so the least-recently used entries are evicted first
-    {
+    passes.push_back({"ReorderScreenProbes", {"ScreenProbes_Cache"}, {"ScreenProbes_Cache"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "ReorderScreenProbes");
 
         uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, reorder_screen_probes_kernel_);
@@ -2550,10 +2999,11 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
             screen_probes_.probe_cached_tile_lru_flag_buffer_);
         gfxCommandBindKernel(gfx_, reorder_screen_probes_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
-    }
+    };
 
     // Filter the probe mask
-    {
+    passes.push_back({"FilterProbeMask", {"ScreenProbes_Mask"}, {"ScreenProbes_Mask"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "FilterProbeMask");
 
         uint32_t const probe_count[] = {
@@ -2579,10 +3029,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
         }
-    }
+    };
 
     // Filter the screen probes
-    {
+    passes.push_back({"FilterScreenProbes", {"GBuffers", "ScreenProbes", "ScreenProbes_Spawn"},
+        {"ScreenProbes"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "FilterScreenProbes");
 
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, filter_screen_probes_kernel_);
@@ -2607,10 +3059,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
         }
-    }
+    };
 
     // Project the screen probes into SH basis
-    {
+    passes.push_back({"ProjectScreenProbes", {"GBuffers", "ScreenProbes", "ScreenProbes_Spawn"},
+        {"ScreenProbes_SH"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "ProjectScreenProbes to SH");
 
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, project_screen_probes_kernel_);
@@ -2618,10 +3072,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, project_screen_probes_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
-    }
+    };
 
     // Interpolate the screen probes to target resolution
-    {
+    passes.push_back({"InterpolateScreenProbes", {"GBuffers", "ScreenProbes"}, {"GIDenoiser",
+        "GlossyReflections", "Reflection"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "InterpolateScreenProbes to Target resolution");
 
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, interpolate_screen_probes_kernel_);
@@ -2630,253 +3086,312 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, interpolate_screen_probes_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
-    }
+    };
 
     // Ray traced reflections for surface with roughness under gi1_glossy_reflections_low_roughness_threshold
     if (options_.gi1_disable_specular_materials)
     {
-        gfxCommandClearTexture(gfx_, capsaicin.getSharedTexture("Reflection"));
+        passes.push_back({"ClearReflection", {}, {"Reflection"}, false});
+        passes.back().execute = [&] {
+            gfxCommandClearTexture(gfx_, capsaicin.getSharedTexture("Reflection"));
+        };
     }
     else
     {
-        TimedSection const timed_section(*this, "TraceReflections");
-
-        gfxProgramSetParameter(gfx_, gi1_program_, "g_TextureSampler", capsaicin.getAnisotropicSampler());
-
-        if (options.gi1_use_dxr10)
+        // Bin the reflection rays by direction octant and origin cell, the samples are sorted in place
+        if (options_.gi1_use_ray_binning)
         {
-            gfxSbtSetShaderGroup(
-                gfx_, sbt_, kGfxShaderGroupType_Raygen, 0, kTraceReflectionsRaygenShaderName);
-            gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Miss, 0, kTraceReflectionsMissShaderName);
-            for (uint32_t i = 0; i < capsaicin.getRaytracingPrimitiveCount(); i++)
-            {
-                gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Hit,
-                    i * capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit),
-                    kTraceReflectionsHitGroupName);
-            }
+            passes.push_back({"BinReflectionRays", {"GBuffers", "GlossyReflections"}, {"GlossyReflections"}});
+            passes.back().execute = [&] {
+                TimedSection const timed_section(*this, "BinReflectionRays");
 
-            generateDispatchRays(glossy_reflections_.rt_sample_count_buffer_);
+                uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, bin_reflection_rays_kernel_);
+                generateDispatch(glossy_reflections_.rt_sample_count_buffer_, num_threads[0]);
 
-            gfxCommandBindKernel(gfx_, trace_reflections_kernel_);
-            gfxCommandDispatchRaysIndirect(gfx_, sbt_, dispatch_command_buffer_);
-        }
-        else
-        {
-            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, trace_reflections_kernel_);
-            generateDispatch(glossy_reflections_.rt_sample_count_buffer_, num_threads[0]);
+                gfxCommandBindKernel(gfx_, bin_reflection_rays_kernel_);
+                gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
 
-            gfxCommandBindKernel(gfx_, trace_reflections_kernel_);
-            gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+                ray_sorter_.sortIndirectPayload(glossy_reflections_.rt_sample_key_buffer_,
+                    glossy_reflections_.rt_sample_count_buffer_,
+                    glossy_reflections_.rt_sample_buffer_.getCount(), glossy_reflections_.rt_sample_buffer_);
+            };
         }
 
-        gfxProgramSetParameter(gfx_, gi1_program_, "g_TextureSampler", capsaicin.getLinearSampler());
+        // Tracing the reflections also refreshes the decay of any cache tile it looks up
+        passes.push_back({"TraceReflections", {"GBuffers", "GlossyReflections", "HashGridCache_Values"},
+            {"GlossyReflections", "HashGridCache_Tiles"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "TraceReflections");
+
+            gfxProgramSetParameter(
+                gfx_, gi1_program_, "g_TextureSampler", capsaicin.getAnisotropicSampler());
+
+            if (options.gi1_use_dxr10)
+            {
+                gfxSbtSetShaderGroup(
+                    gfx_, sbt_, kGfxShaderGroupType_Raygen, 0, kTraceReflectionsRaygenShaderName);
+                gfxSbtSetShaderGroup(
+                    gfx_, sbt_, kGfxShaderGroupType_Miss, 0, kTraceReflectionsMissShaderName);
+                for (uint32_t i = 0; i < capsaicin.getRaytracingPrimitiveCount(); i++)
+                {
+                    gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Hit,
+                        i * capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit),
+                        kTraceReflectionsHitGroupName);
+                }
+
+                generateDispatchRays(glossy_reflections_.rt_sample_count_buffer_);
+
+                gfxCommandBindKernel(gfx_, trace_reflections_kernel_);
+                gfxCommandDispatchRaysIndirect(gfx_, sbt_, dispatch_command_buffer_);
+            }
+            else
+            {
+                uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, trace_reflections_kernel_);
+                generateDispatch(glossy_reflections_.rt_sample_count_buffer_, num_threads[0]);
+
+                gfxCommandBindKernel(gfx_, trace_reflections_kernel_);
+                gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+            }
+
+            gfxProgramSetParameter(gfx_, gi1_program_, "g_TextureSampler", capsaicin.getLinearSampler());
+        };
     }
 
     // Mark fireflies
     if (!options_.gi1_disable_specular_materials && options_.gi1_glossy_reflections_cleanup_fireflies)
     {
-        TimedSection const timed_section(*this, "MarkFireflies");
+        passes.push_back({"MarkFireflies", {"GBuffers", "GlossyReflections"},
+            {"GlossyReflections_Fireflies"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "MarkFireflies");
 
-        uint32_t const spec_buffer_dimensions[] = {glossy_reflections_.specular_buffer_.getWidth(),
-            glossy_reflections_.specular_buffer_.getHeight()};
+            uint32_t const spec_buffer_dimensions[] = {glossy_reflections_.specular_buffer_.getWidth(),
+                glossy_reflections_.specular_buffer_.getHeight()};
 
-        uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, mark_fireflies_kernel_);
-        uint32_t const  num_groups_x = (spec_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
-        uint32_t const  num_groups_y = (spec_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, mark_fireflies_kernel_);
+            uint32_t const  num_groups_x = (spec_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
+            uint32_t const  num_groups_y = (spec_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
 
-        gfxCommandBindKernel(gfx_, mark_fireflies_kernel_);
-        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+            gfxCommandBindKernel(gfx_, mark_fireflies_kernel_);
+            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+        };
     }
 
     // Cleanup fireflies from reflections
     if (!options_.gi1_disable_specular_materials && options_.gi1_glossy_reflections_cleanup_fireflies)
     {
-        TimedSection const timed_section(*this, "CleanupFireflies");
+        passes.push_back({"CleanupFireflies", {"GBuffers", "GlossyReflections",
+            "GlossyReflections_Fireflies"}, {"GlossyReflections"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "CleanupFireflies");
 
-        uint32_t const gloss_buffer_dimensions[] = {glossy_reflections_.specular_buffer_.getWidth(),
-            glossy_reflections_.specular_buffer_.getHeight()};
+            uint32_t const gloss_buffer_dimensions[] = {glossy_reflections_.specular_buffer_.getWidth(),
+                glossy_reflections_.specular_buffer_.getHeight()};
 
-        uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, cleanup_fireflies_kernel_);
-        uint32_t const  num_groups_x = (gloss_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
-        uint32_t const  num_groups_y = (gloss_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, cleanup_fireflies_kernel_);
+            uint32_t const  num_groups_x = (gloss_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
+            uint32_t const  num_groups_y = (gloss_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
 
-        gfxCommandBindKernel(gfx_, cleanup_fireflies_kernel_);
-        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+            gfxCommandBindKernel(gfx_, cleanup_fireflies_kernel_);
+            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+        };
     }
 
     // Resolve the reflections using the BRDF-based ratio estimator
     if (!options_.gi1_disable_specular_materials && options.gi1_glossy_reflections_denoiser_mode == 0)
     {
-        // X
-        {
-            TimedSection const timed_section(*this, "ResolveReflections Split X");
+        passes.push_back({"ResolveReflections", {"GBuffers", "GlossyReflections"}, {"GlossyReflections"}});
+        passes.back().execute = [&] {
+            // X
+            {
+                TimedSection const timed_section(*this, "ResolveReflections Split X");
 
-            GfxKernel const resolve_reflections_kernel_x = resolve_reflections_kernels_[0];
+                GfxKernel const resolve_reflections_kernel_x = resolve_reflections_kernels_[0];
 
-            uint32_t const reflect_buffer_dimensions[] = {glossy_reflections_.reflections_buffer0_.getWidth(),
-                glossy_reflections_.reflections_buffer0_.getHeight()};
+                uint32_t const reflect_buffer_dimensions[] = {
+                    glossy_reflections_.reflections_buffer0_.getWidth(),
+                    glossy_reflections_.reflections_buffer0_.getHeight()};
 
-            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, resolve_reflections_kernel_x);
-            uint32_t const  num_groups_x =
-                (reflect_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
-            uint32_t const num_groups_y =
-                (reflect_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
+                uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, resolve_reflections_kernel_x);
+                uint32_t const  num_groups_x =
+                    (reflect_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
+                uint32_t const num_groups_y =
+                    (reflect_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
 
-            gfxCommandBindKernel(gfx_, resolve_reflections_kernel_x);
-            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
-        }
+                gfxCommandBindKernel(gfx_, resolve_reflections_kernel_x);
+                gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+            }
 
-        // Y
-        {
-            TimedSection const timed_section(*this, "ResolveReflections Split Y");
+            // Y
+            {
+                TimedSection const timed_section(*this, "ResolveReflections Split Y");
 
-            GfxKernel const resolve_reflections_kernel_y = resolve_reflections_kernels_[1];
+                GfxKernel const resolve_reflections_kernel_y = resolve_reflections_kernels_[1];
 
-            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, resolve_reflections_kernel_y);
-            uint32_t const  num_groups_x = (render_dimensions.x + num_threads[0] - 1) / num_threads[0];
-            uint32_t const  num_groups_y = (render_dimensions.y + num_threads[1] - 1) / num_threads[1];
+                uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, resolve_reflections_kernel_y);
+                uint32_t const  num_groups_x = (render_dimensions.x + num_threads[0] - 1) / num_threads[0];
+                uint32_t const  num_groups_y = (render_dimensions.y + num_threads[1] - 1) / num_threads[1];
 
-            gfxCommandBindKernel(gfx_, resolve_reflections_kernel_y);
-            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
-        }
+                gfxCommandBindKernel(gfx_, resolve_reflections_kernel_y);
+                gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+            }
+        };
     }
-    else if (!options_.gi1_disable_specular_materials && options.gi1_glossy_reflections_denoiser_mode == 1)
-    {
-        constexpr std::string_view section_names[] = {"ResolveReflections Atrous 1",
-            "ResolveReflections Atrous 2", "ResolveReflections Atrous 3", "ResolveReflections Atrous 4",
-            "ResolveReflections Atrous 5", "ResolveReflections Atrous 6", "ResolveReflections Atrous 7"};
-        GFX_ASSERT((options.gi1_glossy_reflections_atrous_pass_count - 1)
-                   <= static_cast<int32_t>(std::size(section_names)));
-
-        GfxKernel const atrous_kernels[] = {resolve_reflections_kernels_[2], resolve_reflections_kernels_[3],
-            resolve_reflections_kernels_[4]};
-
-        // First
-        {
-            TimedSection const timed_section(*this, "ResolveReflections Atrous First");
-
-            GfxBuffer const glossy_reflections_atrous_constants =
-                capsaicin.allocateConstantBuffer<GlossyReflectionsAtrousConstants>(1);
-            GlossyReflectionsAtrousConstants glossy_reflections_atrous_constant_data = {};
-            glossy_reflections_atrous_constant_data.ping_pong                        = 0;
-            glossy_reflections_atrous_constant_data.full_step                        = 1;
-            glossy_reflections_atrous_constant_data.pass_index                       = 0;
-            gfxBufferGetData<GlossyReflectionsAtrousConstants>(gfx_, glossy_reflections_atrous_constants)[0] =
-                glossy_reflections_atrous_constant_data;
-            gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflectionsAtrousConstants",
-                glossy_reflections_atrous_constants);
-
-            uint32_t const gloss_buffer_dimensions[] = {glossy_reflections_.reflections_buffer0_.getWidth(),
-                glossy_reflections_.reflections_buffer0_.getHeight()};
-
-            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, atrous_kernels[0]);
-            uint32_t const  num_groups_x = (gloss_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
-            uint32_t const  num_groups_y = (gloss_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
 
-            gfxCommandBindKernel(gfx_, atrous_kernels[0]);
-            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+    // Resolve the reflections using the a-trous filter
+    if (!options_.gi1_disable_specular_materials && options.gi1_glossy_reflections_denoiser_mode == 1)
+    {
+        passes.push_back({"ResolveReflections", {"GBuffers", "GlossyReflections"}, {"GlossyReflections"}});
+        passes.back().execute = [&] {
+            constexpr std::string_view section_names[] = {"ResolveReflections Atrous 1",
+                "ResolveReflections Atrous 2", "ResolveReflections Atrous 3", "ResolveReflections Atrous 4",
+                "ResolveReflections Atrous 5", "ResolveReflections Atrous 6", "ResolveReflections Atrous 7"};
+            GFX_ASSERT((options.gi1_glossy_reflections_atrous_pass_count - 1)
+                       <= static_cast<int32_t>(std::size(section_names)));
 
-            gfxDestroyBuffer(gfx_, glossy_reflections_atrous_constants);
-        }
+            GfxKernel const atrous_kernels[] = {resolve_reflections_kernels_[2],
+                resolve_reflections_kernels_[3], resolve_reflections_kernels_[4]};
 
-        for (uint32_t pass_index = 1; pass_index < options.gi1_glossy_reflections_atrous_pass_count - 1;
-            ++pass_index)
-        {
-            // Iter
+            // First
             {
-                TimedSection const timed_section(*this, section_names[pass_index - 1]);
+                TimedSection const timed_section(*this, "ResolveReflections Atrous First");
 
                 GfxBuffer const glossy_reflections_atrous_constants =
                     capsaicin.allocateConstantBuffer<GlossyReflectionsAtrousConstants>(1);
                 GlossyReflectionsAtrousConstants glossy_reflections_atrous_constant_data = {};
-                glossy_reflections_atrous_constant_data.ping_pong =
-                    static_cast<int32_t>((pass_index + 1) % 2);
-                glossy_reflections_atrous_constant_data.full_step  = 1 << pass_index;
-                glossy_reflections_atrous_constant_data.pass_index = static_cast<int32_t>(pass_index);
+                glossy_reflections_atrous_constant_data.ping_pong                        = 0;
+                glossy_reflections_atrous_constant_data.full_step                        = 1;
+                glossy_reflections_atrous_constant_data.pass_index                       = 0;
                 gfxBufferGetData<GlossyReflectionsAtrousConstants>(
                     gfx_, glossy_reflections_atrous_constants)[0] = glossy_reflections_atrous_constant_data;
                 gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflectionsAtrousConstants",
                     glossy_reflections_atrous_constants);
 
-                uint32_t const refl_buffer_dimensions[] = {
+                uint32_t const gloss_buffer_dimensions[] = {
                     glossy_reflections_.reflections_buffer0_.getWidth(),
                     glossy_reflections_.reflections_buffer0_.getHeight()};
 
-                uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, atrous_kernels[1]);
+                uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, atrous_kernels[0]);
                 uint32_t const  num_groups_x =
-                    (refl_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
+                    (gloss_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
                 uint32_t const num_groups_y =
-                    (refl_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
+                    (gloss_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
 
-                gfxCommandBindKernel(gfx_, atrous_kernels[1]);
+                gfxCommandBindKernel(gfx_, atrous_kernels[0]);
                 gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
 
                 gfxDestroyBuffer(gfx_, glossy_reflections_atrous_constants);
             }
-        }
 
-        // Last
-        {
-            TimedSection const timed_section(*this, "ResolveReflections Atrous Last");
+            for (uint32_t pass_index = 1; pass_index < options.gi1_glossy_reflections_atrous_pass_count - 1;
+                ++pass_index)
+            {
+                // Iter
+                {
+                    TimedSection const timed_section(*this, section_names[pass_index - 1]);
+
+                    GfxBuffer const glossy_reflections_atrous_constants =
+                        capsaicin.allocateConstantBuffer<GlossyReflectionsAtrousConstants>(1);
+                    GlossyReflectionsAtrousConstants glossy_reflections_atrous_constant_data = {};
+                    glossy_reflections_atrous_constant_data.ping_pong =
+                        static_cast<int32_t>((pass_index + 1) % 2);
+                    glossy_reflections_atrous_constant_data.full_step  = 1 << pass_index;
+                    glossy_reflections_atrous_constant_data.pass_index = static_cast<int32_t>(pass_index);
+                    gfxBufferGetData<GlossyReflectionsAtrousConstants>(gfx_,
+                        glossy_reflections_atrous_constants)[0] = glossy_reflections_atrous_constant_data;
+                    gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflectionsAtrousConstants",
+                        glossy_reflections_atrous_constants);
+
+                    uint32_t const refl_buffer_dimensions[] = {
+                        glossy_reflections_.reflections_buffer0_.getWidth(),
+                        glossy_reflections_.reflections_buffer0_.getHeight()};
+
+                    uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, atrous_kernels[1]);
+                    uint32_t const  num_groups_x =
+                        (refl_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
+                    uint32_t const num_groups_y =
+                        (refl_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
+
+                    gfxCommandBindKernel(gfx_, atrous_kernels[1]);
+                    gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+
+                    gfxDestroyBuffer(gfx_, glossy_reflections_atrous_constants);
+                }
+            }
 
-            GfxBuffer const glossy_reflections_atrous_constants =
-                capsaicin.allocateConstantBuffer<GlossyReflectionsAtrousConstants>(1);
-            GlossyReflectionsAtrousConstants glossy_reflections_atrous_constant_data = {};
-            uint32_t const pass_index = options.gi1_glossy_reflections_atrous_pass_count - 1;
-            glossy_reflections_atrous_constant_data.ping_pong  = static_cast<int32_t>(pass_index) % 2;
-            glossy_reflections_atrous_constant_data.full_step  = 1 << pass_index;
-            glossy_reflections_atrous_constant_data.pass_index = static_cast<int32_t>(pass_index);
-            gfxBufferGetData<GlossyReflectionsAtrousConstants>(gfx_, glossy_reflections_atrous_constants)[0] =
-                glossy_reflections_atrous_constant_data;
-            gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflectionsAtrousConstants",
-                glossy_reflections_atrous_constants);
+            // Last
+            {
+                TimedSection const timed_section(*this, "ResolveReflections Atrous Last");
 
-            uint32_t const gloss_buffer_dimensions[] = {glossy_reflections_.reflections_buffer_.getWidth(),
-                glossy_reflections_.reflections_buffer_.getHeight()};
+                GfxBuffer const glossy_reflections_atrous_constants =
+                    capsaicin.allocateConstantBuffer<GlossyReflectionsAtrousConstants>(1);
+                GlossyReflectionsAtrousConstants glossy_reflections_atrous_constant_data = {};
+                uint32_t const pass_index = options.gi1_glossy_reflections_atrous_pass_count - 1;
+                glossy_reflections_atrous_constant_data.ping_pong  = static_cast<int32_t>(pass_index) % 2;
+                glossy_reflections_atrous_constant_data.full_step  = 1 << pass_index;
+                glossy_reflections_atrous_constant_data.pass_index = static_cast<int32_t>(pass_index);
+                gfxBufferGetData<GlossyReflectionsAtrousConstants>(
+                    gfx_, glossy_reflections_atrous_constants)[0] = glossy_reflections_atrous_constant_data;
+                gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflectionsAtrousConstants",
+                    glossy_reflections_atrous_constants);
 
-            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, atrous_kernels[2]);
-            uint32_t const  num_groups_x = (gloss_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
-            uint32_t const  num_groups_y = (gloss_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
+                uint32_t const gloss_buffer_dimensions[] = {
+                    glossy_reflections_.reflections_buffer_.getWidth(),
+                    glossy_reflections_.reflections_buffer_.getHeight()};
 
-            gfxCommandBindKernel(gfx_, atrous_kernels[2]);
-            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+                uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, atrous_kernels[2]);
+                uint32_t const  num_groups_x =
+                    (gloss_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
+                uint32_t const num_groups_y =
+                    (gloss_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
 
-            gfxDestroyBuffer(gfx_, glossy_reflections_atrous_constants);
-        }
+                gfxCommandBindKernel(gfx_, atrous_kernels[2]);
+                gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
 
-        // Unset deleted buffer
-        GfxBuffer const invalid_buffer {};
-        gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflectionsAtrousConstants", invalid_buffer);
+                gfxDestroyBuffer(gfx_, glossy_reflections_atrous_constants);
+            }
+
+            // Unset deleted buffer
+            GfxBuffer const invalid_buffer {};
+            gfxProgramSetParameter(gfx_, gi1_program_, "g_GlossyReflectionsAtrousConstants", invalid_buffer);
+        };
     }
 
     // Reproject the previous frame's reflections
     if (!options_.gi1_disable_specular_materials && options.gi1_glossy_reflections_denoiser_mode < 2)
     {
-        TimedSection const timed_section(*this, "ReprojectReflections");
+        passes.push_back({"ReprojectReflections", {"GBuffers", "GlossyReflections"}, {"Reflection"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "ReprojectReflections");
 
-        uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, reproject_reflections_kernel_);
-        uint32_t const  num_groups_x = (render_dimensions.x + num_threads[0] - 1) / num_threads[0];
-        uint32_t const  num_groups_y = (render_dimensions.y + num_threads[1] - 1) / num_threads[1];
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, reproject_reflections_kernel_);
+            uint32_t const  num_groups_x = (render_dimensions.x + num_threads[0] - 1) / num_threads[0];
+            uint32_t const  num_groups_y = (render_dimensions.y + num_threads[1] - 1) / num_threads[1];
 
-        gfxCommandBindKernel(gfx_, reproject_reflections_kernel_);
-        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+            gfxCommandBindKernel(gfx_, reproject_reflections_kernel_);
+            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+        };
     }
 
     // No denoiser
     if (!options_.gi1_disable_specular_materials && options.gi1_glossy_reflections_denoiser_mode == 2)
     {
-        TimedSection const timed_section(*this, "NoDenoiserReflections");
+        passes.push_back({"NoDenoiserReflections", {"GBuffers", "GlossyReflections"}, {"Reflection"}});
+        passes.back().execute = [&] {
+            TimedSection const timed_section(*this, "NoDenoiserReflections");
 
-        uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, no_denoiser_reflections_kernel_);
-        uint32_t const  num_groups_x = (render_dimensions.x + num_threads[0] - 1) / num_threads[0];
-        uint32_t const  num_groups_y = (render_dimensions.y + num_threads[1] - 1) / num_threads[1];
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, no_denoiser_reflections_kernel_);
+            uint32_t const  num_groups_x = (render_dimensions.x + num_threads[0] - 1) / num_threads[0];
+            uint32_t const  num_groups_y = (render_dimensions.y + num_threads[1] - 1) / num_threads[1];
 
-        gfxCommandBindKernel(gfx_, no_denoiser_reflections_kernel_);
-        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+            gfxCommandBindKernel(gfx_, no_denoiser_reflections_kernel_);
+            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+        };
     }
 
     // Reproject the previous frame's global illumination
-    {
+    passes.push_back({"Denoiser - Temporal ReprojectGI", {"GBuffers", "GIDenoiser"}, {"GIDenoiser"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "Denoiser - Temporal ReprojectGI");
 
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, reproject_gi_kernel_);
@@ -2890,10 +3405,11 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
         gfxCommandBindKernel(gfx_, reproject_gi_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
-    }
+    };
 
     // And blur our disocclusions
-    {
+    passes.push_back({"Denoiser - FilterGI", {"GBuffers", "GIDenoiser"}, {"GIDenoiser", "Irradiance"}});
+    passes.back().execute = [&] {
         TimedSection const timed_section(*this, "Denoiser - FilterGI");
 
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, filter_gi_kernel_);
@@ -2920,12 +3436,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
         }
-    }
-
-    gfxProgramSetParameter(gfx_, gi1_program_, "g_IrradianceBuffer", irradiance_buffer_);
+    };
 
     // Finally, we can resolve the filtered lighting with the per-pixel material details
-    {
+    passes.push_back({"ResolveGI1", {"GBuffers", "GIDenoiser", "Irradiance", "Reflection"},
+        {"GlobalIllumination"}, false});
+    passes.back().execute = [&] {
         gfxProgramSetParameter(gfx_, gi1_program_, "g_TextureSampler", capsaicin.getAnisotropicSampler());
 
         TimedSection const timed_section(*this, "ResolveGI1");
@@ -2933,18 +3449,19 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
         gfxCommandBindColorTarget(gfx_, 0, capsaicin.getSharedTexture("GlobalIllumination"));
         gfxCommandBindKernel(gfx_, resolve_gi1_kernel_);
         gfxCommandDraw(gfx_, 3);
-    }
 
-    // Debug hash grid cache bucket occupancy (as histogram)
-    if (options_.gi1_hash_grid_cache_debug_stats)
-    {
-        auto &free_bucket_count          = hash_grid_cache_.debug_free_bucket_count_;
-        auto &used_bucket_count          = hash_grid_cache_.debug_used_bucket_count_;
-        auto &bucket_occupancy_histogram = hash_grid_cache_.debug_bucket_occupancy_histogram_;
-        auto &bucket_overflow_histogram  = hash_grid_cache_.debug_bucket_overflow_histogram_;
+        gfxProgramSetParameter(gfx_, gi1_program_, "g_TextureSampler", capsaicin.getLinearSampler());
+    };
 
+    // Debug hash grid cache bucket occupancy (as histogram), statistics used for automatic sizing only need
+    // to be sampled at low frequency
+    if (use_hash_grid_stats
+        && (options_.gi1_hash_grid_cache_debug_stats
+            || frame_index % std::max(options_.gi1_hash_grid_cache_auto_size_interval, 1U) == 0))
+    {
         // Build histogram
-        {
+        passes.push_back({"ClearBucketOccupancy", {}, {"HashGridCache_Stats"}});
+        passes.back().execute = [&] {
             TimedSection const timed_section(*this, "ClearBucketOccupancy");
 
             uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, clear_bucket_occupancy_kernel_);
@@ -2954,8 +3471,9 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             gfxCommandBindKernel(gfx_, clear_bucket_occupancy_kernel_);
             gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
-        }
-        {
+        };
+        passes.push_back({"ClearBucketOverflow", {}, {"HashGridCache_Stats"}});
+        passes.back().execute = [&] {
             TimedSection const timed_section(*this, "ClearBucketOverflow");
 
             uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, clear_bucket_overflow_kernel_);
@@ -2965,8 +3483,10 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             gfxCommandBindKernel(gfx_, clear_bucket_overflow_kernel_);
             gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
-        }
-        {
+        };
+        passes.push_back(
+            {"BuildBucketStats", {"HashGridCache_Tiles", "HashGridCache_Stats"}, {"HashGridCache_Stats"}});
+        passes.back().execute = [&] {
             TimedSection const timed_section(*this, "BuildBucketStats");
 
             uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, build_bucket_stats_kernel_);
@@ -2975,8 +3495,9 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             gfxCommandBindKernel(gfx_, build_bucket_stats_kernel_);
             gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
-        }
-        {
+        };
+        passes.push_back({"FormatBucketOccupancy", {"HashGridCache_Stats"}, {"HashGridCache_Stats"}});
+        passes.back().execute = [&] {
             TimedSection const timed_section(*this, "FormatBucketOccupancy");
 
             uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, format_bucket_occupancy_kernel_);
@@ -2986,8 +3507,9 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             gfxCommandBindKernel(gfx_, format_bucket_occupancy_kernel_);
             gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
-        }
-        {
+        };
+        passes.push_back({"FormatBucketOverflow", {"HashGridCache_Stats"}, {"HashGridCache_Stats"}});
+        passes.back().execute = [&] {
             TimedSection const timed_section(*this, "FormatBucketOverflow");
 
             uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, format_bucket_overflow_kernel_);
@@ -2997,10 +3519,12 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             gfxCommandBindKernel(gfx_, format_bucket_overflow_kernel_);
             gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
-        }
+        };
 
         // Copy stats buffer for delayed read-back
-        {
+        passes.push_back(
+            {"CopyBucketStats", {"HashGridCache_Stats"}, {"HashGridCache_StatsReadback"}, false});
+        passes.back().execute = [&] {
             TimedSection const timed_section(*this, "CopyBucketStats");
 
             uint32_t const copy_index = (frame_index + 0) % kGfxConstant_BackBufferCount;
@@ -3012,7 +3536,22 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
 
             GFX_ASSERT(!hash_grid_cache_.radiance_cache_debug_stats_readback_is_pending_[copy_index]);
             hash_grid_cache_.radiance_cache_debug_stats_readback_is_pending_[copy_index] = true;
-        }
+
+            // Label the sample with the size it was captured at, as the cache may be resized before read-back
+            hash_grid_cache_.radiance_cache_debug_stats_readback_sizes_[copy_index] =
+                uint2(std::countr_zero(hash_grid_cache_.num_buckets_),
+                    std::countr_zero(hash_grid_cache_.num_tiles_per_bucket_));
+        };
+    }
+
+    executePasses(passes);
+
+    if (use_hash_grid_stats)
+    {
+        auto &free_bucket_count          = hash_grid_cache_.debug_free_bucket_count_;
+        auto &used_bucket_count          = hash_grid_cache_.debug_used_bucket_count_;
+        auto &bucket_occupancy_histogram = hash_grid_cache_.debug_bucket_occupancy_histogram_;
+        auto &bucket_overflow_histogram  = hash_grid_cache_.debug_bucket_overflow_histogram_;
 
         // Read-back stats
         if (uint32_t const readback_index = (frame_index + 1) % kGfxConstant_BackBufferCount;
@@ -3039,6 +3578,28 @@ void GI1::render(CapsaicinInternal &capsaicin) noexcept
                 formatted_data_cursor, bucket_overflow_histogram.size(), bucket_overflow_histogram.begin());
 
             hash_grid_cache_.radiance_cache_debug_stats_readback_is_pending_[readback_index] = false;
+
+            if (options_.gi1_hash_grid_cache_auto_size)
+            {
+                HashGridCacheSizeController::Statistics statistics;
+                uint2 const size =
+                    hash_grid_cache_.radiance_cache_debug_stats_readback_sizes_[readback_index];
+                statistics.num_buckets          = size.x;
+                statistics.num_tiles_per_bucket = size.y;
+                statistics.free_bucket_count    = free_bucket_count;
+                statistics.used_bucket_count    = used_bucket_count;
+                statistics.bucket_occupancy     = bucket_occupancy_histogram;
+                statistics.bucket_overflow      = bucket_overflow_histogram;
+
+                // The new size is picked up by ensureMemoryIsAllocated() on the next frame
+                if (auto const decision = hash_grid_cache_.size_controller_.update(statistics);
+                    decision.resize)
+                {
+                    capsaicin.setOption<uint32_t>("gi1_hash_grid_cache_num_buckets", decision.num_buckets);
+                    capsaicin.setOption<uint32_t>(
+                        "gi1_hash_grid_cache_num_tiles_per_bucket", decision.num_tiles_per_bucket);
+                }
+            }
         }
         else
         {
@@ -3127,6 +3688,7 @@ void GI1::terminate() noexcept
     gfxDestroyKernel(gfx_, compact_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, patch_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, sample_screen_probes_kernel_);
+    gfxDestroyKernel(gfx_, bin_screen_probe_rays_kernel_);
     gfxDestroyKernel(gfx_, populate_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, blend_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, reorder_screen_probes_kernel_);
@@ -3153,6 +3715,7 @@ void GI1::terminate() noexcept
     gfxDestroyKernel(gfx_, compact_reservoirs_kernel_);
     gfxDestroyKernel(gfx_, resample_reservoirs_kernel_);
 
+    gfxDestroyKernel(gfx_, bin_reflection_rays_kernel_);
     gfxDestroyKernel(gfx_, trace_reflections_kernel_);
     for (auto const &resolve_reflections_kernel : resolve_reflections_kernels_)
     {
@@ -3208,6 +3771,58 @@ void GI1::renderGUI(CapsaicinInternal &capsaicin) const noexcept
     {
         capsaicin.setOption<bool>("gi1_disable_specular_materials", disable_specular);
     }
+    // Binning cost and gains show up in the 'BinScreenProbeRays'/'BinReflectionRays' and trace pass timings
+    // (the multibounce rays are never binned)
+    if (auto use_ray_binning = capsaicin.getOption<bool>("gi1_use_ray_binning");
+        ImGui::Checkbox("Use Ray Binning", &use_ray_binning))
+    {
+        capsaicin.setOption<bool>("gi1_use_ray_binning", use_ray_binning);
+    }
+    if (auto use_packed_storage = capsaicin.getOption<bool>("gi1_use_packed_storage");
+        ImGui::Checkbox("Use Packed Storage", &use_packed_storage))
+    {
+        capsaicin.setOption<bool>("gi1_use_packed_storage", use_packed_storage);
+    }
+    ImGui::Text("Total Memory Size : %u MB", static_cast<uint32_t>(debug_total_memory_size_in_bytes_ >> 20));
+
+    if (ImGui::CollapsingHeader("Screen Probes", ImGuiTreeNodeFlags_None))
+    {
+        auto &use_variable_rate = capsaicin.getOption<bool>("gi1_use_variable_rate_probes");
+        ImGui::Checkbox("Variable Rate Probes", &use_variable_rate);
+        if (use_variable_rate)
+        {
+            auto &low_threshold  = capsaicin.getOption<float>("gi1_variable_rate_probes_low_threshold");
+            auto &high_threshold = capsaicin.getOption<float>("gi1_variable_rate_probes_high_threshold");
+            ImGui::DragFloat("Sparse Importance Threshold", &low_threshold, 0.005F, 0.0F, high_threshold);
+            ImGui::DragFloat("Dense Importance Threshold", &high_threshold, 0.005F, low_threshold, 4.0F);
+
+            auto const &allocation = screen_probes_.debug_allocation_;
+            ImGui::Text("Spawned Probes   : %u / %u", allocation.getProbeCount(), allocation.budget);
+            ImGui::Text("Dropped Probes   : %u", allocation.dropped_count);
+
+            // The saving is only meaningful next to the quality lost against the reference image
+            double ssim = -1.0;
+            for (auto const &node : capsaicin.getStatistics())
+            {
+                if (node.name == "Image Metrics")
+                {
+                    for (auto const &statistic : node.children)
+                    {
+                        ssim = statistic.name == "PQ-SSIM" ? statistic.value : ssim;
+                    }
+                }
+            }
+            double const ray_saving = 100.0 * static_cast<double>(allocation.getRayBudgetSaved());
+            if (ssim >= 0.0)
+            {
+                ImGui::Text("Ray Budget Saved : %.1f%% at PQ-SSIM %.4f", ray_saving, ssim);
+            }
+            else
+            {
+                ImGui::Text("Ray Budget Saved : %.1f%% (enable image metrics for quality loss)", ray_saving);
+            }
+        }
+    }
 
     if (ImGui::CollapsingHeader("Hash Grid Cache", ImGuiTreeNodeFlags_None))
     {
@@ -3227,6 +3842,32 @@ void GI1::renderGUI(CapsaicinInternal &capsaicin) const noexcept
                 static_cast<uint32_t>(glm::clamp(num_tiles_per_bucket, 1, 8)));
         }
 
+        auto &use_cuckoo_hashing = capsaicin.getOption<bool>("gi1_hash_grid_cache_use_cuckoo_hashing");
+        ImGui::Checkbox("Cuckoo Hashing", &use_cuckoo_hashing);
+
+        auto &auto_size = capsaicin.getOption<bool>("gi1_hash_grid_cache_auto_size");
+        ImGui::Checkbox("Automatic Sizing", &auto_size);
+        if (auto_size)
+        {
+            auto auto_size_interval = static_cast<int32_t>(
+                capsaicin.getOption<uint32_t>("gi1_hash_grid_cache_auto_size_interval"));
+            if (ImGui::SliderInt("Sampling Interval (frames)", &auto_size_interval, 1, 240))
+            {
+                capsaicin.setOption<uint32_t>("gi1_hash_grid_cache_auto_size_interval",
+                    static_cast<uint32_t>(glm::clamp(auto_size_interval, 1, 240)));
+            }
+            ImGui::Text("Tile Occupancy : %.1f%%", 100.0F * hash_grid_cache_.size_controller_.getOccupancy());
+            ImGui::Text(
+                "Overflow Ratio : %.2f%%", 100.0F * hash_grid_cache_.size_controller_.getOverflowRatio());
+        }
+
+        auto &persistent = capsaicin.getOption<bool>("gi1_hash_grid_cache_persistent");
+        ImGui::Checkbox("Load Cache at Scene Load", &persistent);
+        if (ImGui::Button("Save Cache"))
+        {
+            capsaicin.setOption<bool>("gi1_hash_grid_cache_save", true);
+        }
+
         auto &debug_stats = capsaicin.getOption<bool>("gi1_hash_grid_cache_debug_stats");
         ImGui::Checkbox("Debug Statistics", &debug_stats);
         if (debug_stats && ImGui::CollapsingHeader("Hash Grid Cache", ImGuiTreeNodeFlags_DefaultOpen))
@@ -3258,6 +3899,56 @@ void GI1::renderGUI(CapsaicinInternal &capsaicin) const noexcept
             ImGui::Text("Total Memory Size : %u MB", static_cast<uint32_t>(total_memory_size_in_bytes >> 20));
         }
     }
+
+    if (ImGui::CollapsingHeader("Async Compute Analysis", ImGuiTreeNodeFlags_None))
+    {
+        auto const &passes = pass_graph_.getPasses();
+        ImGui::Text("Critical Path : %u of %u passes", pass_schedule_.level_count,
+            static_cast<uint32_t>(passes.size()));
+        auto const &async_passes = pass_schedule_.queue_passes[PassDependencyGraph::kQueue_AsyncCompute];
+        ImGui::Text("Async Passes  : %u", static_cast<uint32_t>(async_passes.size()));
+        ImGui::Text("Fences        : %u", static_cast<uint32_t>(pass_schedule_.fences.size()));
+        for (uint32_t pass_index = 0; pass_index < static_cast<uint32_t>(passes.size()); ++pass_index)
+        {
+            ImGui::Text("%2u %s %s", pass_schedule_.levels[pass_index],
+                pass_schedule_.queues[pass_index] == PassDependencyGraph::kQueue_AsyncCompute ? "[Async] "
+                                                                                               : "[Direct]",
+                passes[pass_index].name.c_str());
+        }
+    }
+}
+
+void GI1::executePasses(std::vector<RenderPass> const &passes)
+{
+    // The analysis only needs rebuilding when the options change the declared passes
+    auto const &declared_passes = pass_graph_.getPasses();
+    bool        needs_rebuild   = declared_passes.size() != passes.size();
+    for (size_t pass_index = 0; !needs_rebuild && pass_index < passes.size(); ++pass_index)
+    {
+        auto const &declared_pass = declared_passes[pass_index];
+        auto const &pass          = passes[pass_index];
+        needs_rebuild             = declared_pass.name != pass.name
+                     || !std::ranges::equal(declared_pass.reads, pass.reads)
+                     || !std::ranges::equal(declared_pass.writes, pass.writes)
+                     || declared_pass.async_compute != pass.async_compute;
+    }
+    if (needs_rebuild)
+    {
+        pass_graph_.clear();
+        for (auto const &pass : passes)
+        {
+            pass_graph_.addPass(pass.name, pass.reads, pass.writes, pass.async_compute);
+        }
+        pass_schedule_ = pass_graph_.build();
+    }
+
+    // gfx records everything on a single direct queue, so reordering would gain nothing. The passes also
+    // share state that is not declared (the dispatch arguments, program parameters and CPU read-backs), so
+    // they are recorded in declaration order and the schedule is only reported as an analysis
+    for (auto const &pass : passes)
+    {
+        pass.execute();
+    }
 }
 
 void GI1::generateDispatch(GfxBuffer const &count_buffer, uint32_t const group_size) const
@@ -3269,6 +3960,83 @@ void GI1::generateDispatch(GfxBuffer const &count_buffer, uint32_t const group_s
     gfxCommandDispatch(gfx_, 1, 1, 1);
 }
 
+uint64_t GI1::calculateTotalMemorySize() const noexcept
+{
+    auto const get_texture_size = [](GfxTexture const &texture) -> uint64_t {
+        uint64_t bytes_per_pixel = 0;
+        switch (texture.getFormat())
+        {
+        case DXGI_FORMAT_R32G32B32A32_FLOAT: bytes_per_pixel = 16; break;
+        case DXGI_FORMAT_R16G16B16A16_FLOAT: bytes_per_pixel = 8; break;
+        case DXGI_FORMAT_R11G11B10_FLOAT:
+        case DXGI_FORMAT_R32_UINT:
+        case DXGI_FORMAT_D32_FLOAT: bytes_per_pixel = 4; break;
+        case DXGI_FORMAT_R16_FLOAT: bytes_per_pixel = 2; break;
+        case DXGI_FORMAT_R8_SNORM: bytes_per_pixel = 1; break;
+        default: break;
+        }
+        // Approximation: includes the mip chain but ignores any padding added by the driver
+        uint64_t texture_size = 0;
+        for (uint32_t mip_level = 0; mip_level < texture.getMipLevels(); ++mip_level)
+        {
+            texture_size += static_cast<uint64_t>(GFX_MAX(texture.getWidth() >> mip_level, 1U))
+                          * GFX_MAX(texture.getHeight() >> mip_level, 1U) * bytes_per_pixel;
+        }
+        return texture_size;
+    };
+
+    // The hash grid cache already keeps track of its own memory usage
+    uint64_t total_memory_size_in_bytes = hash_grid_cache_.debug_total_memory_size_in_bytes_;
+    for (GfxTexture const *texture : {&depth_buffer_, &irradiance_buffer_, &screen_probes_.probe_buffers_[0],
+             &screen_probes_.probe_buffers_[1], &screen_probes_.probe_mask_buffers_[0],
+             &screen_probes_.probe_mask_buffers_[1], &screen_probes_.probe_cached_tile_buffer_,
+             &screen_probes_.probe_cached_tile_index_buffer_, &gi_denoiser_.blur_mask_,
+             &gi_denoiser_.color_buffers_[0], &gi_denoiser_.color_buffers_[1],
+             &gi_denoiser_.color_delta_buffers_[0], &gi_denoiser_.color_delta_buffers_[1]})
+    {
+        total_memory_size_in_bytes += get_texture_size(*texture);
+    }
+    for (GfxTexture const &texture : glossy_reflections_.texture_float_)
+    {
+        total_memory_size_in_bytes += get_texture_size(texture);
+    }
+    for (GfxTexture const &texture : glossy_reflections_.texture_float4_)
+    {
+        total_memory_size_in_bytes += get_texture_size(texture);
+    }
+    ScreenProbes const &probes = screen_probes_;
+    for (GfxBuffer const *buffer : {&probes.probe_sh_buffers_[0], &probes.probe_sh_buffers_[1],
+             &probes.probe_spawn_buffers_[0], &probes.probe_spawn_buffers_[1],
+             &probes.probe_spawn_scan_buffer_, &probes.probe_spawn_index_buffer_,
+             &probes.probe_spawn_extra_scan_buffer_,
+             &probes.probe_spawn_extra_index_buffer_, &probes.probe_spawn_probe_buffer_,
+             &probes.probe_spawn_sample_buffer_, &probes.probe_spawn_radiance_buffer_,
+             &probes.probe_ray_key_buffer_, &probes.probe_ray_index_buffer_, &probes.probe_empty_tile_buffer_,
+             &probes.probe_override_tile_buffer_, &probes.probe_cached_tile_lru_buffers_[0],
+             &probes.probe_cached_tile_lru_buffers_[1], &probes.probe_cached_tile_lru_flag_buffer_,
+             &probes.probe_cached_tile_lru_index_buffer_, &probes.probe_cached_tile_mru_buffer_,
+             &probes.probe_cached_tile_list_buffer_, &probes.probe_cached_tile_list_index_buffer_,
+             &probes.probe_cached_tile_list_element_buffer_})
+    {
+        total_memory_size_in_bytes += buffer->getSize();
+    }
+    WorldSpaceReSTIR const &restir = world_space_restir_;
+    for (GfxBuffer const *buffer : {&restir.reservoir_hash_buffers_[0], &restir.reservoir_hash_buffers_[1],
+             &restir.reservoir_hash_index_buffers_[0], &restir.reservoir_hash_index_buffers_[1],
+             &restir.reservoir_hash_value_buffers_[0], &restir.reservoir_hash_value_buffers_[1],
+             &restir.reservoir_hash_list_buffer_, &restir.reservoir_indirect_sample_buffer_,
+             &restir.reservoir_indirect_sample_normal_buffers_[0],
+             &restir.reservoir_indirect_sample_normal_buffers_[1],
+             &restir.reservoir_indirect_sample_material_buffer_,
+             &restir.reservoir_indirect_sample_reservoir_buffers_[0],
+             &restir.reservoir_indirect_sample_reservoir_buffers_[1], &glossy_reflections_.rt_sample_buffer_,
+             &glossy_reflections_.rt_sample_key_buffer_})
+    {
+        total_memory_size_in_bytes += buffer->getSize();
+    }
+    return total_memory_size_in_bytes;
+}
+
 void GI1::generateDispatchRays(GfxBuffer const &count_buffer) const
 {
     gfxProgramSetParameter(gfx_, gi1_program_, "g_CountBuffer", count_buffer);
@@ -3284,6 +4052,7 @@ void GI1::clearHashGridCache() const
         gfxCommandClearBuffer(gfx_, hash_grid_cache_.radiance_cache_hash_buffer_); // clear the radiance cache
         gfxCommandClearBuffer(gfx_, hash_grid_cache_.radiance_cache_packed_tile_count_buffer0_);
         gfxCommandClearBuffer(gfx_, hash_grid_cache_.radiance_cache_packed_tile_count_buffer1_);
+        hash_grid_cache_.needs_file_load_ = true;
     }
 }
 } // namespace Capsaicin
@@ -22,9 +22,15 @@ THE SOFTWARE.
 #pragma once
 
 #include "gi1_shared.h"
+#include "hash_grid_cache_file.h"
+#include "hash_grid_cache_size_controller.h"
 #include "render_technique.h"
+#include "screen_probes_allocator.h"
+#include "utilities/gpu_sort.h"
+#include "utilities/pass_dependency_graph.h"
 
 #include <gfx_scene.h>
+#include <functional>
 
 namespace Capsaicin
 {
@@ -55,11 +61,17 @@ class GI1 final : public RenderTechnique
         bool     gi1_use_multibounce                                     = true;
         bool     gi1_disable_albedo_textures                             = false;
         bool     gi1_disable_specular_materials                          = false;
+        bool     gi1_use_variable_rate_probes                            = false; // Follow variance
+        float    gi1_variable_rate_probes_low_threshold                  = 0.05F; // Sparse below
+        float    gi1_variable_rate_probes_high_threshold                 = 0.25F; // Dense above
+        bool     gi1_use_ray_binning                                     = false; // Sort primary rays
+        bool     gi1_use_packed_storage                                  = false; // Smaller GI buffers
         float    gi1_hash_grid_cache_cell_size                           = 32.0F;
         float    gi1_hash_grid_cache_min_cell_size                       = 1e-1F;
         uint32_t gi1_hash_grid_cache_tile_cell_ratio                     = 8;     // 8x8
         uint32_t gi1_hash_grid_cache_num_buckets                         = 14;    // 1 << 14
         uint32_t gi1_hash_grid_cache_num_tiles_per_bucket                = 4;     // 1 <<  4
+        bool     gi1_hash_grid_cache_use_cuckoo_hashing                  = false; // Two candidate buckets
         float    gi1_hash_grid_cache_max_sample_count                    = 16.0F; //
         float    gi1_hash_grid_cache_discard_multibounce_ray_probability = 0.7F;
         float    gi1_hash_grid_cache_max_multibounce_sample_count        = 16.0F;
@@ -68,6 +80,10 @@ class GI1 final : public RenderTechnique
         uint32_t gi1_hash_grid_cache_debug_max_cell_decay      = 0; // Debug cells touched this frame
         bool     gi1_hash_grid_cache_debug_stats               = false;
         uint32_t gi1_hash_grid_cache_debug_max_bucket_overflow = 64;
+        bool     gi1_hash_grid_cache_auto_size                 = false; // Resize based on bucket statistics
+        uint32_t gi1_hash_grid_cache_auto_size_interval        = 30;    // Frames between statistics samples
+        bool     gi1_hash_grid_cache_persistent                = false; // Warm-start from disk at scene load
+        bool     gi1_hash_grid_cache_save                      = false; // Save to disk, reset once done
         float    gi1_reservoir_cache_cell_size                 = 16.0F;
 
         bool     gi1_glossy_reflections_halfres                            = true;
@@ -119,6 +135,12 @@ class GI1 final : public RenderTechnique
      */
     [[nodiscard]] DebugViewList getDebugViews() const noexcept override;
 
+    /**
+     * Gets a list of any statistics gathered by the current render technique during the last frames.
+     * @return A list of all available statistics.
+     */
+    [[nodiscard]] StatisticList getStatistics() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -150,6 +172,33 @@ class GI1 final : public RenderTechnique
     void generateDispatchRays(GfxBuffer const &count_buffer) const;
     void clearHashGridCache() const;
 
+    /** A GI-1 pass along with the resources it accesses. */
+    struct RenderPass
+    {
+        std::string_view              name;
+        std::vector<std::string_view> reads;
+        std::vector<std::string_view> writes;
+        bool                          async_compute = true; /**< May run on the async compute queue */
+        std::function<void()>         execute;
+    };
+
+    /**
+     * Records the declared passes in declaration order, and analyses the async compute schedule that the
+     * resources they access would allow for display in the UI.
+     * Resources are tracked at the granularity of each building block's buffer groups. Resources that no pass
+     * writes (the scene, the previous frame's outputs) need not be declared. State shared between passes such
+     * as the dispatch arguments or the program parameters is not tracked, so the analysis is not a valid
+     * execution order.
+     * @param passes The passes of the frame, in submission order.
+     */
+    void executePasses(std::vector<RenderPass> const &passes);
+
+    /**
+     * Calculates the GPU memory used by all the GI-1 buffers and textures.
+     * @return The total size in bytes.
+     */
+    [[nodiscard]] uint64_t calculateTotalMemorySize() const noexcept;
+
     class Base
     {
     public:
@@ -205,9 +254,14 @@ class GI1 final : public RenderTechnique
         GfxBuffer  probe_spawn_buffers_[2];
         GfxBuffer  probe_spawn_scan_buffer_;
         GfxBuffer  probe_spawn_index_buffer_;
+        GfxBuffer  probe_spawn_extra_scan_buffer_;
+        GfxBuffer  probe_spawn_extra_index_buffer_;
         GfxBuffer  probe_spawn_probe_buffer_;
         GfxBuffer  probe_spawn_sample_buffer_;
         GfxBuffer  probe_spawn_radiance_buffer_;
+        GfxBuffer  probe_ray_key_buffer_;
+        GfxBuffer  probe_ray_index_buffer_;
+        GfxBuffer  probe_ray_count_buffer_;
         GfxBuffer  probe_empty_tile_buffer_;
         GfxBuffer  probe_empty_tile_count_buffer_;
         GfxBuffer  probe_override_tile_buffer_;
@@ -225,6 +279,10 @@ class GI1 final : public RenderTechnique
         GfxBuffer  probe_cached_tile_list_index_buffer_;
         GfxBuffer  probe_cached_tile_list_element_buffer_;
         GfxBuffer  probe_cached_tile_list_element_count_buffer_;
+        GfxBuffer  probe_spawn_count_readback_buffers_[kGfxConstant_BackBufferCount];
+        bool       probe_spawn_count_readback_is_pending_[kGfxConstant_BackBufferCount] = {};
+
+        ScreenProbesAllocator::Allocation debug_allocation_; /**< Probe counts read back from the GPU */
     };
 
     // Used for caching in world space the lighting calculated at primary (same as screen probes) and
@@ -241,6 +299,44 @@ class GI1 final : public RenderTechnique
 
         void ensureMemoryIsAllocated(RenderOptions const &options, std::string_view const &debug_view);
 
+        /**
+         * Gets the layout of the currently allocated cache as stored in cache files.
+         * @param capsaicin Current framework context.
+         * @param options   Current render options.
+         * @return The cache layout.
+         */
+        [[nodiscard]] HashGridCacheFile::Layout getFileLayout(
+            CapsaicinInternal const &capsaicin, RenderOptions const &options) const;
+
+        /**
+         * Gets the cache file of the current scene.
+         * @param capsaicin Current framework context.
+         * @param layout    The cache layout (used for its scene hash).
+         * @return The file path, empty if no scene is loaded.
+         */
+        [[nodiscard]] static std::filesystem::path GetFilePath(
+            CapsaicinInternal const &capsaicin, HashGridCacheFile::Layout const &layout);
+
+        /**
+         * Reads back the cache contents and writes them to disk.
+         * @note This stalls until all previously submitted GPU work has completed.
+         * @param file_path The file to write.
+         * @param layout    The layout of the currently allocated cache.
+         * @return True if successful.
+         */
+        bool saveToFile(
+            std::filesystem::path const &file_path, HashGridCacheFile::Layout const &layout) const;
+
+        /**
+         * Loads the cache contents from disk, the file is ignored if its layout does not match.
+         * @param file_path   The file to read.
+         * @param layout      The layout of the currently allocated cache.
+         * @param frame_index The current frame index, loaded tiles are considered touched this frame.
+         * @return True if successful.
+         */
+        bool loadFromFile(std::filesystem::path const &file_path, HashGridCacheFile::Layout const &layout,
+            uint32_t frame_index) const;
+
         uint32_t max_ray_count_                         = 0;
         uint32_t max_combined_ray_count_                = 0;
         uint32_t num_buckets_                           = 0;
@@ -302,11 +398,15 @@ class GI1 final : public RenderTechnique
         GfxBuffer &radiance_cache_debug_stats_buffer_;
         GfxBuffer  radiance_cache_debug_stats_readback_buffers_[kGfxConstant_BackBufferCount];
         bool       radiance_cache_debug_stats_readback_is_pending_[kGfxConstant_BackBufferCount];
+        uint2      radiance_cache_debug_stats_readback_sizes_[kGfxConstant_BackBufferCount]; /**< Log2 dims */
 
         std::vector<float> debug_bucket_occupancy_histogram_;
         std::vector<float> debug_bucket_overflow_histogram_;
         float              debug_free_bucket_count_ = 0.0F;
         float              debug_used_bucket_count_ = 0.0F;
+
+        HashGridCacheSizeController size_controller_;
+        mutable bool needs_file_load_ = true; /**< Set on cache resets, to warm-start the cache from disk */
     };
 
     // Used for sampling the direct lighting at primary (i.e., direct lighting; disabled by default) and
@@ -369,6 +469,7 @@ class GI1 final : public RenderTechnique
         GfxTexture &average_squared_buffer1_;
 
         GfxBuffer rt_sample_buffer_;
+        GfxBuffer rt_sample_key_buffer_;
         GfxBuffer rt_sample_count_buffer_;
     };
 
@@ -398,12 +499,19 @@ class GI1 final : public RenderTechnique
     GfxBuffer        draw_command_buffer_;
     GfxBuffer        dispatch_command_buffer_;
 
+    // GI-1 pass dependencies:
+    PassDependencyGraph           pass_graph_;
+    PassDependencyGraph::Schedule pass_schedule_;
+
     // GI-1 building blocks:
     ScreenProbes      screen_probes_;
     HashGridCache     hash_grid_cache_;
     WorldSpaceReSTIR  world_space_restir_;
     GlossyReflections glossy_reflections_;
     GIDenoiser        gi_denoiser_;
+    GPUSort           ray_sorter_; /**< Bins the rays by direction octant and origin cell */
+
+    uint64_t debug_total_memory_size_in_bytes_ = 0;
 
     // GI-1 kernels:
     GfxProgram gi1_program_;
@@ -428,6 +536,7 @@ class GI1 final : public RenderTechnique
     GfxKernel compact_screen_probes_kernel_;
     GfxKernel patch_screen_probes_kernel_;
     GfxKernel sample_screen_probes_kernel_;
+    GfxKernel bin_screen_probe_rays_kernel_;
     GfxKernel populate_screen_probes_kernel_;
     GfxKernel blend_screen_probes_kernel_;
     GfxKernel reorder_screen_probes_kernel_;
@@ -458,6 +567,7 @@ class GI1 final : public RenderTechnique
     GfxKernel resample_reservoirs_kernel_;
 
     // Reflection kernels:
+    GfxKernel bin_reflection_rays_kernel_;
     GfxKernel trace_reflections_kernel_;
     GfxKernel resolve_reflections_kernels_[5];
     GfxKernel reproject_reflections_kernel_;
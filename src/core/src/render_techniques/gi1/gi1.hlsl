@@ -62,4 +62,28 @@ float2 CalculateHaltonSequence(in uint index)
                   CalculateHaltonNumber((index & 0xFFu) + 1, 3));
 }
 
+// Interleaves the lower 12 bits of a value with zeros (i.e., half a 2D Morton code).
+uint SpreadRayBinningBits(in uint value)
+{
+    value &= 0x00000FFFu;
+    value  = (value | (value << 8)) & 0x00FF00FFu;
+    value  = (value | (value << 4)) & 0x0F0F0F0Fu;
+    value  = (value | (value << 2)) & 0x33333333u;
+    value  = (value | (value << 1)) & 0x55555555u;
+
+    return value;
+}
+
+// Calculates the binning key of a ray from its direction octant and the screen cell of its origin.
+// The octant makes up the most significant bits so that rays first get grouped by direction, then
+// ordered along a Morton curve over the screen cells.
+// BE CAREFUL: the CPU reference in 'ray_binning.cpp' must be kept in sync.
+uint CalculateRayBinningKey(in float3 direction, in uint2 pixel, in uint cell_size)
+{
+    uint  octant = (direction.x < 0.0f ? 1 : 0) | (direction.y < 0.0f ? 2 : 0) | (direction.z < 0.0f ? 4 : 0);
+    uint2 cell   = pixel / cell_size;
+
+    return (octant << 24) | SpreadRayBinningBits(cell.x) | (SpreadRayBinningBits(cell.y) << 1);
+}
+
 #endif // GI1_HLSL
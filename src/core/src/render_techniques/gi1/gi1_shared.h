@@ -49,6 +49,8 @@ struct ScreenProbesConstants
     uint                   probe_mask_mip_count;
     uint                   probe_spawn_tile_size;
     ScreenProbesDebugModes debug_mode;
+    float                  variable_rate_low_threshold;
+    float                  variable_rate_high_threshold;
 };
 
 enum HashGridCacheDebugMode
@@ -43,6 +43,7 @@ RWTexture2D<float4> g_GlossyReflections_TextureFloat4[] : register(space95);
 #define             g_GlossyReflections_AverageSquaredBufferX g_GlossyReflections_AverageSquaredBuffer0     //
 
 RWStructuredBuffer<uint> g_GlossyReflections_RtSampleBuffer;
+RWStructuredBuffer<uint> g_GlossyReflections_RtSampleKeyBuffer;
 RWStructuredBuffer<uint> g_GlossyReflections_RtSampleCountBuffer;
 
 //!
@@ -31,6 +31,13 @@ THE SOFTWARE.
 // The amount of float quantization for atomic updates of the hash cells as integer:
 #define kHashGridCache_FloatQuantize 1e3f
 
+// The number of candidate buckets for each tile (bucketized cuckoo addressing uses a primary and alternate bucket):
+#ifdef USE_CUCKOO_HASHING
+#define kHashGridCache_BucketChoiceCount 2
+#else
+#define kHashGridCache_BucketChoiceCount 1
+#endif
+
 //!
 //! Hash-grid radiance cache structures.
 //!
@@ -119,6 +126,9 @@ struct HashGridCache_Data
 struct HashGridCache_Desc
 {
     uint bucket_index;   // bucket index
+#ifdef USE_CUCKOO_HASHING
+    uint bucket_index_alt; // alternate bucket index
+#endif // USE_CUCKOO_HASHING
     uint tile_hash;      // tile hash
     uint2 cell_offset;   // cell offset within the tile
 #ifdef DEBUG_HASH_CELLS
@@ -129,6 +139,13 @@ struct HashGridCache_Desc
 #endif // DEBUG_HASH_CELLS
 };
 
+// Gets the alternate bucket of a tile; the mapping is its own inverse so that either bucket
+// can be recovered from the other one using the tile hash only (num_buckets is a power of two).
+uint HashGridCache_AlternateBucketIndex(uint bucket_index, uint tile_hash)
+{
+    return bucket_index ^ (pcgHash(tile_hash) & (g_HashGridCacheConstants.num_buckets - 1));
+}
+
 // Gets the description for the radiance cell in the current frame structure.
 HashGridCache_Desc HashGridCache_GetDesc(in HashGridCache_Data data)
 {
@@ -180,6 +197,9 @@ HashGridCache_Desc HashGridCache_GetDesc(in HashGridCache_Data data)
 
     HashGridCache_Desc desc;
     desc.bucket_index  = bucket_index;
+#ifdef USE_CUCKOO_HASHING
+    desc.bucket_index_alt = HashGridCache_AlternateBucketIndex(bucket_index, tile_hash);
+#endif // USE_CUCKOO_HASHING
     desc.tile_hash     = tile_hash;
     desc.cell_offset   = cell_offset;
 #ifdef DEBUG_HASH_CELLS
@@ -245,56 +265,74 @@ uint HashGridCache_CellIndex(uint1 cell_offset_mip0, uint tile_index)
     return HashGridCache_CellIndex(cell_offset_mip0, tile_index, 0);
 }
 
+// Gets the index of the candidate bucket for the given choice.
+uint HashGridCache_BucketIndex(in HashGridCache_Desc desc, uint bucket_choice)
+{
+#ifdef USE_CUCKOO_HASHING
+    return (bucket_choice == 0 ? desc.bucket_index : desc.bucket_index_alt);
+#else
+    return desc.bucket_index;
+#endif // USE_CUCKOO_HASHING
+}
+
+// Finds a radiance cell entry inside the current frame hash-grid cache.
+// Decay eviction leaves free tiles in front of live ones, so every candidate tile has to be probed.
+uint HashGridCache_FindCell(in HashGridCache_Desc desc, out uint tile_index)
+{
+    for (uint bucket_choice = 0; bucket_choice < kHashGridCache_BucketChoiceCount; ++bucket_choice)
+    {
+        uint bucket_index = HashGridCache_BucketIndex(desc, bucket_choice);
+        for (uint bucket_offset = 0; bucket_offset < g_HashGridCacheConstants.num_tiles_per_bucket; ++bucket_offset)
+        {
+            tile_index = bucket_offset + bucket_index * g_HashGridCacheConstants.num_tiles_per_bucket;
+            if (g_HashGridCache_HashBuffer[tile_index] == desc.tile_hash)
+                return HashGridCache_CellIndex(desc.cell_offset, tile_index);  // found tile and cell
+        }
+    }
+    tile_index = kGI1_InvalidId;
+    return kGI1_InvalidId; // not found in any candidate bucket
+}
+
 // Inserts a new radiance cell inside the current frame hash-grid cache.
+// All candidate buckets are searched before claiming a free tile, so that a tile is never duplicated into
+// a free tile left by eviction; free tiles are then claimed in order, the alternate bucket being used once
+// the primary one is full.
 uint HashGridCache_InsertCell(in HashGridCache_Data data, out uint tile_index, out bool is_new_tile)
 {
-    uint bucket_offset;
     is_new_tile = false;
-    tile_index = kGI1_InvalidId;
     HashGridCache_Desc desc = HashGridCache_GetDesc(data);
-    for (bucket_offset = 0; bucket_offset < g_HashGridCacheConstants.num_tiles_per_bucket; ++bucket_offset)
+    uint cell_index = HashGridCache_FindCell(desc, tile_index);
+    if (cell_index != kGI1_InvalidId)
+        return cell_index;  // found existing tile and cell
+    for (uint bucket_choice = 0; bucket_choice < kHashGridCache_BucketChoiceCount; ++bucket_choice)
     {
-        uint previous_hash;
-        tile_index = bucket_offset + desc.bucket_index * g_HashGridCacheConstants.num_tiles_per_bucket;
-        InterlockedCompareExchange(g_HashGridCache_HashBuffer[tile_index], 0, desc.tile_hash, previous_hash);
-        if (previous_hash == 0)
+        uint bucket_index = HashGridCache_BucketIndex(desc, bucket_choice);
+        for (uint bucket_offset = 0; bucket_offset < g_HashGridCacheConstants.num_tiles_per_bucket; ++bucket_offset)
         {
-            is_new_tile = true;
-            break;  // inserted new tile and cell
+            uint previous_hash;
+            tile_index = bucket_offset + bucket_index * g_HashGridCacheConstants.num_tiles_per_bucket;
+            InterlockedCompareExchange(g_HashGridCache_HashBuffer[tile_index], 0, desc.tile_hash, previous_hash);
+            if (previous_hash == 0)
+            {
+                is_new_tile = true;
+                return HashGridCache_CellIndex(desc.cell_offset, tile_index);   // inserted new tile and cell
+            }
+            if (previous_hash == desc.tile_hash)
+                return HashGridCache_CellIndex(desc.cell_offset, tile_index);   // inserted concurrently by another thread
         }
-        if (previous_hash == desc.tile_hash)
-            break;  // found existing tile and cell
-    }
-    if (bucket_offset >= g_HashGridCacheConstants.num_tiles_per_bucket)
-    {
-    #ifdef DEBUG_HASH_STATS
-        uint previous_value;
-        InterlockedAdd(g_HashGridCache_DebugStatsBucketOverflowCountBuffer[desc.bucket_index], 1, previous_value);
-    #endif
-        return kGI1_InvalidId; // too much collisions, out of tiles :(
     }
-
-    return HashGridCache_CellIndex(desc.cell_offset, tile_index);
+#ifdef DEBUG_HASH_STATS
+    uint previous_value;
+    InterlockedAdd(g_HashGridCache_DebugStatsBucketOverflowCountBuffer[desc.bucket_index], 1, previous_value);
+#endif
+    tile_index = kGI1_InvalidId;
+    return kGI1_InvalidId; // too much collisions, out of tiles :(
 }
 
 // Finds a radiance cell entry inside the current frame hash-grid cache.
 uint HashGridCache_FindCell(in HashGridCache_Data data, out uint tile_index)
 {
-    uint bucket_offset;
-    tile_index = kGI1_InvalidId;
-    HashGridCache_Desc desc = HashGridCache_GetDesc(data);
-    for (bucket_offset = 0; bucket_offset < g_HashGridCacheConstants.num_tiles_per_bucket; ++bucket_offset)
-    {
-        tile_index = bucket_offset + desc.bucket_index * g_HashGridCacheConstants.num_tiles_per_bucket;
-        uint previous_hash = g_HashGridCache_HashBuffer[tile_index];
-        if (previous_hash == 0)
-            return kGI1_InvalidId; // no other tile in bucket
-        if (previous_hash == desc.tile_hash)
-            break;  // found tile and cell
-    }
-    if (bucket_offset >= g_HashGridCacheConstants.num_tiles_per_bucket)
-        return kGI1_InvalidId; // not found in bucket
-    return HashGridCache_CellIndex(desc.cell_offset, tile_index);  // found tile and cell
+    return HashGridCache_FindCell(HashGridCache_GetDesc(data), tile_index);
 }
 
 // Quantizes the radiance value so it can be blended atomically.
@@ -0,0 +1,238 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "hash_grid_cache_file.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace Capsaicin
+{
+namespace
+{
+template<typename TYPE>
+void WriteValue(std::ofstream &file, TYPE const &value) noexcept
+{
+    file.write(reinterpret_cast<char const *>(&value), sizeof(TYPE));
+}
+
+template<typename TYPE>
+bool ReadValue(std::ifstream &file, TYPE &value) noexcept
+{
+    return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(TYPE)));
+}
+
+void WriteArray(std::ofstream &file, std::vector<uint32_t> const &values) noexcept
+{
+    file.write(reinterpret_cast<char const *>(values.data()),
+        static_cast<std::streamsize>(values.size() * sizeof(uint32_t)));
+}
+
+bool ReadArray(std::ifstream &file, std::vector<uint32_t> &values, size_t const count) noexcept
+{
+    values.resize(count);
+    return static_cast<bool>(file.read(
+        reinterpret_cast<char *>(values.data()), static_cast<std::streamsize>(count * sizeof(uint32_t))));
+}
+} // namespace
+
+void HashGridCacheFile::Compact(Layout const &layout, uint32_t const *hash_buffer,
+    uint32_t const *value_buffer, uint32_t const *indirect_value_buffer, Contents &contents) noexcept
+{
+    contents        = {};
+    contents.layout = layout;
+    if (indirect_value_buffer == nullptr)
+    {
+        contents.layout.flags &= ~static_cast<uint32_t>(kFlag_UseMultibounce);
+    }
+
+    size_t const   num_values_per_tile = 2 * static_cast<size_t>(layout.num_cells_per_tile);
+    uint32_t const num_tiles           = layout.num_buckets * layout.num_tiles_per_bucket;
+    for (uint32_t tile_index = 0; tile_index < num_tiles; ++tile_index)
+    {
+        if (hash_buffer[tile_index] == 0)
+        {
+            continue; // free tile
+        }
+        contents.tile_indices.push_back(tile_index);
+        contents.tile_hashes.push_back(hash_buffer[tile_index]);
+        uint32_t const *values = value_buffer + tile_index * num_values_per_tile;
+        contents.values.insert(contents.values.end(), values, values + num_values_per_tile);
+        if (indirect_value_buffer != nullptr)
+        {
+            uint32_t const *indirect_values = indirect_value_buffer + tile_index * num_values_per_tile;
+            contents.indirect_values.insert(
+                contents.indirect_values.end(), indirect_values, indirect_values + num_values_per_tile);
+        }
+    }
+}
+
+void HashGridCacheFile::Expand(Contents const &contents, std::vector<uint32_t> &hash_buffer,
+    std::vector<uint32_t> &value_buffer, std::vector<uint32_t> &indirect_value_buffer) noexcept
+{
+    Layout const &layout              = contents.layout;
+    size_t const  num_values_per_tile = 2 * static_cast<size_t>(layout.num_cells_per_tile);
+    size_t const  num_tiles           = static_cast<size_t>(layout.num_buckets) * layout.num_tiles_per_bucket;
+    bool const    use_multibounce     = (layout.flags & kFlag_UseMultibounce) != 0;
+
+    hash_buffer.assign(num_tiles, 0);
+    value_buffer.assign(num_tiles * num_values_per_tile, 0);
+    indirect_value_buffer.assign(use_multibounce ? num_tiles * num_values_per_tile : 0, 0);
+    for (size_t i = 0; i < contents.tile_indices.size(); ++i)
+    {
+        uint32_t const tile_index = contents.tile_indices[i];
+        hash_buffer[tile_index]   = contents.tile_hashes[i];
+        auto const source         = contents.values.begin() + static_cast<ptrdiff_t>(i * num_values_per_tile);
+        std::copy_n(source, num_values_per_tile, value_buffer.begin() + tile_index * num_values_per_tile);
+        if (use_multibounce)
+        {
+            auto const indirect_source =
+                contents.indirect_values.begin() + static_cast<ptrdiff_t>(i * num_values_per_tile);
+            std::copy_n(indirect_source, num_values_per_tile,
+                indirect_value_buffer.begin() + tile_index * num_values_per_tile);
+        }
+    }
+}
+
+bool HashGridCacheFile::IsValid(Contents const &contents) noexcept
+{
+    Layout const  &layout    = contents.layout;
+    uint64_t const num_tiles = static_cast<uint64_t>(layout.num_buckets) * layout.num_tiles_per_bucket;
+    if (num_tiles == 0 || num_tiles > 0xFFFFFFFFULL || layout.num_cells_per_tile == 0)
+    {
+        return false;
+    }
+    size_t const num_stored_tiles    = contents.tile_indices.size();
+    size_t const num_values_per_tile = 2 * static_cast<size_t>(layout.num_cells_per_tile);
+    size_t const num_indirect_values =
+        (layout.flags & kFlag_UseMultibounce) != 0 ? num_stored_tiles * num_values_per_tile : 0;
+    if (num_stored_tiles > num_tiles || contents.tile_hashes.size() != num_stored_tiles
+        || contents.values.size() != num_stored_tiles * num_values_per_tile
+        || contents.indirect_values.size() != num_indirect_values)
+    {
+        return false;
+    }
+    // Tiles are stored in increasing index order and hash 0 denotes a free tile
+    for (size_t i = 0; i < num_stored_tiles; ++i)
+    {
+        if (contents.tile_indices[i] >= num_tiles || contents.tile_hashes[i] == 0
+            || (i > 0 && contents.tile_indices[i] <= contents.tile_indices[i - 1]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool HashGridCacheFile::Save(std::filesystem::path const &file_path, Contents const &contents) noexcept
+{
+    if (!IsValid(contents))
+    {
+        return false;
+    }
+    std::ofstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    Layout const &layout = contents.layout;
+    WriteValue(file, kMagic);
+    WriteValue(file, kVersion);
+    WriteValue(file, layout.scene_hash);
+    WriteValue(file, layout.num_buckets);
+    WriteValue(file, layout.num_tiles_per_bucket);
+    WriteValue(file, layout.num_cells_per_tile);
+    WriteValue(file, layout.flags);
+    WriteValue(file, layout.cell_size);
+    WriteValue(file, layout.min_cell_size);
+    WriteValue(file, layout.tile_cell_ratio);
+    WriteValue(file, static_cast<uint32_t>(contents.tile_indices.size()));
+    WriteArray(file, contents.tile_indices);
+    WriteArray(file, contents.tile_hashes);
+    WriteArray(file, contents.values);
+    WriteArray(file, contents.indirect_values);
+    return file.good();
+}
+
+bool HashGridCacheFile::Load(std::filesystem::path const &file_path, Contents &contents) noexcept
+{
+    contents = {};
+    std::error_code ec;
+    auto const      file_size = std::filesystem::file_size(file_path, ec);
+    if (ec)
+    {
+        return false;
+    }
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    uint32_t magic   = 0;
+    uint32_t version = 0;
+    if (!ReadValue(file, magic) || !ReadValue(file, version) || magic != kMagic || version != kVersion)
+    {
+        return false; // not a cache file or an unsupported version
+    }
+    Layout  &layout           = contents.layout;
+    uint32_t num_stored_tiles = 0;
+    if (!ReadValue(file, layout.scene_hash) || !ReadValue(file, layout.num_buckets)
+        || !ReadValue(file, layout.num_tiles_per_bucket) || !ReadValue(file, layout.num_cells_per_tile)
+        || !ReadValue(file, layout.flags) || !ReadValue(file, layout.cell_size)
+        || !ReadValue(file, layout.min_cell_size) || !ReadValue(file, layout.tile_cell_ratio)
+        || !ReadValue(file, num_stored_tiles))
+    {
+        contents = {};
+        return false; // truncated header
+    }
+
+    // Validate the header against the file length before allocating anything, the sizes are computed in
+    // 64 bits so that corrupt values cannot overflow
+    uint64_t const num_tiles = static_cast<uint64_t>(layout.num_buckets) * layout.num_tiles_per_bucket;
+    if (num_stored_tiles > num_tiles || layout.num_cells_per_tile == 0)
+    {
+        contents = {};
+        return false;
+    }
+    uint64_t const num_values = static_cast<uint64_t>(num_stored_tiles) * 2 * layout.num_cells_per_tile;
+    uint64_t const num_indirect_values = (layout.flags & kFlag_UseMultibounce) != 0 ? num_values : 0;
+    uint64_t const header_size         = static_cast<uint64_t>(file.tellg());
+    uint64_t const payload_size =
+        (2 * static_cast<uint64_t>(num_stored_tiles) + num_values + num_indirect_values) * sizeof(uint32_t);
+    if (header_size + payload_size != file_size)
+    {
+        contents = {};
+        return false; // truncated or corrupt file
+    }
+    if (!ReadArray(file, contents.tile_indices, num_stored_tiles)
+        || !ReadArray(file, contents.tile_hashes, num_stored_tiles)
+        || !ReadArray(file, contents.values, static_cast<size_t>(num_values))
+        || !ReadArray(file, contents.indirect_values, static_cast<size_t>(num_indirect_values))
+        || file.peek() != EOF
+        || !IsValid(contents))
+    {
+        contents = {};
+        return false; // truncated or malformed file
+    }
+    return true;
+}
+} // namespace Capsaicin
@@ -0,0 +1,124 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Serialiser for the contents of the GI1 hash-grid radiance cache.
+ * Only the allocated tiles are stored, each one with its key (tile index and hash) and the packed radiance
+ * of all its cells, so that a cache can be saved and later used to warm-start the same scene.
+ * Files are written in native (little-endian) byte order and start with a magic number and version; any
+ * change to the layout below must bump 'kVersion' so that stale files are rejected rather than misread.
+ */
+class HashGridCacheFile
+{
+public:
+    /** File identifier ('GI1C'). */
+    static constexpr uint32_t kMagic = 0x43314947U;
+    /** Current file format version. */
+    static constexpr uint32_t kVersion = 2;
+
+    enum Flags : uint32_t
+    {
+        kFlag_UseMultibounce   = 1U << 0, /**< File contains the multi-bounce radiance */
+        kFlag_UseCuckooHashing = 1U << 1, /**< Tiles were addressed using cuckoo hashing */
+    };
+
+    /**
+     * Cache configuration, a file can only be loaded into a cache with an identical layout as tile
+     * addresses depend on every one of these values.
+     */
+    struct Layout
+    {
+        uint64_t scene_hash           = 0;    /**< Content hash of the scene the cache was built for */
+        uint32_t num_buckets          = 0;    /**< Number of buckets */
+        uint32_t num_tiles_per_bucket = 0;    /**< Number of tiles per bucket */
+        uint32_t num_cells_per_tile   = 0;    /**< Number of cells per tile (all mips) */
+        uint32_t flags                = 0;    /**< Combination of 'Flags' values */
+        float    cell_size            = 0.0F; /**< Cell size option (independent of camera and resolution) */
+        float    min_cell_size        = 0.0F; /**< Minimum cell size used to compute the tile keys */
+        uint32_t tile_cell_ratio      = 0;    /**< Number of cells along each side of a tile */
+
+        bool operator==(Layout const &other) const noexcept = default;
+    };
+
+    /** Contents of a cache file. */
+    struct Contents
+    {
+        Layout                layout;
+        std::vector<uint32_t> tile_indices;    /**< Index of each allocated tile */
+        std::vector<uint32_t> tile_hashes;     /**< Hash of each allocated tile */
+        std::vector<uint32_t> values;          /**< Packed radiance of each cell of each tile (2 per cell) */
+        std::vector<uint32_t> indirect_values; /**< Same as 'values' for the multi-bounce radiance */
+    };
+
+    /**
+     * Extracts the allocated tiles from the cache buffers.
+     * @param layout                The layout of the cache.
+     * @param hash_buffer           The tile hashes ('num_buckets * num_tiles_per_bucket' values).
+     * @param value_buffer          The packed cell radiance (2 values per cell).
+     * @param indirect_value_buffer The packed multi-bounce cell radiance (nullptr if not used).
+     * @param [out] contents        The extracted contents.
+     */
+    static void Compact(Layout const &layout, uint32_t const *hash_buffer, uint32_t const *value_buffer,
+        uint32_t const *indirect_value_buffer, Contents &contents) noexcept;
+
+    /**
+     * Rebuilds the cache buffers from previously extracted tiles, all other tiles are left empty.
+     * @param contents                    The contents to expand (must be valid).
+     * @param [out] hash_buffer           The tile hashes.
+     * @param [out] value_buffer          The packed cell radiance.
+     * @param [out] indirect_value_buffer The packed multi-bounce cell radiance (empty if not used).
+     */
+    static void Expand(Contents const &contents, std::vector<uint32_t> &hash_buffer,
+        std::vector<uint32_t> &value_buffer, std::vector<uint32_t> &indirect_value_buffer) noexcept;
+
+    /**
+     * Checks that contents are consistent with their layout.
+     * @param contents The contents to check.
+     * @return True if valid.
+     */
+    [[nodiscard]] static bool IsValid(Contents const &contents) noexcept;
+
+    /**
+     * Writes cache contents to disk.
+     * @param file_path The file to write.
+     * @param contents  The contents to write.
+     * @return True if successful.
+     */
+    static bool Save(std::filesystem::path const &file_path, Contents const &contents) noexcept;
+
+    /**
+     * Reads cache contents from disk.
+     * @param file_path      The file to read.
+     * @param [out] contents The read contents, cleared on failure.
+     * @return False if the file could not be read, is of another version or is malformed.
+     * @note The header is validated against the file length before any allocation.
+     */
+    static bool Load(std::filesystem::path const &file_path, Contents &contents) noexcept;
+};
+} // namespace Capsaicin
@@ -0,0 +1,585 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "hash_grid_cache_simulator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+
+namespace Capsaicin
+{
+// Must match HASHGRIDCACHE_STEP_FACTOR/HASHGRIDCACHE_SIZE_FACTOR in 'hash_grid_cache.hlsl'
+constexpr float kHashGridCacheStepFactor = 1e3F;
+constexpr float kHashGridCacheSizeFactor = 1e-3F;
+
+// Number of floats per query record in a query stream file
+constexpr uint32_t kQueryRecordSize = 13;
+
+float HashGridCacheSimulator::Statistics::getOccupancy(uint32_t const num_tiles) const noexcept
+{
+    return num_tiles > 0 ? static_cast<float>(num_packed_tiles) / static_cast<float>(num_tiles) : 0.0F;
+}
+
+bool HashGridCacheSimulator::initialise(Settings const &settings) noexcept
+{
+    if (settings.tile_cell_ratio == 0 || (settings.tile_cell_ratio >> 4) != 0 || settings.num_buckets > 24
+        || settings.num_tiles_per_bucket > 16)
+    {
+        return false;
+    }
+    settings_ = settings;
+
+    // Mirrors the sizing in GI1::HashGridCache::ensureMemoryIsAllocated()
+    num_buckets_          = 1U << settings.num_buckets;
+    num_tiles_per_bucket_ = 1U << settings.num_tiles_per_bucket;
+    size_tile_mip_[0]     = settings.tile_cell_ratio;
+    size_tile_mip_[1]     = size_tile_mip_[0] >> 1;
+    size_tile_mip_[2]     = size_tile_mip_[1] >> 1;
+    size_tile_mip_[3]     = size_tile_mip_[2] >> 1;
+    num_cells_per_tile_   = 0;
+    for (uint32_t mip = 0; mip < 4; ++mip)
+    {
+        first_cell_offset_tile_mip_[mip]  = num_cells_per_tile_;
+        num_cells_per_tile_              += size_tile_mip_[mip] * size_tile_mip_[mip];
+    }
+    num_tiles_ = num_tiles_per_bucket_ * num_buckets_;
+    num_cells_ = num_cells_per_tile_ * num_tiles_;
+
+    hash_buffer_.assign(num_tiles_, 0);
+    decay_tile_buffer_.assign(num_tiles_, 0);
+    value_buffer_.assign(num_cells_, uint2(0));
+    update_cell_value_buffer_.assign(4 * static_cast<size_t>(num_cells_), 0);
+    update_tile_buffer_.clear();
+    packed_tile_index_buffer_[0].clear();
+    packed_tile_index_buffer_[1].clear();
+    bucket_overflow_count_buffer_.assign(num_buckets_, 0);
+    buffer_ping_pong_ = 0;
+
+    statistics_ = {};
+    statistics_.bucket_occupancy.assign(num_tiles_per_bucket_ + 1, 0);
+    statistics_.bucket_overflow.assign(settings.debug_max_bucket_overflow + 1, 0);
+    return true;
+}
+
+void HashGridCacheSimulator::simulateFrame(
+    uint32_t const frame_index, std::vector<Query> const &queries) noexcept
+{
+    if (hash_buffer_.empty())
+    {
+        return; // not initialised
+    }
+
+    statistics_             = {};
+    statistics_.num_queries = static_cast<uint32_t>(queries.size());
+    statistics_.bucket_occupancy.assign(num_tiles_per_bucket_ + 1, 0);
+    statistics_.bucket_overflow.assign(settings_.debug_max_bucket_overflow + 1, 0);
+
+    // Same pass order as GI1::render()
+    std::fill(bucket_overflow_count_buffer_.begin(), bucket_overflow_count_buffer_.end(), 0U);
+    buffer_ping_pong_ = 1 - buffer_ping_pong_;
+    packed_tile_index_buffer_[buffer_ping_pong_].clear();
+    update_tile_buffer_.clear();
+    purgeTiles(frame_index);
+    populateCells(frame_index, queries);
+    updateTiles();
+    buildBucketStatistics();
+    statistics_.num_packed_tiles = static_cast<uint32_t>(packed_tile_index_buffer_[buffer_ping_pong_].size());
+}
+
+uint32_t HashGridCacheSimulator::findCell(Query const &query, uint32_t &tile_index) const noexcept
+{
+    uint32_t probe_length = 0;
+    return findCell(getDesc(query), tile_index, probe_length);
+}
+
+float4 HashGridCacheSimulator::getCellRadiance(uint32_t const cell_index) const noexcept
+{
+    return cell_index < num_cells_ ? UnpackRadiance(value_buffer_[cell_index]) : float4(0.0F);
+}
+
+HashGridCacheSimulator::Desc HashGridCacheSimulator::getDesc(Query const &query) const noexcept
+{
+    float const cell_size_step =
+        std::max(glm::distance(query.eye_position, query.hit_position) * settings_.cell_size,
+            settings_.min_cell_size);
+    float const log_step_multiplier = std::floor(std::log2(kHashGridCacheStepFactor * cell_size_step));
+    float const hit_cell_size       = kHashGridCacheSizeFactor * std::exp2(log_step_multiplier);
+    float const hit_tile_size       = hit_cell_size * static_cast<float>(settings_.tile_cell_ratio);
+
+    float3 const signed_c = glm::floor(query.hit_position / hit_tile_size);
+    float3 const signed_d = glm::floor(0.5F + (0.5F * query.direction + 0.5F) * 4.0F);
+
+    // Reinterpret as unsigned as negative values matter to the hash functions
+    auto const     l = static_cast<uint32_t>(log_step_multiplier);
+    uint3 const    c = uint3(int3(signed_c));
+    uint3 const    d = uint3(int3(signed_d));
+    uint32_t const t = query.hit_distance < hit_tile_size ? 1U : 0U;
+
+    // Evaluated inner-most first, same as the nested calls in 'HashGridCache_GetDesc'
+    uint32_t bucket_hash = PcgHash(t);
+    uint32_t tile_hash   = XxHash(t);
+    for (uint32_t const value : {d.z, d.y, d.x, c.z, c.y, c.x})
+    {
+        bucket_hash = PcgHash(value + bucket_hash);
+        tile_hash   = XxHash(value + tile_hash);
+    }
+
+    Desc desc         = {};
+    desc.bucket_index = PcgHash(l + bucket_hash) % num_buckets_;
+    desc.tile_hash    = std::max(1U, XxHash(l + tile_hash));
+    // Same as 'HashGridCache_AlternateBucketIndex', the bucket count is always a power of two
+    desc.bucket_index_alt = desc.bucket_index ^ (PcgHash(desc.tile_hash) & (num_buckets_ - 1));
+
+    float3 const e =
+        glm::floor(query.hit_position / hit_cell_size)
+        - glm::floor(query.hit_position / hit_tile_size) * static_cast<float>(settings_.tile_cell_ratio);
+    float3 const abs_direction = glm::abs(query.direction);
+    float const  max_direction = std::max(std::max(abs_direction.x, abs_direction.y), abs_direction.z);
+    if (abs_direction.x == max_direction)
+    {
+        desc.cell_offset = uint2(static_cast<uint32_t>(e.y), static_cast<uint32_t>(e.z));
+    }
+    else if (abs_direction.y == max_direction)
+    {
+        desc.cell_offset = uint2(static_cast<uint32_t>(e.x), static_cast<uint32_t>(e.z));
+    }
+    else
+    {
+        desc.cell_offset = uint2(static_cast<uint32_t>(e.x), static_cast<uint32_t>(e.y));
+    }
+    return desc;
+}
+
+uint32_t HashGridCacheSimulator::cellIndex(
+    uint2 const cell_offset_mip0, uint32_t const tile_index, uint32_t const mip_level) const noexcept
+{
+    uint32_t const mip_size    = size_tile_mip_[0] >> mip_level;
+    uint2 const    cell_offset = cell_offset_mip0 >> mip_level;
+    return tile_index * num_cells_per_tile_ + first_cell_offset_tile_mip_[mip_level] + cell_offset.x
+         + cell_offset.y * mip_size;
+}
+
+bool HashGridCacheSimulator::LoadQueryStream(
+    std::filesystem::path const &file_path, std::vector<std::vector<Query>> &frames) noexcept
+{
+    frames.clear();
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    uint32_t num_queries = 0;
+    while (file.read(reinterpret_cast<char *>(&num_queries), sizeof(num_queries)))
+    {
+        std::vector<float> records(static_cast<size_t>(num_queries) * kQueryRecordSize);
+        if (!file.read(reinterpret_cast<char *>(records.data()),
+                static_cast<std::streamsize>(records.size() * sizeof(float))))
+        {
+            frames.clear();
+            return false; // truncated file
+        }
+        std::vector<Query> &queries = frames.emplace_back();
+        queries.reserve(num_queries);
+        for (uint32_t i = 0; i < num_queries; ++i)
+        {
+            float const *record = &records[static_cast<size_t>(i) * kQueryRecordSize];
+            Query       &query  = queries.emplace_back();
+            query.eye_position  = float3(record[0], record[1], record[2]);
+            query.hit_position  = float3(record[3], record[4], record[5]);
+            query.direction     = float3(record[6], record[7], record[8]);
+            query.hit_distance  = record[9];
+            query.radiance      = float3(record[10], record[11], record[12]);
+        }
+    }
+    return file.eof();
+}
+
+bool HashGridCacheSimulator::SaveQueryStream(
+    std::filesystem::path const &file_path, std::vector<std::vector<Query>> const &frames) noexcept
+{
+    std::ofstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    std::vector<float> records;
+    for (auto const &queries : frames)
+    {
+        auto const num_queries = static_cast<uint32_t>(queries.size());
+        records.clear();
+        records.reserve(static_cast<size_t>(num_queries) * kQueryRecordSize);
+        for (auto const &query : queries)
+        {
+            records.insert(records.end(),
+                {query.eye_position.x, query.eye_position.y, query.eye_position.z, query.hit_position.x,
+                    query.hit_position.y, query.hit_position.z, query.direction.x, query.direction.y,
+                    query.direction.z, query.hit_distance, query.radiance.x, query.radiance.y,
+                    query.radiance.z});
+        }
+        file.write(reinterpret_cast<char const *>(&num_queries), sizeof(num_queries));
+        file.write(reinterpret_cast<char const *>(records.data()),
+            static_cast<std::streamsize>(records.size() * sizeof(float)));
+    }
+    return file.good();
+}
+
+std::vector<HashGridCacheSimulator::AddressingReport> HashGridCacheSimulator::BenchmarkAddressing(
+    Settings const &settings, std::vector<std::vector<Query>> const &frames) noexcept
+{
+    std::vector<AddressingReport> reports;
+    for (bool const use_cuckoo_hashing : {false, true})
+    {
+        Settings scheme_settings           = settings;
+        scheme_settings.use_cuckoo_hashing = use_cuckoo_hashing;
+        HashGridCacheSimulator simulator;
+        if (!simulator.initialise(scheme_settings))
+        {
+            return {};
+        }
+
+        AddressingReport &report  = reports.emplace_back();
+        report.use_cuckoo_hashing = use_cuckoo_hashing;
+        uint64_t num_probes       = 0;
+        uint32_t num_used_tiles   = 0;
+        auto const num_tiles      = static_cast<float>(simulator.num_tiles_);
+        for (auto const &queries : frames)
+        {
+            for (auto const &query : queries)
+            {
+                uint32_t tile_index   = kInvalidId;
+                bool     is_new_tile  = false;
+                uint32_t probe_length = 0;
+                if (simulator.insertCell(query, tile_index, is_new_tile, probe_length) == kInvalidId)
+                {
+                    if (report.num_failures++ == 0)
+                    {
+                        report.max_load_factor = static_cast<float>(num_used_tiles) / num_tiles;
+                    }
+                }
+                else if (is_new_tile)
+                {
+                    ++num_used_tiles;
+                }
+                ++report.num_inserts;
+                num_probes              += probe_length;
+                report.max_probe_length  = std::max(report.max_probe_length, probe_length);
+            }
+        }
+
+        report.final_load_factor = static_cast<float>(num_used_tiles) / num_tiles;
+        if (report.num_failures == 0)
+        {
+            report.max_load_factor = report.final_load_factor;
+        }
+        if (report.num_inserts > 0)
+        {
+            report.failure_rate =
+                static_cast<float>(report.num_failures) / static_cast<float>(report.num_inserts);
+            report.average_probe_length =
+                static_cast<float>(static_cast<double>(num_probes) / static_cast<double>(report.num_inserts));
+        }
+    }
+    return reports;
+}
+
+uint32_t HashGridCacheSimulator::PcgHash(uint32_t const value) noexcept
+{
+    uint32_t const state = value * 747796405U + 2891336453U;
+    uint32_t const word  = ((state >> ((state >> 28U) + 4U)) ^ state) * 277803737U;
+    return (word >> 22U) ^ word;
+}
+
+uint32_t HashGridCacheSimulator::XxHash(uint32_t const value) noexcept
+{
+    uint32_t ret = value + 374761393U;
+    ret          = 668265263U * std::rotl(ret, 17);
+    ret          = 2246822519U * (ret ^ (ret >> 15U));
+    ret          = 3266489917U * (ret ^ (ret >> 13U));
+    return ret ^ (ret >> 16U);
+}
+
+uint4 HashGridCacheSimulator::QuantizeRadiance(float3 const &radiance) noexcept
+{
+    // HLSL round() rounds half away from zero, as does std::round()
+    return {static_cast<uint32_t>(std::round(kFloatQuantize * radiance.x)),
+        static_cast<uint32_t>(std::round(kFloatQuantize * radiance.y)),
+        static_cast<uint32_t>(std::round(kFloatQuantize * radiance.z)), 1U};
+}
+
+float4 HashGridCacheSimulator::RecoverRadiance(uint4 const &quantized_radiance) noexcept
+{
+    return {static_cast<float>(quantized_radiance.x) / kFloatQuantize,
+        static_cast<float>(quantized_radiance.y) / kFloatQuantize,
+        static_cast<float>(quantized_radiance.z) / kFloatQuantize, static_cast<float>(quantized_radiance.w)};
+}
+
+uint2 HashGridCacheSimulator::PackRadiance(float4 const &radiance) noexcept
+{
+    return {glm::packHalf2x16(glm::vec2(radiance.x, radiance.y)),
+        glm::packHalf2x16(glm::vec2(radiance.z, radiance.w))};
+}
+
+float4 HashGridCacheSimulator::UnpackRadiance(uint2 const &packed_radiance) noexcept
+{
+    glm::vec2 const xy = glm::unpackHalf2x16(packed_radiance.x);
+    glm::vec2 const zw = glm::unpackHalf2x16(packed_radiance.y);
+    return {xy.x, xy.y, zw.x, zw.y};
+}
+
+uint32_t HashGridCacheSimulator::findCell(
+    Desc const &desc, uint32_t &tile_index, uint32_t &probe_length) const noexcept
+{
+    // Eviction leaves free tiles in front of live ones, so every candidate tile has to be probed
+    uint32_t const bucket_choices = settings_.use_cuckoo_hashing ? 2 : 1;
+    for (uint32_t bucket_choice = 0; bucket_choice < bucket_choices; ++bucket_choice)
+    {
+        uint32_t const bucket_index = bucket_choice == 0 ? desc.bucket_index : desc.bucket_index_alt;
+        for (uint32_t bucket_offset = 0; bucket_offset < num_tiles_per_bucket_; ++bucket_offset)
+        {
+            ++probe_length;
+            tile_index = bucket_offset + bucket_index * num_tiles_per_bucket_;
+            if (hash_buffer_[tile_index] == desc.tile_hash)
+            {
+                return cellIndex(desc.cell_offset, tile_index, 0); // found tile and cell
+            }
+        }
+    }
+    tile_index = kInvalidId;
+    return kInvalidId; // not found in any candidate bucket
+}
+
+uint32_t HashGridCacheSimulator::insertCell(
+    Query const &query, uint32_t &tile_index, bool &is_new_tile, uint32_t &probe_length) noexcept
+{
+    is_new_tile               = false;
+    probe_length              = 0;
+    Desc const     desc       = getDesc(query);
+    uint32_t const cell_index = findCell(desc, tile_index, probe_length);
+    if (cell_index != kInvalidId)
+    {
+        return cell_index; // found existing tile and cell
+    }
+
+    // Claim the first free tile, the alternate bucket is only used once the primary one is full
+    uint32_t const bucket_choices = settings_.use_cuckoo_hashing ? 2 : 1;
+    for (uint32_t bucket_choice = 0; bucket_choice < bucket_choices; ++bucket_choice)
+    {
+        uint32_t const bucket_index = bucket_choice == 0 ? desc.bucket_index : desc.bucket_index_alt;
+        for (uint32_t bucket_offset = 0; bucket_offset < num_tiles_per_bucket_; ++bucket_offset)
+        {
+            ++probe_length;
+            tile_index = bucket_offset + bucket_index * num_tiles_per_bucket_;
+            if (hash_buffer_[tile_index] == 0)
+            {
+                hash_buffer_[tile_index] = desc.tile_hash;
+                is_new_tile              = true;
+                return cellIndex(desc.cell_offset, tile_index, 0); // inserted new tile and cell
+            }
+        }
+    }
+    ++bucket_overflow_count_buffer_[desc.bucket_index];
+    tile_index = kInvalidId;
+    return kInvalidId; // too many collisions, out of tiles
+}
+
+void HashGridCacheSimulator::purgeTiles(uint32_t const frame_index) noexcept
+{
+    std::vector<uint32_t> &packed_tiles = packed_tile_index_buffer_[buffer_ping_pong_];
+    for (uint32_t const tile_index : packed_tile_index_buffer_[1 - buffer_ping_pong_])
+    {
+        uint32_t tile_decay = decay_tile_buffer_[tile_index];
+        if (frame_index < tile_decay) // account for integer wraparound case
+        {
+            tile_decay = (0xFFFFFFFFU - tile_decay) + frame_index + 1;
+        }
+        else
+        {
+            tile_decay = frame_index - tile_decay;
+        }
+
+        if (tile_decay >= kTileDecay)
+        {
+            hash_buffer_[tile_index] = 0;
+            ++statistics_.num_evicted_tiles;
+            continue; // kill the tile
+        }
+        packed_tiles.push_back(tile_index);
+    }
+}
+
+void HashGridCacheSimulator::populateCells(
+    uint32_t const frame_index, std::vector<Query> const &queries) noexcept
+{
+    std::vector<uint32_t> &packed_tiles = packed_tile_index_buffer_[buffer_ping_pong_];
+    for (auto const &query : queries)
+    {
+        uint32_t       tile_index   = kInvalidId;
+        bool           is_new_tile  = false;
+        uint32_t       probe_length = 0;
+        uint32_t const cell_index   = insertCell(query, tile_index, is_new_tile, probe_length);
+        statistics_.num_probes       += probe_length;
+        statistics_.max_probe_length  = std::max(statistics_.max_probe_length, probe_length);
+        if (cell_index == kInvalidId)
+        {
+            ++statistics_.num_overflows;
+            continue;
+        }
+        ++statistics_.num_inserted;
+
+        // Bump the tile's decay now that it's been 'touched'
+        uint32_t const previous_tile_decay = decay_tile_buffer_[tile_index];
+        decay_tile_buffer_[tile_index]     = frame_index;
+
+        if (is_new_tile)
+        {
+            ++statistics_.num_new_tiles;
+            packed_tiles.push_back(tile_index);
+
+            // Clear mip0 cells (others will be reset anyways by UpdateTiles)
+            uint32_t const first_cell = tile_index * num_cells_per_tile_;
+            std::fill_n(value_buffer_.begin() + first_cell, size_tile_mip_[0] * size_tile_mip_[0], uint2(0));
+        }
+
+        if (is_new_tile || previous_tile_decay != frame_index)
+        {
+            update_tile_buffer_.push_back(tile_index);
+        }
+
+        // Accumulate the quantized radiance using wrapping integer adds just like the GPU atomics
+        uint4 const quantized_radiance = QuantizeRadiance(query.radiance);
+        uint32_t   *update_cell_value  = &update_cell_value_buffer_[4 * static_cast<size_t>(cell_index)];
+        if (glm::dot(query.radiance, query.radiance) > 0.0F)
+        {
+            update_cell_value[0] += quantized_radiance.x;
+            update_cell_value[1] += quantized_radiance.y;
+            update_cell_value[2] += quantized_radiance.z;
+        }
+        update_cell_value[3] += quantized_radiance.w;
+    }
+}
+
+void HashGridCacheSimulator::updateTiles() noexcept
+{
+    uint32_t const size             = size_tile_mip_[0];
+    auto const     max_sample_count = static_cast<float>(settings_.max_sample_count);
+
+    // Emulates 'lds_UpdateTiles_ValueBuffer'
+    std::vector<uint2> lds(static_cast<size_t>(size) * size);
+    auto const lds_at = [&lds, size](uint32_t const x, uint32_t const y) -> uint2 & {
+        return lds[static_cast<size_t>(x) * size + y];
+    };
+
+    for (uint32_t const tile_index : update_tile_buffer_)
+    {
+        // MIP 0
+        for (uint32_t y = 0; y < size; ++y)
+        {
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                uint32_t const cell_index = cellIndex(uint2(x, y), tile_index, 0);
+                uint32_t *update_cell_value = &update_cell_value_buffer_[4 * static_cast<size_t>(cell_index)];
+
+                // Temporal accumulation
+                float4 radiance     = UnpackRadiance(value_buffer_[cell_index]);
+                float4 new_radiance = RecoverRadiance(uint4(
+                    update_cell_value[0], update_cell_value[1], update_cell_value[2], update_cell_value[3]));
+                float const sample_count  = std::min(radiance.w + new_radiance.w, max_sample_count);
+                radiance                 /= std::max(radiance.w, 1.0F);
+                new_radiance             /= std::max(new_radiance.w, 1.0F);
+                if (radiance.w <= 0.0F)
+                {
+                    radiance = new_radiance;
+                }
+                else
+                {
+                    radiance = radiance + (1.0F / sample_count) * (new_radiance - radiance);
+                }
+                radiance *= sample_count; // sample count is used as a hint for picking prefiltering amount
+
+                uint2 const packed_radiance = PackRadiance(radiance);
+                lds_at(x, y)                = packed_radiance;
+                value_buffer_[cell_index]   = packed_radiance;
+
+                // Clear scratch
+                std::fill_n(update_cell_value, 4, 0U);
+            }
+        }
+
+        // MIP 1-3, 2x2 box sum of the previous level
+        for (uint32_t mip = 1; mip < 4 && size_tile_mip_[mip] > 0; ++mip)
+        {
+            uint32_t const step = 1U << (mip - 1);
+            for (uint32_t y = 0; y < size; y += 2 * step)
+            {
+                for (uint32_t x = 0; x < size; x += 2 * step)
+                {
+                    float4 radiance(0.0F);
+                    radiance += UnpackRadiance(lds_at(x + 0, y + 0));
+                    radiance += UnpackRadiance(lds_at(x + step, y + 0));
+                    radiance += UnpackRadiance(lds_at(x + 0, y + step));
+                    radiance += UnpackRadiance(lds_at(x + step, y + step));
+
+                    uint2 const packed_radiance                            = PackRadiance(radiance);
+                    lds_at(x, y)                                           = packed_radiance;
+                    value_buffer_[cellIndex(uint2(x, y), tile_index, mip)] = packed_radiance;
+                }
+            }
+        }
+    }
+    statistics_.num_updated_tiles = static_cast<uint32_t>(update_tile_buffer_.size());
+}
+
+void HashGridCacheSimulator::buildBucketStatistics() noexcept
+{
+    auto const occupancy_histogram_size = static_cast<uint32_t>(statistics_.bucket_occupancy.size());
+    auto const overflow_histogram_size  = static_cast<uint32_t>(statistics_.bucket_overflow.size());
+    for (uint32_t bucket_index = 0; bucket_index < num_buckets_; ++bucket_index)
+    {
+        uint32_t bucket_offset = 0;
+        for (; bucket_offset < num_tiles_per_bucket_; ++bucket_offset)
+        {
+            if (hash_buffer_[bucket_offset + bucket_index * num_tiles_per_bucket_] == 0)
+            {
+                break; // free tile
+            }
+        }
+
+        uint32_t const bucket_occupancy = std::min(bucket_offset, occupancy_histogram_size - 1);
+        ++statistics_.bucket_occupancy[bucket_occupancy];
+
+        uint32_t const bucket_overflow_count =
+            std::min(bucket_overflow_count_buffer_[bucket_index], overflow_histogram_size - 1);
+        ++statistics_.bucket_overflow[bucket_overflow_count];
+
+        if (bucket_occupancy < 1)
+        {
+            ++statistics_.num_free_buckets;
+        }
+        else
+        {
+            ++statistics_.num_used_buckets;
+        }
+    }
+}
+} // namespace Capsaicin
@@ -0,0 +1,273 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * CPU reference implementation of the GI1 hash-grid radiance cache.
+ * Mirrors the cell addressing, tile insertion/lookup, decay based eviction, packed tile compaction and
+ * quantized radiance accumulation performed by 'hash_grid_cache.hlsl' and the 'PurgeTiles',
+ * 'UpdateTiles' and 'BuildBucketStatistics' kernels of 'gi1.comp'. Queries are processed serially in
+ * submission order, which corresponds to one valid ordering of the GPU atomics.
+ * @note Any change to the hashing or update logic on the GPU must be reflected here.
+ */
+class HashGridCacheSimulator
+{
+public:
+    /** Number of frames before an unused tile is evicted (kHashGridCache_TileDecay). */
+    static constexpr uint32_t kTileDecay = 50;
+    /** Float quantization used for atomic radiance accumulation (kHashGridCache_FloatQuantize). */
+    static constexpr float kFloatQuantize = 1e3F;
+    /** Value returned for failed insertions/lookups (kGI1_InvalidId). */
+    static constexpr uint32_t kInvalidId = 0xFFFFFFFFU;
+
+    /** Cache configuration, matches the 'gi1_hash_grid_cache_*' render options. */
+    struct Settings
+    {
+        float    cell_size                 = 0.02F; /**< Cell size to eye distance ratio (GI1 constant) */
+        float    min_cell_size             = 0.1F;  /**< Minimum world space cell size */
+        uint32_t tile_cell_ratio           = 8;     /**< Number of cells per tile side (mip 0) */
+        uint32_t num_buckets               = 14;    /**< Log2 of the number of buckets */
+        uint32_t num_tiles_per_bucket      = 4;     /**< Log2 of the number of tiles per bucket */
+        uint32_t max_sample_count          = 16;    /**< Maximum temporal sample count */
+        uint32_t debug_max_bucket_overflow = 64;    /**< Overflow histogram upper bound */
+        bool     use_cuckoo_hashing        = false; /**< Probe an alternate bucket (USE_CUCKOO_HASHING) */
+    };
+
+    /** A single cache population query, equivalent to 'HashGridCache_Data' plus the traced lighting. */
+    struct Query
+    {
+        float3 eye_position;
+        float3 hit_position;
+        float3 direction;
+        float  hit_distance;
+        float3 radiance;
+    };
+
+    /** Cell descriptor, equivalent to 'HashGridCache_Desc'. */
+    struct Desc
+    {
+        uint32_t bucket_index;
+        uint32_t bucket_index_alt;
+        uint32_t tile_hash;
+        uint2    cell_offset;
+    };
+
+    /** Statistics gathered for the last simulated frame. */
+    struct Statistics
+    {
+        uint32_t              num_queries       = 0; /**< Number of queries submitted */
+        uint32_t              num_inserted      = 0; /**< Queries that resolved to a cell */
+        uint32_t              num_new_tiles     = 0; /**< Tiles allocated this frame */
+        uint32_t              num_overflows     = 0; /**< Queries that could not find a free tile */
+        uint32_t              num_evicted_tiles = 0; /**< Tiles evicted by decay this frame */
+        uint32_t              num_packed_tiles  = 0; /**< Tiles alive at the end of the frame */
+        uint32_t              num_updated_tiles = 0; /**< Tiles resolved by the update pass */
+        uint32_t              num_free_buckets  = 0; /**< Buckets without any allocated tile */
+        uint32_t              num_used_buckets  = 0; /**< Buckets with at least one allocated tile */
+        uint64_t              num_probes        = 0; /**< Tile slots inspected by all insertions */
+        uint32_t              max_probe_length  = 0; /**< Most tile slots inspected by an insertion */
+        std::vector<uint32_t> bucket_occupancy;      /**< Histogram of tiles used per bucket */
+        std::vector<uint32_t> bucket_overflow;       /**< Histogram of overflow counts per bucket */
+
+        /**
+         * Gets the ratio of allocated tiles to available tiles.
+         * @param num_tiles Total number of tiles in the cache.
+         * @return The occupancy in the range [0, 1].
+         */
+        [[nodiscard]] float getOccupancy(uint32_t num_tiles) const noexcept;
+    };
+
+    /** Results of an addressing benchmark run. */
+    struct AddressingReport
+    {
+        bool     use_cuckoo_hashing   = false; /**< The addressing scheme that was measured */
+        uint32_t num_inserts          = 0;     /**< Number of insertions performed */
+        uint32_t num_failures         = 0;     /**< Insertions that could not find a tile */
+        float    failure_rate         = 0.0F;  /**< Ratio of failed insertions */
+        float    average_probe_length = 0.0F;  /**< Average tile slots inspected per insertion */
+        uint32_t max_probe_length     = 0;     /**< Most tile slots inspected by an insertion */
+        float    max_load_factor      = 0.0F;  /**< Tile occupancy reached before the first failure */
+        float    final_load_factor    = 0.0F;  /**< Tile occupancy at the end of the stream */
+    };
+
+    HashGridCacheSimulator() noexcept = default;
+
+    ~HashGridCacheSimulator() noexcept = default;
+
+    HashGridCacheSimulator(HashGridCacheSimulator const &other)                = delete;
+    HashGridCacheSimulator(HashGridCacheSimulator &&other) noexcept            = delete;
+    HashGridCacheSimulator &operator=(HashGridCacheSimulator const &other)     = delete;
+    HashGridCacheSimulator &operator=(HashGridCacheSimulator &&other) noexcept = delete;
+
+    /**
+     * Initialise the cache storage, this clears any previous cache contents.
+     * @param settings The cache configuration.
+     * @return True if successful, false if the settings are invalid.
+     */
+    bool initialise(Settings const &settings) noexcept;
+
+    /**
+     * Simulate a single frame of cache activity.
+     * Performs the purge, populate, update and statistics passes in the same order as GI1::render().
+     * @param frame_index Current frame index (may wrap around).
+     * @param queries     The list of population queries for the frame.
+     */
+    void simulateFrame(uint32_t frame_index, std::vector<Query> const &queries) noexcept;
+
+    /**
+     * Finds a radiance cell inside the cache, equivalent to 'HashGridCache_FindCell'.
+     * @param query      The query to look up.
+     * @param tile_index (Out) The index of the probed tile.
+     * @return The mip0 cell index, kInvalidId if not found.
+     */
+    [[nodiscard]] uint32_t findCell(Query const &query, uint32_t &tile_index) const noexcept;
+
+    /**
+     * Gets the stored radiance of a cell (radiance is pre-multiplied by the sample count in .w).
+     * @param cell_index The cell index.
+     * @return The unpacked cell value.
+     */
+    [[nodiscard]] float4 getCellRadiance(uint32_t cell_index) const noexcept;
+
+    /**
+     * Gets the cell descriptor for a query, equivalent to 'HashGridCache_GetDesc'.
+     * @param query The query to describe.
+     * @return The cell descriptor.
+     */
+    [[nodiscard]] Desc getDesc(Query const &query) const noexcept;
+
+    /**
+     * Gets the cell index within a tile, equivalent to 'HashGridCache_CellIndex'.
+     * @param cell_offset_mip0 The cell offset within the mip0 tile.
+     * @param tile_index       The tile index.
+     * @param mip_level        The requested mip level.
+     * @return The cell index.
+     */
+    [[nodiscard]] uint32_t cellIndex(
+        uint2 cell_offset_mip0, uint32_t tile_index, uint32_t mip_level) const noexcept;
+
+    [[nodiscard]] Statistics const &getStatistics() const noexcept { return statistics_; }
+
+    [[nodiscard]] uint32_t getNumBuckets() const noexcept { return num_buckets_; }
+
+    [[nodiscard]] uint32_t getNumTilesPerBucket() const noexcept { return num_tiles_per_bucket_; }
+
+    [[nodiscard]] uint32_t getNumTiles() const noexcept { return num_tiles_; }
+
+    [[nodiscard]] uint32_t getNumCells() const noexcept { return num_cells_; }
+
+    [[nodiscard]] std::vector<uint32_t> const &getHashBuffer() const noexcept { return hash_buffer_; }
+
+    [[nodiscard]] std::vector<uint32_t> const &getDecayTileBuffer() const noexcept
+    {
+        return decay_tile_buffer_;
+    }
+
+    [[nodiscard]] std::vector<uint2> const &getValueBuffer() const noexcept { return value_buffer_; }
+
+    /**
+     * Loads a recorded query stream.
+     * The file is a flat binary list of frames, each one being a uint32_t query count followed by that
+     * many tightly packed records of 13 floats (eye, hit, direction, hit distance, radiance).
+     * @param file_path The file to read.
+     * @param frames    (Out) The queries for each recorded frame.
+     * @return True if successful, false if the file could not be read or is malformed.
+     */
+    static bool LoadQueryStream(
+        std::filesystem::path const &file_path, std::vector<std::vector<Query>> &frames) noexcept;
+
+    /**
+     * Saves a query stream in the format read by LoadQueryStream.
+     * @param file_path The file to write.
+     * @param frames    The queries for each frame.
+     * @return True if successful.
+     */
+    static bool SaveQueryStream(
+        std::filesystem::path const &file_path, std::vector<std::vector<Query>> const &frames) noexcept;
+
+    /**
+     * Compares the bucket addressing schemes on a query stream.
+     * Every query is inserted into an initially empty cache without any decay, so the cache fills up
+     * until insertions start failing, measuring how much of the cache each scheme can actually use.
+     * @param settings The cache configuration ('use_cuckoo_hashing' is ignored).
+     * @param frames   The queries for each recorded frame.
+     * @return One report for the linear bucket probing followed by one for cuckoo addressing.
+     */
+    static std::vector<AddressingReport> BenchmarkAddressing(
+        Settings const &settings, std::vector<std::vector<Query>> const &frames) noexcept;
+
+    /** PCG hash, equivalent to 'pcgHash' in 'math/hash.hlsl'. */
+    [[nodiscard]] static uint32_t PcgHash(uint32_t value) noexcept;
+
+    /** xxHash32 finaliser, equivalent to 'xxHash' in 'math/hash.hlsl'. */
+    [[nodiscard]] static uint32_t XxHash(uint32_t value) noexcept;
+
+    /** Quantizes radiance for atomic accumulation, equivalent to 'HashGridCache_QuantizeRadiance'. */
+    [[nodiscard]] static uint4 QuantizeRadiance(float3 const &radiance) noexcept;
+
+    /** Recovers quantized radiance, equivalent to 'HashGridCache_RecoverRadiance'. */
+    [[nodiscard]] static float4 RecoverRadiance(uint4 const &quantized_radiance) noexcept;
+
+    /** Packs radiance to half precision, equivalent to 'HashGridCache_PackRadiance'. */
+    [[nodiscard]] static uint2 PackRadiance(float4 const &radiance) noexcept;
+
+    /** Unpacks half precision radiance, equivalent to 'HashGridCache_UnpackRadiance'. */
+    [[nodiscard]] static float4 UnpackRadiance(uint2 const &packed_radiance) noexcept;
+
+private:
+    uint32_t findCell(Desc const &desc, uint32_t &tile_index, uint32_t &probe_length) const noexcept;
+    uint32_t insertCell(
+        Query const &query, uint32_t &tile_index, bool &is_new_tile, uint32_t &probe_length) noexcept;
+    void     purgeTiles(uint32_t frame_index) noexcept;
+    void     populateCells(uint32_t frame_index, std::vector<Query> const &queries) noexcept;
+    void     updateTiles() noexcept;
+    void     buildBucketStatistics() noexcept;
+
+    Settings settings_;
+
+    uint32_t num_buckets_                   = 0;
+    uint32_t num_tiles_per_bucket_          = 0;
+    uint32_t num_tiles_                     = 0;
+    uint32_t num_cells_                     = 0;
+    uint32_t num_cells_per_tile_            = 0;
+    uint32_t size_tile_mip_[4]              = {};
+    uint32_t first_cell_offset_tile_mip_[4] = {};
+
+    std::vector<uint32_t> hash_buffer_;                  /**< Tile hashes, 0 means free */
+    std::vector<uint32_t> decay_tile_buffer_;            /**< Frame index each tile was last touched */
+    std::vector<uint2>    value_buffer_;                 /**< Half packed radiance for each cell */
+    std::vector<uint32_t> update_cell_value_buffer_;     /**< Quantized radiance scratch (4 per cell) */
+    std::vector<uint32_t> update_tile_buffer_;           /**< Tiles touched this frame */
+    std::vector<uint32_t> packed_tile_index_buffer_[2];  /**< Ping-pong compacted list of live tiles */
+    std::vector<uint32_t> bucket_overflow_count_buffer_; /**< Per-bucket overflow counts */
+    uint32_t              buffer_ping_pong_ = 0;
+
+    Statistics statistics_;
+};
+} // namespace Capsaicin
@@ -0,0 +1,156 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "hash_grid_cache_size_controller.h"
+
+#include <cmath>
+
+namespace Capsaicin
+{
+void HashGridCacheSizeController::setSettings(Settings const &settings) noexcept
+{
+    settings_ = settings;
+    reset();
+}
+
+void HashGridCacheSizeController::reset() noexcept
+{
+    grow_count_     = 0;
+    shrink_count_   = 0;
+    cooldown_count_ = 0;
+    occupancy_      = 0.0F;
+    overflow_ratio_ = 0.0F;
+}
+
+HashGridCacheSizeController::Decision HashGridCacheSizeController::update(
+    Statistics const &statistics) noexcept
+{
+    Decision decision             = {};
+    decision.num_buckets          = statistics.num_buckets;
+    decision.num_tiles_per_bucket = statistics.num_tiles_per_bucket;
+
+    // Discard samples in flight from before the last resize
+    if (cooldown_count_ > 0)
+    {
+        --cooldown_count_;
+        return decision;
+    }
+    if (!IsValid(statistics))
+    {
+        return decision;
+    }
+
+    occupancy_      = CalculateOccupancy(statistics);
+    overflow_ratio_ = CalculateOverflowRatio(statistics);
+
+    // Hysteresis, only act on consecutive agreeing samples
+    if (overflow_ratio_ > settings_.grow_overflow_ratio || occupancy_ > settings_.grow_occupancy)
+    {
+        ++grow_count_;
+        shrink_count_ = 0;
+    }
+    else if (overflow_ratio_ <= 0.0F && occupancy_ < settings_.shrink_occupancy)
+    {
+        ++shrink_count_;
+        grow_count_ = 0;
+    }
+    else
+    {
+        grow_count_   = 0;
+        shrink_count_ = 0;
+    }
+
+    if (grow_count_ >= settings_.grow_sample_count)
+    {
+        // Overflowing while mostly empty means the tiles are clustered into few buckets, in which case
+        // deeper buckets help more than adding buckets
+        bool const can_grow_depth = statistics.num_tiles_per_bucket < settings_.max_num_tiles_per_bucket;
+        bool const can_grow_width = statistics.num_buckets < settings_.max_num_buckets;
+        if (can_grow_depth && (occupancy_ < settings_.cluster_occupancy || !can_grow_width))
+        {
+            ++decision.num_tiles_per_bucket;
+        }
+        else if (can_grow_width)
+        {
+            ++decision.num_buckets;
+        }
+    }
+    else if (shrink_count_ >= settings_.shrink_sample_count)
+    {
+        if (statistics.num_buckets > settings_.min_num_buckets)
+        {
+            --decision.num_buckets;
+        }
+        else if (statistics.num_tiles_per_bucket > settings_.min_num_tiles_per_bucket)
+        {
+            --decision.num_tiles_per_bucket;
+        }
+    }
+
+    decision.resize = decision.num_buckets != statistics.num_buckets
+                   || decision.num_tiles_per_bucket != statistics.num_tiles_per_bucket;
+    if (decision.resize)
+    {
+        grow_count_     = 0;
+        shrink_count_   = 0;
+        cooldown_count_ = settings_.cooldown_sample_count;
+    }
+    return decision;
+}
+
+float HashGridCacheSizeController::CalculateOccupancy(Statistics const &statistics) noexcept
+{
+    // Bin 'i' of the occupancy histogram counts the buckets with 'i' allocated tiles
+    double used_tiles = 0.0;
+    for (size_t i = 0; i < statistics.bucket_occupancy.size(); ++i)
+    {
+        used_tiles += static_cast<double>(i) * static_cast<double>(statistics.bucket_occupancy[i]);
+    }
+    double const num_tiles =
+        std::ldexp(1.0, static_cast<int>(statistics.num_buckets + statistics.num_tiles_per_bucket));
+    return static_cast<float>(used_tiles / num_tiles);
+}
+
+float HashGridCacheSizeController::CalculateOverflowRatio(Statistics const &statistics) noexcept
+{
+    // Bin 0 of the overflow histogram counts the buckets that never overflowed
+    double overflowing_buckets = 0.0;
+    for (size_t i = 1; i < statistics.bucket_overflow.size(); ++i)
+    {
+        overflowing_buckets += static_cast<double>(statistics.bucket_overflow[i]);
+    }
+    double const num_buckets = std::ldexp(1.0, static_cast<int>(statistics.num_buckets));
+    return static_cast<float>(overflowing_buckets / num_buckets);
+}
+
+bool HashGridCacheSizeController::IsValid(Statistics const &statistics) noexcept
+{
+    if (statistics.num_buckets >= 31 || statistics.num_tiles_per_bucket >= 31
+        || statistics.bucket_occupancy.size() != (1ULL << statistics.num_tiles_per_bucket) + 1)
+    {
+        return false;
+    }
+    // Every bucket is either free or used, so a mismatch indicates a sample taken at another size
+    auto const num_buckets = static_cast<float>(1U << statistics.num_buckets);
+    return statistics.free_bucket_count + statistics.used_bucket_count == num_buckets;
+}
+} // namespace Capsaicin
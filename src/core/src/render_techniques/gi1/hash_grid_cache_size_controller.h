@@ -0,0 +1,144 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Controller for automatically sizing the GI1 hash-grid cache.
+ * Consumes the bucket statistics read back from the GPU and decides when to grow or shrink the cache.
+ * Decisions require several consecutive agreeing samples and are followed by a cooldown period, which
+ * both filters out transient spikes and skips any samples still in flight from the previous size.
+ * @note Shrinking halves the tile count (doubling occupancy), so 'shrink_occupancy' must be kept below
+ *  half of 'grow_occupancy' to avoid oscillating between two sizes.
+ */
+class HashGridCacheSizeController
+{
+public:
+    /** Controller configuration, bucket/tile counts are expressed as log2 values. */
+    struct Settings
+    {
+        uint32_t min_num_buckets          = 10;    /**< Smallest allowed number of buckets */
+        uint32_t max_num_buckets          = 16;    /**< Largest allowed number of buckets */
+        uint32_t min_num_tiles_per_bucket = 2;     /**< Smallest allowed number of tiles per bucket */
+        uint32_t max_num_tiles_per_bucket = 6;     /**< Largest allowed number of tiles per bucket */
+        float    grow_overflow_ratio      = 0.01F; /**< Ratio of overflowing buckets that triggers growth */
+        float    grow_occupancy           = 0.80F; /**< Tile occupancy that triggers growth */
+        float    shrink_occupancy         = 0.20F; /**< Tile occupancy below which the cache shrinks */
+        float    cluster_occupancy        = 0.40F; /**< Overflow below this deepens the buckets */
+        uint32_t grow_sample_count        = 2;     /**< Consecutive samples required before growing */
+        uint32_t shrink_sample_count      = 8;     /**< Consecutive samples required before shrinking */
+        uint32_t cooldown_sample_count    = 4;     /**< Samples ignored after each resize */
+    };
+
+    /** Bucket statistics as produced by the 'BuildBucketStatistics' pass. */
+    struct Statistics
+    {
+        uint32_t           num_buckets          = 0;    /**< Log2 of the number of buckets */
+        uint32_t           num_tiles_per_bucket = 0;    /**< Log2 of the number of tiles per bucket */
+        float              free_bucket_count    = 0.0F; /**< Buckets without any allocated tile */
+        float              used_bucket_count    = 0.0F; /**< Buckets with at least one allocated tile */
+        std::vector<float> bucket_occupancy;            /**< Histogram of tiles used per bucket */
+        std::vector<float> bucket_overflow;             /**< Histogram of overflow counts per bucket */
+    };
+
+    /** Result of a controller update. */
+    struct Decision
+    {
+        bool     resize               = false; /**< True if the cache should be resized */
+        uint32_t num_buckets          = 0;     /**< Log2 of the requested number of buckets */
+        uint32_t num_tiles_per_bucket = 0;     /**< Log2 of the requested number of tiles per bucket */
+    };
+
+    HashGridCacheSizeController() noexcept = default;
+
+    ~HashGridCacheSizeController() noexcept = default;
+
+    HashGridCacheSizeController(HashGridCacheSizeController const &other)                = delete;
+    HashGridCacheSizeController(HashGridCacheSizeController &&other) noexcept            = delete;
+    HashGridCacheSizeController &operator=(HashGridCacheSizeController const &other)     = delete;
+    HashGridCacheSizeController &operator=(HashGridCacheSizeController &&other) noexcept = delete;
+
+    /**
+     * Sets the controller configuration and resets its state.
+     * @param settings The new configuration.
+     */
+    void setSettings(Settings const &settings) noexcept;
+
+    [[nodiscard]] Settings const &getSettings() const noexcept { return settings_; }
+
+    /** Resets the controller state (e.g. after a scene change or a manual resize). */
+    void reset() noexcept;
+
+    /**
+     * Updates the controller with a new statistics sample.
+     * @param statistics The statistics read back from the GPU.
+     * @return The sizing decision, 'resize' is false if the current size should be kept.
+     */
+    Decision update(Statistics const &statistics) noexcept;
+
+    /**
+     * Gets the tile occupancy of the last valid sample.
+     * @return The ratio of allocated tiles to available tiles.
+     */
+    [[nodiscard]] float getOccupancy() const noexcept { return occupancy_; }
+
+    /**
+     * Gets the overflow ratio of the last valid sample.
+     * @return The ratio of buckets that failed at least one insertion.
+     */
+    [[nodiscard]] float getOverflowRatio() const noexcept { return overflow_ratio_; }
+
+    /**
+     * Computes the tile occupancy from a statistics sample.
+     * @param statistics The statistics to evaluate.
+     * @return The ratio of allocated tiles to available tiles.
+     */
+    [[nodiscard]] static float CalculateOccupancy(Statistics const &statistics) noexcept;
+
+    /**
+     * Computes the ratio of overflowing buckets from a statistics sample.
+     * @param statistics The statistics to evaluate.
+     * @return The ratio of buckets that failed at least one insertion.
+     */
+    [[nodiscard]] static float CalculateOverflowRatio(Statistics const &statistics) noexcept;
+
+private:
+    /**
+     * Check whether a sample was generated using the given cache dimensions.
+     * @param statistics The statistics to check.
+     * @return True if the sample is consistent with its reported dimensions.
+     */
+    [[nodiscard]] static bool IsValid(Statistics const &statistics) noexcept;
+
+    Settings settings_;
+
+    uint32_t grow_count_     = 0;
+    uint32_t shrink_count_   = 0;
+    uint32_t cooldown_count_ = 0;
+    float    occupancy_      = 0.0F;
+    float    overflow_ratio_ = 0.0F;
+};
+} // namespace Capsaicin
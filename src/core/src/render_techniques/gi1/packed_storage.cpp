@@ -0,0 +1,118 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "packed_storage.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Capsaicin
+{
+namespace
+{
+uint32_t PackHalf(float const value) noexcept
+{
+    return glm::packHalf2x16(glm::vec2(value, 0.0F)) & 0xFFFFU;
+}
+
+float UnpackHalf(uint32_t const packed) noexcept
+{
+    return glm::unpackHalf2x16(packed & 0xFFFFU).x;
+}
+} // namespace
+
+uint32_t PackedStorage::PackSignedFloat3(float3 const &value) noexcept
+{
+    float3 const magnitude = glm::min(glm::abs(value), float3(kMaxSignedFloat3));
+    float const  max_value = std::max(magnitude.x, std::max(magnitude.y, magnitude.z));
+    int32_t exponent = static_cast<int32_t>(std::floor(std::log2(std::max(max_value, 1.0F / 65536.0F)))) + 16;
+    if (std::floor(max_value * std::exp2(static_cast<float>(23 - exponent)) + 0.5F) >= 256.0F)
+    {
+        ++exponent; // rounding overflowed the mantissa
+    }
+    float const scale  = std::exp2(static_cast<float>(23 - exponent));
+    uint32_t    packed = static_cast<uint32_t>(exponent) << 27;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        auto const     mantissa = static_cast<uint32_t>(std::floor(magnitude[i] * scale + 0.5F));
+        uint32_t const sign     = value[i] < 0.0F && mantissa != 0 ? 1U : 0U; // no negative zero
+        packed |= (mantissa | (sign << 8)) << (9 * i);
+    }
+    return packed;
+}
+
+float3 PackedStorage::UnpackSignedFloat3(uint32_t const packed) noexcept
+{
+    float const scale = std::exp2(static_cast<float>(static_cast<int32_t>(packed >> 27) - 23));
+    float3      value;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        uint32_t const channel = packed >> (9 * i);
+        value[i] = ((channel >> 8) & 1U ? -1.0F : 1.0F) * static_cast<float>(channel & 0xFFU) * scale;
+    }
+    return value;
+}
+
+uint32_t PackedStorage::PackOctahedral(float3 const &direction) noexcept
+{
+    // Project the sphere onto the octahedron, and then onto the xy plane
+    float2 p = float2(direction.x, direction.y)
+             * (1.0F / (std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z)));
+    if (direction.z < 0.0F)
+    {
+        // Reflect the folds of the lower hemisphere over the diagonals
+        p = (1.0F - glm::abs(float2(p.y, p.x)))
+          * float2(p.x >= 0.0F ? 1.0F : -1.0F, p.y >= 0.0F ? 1.0F : -1.0F);
+    }
+    return glm::packSnorm2x16(p);
+}
+
+float3 PackedStorage::UnpackOctahedral(uint32_t const packed) noexcept
+{
+    float2 const p         = glm::unpackSnorm2x16(packed);
+    float3       direction = float3(p.x, p.y, 1.0F - std::abs(p.x) - std::abs(p.y));
+    float const  fold      = std::clamp(-direction.z, 0.0F, 1.0F);
+    direction.x += direction.x >= 0.0F ? -fold : fold;
+    direction.y += direction.y >= 0.0F ? -fold : fold;
+    return glm::normalize(direction);
+}
+
+uint3 PackedStorage::PackIndirectSample(IndirectSample const &sample) noexcept
+{
+    // The hit position is stored relative to the quantized origin so that both stay consistent
+    float3 const origin(UnpackHalf(PackHalf(sample.origin.x)), UnpackHalf(PackHalf(sample.origin.y)),
+        UnpackHalf(PackHalf(sample.origin.z)));
+    float3 const   hit_vector   = sample.hit_position - origin;
+    float const    hit_distance = glm::length(hit_vector);
+    uint32_t const direction =
+        PackOctahedral(hit_distance > 0.0F ? hit_vector / hit_distance : float3(0.0F, 0.0F, 1.0F));
+    return {PackHalf(sample.origin.x) | (PackHalf(sample.origin.y) << 16),
+        PackHalf(sample.origin.z) | (PackHalf(hit_distance) << 16), direction};
+}
+
+PackedStorage::IndirectSample PackedStorage::UnpackIndirectSample(uint3 const &packed) noexcept
+{
+    IndirectSample sample;
+    sample.origin       = float3(UnpackHalf(packed.x), UnpackHalf(packed.x >> 16), UnpackHalf(packed.y));
+    sample.hit_position = sample.origin + UnpackOctahedral(packed.z) * UnpackHalf(packed.y >> 16);
+    return sample;
+}
+} // namespace Capsaicin
@@ -0,0 +1,89 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+namespace Capsaicin
+{
+/**
+ * CPU reference implementation of the GI1 packed storage formats.
+ * Mirrors the packing helpers in 'math/pack.hlsl' used when 'USE_PACKED_STORAGE' is defined, so that their
+ * precision can be checked without going through the GPU.
+ * @note Any change to the bit layouts on the GPU must be reflected here.
+ */
+class PackedStorage
+{
+public:
+    /** Largest magnitude that can be stored by the shared exponent format. */
+    static constexpr float kMaxSignedFloat3 = 65280.0F;
+
+    /** An indirect sample as stored in 'g_Reservoir_IndirectSampleBuffer'. */
+    struct IndirectSample
+    {
+        float3 origin;
+        float3 hit_position;
+    };
+
+    /**
+     * Packs signed float3 values using a shared exponent, equivalent to 'packSignedFloat3'.
+     * @param value The values to pack.
+     * @return The packed values (3x sign + 8bit mantissa, 5bit exponent).
+     */
+    [[nodiscard]] static uint32_t PackSignedFloat3(float3 const &value) noexcept;
+
+    /**
+     * Unpacks signed float3 values, equivalent to 'unpackSignedFloat3'.
+     * @param packed The packed values.
+     * @return The unpacked values.
+     */
+    [[nodiscard]] static float3 UnpackSignedFloat3(uint32_t packed) noexcept;
+
+    /**
+     * Packs a direction using an octahedral mapping, equivalent to 'packOctahedral'.
+     * @param direction The direction to pack (must be normalised).
+     * @return The packed 16bit snorm coordinates.
+     */
+    [[nodiscard]] static uint32_t PackOctahedral(float3 const &direction) noexcept;
+
+    /**
+     * Unpacks a direction, equivalent to 'unpackOctahedral'.
+     * @param packed The packed coordinates.
+     * @return The normalised direction.
+     */
+    [[nodiscard]] static float3 UnpackOctahedral(uint32_t packed) noexcept;
+
+    /**
+     * Packs an indirect sample, equivalent to 'Reservoir_PackIndirectSample'.
+     * @param sample The sample to pack.
+     * @return The half precision origin, hit distance and octahedral hit direction.
+     */
+    [[nodiscard]] static uint3 PackIndirectSample(IndirectSample const &sample) noexcept;
+
+    /**
+     * Unpacks an indirect sample, equivalent to 'Reservoir_UnpackIndirectSample'.
+     * @param packed The packed sample.
+     * @return The unpacked sample.
+     */
+    [[nodiscard]] static IndirectSample UnpackIndirectSample(uint3 const &packed) noexcept;
+};
+} // namespace Capsaicin
@@ -0,0 +1,62 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "ray_binning.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Capsaicin
+{
+uint32_t RayBinning::SpreadBits(uint32_t value) noexcept
+{
+    value &= (1U << kCellBitCount) - 1;
+    value = (value | (value << 8)) & 0x00FF00FFU;
+    value = (value | (value << 4)) & 0x0F0F0F0FU;
+    value = (value | (value << 2)) & 0x33333333U;
+    value = (value | (value << 1)) & 0x55555555U;
+    return value;
+}
+
+uint32_t RayBinning::CalculateKey(
+    float3 const &direction, uint2 const pixel, uint32_t const cell_size) noexcept
+{
+    uint32_t const octant = (direction.x < 0.0F ? 1U : 0U) | (direction.y < 0.0F ? 2U : 0U)
+                          | (direction.z < 0.0F ? 4U : 0U);
+    uint2 const cell = pixel / cell_size;
+    return (octant << (2 * kCellBitCount)) | SpreadBits(cell.x) | (SpreadBits(cell.y) << 1);
+}
+
+uint32_t RayBinning::GetOctant(uint32_t const key) noexcept
+{
+    return (key >> (2 * kCellBitCount)) & 7U;
+}
+
+std::vector<uint32_t> RayBinning::Sort(std::vector<uint32_t> const &keys) noexcept
+{
+    std::vector<uint32_t> indices(keys.size());
+    std::iota(indices.begin(), indices.end(), 0U);
+    std::stable_sort(indices.begin(), indices.end(),
+        [&keys](uint32_t const lhs, uint32_t const rhs) { return keys[lhs] < keys[rhs]; });
+    return indices;
+}
+} // namespace Capsaicin
@@ -0,0 +1,78 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * CPU reference implementation of the GI1 ray binning.
+ * Mirrors 'CalculateRayBinningKey' in 'gi1.hlsl' and the key/payload sort performed with 'GPUSort' before
+ * the 'PopulateScreenProbesCells' and 'TraceReflections' passes.
+ * The rays of 'PopulateMultibounceCells' are never binned as they start from hash-grid cells rather than
+ * from screen pixels.
+ * @note Any change to the key layout on the GPU must be reflected here.
+ */
+class RayBinning
+{
+public:
+    /** Number of bits used by each of the screen cell coordinates. */
+    static constexpr uint32_t kCellBitCount = 12;
+
+    /** Key of rays that do not need to be traced (sorted last). */
+    static constexpr uint32_t kInvalidKey = 0xFFFFFFFFU;
+
+    /**
+     * Interleaves the lower 12 bits of a value with zeros, equivalent to 'SpreadRayBinningBits'.
+     * @param value The value to spread.
+     * @return The spread bits.
+     */
+    [[nodiscard]] static uint32_t SpreadBits(uint32_t value) noexcept;
+
+    /**
+     * Calculates the binning key of a ray, equivalent to 'CalculateRayBinningKey'.
+     * @param direction The ray direction (does not need to be normalised).
+     * @param pixel     The pixel the ray originates from.
+     * @param cell_size The size of the screen cells in pixels.
+     * @return The key, made of the direction octant followed by the Morton code of the screen cell.
+     */
+    [[nodiscard]] static uint32_t CalculateKey(
+        float3 const &direction, uint2 pixel, uint32_t cell_size) noexcept;
+
+    /**
+     * Gets the direction octant stored in a binning key.
+     * @param key The binning key.
+     * @return The octant index in the range [0, 7].
+     */
+    [[nodiscard]] static uint32_t GetOctant(uint32_t key) noexcept;
+
+    /**
+     * Sorts the rays by key, equivalent to 'GPUSort::sortIndirectPayload' with the ray indices as payload.
+     * @param keys The binning keys of the rays.
+     * @return The ray indices in trace order (the sort is stable like the GPU radix sort).
+     */
+    [[nodiscard]] static std::vector<uint32_t> Sort(std::vector<uint32_t> const &keys) noexcept;
+};
+} // namespace Capsaicin
@@ -45,16 +45,27 @@ RWTexture2D<uint>   g_ScreenProbes_OutProbeMaskBuffer;
 RWTexture2D<float4> g_ScreenProbes_PreviousProbeBuffer;
 RWTexture2D<uint>   g_ScreenProbes_PreviousProbeMaskBuffer;
 
-RWStructuredBuffer<uint2> g_ScreenProbes_ProbeSHBuffer;
-RWStructuredBuffer<uint2> g_ScreenProbes_PreviousProbeSHBuffer;
+#ifdef USE_PACKED_STORAGE
+typedef uint  ScreenProbes_PackedSHColor; // signed shared exponent
+#else
+typedef uint2 ScreenProbes_PackedSHColor; // half precision
+#endif // USE_PACKED_STORAGE
+
+RWStructuredBuffer<ScreenProbes_PackedSHColor> g_ScreenProbes_ProbeSHBuffer;
+RWStructuredBuffer<ScreenProbes_PackedSHColor> g_ScreenProbes_PreviousProbeSHBuffer;
 
 RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnBuffer;
 RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnScanBuffer;
 RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnIndexBuffer;
+RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnExtraScanBuffer;
+RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnExtraIndexBuffer;
 RWStructuredBuffer<uint2> g_ScreenProbes_ProbeSpawnProbeBuffer;
 RWStructuredBuffer<uint2> g_ScreenProbes_ProbeSpawnSampleBuffer;
 RWStructuredBuffer<uint2> g_ScreenProbes_ProbeSpawnRadianceBuffer;
 RWStructuredBuffer<uint>  g_ScreenProbes_PreviousProbeSpawnBuffer;
+RWStructuredBuffer<uint>  g_ScreenProbes_ProbeRayKeyBuffer;
+RWStructuredBuffer<uint>  g_ScreenProbes_ProbeRayIndexBuffer;
+RWStructuredBuffer<uint>  g_ScreenProbes_ProbeRayCountBuffer;
 
 RWStructuredBuffer<uint> g_ScreenProbes_EmptyTileBuffer;
 RWStructuredBuffer<uint> g_ScreenProbes_EmptyTileCountBuffer;
@@ -101,6 +112,81 @@ uint2 ScreenProbes_UnpackSeed(in uint packed_seed)
     return uint2(packed_seed >> 16, packed_seed & 0xFFFFu);
 }
 
+// Gets the number of probe spawn tiles.
+uint ScreenProbes_GetMaxProbeSpawnCount()
+{
+    return ((g_BufferDimensions.x + g_ScreenProbesConstants.probe_spawn_tile_size - 1) / g_ScreenProbesConstants.probe_spawn_tile_size)
+         * ((g_BufferDimensions.y + g_ScreenProbesConstants.probe_spawn_tile_size - 1) / g_ScreenProbesConstants.probe_spawn_tile_size);
+}
+
+// Gets the number of base probes spawned this frame (at most one per spawn tile).
+uint ScreenProbes_GetBaseProbeCount()
+{
+    uint max_probe_spawn_count = ScreenProbes_GetMaxProbeSpawnCount();
+
+    return g_ScreenProbes_ProbeSpawnScanBuffer[max_probe_spawn_count - 1]
+         + g_ScreenProbes_ProbeSpawnIndexBuffer[max_probe_spawn_count - 1];
+}
+
+// Gets the number of probes spawned this frame.
+// With variable-rate probes, the extra probes of the detailed tiles are appended after the base probes,
+// as long as the total remains within the ray budget of one probe per spawn tile.
+uint ScreenProbes_GetSpawnedProbeCount()
+{
+    uint probe_count = ScreenProbes_GetBaseProbeCount();
+
+#ifdef USE_VARIABLE_RATE_PROBES
+    uint max_probe_spawn_count = ScreenProbes_GetMaxProbeSpawnCount();
+    uint extra_probe_count     = g_ScreenProbes_ProbeSpawnExtraScanBuffer[max_probe_spawn_count - 1]
+                               + g_ScreenProbes_ProbeSpawnExtraIndexBuffer[max_probe_spawn_count - 1];
+
+    probe_count += min(extra_probe_count, max_probe_spawn_count - probe_count);
+#endif // USE_VARIABLE_RATE_PROBES
+
+    return probe_count;
+}
+
+// Gets the query index of the probe ray traced by a given thread.
+// With ray binning, the rays are traced in the order given by sorting their binning keys.
+uint ScreenProbes_GetBinnedQueryIndex(in uint did)
+{
+#ifdef USE_RAY_BINNING
+    if (did < g_ScreenProbes_ProbeRayCountBuffer[0])
+    {
+        return g_ScreenProbes_ProbeRayIndexBuffer[did];
+    }
+#endif // USE_RAY_BINNING
+
+    return did;
+}
+
+// Calculates the importance of a probe spawn tile from the relative temporal variance of its lighting and
+// its geometric complexity (i.e., normal and depth discontinuities).
+float ScreenProbes_CalculateSpawnTileImportance(in float relative_variance, in float normal_variation, in float depth_variation)
+{
+    return max(relative_variance, max(normal_variation, depth_variation));
+}
+
+// Calculates the number of probes to spawn into a tile for variable-rate probe placement:
+//  - detailed tiles get a probe in each of their (non-sky) probe tiles,
+//  - flat and fully reprojected tiles only get refreshed every other frame in a checkerboard pattern,
+//  - all other tiles get a single probe, same as fixed-rate placement.
+// Note: this must be kept in sync with ScreenProbesAllocator on the CPU.
+uint ScreenProbes_CalculateSpawnTileProbeCount(in float importance, in bool is_reprojected, in uint extra_probe_count, in uint2 tile, in uint frame_index)
+{
+    if (importance >= g_ScreenProbesConstants.variable_rate_high_threshold)
+    {
+        return 1 + min(extra_probe_count, 3);
+    }
+
+    if (importance < g_ScreenProbesConstants.variable_rate_low_threshold && is_reprojected)
+    {
+        return ((tile.x + tile.y + frame_index) & 1) == 0 ? 1 : 0;
+    }
+
+    return 1;
+}
+
 // Finds the closest probe to the specified location on the probe grid.
 // Here, we start at the highest mip level in the probe mask and fall back
 // to lower mips if failing to find a valid probe seed.
@@ -166,15 +252,23 @@ uint ScreenProbes_FindClosestProbe(in uint2 pos, in int2 offset)
 }
 
 // Packs the coefficients of the SH color.
-uint2 ScreenProbes_PackSHColor(in float4 sh_color)
+ScreenProbes_PackedSHColor ScreenProbes_PackSHColor(in float4 sh_color)
 {
+#ifdef USE_PACKED_STORAGE
+    return packSignedFloat3(sh_color.xyz); // only the color is ever evaluated
+#else
     return packHalf4(sh_color);
+#endif
 }
 
 // Unpacks the SH color from its packed format inside the probes.
-float4 ScreenProbes_UnpackSHColor(in uint2 packed_sh_color)
+float4 ScreenProbes_UnpackSHColor(in ScreenProbes_PackedSHColor packed_sh_color)
 {
+#ifdef USE_PACKED_STORAGE
+    return float4(unpackSignedFloat3(packed_sh_color), 1.0f);
+#else
     return unpackHalf4(packed_sh_color);
+#endif
 }
 
 // Evaluates the irradiance from the probe's SH representation.
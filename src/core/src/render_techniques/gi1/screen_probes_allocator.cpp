@@ -0,0 +1,94 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "screen_probes_allocator.h"
+
+#include <algorithm>
+
+namespace Capsaicin
+{
+float ScreenProbesAllocator::Allocation::getRayBudgetSaved() const noexcept
+{
+    return budget > 0 ? 1.0F - static_cast<float>(getProbeCount()) / static_cast<float>(budget) : 0.0F;
+}
+
+float ScreenProbesAllocator::CalculateImportance(Tile const &tile) noexcept
+{
+    return std::max(tile.relative_variance, std::max(tile.normal_variation, tile.depth_variation));
+}
+
+uint32_t ScreenProbesAllocator::CalculateProbeCount(Settings const &settings, Tile const &tile,
+    uint2 const tile_coords, uint32_t const frame_index) noexcept
+{
+    if (tile.is_sky)
+    {
+        return 0; // same as fixed-rate spawning
+    }
+    float const importance = CalculateImportance(tile);
+    if (importance >= settings.high_threshold)
+    {
+        return 1 + std::min(tile.extra_probe_count, kMaxProbesPerTile - 1);
+    }
+    if (importance < settings.low_threshold && tile.is_reprojected)
+    {
+        // Refresh sparse tiles in a checkerboard pattern so that they are never starved for too long
+        return ((tile_coords.x + tile_coords.y + frame_index) & 1) == 0 ? 1 : 0;
+    }
+    return 1;
+}
+
+ScreenProbesAllocator::Allocation ScreenProbesAllocator::Allocate(Settings const &settings,
+    std::vector<Tile> const &tiles, uint32_t const tile_width, uint32_t const frame_index) noexcept
+{
+    Allocation allocation = {};
+    auto const tile_count = static_cast<uint32_t>(tiles.size());
+    allocation.budget     = tile_count;
+    allocation.base_counts.resize(tile_count);
+    allocation.extra_counts.resize(tile_count);
+    allocation.base_offsets.resize(tile_count);
+    allocation.extra_offsets.resize(tile_count);
+    if (tile_width == 0)
+    {
+        return allocation;
+    }
+
+    // Equivalent to the 'SpawnScreenProbes' kernel followed by the two scan sums
+    uint32_t requested_extra_count = 0;
+    for (uint32_t tile_index = 0; tile_index < tile_count; ++tile_index)
+    {
+        uint2 const    tile_coords(tile_index % tile_width, tile_index / tile_width);
+        uint32_t const probe_count =
+            CalculateProbeCount(settings, tiles[tile_index], tile_coords, frame_index);
+        allocation.base_counts[tile_index]   = std::min(probe_count, 1U);
+        allocation.extra_counts[tile_index]  = probe_count - allocation.base_counts[tile_index];
+        allocation.base_offsets[tile_index]  = allocation.base_probe_count;
+        allocation.extra_offsets[tile_index] = requested_extra_count;
+        allocation.base_probe_count += allocation.base_counts[tile_index];
+        requested_extra_count += allocation.extra_counts[tile_index];
+    }
+
+    // Extra probes are only kept while they fit after all the base ones ('CompactScreenProbes')
+    allocation.extra_probe_count = std::min(requested_extra_count, tile_count - allocation.base_probe_count);
+    allocation.dropped_count     = requested_extra_count - allocation.extra_probe_count;
+    return allocation;
+}
+} // namespace Capsaicin
@@ -0,0 +1,120 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * CPU reference implementation of the GI1 variable-rate screen probe allocation.
+ * Mirrors 'ScreenProbes_CalculateSpawnTileImportance' and 'ScreenProbes_CalculateSpawnTileProbeCount' in
+ * 'screen_probes.hlsl' along with the two-level prefix-sum compaction performed by the 'SpawnScreenProbes'
+ * and 'CompactScreenProbes' kernels of 'gi1.comp'.
+ * Each spawn tile covers 2x2 probe tiles and receives either no probe (flat and fully reprojected tiles on
+ * alternate frames), a single base probe (the default) or a probe in each of its probe tiles (detailed
+ * tiles). Base probes always fit in the ray budget, extra probes are then granted in tile order until the
+ * budget of one probe per spawn tile is exhausted.
+ * @note Any change to the allocation policy on the GPU must be reflected here.
+ */
+class ScreenProbesAllocator
+{
+public:
+    /** Number of probe tiles per spawn tile (kSamplingMode_QuarterSpp). */
+    static constexpr uint32_t kMaxProbesPerTile = 4;
+
+    /** Allocation configuration, matches the 'gi1_variable_rate_probes_*' render options. */
+    struct Settings
+    {
+        float low_threshold  = 0.05F; /**< Importance below which fully reprojected tiles are sparse */
+        float high_threshold = 0.25F; /**< Importance above which tiles get a probe per probe tile */
+    };
+
+    /** Per spawn tile inputs, as gathered by the 'SpawnScreenProbes' kernel. */
+    struct Tile
+    {
+        float    relative_variance = 0.0F;  /**< Temporal luminance delta over luminance of the lighting */
+        float    normal_variation  = 0.0F;  /**< One minus the smallest normal cosine to the base seed */
+        float    depth_variation   = 0.0F;  /**< Largest relative eye distance difference to the base seed */
+        bool     is_reprojected    = false; /**< All probe tiles were successfully reprojected */
+        bool     is_sky            = false; /**< The base probe seed lands on the sky */
+        uint32_t extra_probe_count = 3;     /**< Number of non-sky probe tiles besides the base one */
+    };
+
+    /** Result of allocating the probes of a frame. */
+    struct Allocation
+    {
+        std::vector<uint32_t> base_counts;           /**< Base probes spawned per tile (0 or 1) */
+        std::vector<uint32_t> extra_counts;          /**< Extra probes requested per tile */
+        std::vector<uint32_t> base_offsets;          /**< Exclusive prefix sum of 'base_counts' */
+        std::vector<uint32_t> extra_offsets;         /**< Exclusive prefix sum of 'extra_counts' */
+        uint32_t              budget            = 0; /**< Maximum number of probes (one per spawn tile) */
+        uint32_t              base_probe_count  = 0; /**< Total number of base probes */
+        uint32_t              extra_probe_count = 0; /**< Total number of extra probes that fit the budget */
+        uint32_t              dropped_count     = 0; /**< Extra probes that did not fit the budget */
+
+        /**
+         * Gets the total number of spawned probes, equivalent to 'ScreenProbes_GetSpawnedProbeCount'.
+         * @return The number of probes.
+         */
+        [[nodiscard]] uint32_t getProbeCount() const noexcept { return base_probe_count + extra_probe_count; }
+
+        /**
+         * Gets the ratio of the ray budget that was left unused.
+         * @return The saved ratio in the range [0, 1].
+         */
+        [[nodiscard]] float getRayBudgetSaved() const noexcept;
+    };
+
+    /**
+     * Calculates the importance of a spawn tile, equivalent to 'ScreenProbes_CalculateSpawnTileImportance'.
+     * @param tile The tile inputs.
+     * @return The importance, zero for a flat and temporally stable tile.
+     */
+    [[nodiscard]] static float CalculateImportance(Tile const &tile) noexcept;
+
+    /**
+     * Calculates the number of probes requested by a spawn tile, equivalent to
+     * 'ScreenProbes_CalculateSpawnTileProbeCount'.
+     * @param settings    The allocation configuration.
+     * @param tile        The tile inputs.
+     * @param tile_coords The spawn tile coordinates.
+     * @param frame_index Current frame index.
+     * @return The number of probes in the range [0, kMaxProbesPerTile].
+     */
+    [[nodiscard]] static uint32_t CalculateProbeCount(
+        Settings const &settings, Tile const &tile, uint2 tile_coords, uint32_t frame_index) noexcept;
+
+    /**
+     * Allocates the probes of all spawn tiles.
+     * @param settings    The allocation configuration.
+     * @param tiles       The tile inputs in row-major order.
+     * @param tile_width  The number of spawn tiles per row.
+     * @param frame_index Current frame index.
+     * @return The allocation.
+     */
+    [[nodiscard]] static Allocation Allocate(Settings const &settings, std::vector<Tile> const &tiles,
+        uint32_t tile_width, uint32_t frame_index) noexcept;
+};
+} // namespace Capsaicin
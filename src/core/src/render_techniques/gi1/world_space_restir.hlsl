@@ -46,7 +46,13 @@ RWStructuredBuffer<uint>  g_Reservoir_PreviousHashCountBuffer;
 RWStructuredBuffer<uint>  g_Reservoir_PreviousHashIndexBuffer;
 RWStructuredBuffer<uint>  g_Reservoir_PreviousHashValueBuffer;
 
-RWStructuredBuffer<float4> g_Reservoir_IndirectSampleBuffer;
+#ifdef USE_PACKED_STORAGE
+typedef uint3  Reservoir_PackedIndirectSample; // origin, direction and distance
+#else
+typedef float4 Reservoir_PackedIndirectSample; // origin and hit position
+#endif // USE_PACKED_STORAGE
+
+RWStructuredBuffer<Reservoir_PackedIndirectSample> g_Reservoir_IndirectSampleBuffer;
 RWStructuredBuffer<uint>   g_Reservoir_IndirectSampleNormalBuffer;
 RWStructuredBuffer<uint>   g_Reservoir_IndirectSampleMaterialBuffer;
 RWStructuredBuffer<uint4>  g_Reservoir_IndirectSampleReservoirBuffer;
@@ -151,16 +157,29 @@ uint Reservoir_FindPreviousEntry(in float3 position)
 }
 
 // Packs the indirect sample.
-float4 Reservoir_PackIndirectSample(in float3 origin, in float3 hit_position)
+Reservoir_PackedIndirectSample Reservoir_PackIndirectSample(in float3 origin, in float3 hit_position)
 {
+#ifdef USE_PACKED_STORAGE
+    uint2  packed_origin = packHalf3(origin);
+    float3 hit_vector    = hit_position - unpackHalf3(packed_origin);
+    float  hit_distance  = length(hit_vector);
+    uint   direction     = packOctahedral(hit_distance > 0.0f ? hit_vector / hit_distance : float3(0.0f, 0.0f, 1.0f));
+    return uint3(packed_origin.x, packed_origin.y | (f32tof16(hit_distance) << 16), direction);
+#else
     return asfloat(uint4(packHalf3(origin), packHalf3(hit_position)));
+#endif
 }
 
 // Unpacks the indirect sample.
-void Reservoir_UnpackIndirectSample(in float4 packed_indirect_sample, out float3 origin, out float3 hit_position)
+void Reservoir_UnpackIndirectSample(in Reservoir_PackedIndirectSample packed_indirect_sample, out float3 origin, out float3 hit_position)
 {
+#ifdef USE_PACKED_STORAGE
+    origin       = unpackHalf3(packed_indirect_sample.xy);
+    hit_position = origin + unpackOctahedral(packed_indirect_sample.z) * f16tof32(packed_indirect_sample.y >> 16);
+#else
     origin       = unpackHalf3(asuint(packed_indirect_sample.xy));
     hit_position = unpackHalf3(asuint(packed_indirect_sample.zw));
+#endif
 }
 
 #endif // WORLD_SPACE_RESTIR_HLSL
@@ -63,6 +63,20 @@ SharedTextureList ImageMetrics::getSharedTextures() const noexcept
     return textures;
 }
 
+StatisticList ImageMetrics::getStatistics() const noexcept
+{
+    StatisticList statistics;
+    if (!metricsReady)
+    {
+        return statistics;
+    }
+    statistics.emplace_back("PQ-MSE", static_cast<double>(metricMSE.getMetricValue()));
+    statistics.emplace_back("PQ-RMAE", static_cast<double>(metricRMAE.getMetricValue()));
+    statistics.emplace_back("PQ-SMAPE", static_cast<double>(metricSMAPE.getMetricValue()));
+    statistics.emplace_back("PQ-SSIM", static_cast<double>(metricSSIM.getMetricValue()));
+    return statistics;
+}
+
 bool ImageMetrics::init(CapsaicinInternal const &capsaicin) noexcept
 {
     options = convertOptions(capsaicin.getOptions());
@@ -97,6 +111,7 @@ bool ImageMetrics::init(CapsaicinInternal const &capsaicin) noexcept
 
 void ImageMetrics::render(CapsaicinInternal &capsaicin) noexcept
 {
+    metricsReady = false;
     RenderOptions const newOptions = convertOptions(capsaicin.getOptions());
     if (options.image_metrics_enable != newOptions.image_metrics_enable)
     {
@@ -152,6 +167,7 @@ void ImageMetrics::render(CapsaicinInternal &capsaicin) noexcept
     metricRMAE.compareAsync(colourBuffer, referenceImage);
     metricSMAPE.compareAsync(colourBuffer, referenceImage);
     metricSSIM.compareAsync(colourBuffer, referenceImage);
+    metricsReady = capsaicin.getFrameIndex() > metricMSE.getAsyncDelay();
 
     if (options.image_metrics_save_to_file && capsaicin.getFrameIndex() > metricMSE.getAsyncDelay())
     {
@@ -64,6 +64,12 @@ class ImageMetrics final : public RenderTechnique
      */
     [[nodiscard]] SharedTextureList getSharedTextures() const noexcept override;
 
+    /**
+     * Gets a list of any statistics gathered by the current render technique during the last frames.
+     * @return A list of all available statistics.
+     */
+    [[nodiscard]] StatisticList getStatistics() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -97,7 +103,8 @@ class ImageMetrics final : public RenderTechnique
     void               closeFile() noexcept;
 
     RenderOptions options;
-    bool          needsInit = false;
+    bool          needsInit    = false;
+    bool          metricsReady = false; /**< True if the metrics contain values for a recent frame */
 
     GPUImageMetrics metricMSE;
     GPUImageMetrics metricRMAE;
@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include "lens.h"
 
 #include "../../components/blue_noise_sampler/blue_noise_sampler.h"
+#include "../../components/post_process_chain/post_process_chain.h"
 #include "capsaicin_internal.h"
 
 namespace Capsaicin
@@ -62,6 +63,13 @@ Lens::RenderOptions Lens::convertOptions(RenderOptionList const &options) noexce
     return newOptions;
 }
 
+ComponentList Lens::getComponents() const noexcept
+{
+    ComponentList components;
+    components.emplace_back(COMPONENT_MAKE(PostProcessChain));
+    return components;
+}
+
 SharedTextureList Lens::getSharedTextures() const noexcept
 {
     SharedTextureList textures;
@@ -74,6 +82,8 @@ SharedTextureList Lens::getSharedTextures() const noexcept
 
 bool Lens::init(CapsaicinInternal const &capsaicin) noexcept
 {
+    capsaicin.getComponent<PostProcessChain>()->registerStage(PostProcessChain::Slot::Lens);
+
     // Reset internal grain values
     grainSeed = 0;
     grainTime = 0.0;
@@ -91,7 +101,8 @@ bool Lens::init(CapsaicinInternal const &capsaicin) noexcept
 
 void Lens::render(CapsaicinInternal &capsaicin) noexcept
 {
-    auto const newOptions = convertOptions(capsaicin.getOptions());
+    auto const newOptions       = convertOptions(capsaicin.getOptions());
+    auto const postProcessChain = capsaicin.getComponent<PostProcessChain>();
 
     if (!newOptions.lens_chromatic_enable && !newOptions.lens_vignette_enable
         && !newOptions.lens_film_grain_enable)
@@ -102,6 +113,7 @@ void Lens::render(CapsaicinInternal &capsaicin) noexcept
             terminate();
         }
         options = newOptions;
+        postProcessChain->skip(capsaicin, PostProcessChain::Slot::Lens);
         return;
     }
 
@@ -118,6 +130,7 @@ void Lens::render(CapsaicinInternal &capsaicin) noexcept
     {
         if (!init(capsaicin))
         {
+            postProcessChain->skip(capsaicin, PostProcessChain::Slot::Lens);
             return;
         }
     }
@@ -125,6 +138,7 @@ void Lens::render(CapsaicinInternal &capsaicin) noexcept
     {
         if (!initLens(capsaicin))
         {
+            postProcessChain->skip(capsaicin, PostProcessChain::Slot::Lens);
             return;
         }
     }
@@ -132,36 +146,41 @@ void Lens::render(CapsaicinInternal &capsaicin) noexcept
     bool const usesScaling = capsaicin.hasSharedTexture("ColorScaled")
                           && capsaicin.hasOption<bool>("taa_enable")
                           && capsaicin.getOption<bool>("taa_enable");
-    auto const &input =
-        !usesScaling ? capsaicin.getSharedTexture("Color") : capsaicin.getSharedTexture("ColorScaled");
-    auto const &output = options.lens_chromatic_enable ? chromaticAberrationTexture : input;
-
     auto const bufferDimensions =
         !usesScaling ? capsaicin.getRenderDimensions() : capsaicin.getWindowDimensions();
-    gfxProgramSetParameter(gfx_, lensProgram, "g_BufferDimensions", bufferDimensions);
-    gfxProgramSetParameter(gfx_, lensProgram, "g_InputBuffer", input);
-    gfxProgramSetParameter(gfx_, lensProgram, "g_OutputBuffer", output);
-    if (options.lens_chromatic_enable)
-    {
-        gfxProgramSetParameter(gfx_, lensProgram, "g_LinearClampSampler", capsaicin.getLinearSampler());
-        gfxProgramSetParameter(gfx_, lensProgram, "g_ChromAb", options.lens_chromatic_intensity);
-    }
-    if (options.lens_vignette_enable)
-    {
-        gfxProgramSetParameter(gfx_, lensProgram, "g_Vignette", options.lens_vignette_intensity);
-    }
     if (options.lens_film_grain_enable)
     {
-        gfxProgramSetParameter(gfx_, lensProgram, "g_GrainScale", options.lens_filmgrain_scale);
-        gfxProgramSetParameter(gfx_, lensProgram, "g_GrainAmount", options.lens_filmgrain_amount);
         grainTime += capsaicin.getFrameTime();
         if (grainTime >= 0.02)
         {
             ++grainSeed;
             grainTime = 0.0;
         }
-        gfxProgramSetParameter(gfx_, lensProgram, "g_GrainSeed", grainSeed);
     }
+
+    // Try and fuse with any neighbouring post-processing operators, this is not possible when using
+    // chromatic aberration as it samples neighbouring pixels
+    PostProcessChain::Stage stage {.slot = PostProcessChain::Slot::Lens,
+        .buffer                          = !usesScaling ? "Color" : "ColorScaled",
+        .dimensions                      = bufferDimensions,
+        .defines                         = lensDefines,
+        .bind = [this](CapsaicinInternal const &context, GfxProgram const &program) {
+            addProgramParameters(context, program);
+        },
+        .readsNeighbours = options.lens_chromatic_enable};
+    if (postProcessChain->fuse(capsaicin, std::move(stage)))
+    {
+        return;
+    }
+
+    auto const &input =
+        !usesScaling ? capsaicin.getSharedTexture("Color") : capsaicin.getSharedTexture("ColorScaled");
+    auto const &output = options.lens_chromatic_enable ? chromaticAberrationTexture : input;
+
+    addProgramParameters(capsaicin, lensProgram);
+    gfxProgramSetParameter(gfx_, lensProgram, "g_BufferDimensions", bufferDimensions);
+    gfxProgramSetParameter(gfx_, lensProgram, "g_InputBuffer", input);
+    gfxProgramSetParameter(gfx_, lensProgram, "g_OutputBuffer", output);
     {
         TimedSection const timed_section(*this, "Lens");
         uint32_t const     numGroupsX = (bufferDimensions.x + 8 - 1) / 8;
@@ -187,6 +206,25 @@ void Lens::terminate() noexcept
     chromaticAberrationTexture = {};
 }
 
+void Lens::addProgramParameters(CapsaicinInternal const &capsaicin, GfxProgram const &program) const noexcept
+{
+    if (options.lens_chromatic_enable)
+    {
+        gfxProgramSetParameter(gfx_, program, "g_LinearClampSampler", capsaicin.getLinearSampler());
+        gfxProgramSetParameter(gfx_, program, "g_ChromAb", options.lens_chromatic_intensity);
+    }
+    if (options.lens_vignette_enable)
+    {
+        gfxProgramSetParameter(gfx_, program, "g_Vignette", options.lens_vignette_intensity);
+    }
+    if (options.lens_film_grain_enable)
+    {
+        gfxProgramSetParameter(gfx_, program, "g_GrainScale", options.lens_filmgrain_scale);
+        gfxProgramSetParameter(gfx_, program, "g_GrainAmount", options.lens_filmgrain_amount);
+        gfxProgramSetParameter(gfx_, program, "g_GrainSeed", grainSeed);
+    }
+}
+
 void Lens::renderGUI(CapsaicinInternal &capsaicin) const noexcept
 {
     bool chromaticEnabled = capsaicin.getOption<bool>("lens_chromatic_enable");
@@ -239,7 +277,8 @@ bool Lens::initLens(CapsaicinInternal const &capsaicin) noexcept
 {
     gfxDestroyKernel(gfx_, lensMapKernel);
 
-    std::vector<char const *> defines;
+    std::vector<char const *> &defines = lensDefines;
+    defines.clear();
     if (options.lens_chromatic_enable)
     {
         defines.push_back("ENABLE_CHROMATIC");
@@ -60,6 +60,12 @@ class Lens final : public RenderTechnique
      */
     static RenderOptions convertOptions(RenderOptionList const &options) noexcept;
 
+    /**
+     * Gets a list of any shared components used by the current render technique.
+     * @return A list of all supported components.
+     */
+    [[nodiscard]] ComponentList getComponents() const noexcept override;
+
     /**
      * Gets the required list of shared textures needed for the current render technique.
      * @return A list of all required shared textures.
@@ -95,7 +101,15 @@ class Lens final : public RenderTechnique
 private:
     [[nodiscard]] bool initLens(CapsaicinInternal const &capsaicin) noexcept;
 
-    RenderOptions options;
+    /**
+     * Add the lens effect parameters to a program.
+     * @param capsaicin Current framework context.
+     * @param program   The shader program to bind parameters to.
+     */
+    void addProgramParameters(CapsaicinInternal const &capsaicin, GfxProgram const &program) const noexcept;
+
+    RenderOptions             options;
+    std::vector<char const *> lensDefines; /**< Defines of the current lens kernel permutation */
 
     uint32_t grainSeed = 0;
     double   grainTime = 0.0;
@@ -0,0 +1,150 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#ifndef LENS_HLSL
+#define LENS_HLSL
+
+// Requires g_BufferDimensions, g_InputBuffer and g_OutputBuffer to be declared before inclusion
+// Optionally ENABLE_CHROMATIC, ENABLE_VIGNETTE and ENABLE_FILMGRAIN may be defined
+
+#define FFX_GPU 1
+#define FFX_HLSL 1
+#define FFX_HLSL_SM 67
+#include "FidelityFX/gpu/ffx_core.h"
+
+#ifdef ENABLE_CHROMATIC
+SamplerState g_LinearClampSampler;
+float g_ChromAb;
+#endif
+#ifdef ENABLE_VIGNETTE
+float g_Vignette;
+#endif
+#ifdef ENABLE_FILMGRAIN
+float g_GrainScale;
+float g_GrainAmount;
+uint g_GrainSeed;
+#endif
+
+FfxFloat32 FfxLensSampleR(FfxFloat32x2 fPxPos)
+{
+#ifdef ENABLE_CHROMATIC
+    return g_InputBuffer.SampleLevel(g_LinearClampSampler, fPxPos, 0).r;
+#else
+    return 0.0f;
+#endif
+}
+
+FfxFloat32 FfxLensSampleG(FfxFloat32x2 fPxPos)
+{
+#ifdef ENABLE_CHROMATIC
+    return g_InputBuffer.SampleLevel(g_LinearClampSampler, fPxPos, 0).g;
+#else
+    return 0.0f;
+#endif
+}
+
+FfxFloat32 FfxLensSampleB(FfxFloat32x2 fPxPos)
+{
+#ifdef ENABLE_CHROMATIC
+    return g_InputBuffer.SampleLevel(g_LinearClampSampler, fPxPos, 0).b;
+#else
+    return 0.0f;
+#endif
+}
+
+FfxFloat32 GrainScale()
+{
+#ifdef ENABLE_FILMGRAIN
+    return g_GrainScale;
+#else
+    return 0.0f;
+#endif
+}
+
+FfxFloat32 GrainAmount()
+{
+#ifdef ENABLE_FILMGRAIN
+    return g_GrainAmount;
+#else
+    return 0.0f;
+#endif
+}
+
+FfxUInt32 GrainSeed()
+{
+#ifdef ENABLE_FILMGRAIN
+    return g_GrainSeed;
+#else
+    return 0;
+#endif
+}
+
+FfxUInt32x2 Center()
+{
+    return g_BufferDimensions / 2;
+}
+
+FfxFloat32 Vignette()
+{
+#ifdef ENABLE_VIGNETTE
+    return g_Vignette;
+#else
+    return 0.0f;
+#endif
+}
+
+FfxFloat32 ChromAb()
+{
+#ifdef ENABLE_CHROMATIC
+    return g_ChromAb;
+#else
+    return 0.0f;
+#endif
+}
+
+void StoreLensOutput(FfxInt32x2 iPxPos, FfxFloat32x3 fColor)
+{
+    g_OutputBuffer[iPxPos] = float4(fColor, 1.0f);
+}
+
+#include "FidelityFX/gpu/lens/ffx_lens.h"
+
+/**
+ * Apply the per-pixel lens effects (vignette and film grain) to a colour value.
+ * @note Chromatic aberration is not applied here as it requires sampling neighbouring pixels.
+ * @param coord Pixel coordinate of the colour value.
+ * @param color Input colour value.
+ * @return The colour with lens effects applied.
+ */
+float3 LensApply(uint2 coord, float3 color)
+{
+    FfxUInt32x2 center = g_BufferDimensions / 2;
+#ifdef ENABLE_VIGNETTE
+    FfxLensApplyVignette(coord, center, color, g_Vignette);
+#endif
+#ifdef ENABLE_FILMGRAIN
+    FfxLensApplyFilmGrain(coord, color, g_GrainScale, g_GrainAmount, g_GrainSeed);
+#endif
+    return color;
+}
+
+#endif // LENS_HLSL
@@ -52,6 +52,11 @@ DebugViewList RenderTechnique::getDebugViews() const noexcept
     return {};
 }
 
+StatisticList RenderTechnique::getStatistics() const noexcept
+{
+    return {};
+}
+
 void RenderTechnique::renderGUI(CapsaicinInternal &capsaicin) const noexcept
 {
     (void)&capsaicin;
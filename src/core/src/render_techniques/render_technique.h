@@ -75,6 +75,13 @@ class RenderTechnique : public Timeable
      */
     [[nodiscard]] virtual DebugViewList getDebugViews() const noexcept;
 
+    /**
+     * Gets a list of any statistics gathered by the current render technique during the last frames.
+     * @note Names must remain valid for the lifetime of the render technique.
+     * @return A list of all available statistics.
+     */
+    [[nodiscard]] virtual StatisticList getStatistics() const noexcept;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
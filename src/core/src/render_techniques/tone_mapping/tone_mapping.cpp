@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include "tone_mapping.h"
 
 #include "../../components/blue_noise_sampler/blue_noise_sampler.h"
+#include "../../components/post_process_chain/post_process_chain.h"
 #include "capsaicin_internal.h"
 
 using namespace std;
@@ -58,6 +59,7 @@ ComponentList ToneMapping::getComponents() const noexcept
 {
     ComponentList components;
     components.emplace_back(COMPONENT_MAKE(BlueNoiseSampler));
+    components.emplace_back(COMPONENT_MAKE(PostProcessChain));
     return components;
 }
 
@@ -88,6 +90,8 @@ DebugViewList ToneMapping::getDebugViews() const noexcept
 
 bool ToneMapping::init(CapsaicinInternal const &capsaicin) noexcept
 {
+    capsaicin.getComponent<PostProcessChain>()->registerStage(PostProcessChain::Slot::ToneMapping);
+
     options = convertOptions(capsaicin.getOptions());
     if (options.tonemap_enable)
     {
@@ -101,7 +105,8 @@ bool ToneMapping::init(CapsaicinInternal const &capsaicin) noexcept
 
 void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
 {
-    auto const newOptions = convertOptions(capsaicin.getOptions());
+    auto const newOptions       = convertOptions(capsaicin.getOptions());
+    auto const postProcessChain = capsaicin.getComponent<PostProcessChain>();
 
     if (!newOptions.tonemap_enable)
     {
@@ -111,6 +116,7 @@ void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
             terminate();
         }
         options = newOptions;
+        postProcessChain->skip(capsaicin, PostProcessChain::Slot::ToneMapping);
         return;
     }
 
@@ -122,6 +128,7 @@ void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
     {
         if (!init(capsaicin))
         {
+            postProcessChain->skip(capsaicin, PostProcessChain::Slot::ToneMapping);
             return;
         }
     }
@@ -130,6 +137,7 @@ void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
     {
         if (!initToneMapKernel())
         {
+            postProcessChain->skip(capsaicin, PostProcessChain::Slot::ToneMapping);
             return;
         }
     }
@@ -139,10 +147,12 @@ void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
                           && capsaicin.getOption<bool>("taa_enable");
     GfxTexture input =
         !usesScaling ? capsaicin.getSharedTexture("Color") : capsaicin.getSharedTexture("ColorScaled");
-    GfxTexture output = input;
+    GfxTexture output    = input;
+    bool       debugging = false;
 
     if (auto const debugView = capsaicin.getCurrentDebugView(); !debugView.empty() && debugView != "None")
     {
+        debugging = true;
         if (debugView == "ToneMappedOutput")
         {
             // Output tone-mapping to debug view instead of output. This is only possible when the input
@@ -179,24 +189,34 @@ void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
         }
     }
 
-    // Call the tone mapping kernel on each pixel of colour buffer
-    if (usingDither)
-    {
-        auto const blueNoiseSampler = capsaicin.getComponent<BlueNoiseSampler>();
-        blueNoiseSampler->addProgramParameters(capsaicin, toneMappingProgram);
-        gfxProgramSetParameter(gfx_, toneMappingProgram, "g_FrameIndex", capsaicin.getFrameIndex());
-    }
     auto const bufferDimensions =
         !usesScaling ? capsaicin.getRenderDimensions() : capsaicin.getWindowDimensions();
-    gfxProgramSetParameter(gfx_, toneMappingProgram, "g_BufferDimensions", bufferDimensions);
-    gfxProgramSetParameter(gfx_, toneMappingProgram, "g_InputBuffer", input);
-    if (usingHDR)
+    if (!debugging)
+    {
+        // Try and fuse with any following post-processing operators
+        PostProcessChain::Stage stage {.slot = PostProcessChain::Slot::ToneMapping,
+            .buffer                          = !usesScaling ? "Color" : "ColorScaled",
+            .dimensions                      = bufferDimensions,
+            .defines                         = toneMapDefines,
+            .bind = [this](CapsaicinInternal const &context, GfxProgram const &program) {
+                addProgramParameters(context, program);
+            }};
+        if (postProcessChain->fuse(capsaicin, std::move(stage)))
+        {
+            return;
+        }
+    }
+    else
     {
-        gfxProgramSetParameter(gfx_, toneMappingProgram, "g_MaxLuminance", maxLuminance);
-        gfxProgramSetParameter(gfx_, toneMappingProgram, "g_ExposureScale", exposureScale);
+        // Debug views are written to a different buffer so any queued operators must be applied first
+        postProcessChain->flush(capsaicin);
     }
+
+    // Call the tone mapping kernel on each pixel of colour buffer
+    addProgramParameters(capsaicin, toneMappingProgram);
+    gfxProgramSetParameter(gfx_, toneMappingProgram, "g_BufferDimensions", bufferDimensions);
+    gfxProgramSetParameter(gfx_, toneMappingProgram, "g_InputBuffer", input);
     gfxProgramSetParameter(gfx_, toneMappingProgram, "g_OutputBuffer", output);
-    gfxProgramSetParameter(gfx_, toneMappingProgram, "g_Exposure", capsaicin.getSharedBuffer("Exposure"));
     {
         TimedSection const timed_section(*this, "ToneMap");
         uint32_t const    *numThreads = gfxKernelGetNumThreads(gfx_, toneMapKernel);
@@ -205,6 +225,10 @@ void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
         gfxCommandBindKernel(gfx_, toneMapKernel);
         gfxCommandDispatch(gfx_, numGroupsX, numGroupsY, 1);
     }
+    if (debugging)
+    {
+        postProcessChain->skip(capsaicin, PostProcessChain::Slot::ToneMapping);
+    }
 }
 
 void ToneMapping::terminate() noexcept
@@ -216,6 +240,23 @@ void ToneMapping::terminate() noexcept
     toneMappingProgram = {};
 }
 
+void ToneMapping::addProgramParameters(
+    CapsaicinInternal const &capsaicin, GfxProgram const &program) const noexcept
+{
+    if (usingDither)
+    {
+        auto const blueNoiseSampler = capsaicin.getComponent<BlueNoiseSampler>();
+        blueNoiseSampler->addProgramParameters(capsaicin, program);
+        gfxProgramSetParameter(gfx_, program, "g_FrameIndex", capsaicin.getFrameIndex());
+    }
+    if (usingHDR)
+    {
+        gfxProgramSetParameter(gfx_, program, "g_MaxLuminance", maxLuminance);
+        gfxProgramSetParameter(gfx_, program, "g_ExposureScale", exposureScale);
+    }
+    gfxProgramSetParameter(gfx_, program, "g_Exposure", capsaicin.getSharedBuffer("Exposure"));
+}
+
 void ToneMapping::renderGUI(CapsaicinInternal &capsaicin) const noexcept
 {
     bool &enabled = capsaicin.getOption<bool>("tonemap_enable");
@@ -244,7 +285,8 @@ bool ToneMapping::initToneMapKernel() noexcept
     // Get current display color space and depth
     colourSpace = gfxGetBackBufferColorSpace(gfx_);
 
-    vector<char const *> defines;
+    vector<char const *> &defines = toneMapDefines;
+    defines.clear();
     if (colourSpace == DXGI_COLOR_SPACE_RGB_FULL_G10_NONE_P709)
     {
         // scRGB
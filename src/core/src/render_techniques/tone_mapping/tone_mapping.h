@@ -122,6 +122,13 @@ class ToneMapping final : public RenderTechnique
 private:
     [[nodiscard]] bool initToneMapKernel() noexcept;
 
+    /**
+     * Add the tone mapping operator parameters to a program.
+     * @param capsaicin Current framework context.
+     * @param program   The shader program to bind parameters to.
+     */
+    void addProgramParameters(CapsaicinInternal const &capsaicin, GfxProgram const &program) const noexcept;
+
     RenderOptions options;
 
     DXGI_COLOR_SPACE_TYPE colourSpace;         /**< Current working space of the display */
@@ -129,6 +136,7 @@ class ToneMapping final : public RenderTechnique
     bool                  usingHDR    = false; /**< Whether HDR output is being used */
     float                 maxLuminance  = 1.0F; /**< Maximum luminance of the current display */
     float                 exposureScale = 1.0F; /**< Exposure scale for HDR reference white setting */
+    std::vector<char const *> toneMapDefines; /**< Defines of the current tone mapping kernel permutation */
 
     GfxProgram toneMappingProgram;
     GfxKernel  toneMapKernel;
@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "../../ray_tracing/path_tracing_shared.h"
 #include "capsaicin_internal.h"
 #include "components/blue_noise_sampler/blue_noise_sampler.h"
+#include "frustum.h"
 #include "visibility_buffer_shared.h"
 
 namespace Capsaicin
@@ -45,6 +46,8 @@ RenderOptionList VisibilityBuffer::getRenderOptions() noexcept
     newOptions.emplace(RENDER_OPTION_MAKE(visibility_buffer_use_rt, options));
     newOptions.emplace(RENDER_OPTION_MAKE(visibility_buffer_use_rt_dxr10, options));
     newOptions.emplace(RENDER_OPTION_MAKE(visibility_buffer_enable_hzb, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(visibility_buffer_culling_stats, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(visibility_buffer_instance_culling, options));
     return newOptions;
 }
 
@@ -55,6 +58,8 @@ VisibilityBuffer::RenderOptions VisibilityBuffer::convertOptions(RenderOptionLis
     RENDER_OPTION_GET(visibility_buffer_use_rt, newOptions, options)
     RENDER_OPTION_GET(visibility_buffer_use_rt_dxr10, newOptions, options)
     RENDER_OPTION_GET(visibility_buffer_enable_hzb, newOptions, options)
+    RENDER_OPTION_GET(visibility_buffer_culling_stats, newOptions, options)
+    RENDER_OPTION_GET(visibility_buffer_instance_culling, newOptions, options)
     return newOptions;
 }
 
@@ -132,6 +137,33 @@ DebugViewList VisibilityBuffer::getDebugViews() const noexcept
     return views;
 }
 
+StatisticList VisibilityBuffer::getStatistics() const noexcept
+{
+    static constexpr std::string_view kStatisticNames[2][5] = {
+        {"Pass1 Meshlets Tested", "Pass1 Meshlets Frustum Culled", "Pass1 Meshlets Occlusion Culled",
+         "Pass1 Meshlets Cone Culled", "Pass1 Meshlets Drawn"},
+        {"Pass2 Meshlets Tested", "Pass2 Meshlets Frustum Culled", "Pass2 Meshlets Occlusion Culled",
+         "Pass2 Meshlets Cone Culled", "Pass2 Meshlets Drawn"}
+    };
+
+    StatisticList statistics;
+    if (!culling_statistics_buffer)
+    {
+        return statistics;
+    }
+    uint32_t const passCount = options.visibility_buffer_enable_hzb ? 2U : 1U;
+    for (uint32_t pass = 0; pass < passCount; ++pass)
+    {
+        auto const &names = kStatisticNames[pass];
+        statistics.emplace_back(names[0], culling_statistics[pass].tested);
+        statistics.emplace_back(names[1], culling_statistics[pass].frustumCulled);
+        statistics.emplace_back(names[2], culling_statistics[pass].occlusionCulled);
+        statistics.emplace_back(names[3], culling_statistics[pass].coneCulled);
+        statistics.emplace_back(names[4], culling_statistics[pass].drawn);
+    }
+    return statistics;
+}
+
 bool VisibilityBuffer::init(CapsaicinInternal const &capsaicin) noexcept
 {
     if (capsaicin.hasSharedTexture("DisocclusionMask"))
@@ -161,7 +193,11 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
         || options.visibility_buffer_disable_alpha_testing
                != newOptions.visibility_buffer_disable_alpha_testing
         || (!options.visibility_buffer_use_rt
-            && options.visibility_buffer_enable_hzb != newOptions.visibility_buffer_enable_hzb);
+            && options.visibility_buffer_enable_hzb != newOptions.visibility_buffer_enable_hzb)
+        || (!options.visibility_buffer_use_rt
+            && options.visibility_buffer_culling_stats != newOptions.visibility_buffer_culling_stats)
+        || (!options.visibility_buffer_use_rt
+            && options.visibility_buffer_instance_culling != newOptions.visibility_buffer_instance_culling);
 
     options = newOptions;
     if (recompile)
@@ -170,11 +206,23 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
         gfxDestroyKernel(gfx_, visibility_buffer_kernel_);
         gfxDestroySbt(gfx_, visibility_buffer_sbt_);
         visibility_buffer_sbt_ = {};
+        gfxDestroyKernel(gfx_, cull_instances_kernel_);
+        cull_instances_kernel_ = {};
+        gfxDestroyKernel(gfx_, generate_draw_command_kernel_);
+        generate_draw_command_kernel_ = {};
+        gfxDestroyProgram(gfx_, instance_culling_program_);
+        instance_culling_program_ = {};
 
         initKernel(capsaicin);
 
         gfxDestroyBuffer(gfx_, constants_buffer);
         constants_buffer = {};
+
+        // Counters are re-created on demand, stale values must not be reported
+        gfxDestroyBuffer(gfx_, culling_statistics_buffer);
+        culling_statistics_buffer = {};
+        culling_statistics_readback.clear();
+        memset(culling_statistics, 0, sizeof(culling_statistics));
     }
 
     auto        blue_noise_sampler = capsaicin.getComponent<BlueNoiseSampler>(); // Used for stochastic alpha
@@ -183,7 +231,37 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
 
     if (!options.visibility_buffer_use_rt || debugView == "Meshlets" || debugView == "Wireframe")
     {
-        if (!draw_data_buffer || capsaicin.getMeshesUpdated() || capsaicin.getInstancesUpdated())
+        bool const useInstanceCulling =
+            !options.visibility_buffer_use_rt && options.visibility_buffer_instance_culling;
+        bool const needsDrawData =
+            !useInstanceCulling || debugView == "Meshlets" || debugView == "Wireframe";
+        bool const sceneUpdated = capsaicin.getMeshesUpdated() || capsaicin.getInstancesUpdated();
+        if (useInstanceCulling && (!instance_draw_data_buffer || sceneUpdated))
+        {
+            // Only a single entry per instance is needed as the meshlets are expanded on the GPU
+            std::vector<InstanceDrawData> instanceDrawData;
+            drawCount = 0;
+            for (auto const &index : capsaicin.getInstanceIdData())
+            {
+                instanceDrawData.emplace_back(index, drawCount);
+                drawCount += capsaicin.getInstanceData()[index].meshlet_count;
+            }
+            instanceCount = static_cast<uint32_t>(instanceDrawData.size());
+            gfxDestroyBuffer(gfx_, instance_draw_data_buffer);
+            instance_draw_data_buffer =
+                gfxCreateBuffer<InstanceDrawData>(gfx_, instanceCount, instanceDrawData.data());
+            instance_draw_data_buffer.setName("VisibilityBuffer_InstanceDrawDataBuffer");
+
+            // The compacted list must be able to hold every meshlet of the scene
+            gfxDestroyBuffer(gfx_, culled_draw_data_buffer);
+            culled_draw_data_buffer = gfxCreateBuffer<CulledDrawData>(gfx_, glm::max(drawCount, 1U));
+            culled_draw_data_buffer.setName("VisibilityBuffer_CulledDrawDataBuffer");
+
+            // The per meshlet list is now out of date so is only rebuilt when next required
+            gfxDestroyBuffer(gfx_, draw_data_buffer);
+            draw_data_buffer = {};
+        }
+        if (needsDrawData && (!draw_data_buffer || sceneUpdated))
         {
             std::vector<DrawData> drawData;
             for (auto const &index : capsaicin.getInstanceIdData())
@@ -198,23 +276,18 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
             drawCount = static_cast<uint32_t>(drawData.size());
             gfxDestroyBuffer(gfx_, draw_data_buffer);
             draw_data_buffer = gfxCreateBuffer<DrawData>(gfx_, drawCount, drawData.data());
+
+            if (!useInstanceCulling)
+            {
+                // The per instance list is now out of date so is only rebuilt when next required
+                gfxDestroyBuffer(gfx_, instance_draw_data_buffer);
+                instance_draw_data_buffer = {};
+            }
         }
 
         {
             DrawConstants constants;
-            auto const   &vp           = transpose(cameraMatrices.view_projection);
-            constants.cameraFrustum[0] = (vp[3] + vp[0]); // left
-            constants.cameraFrustum[0] /= length(float3(constants.cameraFrustum[0]));
-            constants.cameraFrustum[1] = (vp[3] - vp[0]); // right
-            constants.cameraFrustum[1] /= length(float3(constants.cameraFrustum[1]));
-            constants.cameraFrustum[2] = (vp[3] + vp[1]); // bottom
-            constants.cameraFrustum[2] /= length(float3(constants.cameraFrustum[2]));
-            constants.cameraFrustum[3] = (vp[3] - vp[1]); // top
-            constants.cameraFrustum[3] /= length(float3(constants.cameraFrustum[3]));
-            constants.cameraFrustum[4] = (vp[3] + vp[2]); // near
-            constants.cameraFrustum[4] /= length(float3(constants.cameraFrustum[4]));
-            constants.cameraFrustum[5] = (vp[3] - vp[2]); // far
-            constants.cameraFrustum[5] /= length(float3(constants.cameraFrustum[5]));
+            CalculateFrustumPlanes(cameraMatrices.view_projection, constants.cameraFrustum);
             auto const &camera           = capsaicin.getCamera();
             constants.cameraPosition     = camera.eye;
             constants.drawCount          = drawCount;
@@ -226,7 +299,7 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
                 float2(cameraMatrices.projection[0][0], cameraMatrices.projection[1][1]);
             constants.view = cameraMatrices.view;
             gfxDestroyBuffer(gfx_, constants_buffer);
-            constants_buffer = gfxCreateBuffer<DrawConstants>(gfx_, 1, &constants);
+            constants_buffer = capsaicin.allocateConstantBuffer<DrawConstants>(&constants, 1);
         }
     }
 
@@ -234,7 +307,23 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
     {
         // Render using raster pass
         gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_VBConstants", constants_buffer);
-        gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_DrawDataBuffer", draw_data_buffer);
+        if (options.visibility_buffer_instance_culling)
+        {
+            if (!draw_count_buffer)
+            {
+                draw_count_buffer = gfxCreateBuffer<uint32_t>(gfx_, 1);
+                draw_count_buffer.setName("VisibilityBuffer_DrawCountBuffer");
+                draw_command_buffer = gfxCreateBuffer<DispatchCommand>(gfx_, 1);
+                draw_command_buffer.setName("VisibilityBuffer_DrawCommandBuffer");
+            }
+            gfxProgramSetParameter(
+                gfx_, visibility_buffer_program_, "g_DrawDataBuffer", culled_draw_data_buffer);
+            gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_DrawCountBuffer", draw_count_buffer);
+        }
+        else
+        {
+            gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_DrawDataBuffer", draw_data_buffer);
+        }
         gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_FrameIndex", capsaicin.getFrameIndex());
         gfxProgramSetParameter(
             gfx_, visibility_buffer_program_, "g_RenderScale", capsaicin.getRenderDimensionsScale());
@@ -297,7 +386,7 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
 
         if (options.visibility_buffer_enable_hzb)
         {
-            if (auto packedDrawSize = glm::max(drawCount >> 5, 1U);
+            if (auto packedDrawSize = glm::max((drawCount + 31) >> 5, 1U);
                 !meshlet_visibility_buffer || meshlet_visibility_buffer.getSize() < packedDrawSize)
             {
                 gfxDestroyBuffer(gfx_, meshlet_visibility_buffer);
@@ -333,15 +422,39 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
             gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_FirstPass", true);
         }
 
+        if (options.visibility_buffer_culling_stats)
+        {
+            if (!culling_statistics_buffer)
+            {
+                culling_statistics_buffer = gfxCreateBuffer<CullingStatistics>(
+                    gfx_, static_cast<uint32_t>(std::size(culling_statistics)));
+                culling_statistics_buffer.setName("VisibilityBuffer_CullingStatisticsBuffer");
+            }
+            gfxCommandClearBuffer(gfx_, culling_statistics_buffer);
+            gfxProgramSetParameter(
+                gfx_, visibility_buffer_program_, "g_CullingStatisticsBuffer", culling_statistics_buffer);
+        }
+
+        if (options.visibility_buffer_instance_culling)
+        {
+            cullInstances(capsaicin, true);
+        }
+
         // Run first pass
         {
             TimedSection const timed_section(*this, "VisibilityBufferPass1");
 
-            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, visibility_buffer_kernel_);
-            uint32_t const  num_groups_x = (drawCount + num_threads[0] - 1) / num_threads[0];
-
             gfxCommandBindKernel(gfx_, visibility_buffer_kernel_);
-            gfxCommandDrawMesh(gfx_, num_groups_x, 1, 1);
+            if (options.visibility_buffer_instance_culling)
+            {
+                gfxCommandDrawMeshIndirect(gfx_, draw_command_buffer);
+            }
+            else
+            {
+                uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, visibility_buffer_kernel_);
+                uint32_t const  num_groups_x = (drawCount + num_threads[0] - 1) / num_threads[0];
+                gfxCommandDrawMesh(gfx_, num_groups_x, 1, 1);
+            }
         }
 
         if (options.visibility_buffer_enable_hzb)
@@ -353,17 +466,42 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
                 depth_pyramid_mip.mip(depth_pyramid);
             }
 
+            if (options.visibility_buffer_instance_culling)
+            {
+                cullInstances(capsaicin, false);
+
+                // Only the meshlets of visible instances are tested, so the history of all others must be
+                // reset here
+                gfxCommandClearBuffer(gfx_, meshlet_visibility_buffer, 0);
+            }
+
             // Run HzB second pass
             {
                 gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_FirstPass", false);
 
                 TimedSection const timed_section(*this, "VisibilityBufferPass2");
 
-                uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, visibility_buffer_kernel_);
-                uint32_t const  num_groups_x = (drawCount + num_threads[0] - 1) / num_threads[0];
-
                 gfxCommandBindKernel(gfx_, visibility_buffer_kernel_);
-                gfxCommandDrawMesh(gfx_, num_groups_x, 1, 1);
+                if (options.visibility_buffer_instance_culling)
+                {
+                    gfxCommandDrawMeshIndirect(gfx_, draw_command_buffer);
+                }
+                else
+                {
+                    uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, visibility_buffer_kernel_);
+                    uint32_t const  num_groups_x = (drawCount + num_threads[0] - 1) / num_threads[0];
+                    gfxCommandDrawMesh(gfx_, num_groups_x, 1, 1);
+                }
+            }
+        }
+
+        if (options.visibility_buffer_culling_stats)
+        {
+            // The counters are only available a few frames later so as not to stall the GPU
+            if (auto const *data = culling_statistics_readback.readback(capsaicin, culling_statistics_buffer);
+                data != nullptr)
+            {
+                memcpy(culling_statistics, data, sizeof(culling_statistics));
             }
         }
 
@@ -382,7 +520,7 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
                               cameraMatrices.projection[2][1] * static_cast<float>(bufferDimensions.y))
                         * 0.5F};
             gfxDestroyBuffer(gfx_, constants_buffer);
-            constants_buffer = gfxCreateBuffer<DrawConstantsRT>(gfx_, 1, &constants);
+            constants_buffer = capsaicin.allocateConstantBuffer<DrawConstantsRT>(&constants, 1);
         }
 
         // Render using ray tracing pass
@@ -814,12 +952,50 @@ void VisibilityBuffer::terminate() noexcept
     depth_pyramid = {};
     gfxDestroySamplerState(gfx_, depth_pyramid_sampler);
     depth_pyramid_sampler = {};
+    gfxDestroyBuffer(gfx_, culling_statistics_buffer);
+    culling_statistics_buffer = {};
+    culling_statistics_readback.clear();
+
+    gfxDestroyKernel(gfx_, cull_instances_kernel_);
+    cull_instances_kernel_ = {};
+    gfxDestroyKernel(gfx_, generate_draw_command_kernel_);
+    generate_draw_command_kernel_ = {};
+    gfxDestroyProgram(gfx_, instance_culling_program_);
+    instance_culling_program_ = {};
+    gfxDestroyBuffer(gfx_, instance_draw_data_buffer);
+    instance_draw_data_buffer = {};
+    gfxDestroyBuffer(gfx_, culled_draw_data_buffer);
+    culled_draw_data_buffer = {};
+    gfxDestroyBuffer(gfx_, draw_count_buffer);
+    draw_count_buffer = {};
+    gfxDestroyBuffer(gfx_, draw_command_buffer);
+    draw_command_buffer = {};
 }
 
 void VisibilityBuffer::renderGUI(CapsaicinInternal &capsaicin) const noexcept
 {
     ImGui::Checkbox(
         "Disable Alpha Testing", &capsaicin.getOption<bool>("visibility_buffer_disable_alpha_testing"));
+    if (options.visibility_buffer_use_rt)
+    {
+        return;
+    }
+    ImGui::Checkbox("Instance Culling", &capsaicin.getOption<bool>("visibility_buffer_instance_culling"));
+    ImGui::Checkbox("Culling Statistics", &capsaicin.getOption<bool>("visibility_buffer_culling_stats"));
+    if (culling_statistics_buffer)
+    {
+        uint32_t const passCount = options.visibility_buffer_enable_hzb ? 2U : 1U;
+        for (uint32_t pass = 0; pass < passCount; ++pass)
+        {
+            CullingStatistics const &passStatistics = culling_statistics[pass];
+            ImGui::Text("Pass %u", pass + 1);
+            ImGui::Text("  Meshlets Tested   : %u", passStatistics.tested);
+            ImGui::Text("  Frustum Culled    : %u", passStatistics.frustumCulled);
+            ImGui::Text("  Occlusion Culled  : %u", passStatistics.occlusionCulled);
+            ImGui::Text("  Cone Culled       : %u", passStatistics.coneCulled);
+            ImGui::Text("  Meshlets Drawn    : %u", passStatistics.drawn);
+        }
+    }
 }
 
 bool VisibilityBuffer::initKernel(CapsaicinInternal const &capsaicin) noexcept
@@ -870,6 +1046,14 @@ bool VisibilityBuffer::initKernel(CapsaicinInternal const &capsaicin) noexcept
         {
             defines.push_back("VISIBILITY_ENABLE_HZB");
         }
+        if (options.visibility_buffer_culling_stats)
+        {
+            defines.push_back("VISIBILITY_ENABLE_CULLING_STATS");
+        }
+        if (options.visibility_buffer_instance_culling)
+        {
+            defines.push_back("VISIBILITY_ENABLE_INSTANCE_CULLING");
+        }
         gfxDrawStateSetDepthStencilTarget(
             visibility_buffer_draw_state, capsaicin.getSharedTexture("Depth").getFormat());
 
@@ -877,6 +1061,22 @@ bool VisibilityBuffer::initKernel(CapsaicinInternal const &capsaicin) noexcept
             capsaicin.createProgram("render_techniques/visibility_buffer/visibility_buffer");
         visibility_buffer_kernel_ = gfxCreateMeshKernel(gfx_, visibility_buffer_program_,
             visibility_buffer_draw_state, nullptr, defines.data(), static_cast<uint32_t>(defines.size()));
+
+        if (options.visibility_buffer_instance_culling)
+        {
+            // Initialise the instance culling kernels
+            std::vector<char const *> culling_defines;
+            if (options.visibility_buffer_enable_hzb)
+            {
+                culling_defines.push_back("VISIBILITY_ENABLE_HZB");
+            }
+            instance_culling_program_ =
+                capsaicin.createProgram("render_techniques/visibility_buffer/instance_culling");
+            cull_instances_kernel_ = gfxCreateComputeKernel(gfx_, instance_culling_program_,
+                "CullInstances", culling_defines.data(), static_cast<uint32_t>(culling_defines.size()));
+            generate_draw_command_kernel_ = gfxCreateComputeKernel(gfx_, instance_culling_program_,
+                "GenerateDrawCommand", culling_defines.data(), static_cast<uint32_t>(culling_defines.size()));
+        }
     }
     else
     {
@@ -931,4 +1131,39 @@ bool VisibilityBuffer::initKernel(CapsaicinInternal const &capsaicin) noexcept
 
     return !!visibility_buffer_program_;
 }
+
+void VisibilityBuffer::cullInstances(CapsaicinInternal const &capsaicin, bool const firstPass) noexcept
+{
+    TimedSection const timed_section(*this, firstPass ? "CullInstancesPass1" : "CullInstancesPass2");
+
+    gfxProgramSetParameter(gfx_, instance_culling_program_, "g_VBConstants", constants_buffer);
+    gfxProgramSetParameter(
+        gfx_, instance_culling_program_, "g_InstanceDrawDataBuffer", instance_draw_data_buffer);
+    gfxProgramSetParameter(
+        gfx_, instance_culling_program_, "g_InstanceBuffer", capsaicin.getInstanceBuffer());
+    gfxProgramSetParameter(
+        gfx_, instance_culling_program_, "g_InstanceBoundsBuffer", capsaicin.getInstanceBoundsBuffer());
+    gfxProgramSetParameter(gfx_, instance_culling_program_, "g_InstanceCount", instanceCount);
+    gfxProgramSetParameter(
+        gfx_, instance_culling_program_, "g_CulledDrawDataBuffer", culled_draw_data_buffer);
+    gfxProgramSetParameter(gfx_, instance_culling_program_, "g_DrawCountBuffer", draw_count_buffer);
+    gfxProgramSetParameter(gfx_, instance_culling_program_, "g_DrawCommandBuffer", draw_command_buffer);
+    if (options.visibility_buffer_enable_hzb)
+    {
+        gfxProgramSetParameter(gfx_, instance_culling_program_, "g_FirstPass", firstPass);
+        gfxProgramSetParameter(gfx_, instance_culling_program_, "g_DepthPyramid", depth_pyramid);
+        gfxProgramSetParameter(gfx_, instance_culling_program_, "g_DepthSampler", depth_pyramid_sampler);
+    }
+
+    gfxCommandClearBuffer(gfx_, draw_count_buffer, 0);
+
+    // Each group loops over the instances so the dispatch size is kept within API limits
+    uint32_t const num_groups_x = glm::clamp(instanceCount, 1U, 65535U);
+    gfxProgramSetParameter(gfx_, instance_culling_program_, "g_GroupCount", num_groups_x);
+    gfxCommandBindKernel(gfx_, cull_instances_kernel_);
+    gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
+
+    gfxCommandBindKernel(gfx_, generate_draw_command_kernel_);
+    gfxCommandDispatch(gfx_, 1, 1, 1);
+}
 } // namespace Capsaicin
@@ -23,6 +23,8 @@ THE SOFTWARE.
 
 #include "render_technique.h"
 #include "utilities/gpu_mip.h"
+#include "utilities/gpu_readback.h"
+#include "visibility_buffer_shared.h"
 
 namespace Capsaicin
 {
@@ -52,6 +54,10 @@ class VisibilityBuffer final : public RenderTechnique
                    (only effects if visibility_buffer_use_rt is enabled) */
         bool visibility_buffer_enable_hzb =
             false; /**< Use HzB based occlusion culling (does not affect RT mode) */
+        bool visibility_buffer_culling_stats =
+            false; /**< Count the meshlets culled by each test (does not affect RT mode) */
+        bool visibility_buffer_instance_culling =
+            false; /**< Cull whole instances on the GPU before meshlet culling (does not affect RT mode) */
     };
 
     /**
@@ -85,6 +91,12 @@ class VisibilityBuffer final : public RenderTechnique
      */
     [[nodiscard]] DebugViewList getDebugViews() const noexcept override;
 
+    /**
+     * Gets a list of any statistics gathered by the current render technique during the last frames.
+     * @return A list of all available statistics.
+     */
+    [[nodiscard]] StatisticList getStatistics() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -119,6 +131,13 @@ class VisibilityBuffer final : public RenderTechnique
      */
     bool initKernel(CapsaicinInternal const &capsaicin) noexcept;
 
+    /**
+     * Cull instances and build the compacted meshlet draw list used by the next raster pass.
+     * @param capsaicin The current capsaicin context.
+     * @param firstPass True if culling for the first pass of 2-pass HzB (or when HzB is disabled).
+     */
+    void cullInstances(CapsaicinInternal const &capsaicin, bool firstPass) noexcept;
+
     RenderOptions    options;
     GfxKernel        disocclusion_mask_kernel_;
     GfxProgram       disocclusion_mask_program_;
@@ -133,8 +152,20 @@ class VisibilityBuffer final : public RenderTechnique
     GfxBuffer        draw_data_buffer;
     GfxBuffer        constants_buffer;
     GfxBuffer        meshlet_visibility_buffer;
+    GfxProgram       instance_culling_program_;
+    GfxKernel        cull_instances_kernel_;
+    GfxKernel        generate_draw_command_kernel_;
+    uint32_t         instanceCount = 0;
+    GfxBuffer        instance_draw_data_buffer; /**< Instances along with the draw index of their meshlets */
+    GfxBuffer        culled_draw_data_buffer;   /**< Compacted meshlets of the visible instances */
+    GfxBuffer        draw_count_buffer;
+    GfxBuffer        draw_command_buffer;
     GfxTexture       depth_pyramid;
     GfxSamplerState  depth_pyramid_sampler;
     GPUMip           depth_pyramid_mip;
+
+    GfxBuffer         culling_statistics_buffer;   /**< Per pass meshlet culling counters */
+    GPUReadback       culling_statistics_readback; /**< Asynchronous readback of the culling counters */
+    CullingStatistics culling_statistics[2] = {};  /**< Last read back counters for each pass */
 };
 } // namespace Capsaicin
@@ -0,0 +1,124 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+
+#ifndef VISIBILITY_BUFFER_CULLING_HLSL
+#define VISIBILITY_BUFFER_CULLING_HLSL
+
+#include "visibility_buffer_shared.h"
+
+#include "math/transform.hlsl"
+
+/**
+ * Projects a view space sphere to screen AABB.
+ * @param centerVS       The view space position of the sphere center.
+ * @param radius         The radius of the sphere.
+ * @param zNear          The near clipping plane.
+ * @param projection0011 The [0][0] and [1][1] values of the projection matrix
+ * @return True if possible to project sphere.
+ */
+bool sphereProjection(float3 centerVS, float radius, float zNear, float2 projection0011, out float4 aabb)
+{
+    if (centerVS.z < (radius + zNear))
+    {
+        // Sphere intersects near plane
+        return false;
+    }
+
+    // 2D Polyhedral Bounds of a Clipped, Perspective-Projected 3D Sphere. Michael Mara, Morgan McGuire. 2013
+    float3 cr = centerVS * radius;
+    float czr2 = centerVS.z * centerVS.z - radius * radius;
+
+    float2 vxy = sqrt(squared(centerVS.xy) + czr2.xx);
+    float4 vxx = centerVS.xyzz * vxy.xyxy;
+    float minx = (vxx.x - cr.z) / (vxx.z + cr.x);
+    float maxx = (vxx.x + cr.z) / (vxx.z - cr.x);
+
+    float miny = (vxx.y + cr.z) / (vxx.w - cr.y);
+    float maxy = (vxx.y - cr.z) / (vxx.w + cr.y);
+
+    // Convert to UV space by first converting to clip space then scaling/offsetting
+    // Note: This assumes symmetric projection matrix (i.e. wont work with VR)
+    float2 scaler = projection0011 * float2(0.5f, -0.5f);
+    aabb = float4(minx, miny, maxx, maxy) * scaler.xyxy;
+    aabb += 0.5f.xxxx;
+
+    return true;
+}
+
+/**
+ * Checks if a world space sphere is entirely behind the geometry stored in a HzB.
+ * @param sphereCenter The world space position of the sphere center.
+ * @param radius       The radius of the sphere.
+ * @param constants    The current view data.
+ * @param depthPyramid The depth pyramid (HzB) of the current view.
+ * @param depthSampler Sampler used to perform a min reduction of the depth pyramid.
+ * @return True if occluded.
+ */
+bool isSphereOccluded(float3 sphereCenter, float radius, DrawConstants constants, Texture2D<float> depthPyramid,
+    SamplerState depthSampler)
+{
+    float3 centerVS = transformPoint(sphereCenter, constants.view);
+    // Must convert from RH to LH (i.e. view has negative depth)
+    centerVS.z = -centerVS.z;
+    // Get the axis aligned bounding box for the bounding sphere over the current depth buffer
+    float4 aabb;
+    if (sphereProjection(centerVS, radius, constants.nearZ, constants.projection0011, aabb))
+    {
+        float2 dimensions = (aabb.zw - aabb.xy) * constants.dimensions;
+        float mipLevel = floor(log2(hmax(dimensions)));
+
+        // Sampler is set to use min reduction of 2x2 neighbourhood
+        float depth = depthPyramid.SampleLevel(depthSampler, (aabb.xy + aabb.zw) * 0.5, mipLevel).x;
+        float depthSphere = constants.nearZ / (centerVS.z - radius);
+
+        // Reject if entirely behind existing occluding geometry in the HzB
+        return depthSphere <= depth;
+    }
+    return false;
+}
+
+/**
+ * Checks if an axis aligned bounding box is at least partially inside a view frustum.
+ * @note The CPU equivalent is 'IsBoundsInFrustum' in 'capsaicin/frustum.h'.
+ * @param boundsMin The minimum corner of the box.
+ * @param boundsMax The maximum corner of the box.
+ * @param frustum   The normalised frustum planes (with normals pointing inside the frustum).
+ * @return True if visible.
+ */
+bool isBoundsInFrustum(float3 boundsMin, float3 boundsMax, float4 frustum[6])
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        // Only the corner furthest along the plane normal needs to be tested
+        float3 corner = float3(frustum[i].x >= 0.0f ? boundsMax.x : boundsMin.x,
+            frustum[i].y >= 0.0f ? boundsMax.y : boundsMin.y,
+            frustum[i].z >= 0.0f ? boundsMax.z : boundsMin.z);
+        if ((dot(corner, frustum[i].xyz) + frustum[i].w) < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // VISIBILITY_BUFFER_CULLING_HLSL
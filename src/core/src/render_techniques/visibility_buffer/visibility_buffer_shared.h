@@ -61,6 +61,28 @@ struct DrawData
     uint instanceIndex;
 };
 
+struct InstanceDrawData
+{
+    uint instanceIndex;
+    uint drawOffset; /**< Draw index of the first meshlet of the instance */
+};
+
+struct CulledDrawData
+{
+    uint meshletIndex;
+    uint instanceIndex;
+    uint drawIndex; /**< Index of the meshlet in the uncompacted draw list */
+};
+
+struct CullingStatistics
+{
+    uint tested;          /**< Number of meshlets tested */
+    uint frustumCulled;   /**< Number of meshlets outside the view frustum */
+    uint occlusionCulled; /**< Number of meshlets behind the HzB */
+    uint coneCulled;      /**< Number of back facing meshlets */
+    uint drawn;           /**< Number of meshlets sent to the mesh shader */
+};
+
 struct DrawConstants
 {
     float3   cameraPosition;
@@ -23,9 +23,11 @@ THE SOFTWARE.
 #include "atmosphere/atmosphere.h"
 #include "auto_exposure/auto_exposure.h"
 #include "bloom/bloom.h"
+#include "color_pyramid/color_pyramid.h"
 #include "combine/combine.h"
 #include "fsr/fsr.h"
 #include "gi1/gi1.h"
+#include "image_metrics/image_metrics.h"
 #include "lens/lens.h"
 #include "renderer.h"
 #include "skybox/skybox.h"
@@ -64,6 +66,8 @@ class GI1Renderer final
         render_techniques.emplace_back(std::make_unique<Skybox>());
         render_techniques.emplace_back(std::make_unique<Combine>());
         render_techniques.emplace_back(std::make_unique<FSR>());
+        render_techniques.emplace_back(std::make_unique<ImageMetrics>());
+        render_techniques.emplace_back(std::make_unique<ColorPyramid>());
         render_techniques.emplace_back(std::make_unique<AutoExposure>());
         render_techniques.emplace_back(std::make_unique<Bloom>());
         render_techniques.emplace_back(std::make_unique<ToneMapping>());
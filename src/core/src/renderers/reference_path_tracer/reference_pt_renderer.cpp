@@ -21,6 +21,7 @@ THE SOFTWARE.
 ********************************************************************/
 
 #include "auto_exposure/auto_exposure.h"
+#include "color_pyramid/color_pyramid.h"
 #include "image_metrics/image_metrics.h"
 #include "reference_path_tracer/reference_path_tracer.h"
 #include "renderer.h"
@@ -53,6 +54,7 @@ class ReferencePathTracer final
         std::vector<std::unique_ptr<RenderTechnique>> render_techniques;
         render_techniques.emplace_back(std::make_unique<ReferencePT>());
         render_techniques.emplace_back(std::make_unique<ImageMetrics>());
+        render_techniques.emplace_back(std::make_unique<ColorPyramid>());
         render_techniques.emplace_back(std::make_unique<AutoExposure>());
         render_techniques.emplace_back(std::make_unique<ToneMapping>());
         render_techniques.emplace_back(std::make_unique<VarianceEstimate>());
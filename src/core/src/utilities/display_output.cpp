@@ -0,0 +1,78 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "display_output.h"
+
+namespace Capsaicin
+{
+DisplayOutput::~DisplayOutput() noexcept
+{
+    release();
+}
+
+void DisplayOutput::initialise(GfxContext const &gfx, GfxProgram const &blit_program) noexcept
+{
+    gfx_          = gfx;
+    blit_program_ = blit_program;
+}
+
+void DisplayOutput::setOffscreenDimensions(uint2 const &dimensions) noexcept
+{
+    // Both dimensions must be valid, anything else reverts to using the back buffer
+    offscreen_dimensions_ = (dimensions.x > 0 && dimensions.y > 0) ? dimensions : uint2(0);
+}
+
+bool DisplayOutput::getOffscreen() const noexcept
+{
+    return offscreen_dimensions_.x > 0;
+}
+
+uint2 DisplayOutput::getDimensions() const noexcept
+{
+    return getOffscreen() ? offscreen_dimensions_
+                          : uint2(gfxGetBackBufferWidth(gfx_), gfxGetBackBufferHeight(gfx_));
+}
+
+void DisplayOutput::present(GfxTexture const &view) noexcept
+{
+    if (getOffscreen())
+    {
+        return;
+    }
+    if (!blit_kernel_)
+    {
+        blit_kernel_ = gfxCreateGraphicsKernel(gfx_, blit_program_);
+    }
+    gfxProgramSetTexture(gfx_, blit_program_, "g_InputBuffer", view);
+    uint2 const inputResolution = uint2(view.getWidth(), view.getHeight());
+    gfxProgramSetParameter(gfx_, blit_program_, "g_InputResolution", inputResolution);
+    gfxProgramSetParameter(gfx_, blit_program_, "g_Scale",
+        static_cast<float2>(inputResolution) / static_cast<float2>(getDimensions()));
+    gfxCommandBindKernel(gfx_, blit_kernel_);
+    gfxCommandDraw(gfx_, 3);
+}
+
+void DisplayOutput::release() noexcept
+{
+    gfxDestroyKernel(gfx_, blit_kernel_);
+    blit_kernel_ = {};
+}
+} // namespace Capsaicin
@@ -0,0 +1,88 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <gfx.h>
+
+namespace Capsaicin
+{
+/**
+ * The final output of each frame. This is either the back buffer of the swap chain or, when rendering
+ * headless, a fixed resolution with no window. When headless the back buffer is never queried or drawn to.
+ */
+class DisplayOutput
+{
+public:
+    /** Default constructor. */
+    DisplayOutput() noexcept = default;
+
+    /** Destructor. */
+    ~DisplayOutput() noexcept;
+
+    DisplayOutput(DisplayOutput const &other)                = delete;
+    DisplayOutput(DisplayOutput &&other) noexcept            = delete;
+    DisplayOutput &operator=(DisplayOutput const &other)     = delete;
+    DisplayOutput &operator=(DisplayOutput &&other) noexcept = delete;
+
+    /**
+     * Initialise the output.
+     * @param gfx          Current gfx context.
+     * @param blit_program The program used to blit to the back buffer (owned by the caller).
+     */
+    void initialise(GfxContext const &gfx, GfxProgram const &blit_program) noexcept;
+
+    /**
+     * Set a fixed output resolution to render headless without a back buffer.
+     * @param dimensions The output width and height, a zero dimension reverts to using the back buffer.
+     */
+    void setOffscreenDimensions(uint2 const &dimensions) noexcept;
+
+    /**
+     * Check if rendering headless to offscreen targets.
+     * @return True if offscreen dimensions have been set.
+     */
+    [[nodiscard]] bool getOffscreen() const noexcept;
+
+    /**
+     * Gets the resolution of the output, either the back buffer or the offscreen dimensions if set.
+     * @return The output width and height.
+     */
+    [[nodiscard]] uint2 getDimensions() const noexcept;
+
+    /**
+     * Blit a texture to the back buffer scaled to fill it, does nothing when rendering headless.
+     * @param view The texture to display.
+     */
+    void present(GfxTexture const &view) noexcept;
+
+    /** Release the blit kernel. */
+    void release() noexcept;
+
+private:
+    GfxContext gfx_;
+    GfxProgram blit_program_;
+    GfxKernel  blit_kernel_;                    /**< Created on first use so headless never creates it */
+    uint2      offscreen_dimensions_ = uint2(0); /**< Headless resolution (0 if using the back buffer) */
+};
+} // namespace Capsaicin
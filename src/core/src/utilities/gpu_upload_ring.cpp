@@ -0,0 +1,121 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "gpu_upload_ring.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Capsaicin
+{
+namespace
+{
+/** Minimum alignment of constant buffer views. */
+constexpr uint64_t kConstantBufferAlignment = 256;
+
+/** Granularity of the pool sizes. */
+constexpr uint64_t kPoolAlignment = 65536;
+} // namespace
+
+GPUUploadRing::~GPUUploadRing() noexcept
+{
+    clear();
+}
+
+void GPUUploadRing::initialise(GfxContext const &gfx) noexcept
+{
+    gfx_ = gfx;
+}
+
+void GPUUploadRing::beginFrame() noexcept
+{
+    peak_bytes_used_ = std::max(peak_bytes_used_, statistics_.bytes_used);
+    pool_index_      = gfxGetBackBufferIndex(gfx_);
+    cursor_          = 0;
+    statistics_      = {};
+
+    // Grow the pool ahead of time if any previous frame needed more memory than it holds
+    if (pools_[pool_index_].getSize() < peak_bytes_used_)
+    {
+        createPool(peak_bytes_used_);
+    }
+    statistics_.capacity = pools_[pool_index_].getSize();
+}
+
+GfxBuffer GPUUploadRing::allocate(uint64_t const size, uint32_t const stride) noexcept
+{
+    // The offset must be a multiple of the element size so that it maps to a structured buffer element
+    uint64_t const alignment =
+        std::lcm(kConstantBufferAlignment, static_cast<uint64_t>(std::max(stride, 1U)));
+    uint64_t offset = (cursor_ + alignment - 1) / alignment * alignment;
+
+    if (offset + size > pools_[pool_index_].getSize())
+    {
+        // Previous allocations keep the replaced pool alive until they are destroyed
+        createPool(std::max(statistics_.bytes_used + size, 2 * pools_[pool_index_].getSize()));
+        cursor_ = 0;
+        offset  = 0;
+    }
+
+    GfxBuffer const buffer = gfxCreateBufferRange(gfx_, pools_[pool_index_], offset, size);
+
+    statistics_.bytes_used += offset + size - cursor_;
+    ++statistics_.allocations;
+    cursor_ = offset + size;
+
+    return buffer;
+}
+
+GPUUploadRing::Statistics const &GPUUploadRing::getStatistics() const noexcept
+{
+    return statistics_;
+}
+
+void GPUUploadRing::clear() noexcept
+{
+    for (GfxBuffer &pool : pools_)
+    {
+        gfxDestroyBuffer(gfx_, pool);
+        pool = {};
+    }
+    cursor_          = 0;
+    peak_bytes_used_ = 0;
+    statistics_      = {};
+}
+
+void GPUUploadRing::createPool(uint64_t const size) noexcept
+{
+    // Leave some headroom so that small variations between frames do not trigger a new pool
+    uint64_t pool_size = size + ((size + 2) >> 1);
+    pool_size          = (pool_size + kPoolAlignment - 1) / kPoolAlignment * kPoolAlignment;
+
+    GfxBuffer &pool = pools_[pool_index_];
+    gfxDestroyBuffer(gfx_, pool);
+    pool = gfxCreateBuffer(gfx_, pool_size, nullptr, kGfxCpuAccess_Write);
+
+    char buffer[256];
+    GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_UploadRing%u", pool_index_);
+    pool.setName(buffer);
+
+    statistics_.capacity = pool_size;
+    ++statistics_.buffers_created;
+}
+} // namespace Capsaicin
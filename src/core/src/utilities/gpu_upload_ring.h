@@ -0,0 +1,131 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <gfx.h>
+
+namespace Capsaicin
+{
+/**
+ * A ring of CPU writable memory used to sub-allocate constant buffers and small upload buffers each frame.
+ * Each back buffer owns a separate pool so that data is never overwritten while the GPU may still be reading
+ * it. Pools grow automatically to the peak per-frame usage so that steady state frames create no buffers.
+ */
+class GPUUploadRing
+{
+public:
+    /** Usage of the ring during a single frame. */
+    struct Statistics
+    {
+        uint64_t bytes_used      = 0; /**< Number of bytes sub-allocated (including alignment padding) */
+        uint64_t capacity        = 0; /**< Size of the pool used by the frame (in bytes) */
+        uint32_t allocations     = 0; /**< Number of sub-allocations */
+        uint32_t buffers_created = 0; /**< Number of pools (re)created, should be 0 in steady state */
+    };
+
+    /** Default constructor. */
+    GPUUploadRing() noexcept = default;
+
+    /** Destructor. */
+    ~GPUUploadRing() noexcept;
+
+    GPUUploadRing(GPUUploadRing const &other)                = delete;
+    GPUUploadRing(GPUUploadRing &&other) noexcept            = delete;
+    GPUUploadRing &operator=(GPUUploadRing const &other)     = delete;
+    GPUUploadRing &operator=(GPUUploadRing &&other) noexcept = delete;
+
+    /**
+     * Initialise the ring.
+     * @param gfx Current gfx context.
+     */
+    void initialise(GfxContext const &gfx) noexcept;
+
+    /**
+     * Start a new frame.
+     * @note Any buffer allocated the last time the current back buffer was used must no longer be in use.
+     */
+    void beginFrame() noexcept;
+
+    /**
+     * Sub-allocate a buffer from the ring.
+     * @param size   The size of the buffer (in bytes).
+     * @param stride The size of each element, the buffer offset is aligned so that it can be bound as a
+     *               structured buffer.
+     * @return The new buffer, must be destroyed by the caller once the commands using it have been recorded.
+     */
+    [[nodiscard]] GfxBuffer allocate(uint64_t size, uint32_t stride = 1) noexcept;
+
+    /**
+     * Sub-allocate a typed buffer from the ring.
+     * @tparam TYPE Type of each element.
+     * @param element_count The number of elements.
+     * @return The new buffer, must be destroyed by the caller once the commands using it have been recorded.
+     */
+    template<typename TYPE>
+    [[nodiscard]] GfxBuffer allocate(uint32_t const element_count) noexcept
+    {
+        GfxBuffer buffer = allocate(element_count * sizeof(TYPE), static_cast<uint32_t>(sizeof(TYPE)));
+        buffer.setStride(static_cast<uint32_t>(sizeof(TYPE)));
+        return buffer;
+    }
+
+    /**
+     * Sub-allocate a typed buffer from the ring and fill it with data.
+     * @tparam TYPE Type of each element.
+     * @param data          The data to copy into the buffer.
+     * @param element_count The number of elements.
+     * @return The new buffer, must be destroyed by the caller once the commands using it have been recorded.
+     */
+    template<typename TYPE>
+    [[nodiscard]] GfxBuffer allocate(TYPE const *data, uint32_t const element_count) noexcept
+    {
+        GfxBuffer const buffer = allocate<TYPE>(element_count);
+        memcpy(gfxBufferGetData(gfx_, buffer), data, element_count * sizeof(TYPE));
+        return buffer;
+    }
+
+    /**
+     * Gets the usage of the ring since the start of the current frame.
+     * @return The frame statistics.
+     */
+    [[nodiscard]] Statistics const &getStatistics() const noexcept;
+
+    /** Release all pools. */
+    void clear() noexcept;
+
+private:
+    /**
+     * Create a new pool for the current back buffer, replacing any existing one.
+     * @param size The minimum size of the new pool (in bytes).
+     */
+    void createPool(uint64_t size) noexcept;
+
+    GfxContext gfx_;
+    GfxBuffer  pools_[kGfxConstant_BackBufferCount]; /**< One pool per back buffer */
+    uint32_t   pool_index_      = 0; /**< Index of the pool used by the current frame */
+    uint64_t   cursor_          = 0; /**< Offset of the next allocation in the current pool */
+    uint64_t   peak_bytes_used_ = 0; /**< Largest amount of memory used by any previous frame */
+    Statistics statistics_;          /**< Usage during the current frame */
+};
+} // namespace Capsaicin
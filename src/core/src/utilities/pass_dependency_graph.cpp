@@ -0,0 +1,189 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "pass_dependency_graph.h"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+namespace Capsaicin
+{
+void PassDependencyGraph::clear() noexcept
+{
+    passes_.clear();
+}
+
+uint32_t PassDependencyGraph::addPass(std::string_view const &name,
+    std::vector<std::string_view> const &reads, std::vector<std::string_view> const &writes,
+    bool const async_compute) noexcept
+{
+    Pass &pass = passes_.emplace_back();
+    pass.name  = name;
+    pass.reads.assign(reads.begin(), reads.end());
+    pass.writes.assign(writes.begin(), writes.end());
+    pass.async_compute = async_compute;
+    return static_cast<uint32_t>(passes_.size() - 1);
+}
+
+std::vector<std::vector<uint32_t>> PassDependencyGraph::getDependencies() const noexcept
+{
+    struct ResourceState
+    {
+        uint32_t              last_writer = UINT32_MAX;
+        std::vector<uint32_t> readers; // readers since the last write
+    };
+    std::unordered_map<std::string, ResourceState> resources;
+    std::vector<std::vector<uint32_t>>             dependencies(passes_.size());
+    for (uint32_t pass_index = 0; pass_index < static_cast<uint32_t>(passes_.size()); ++pass_index)
+    {
+        Pass const &pass      = passes_[pass_index];
+        auto       &pass_deps = dependencies[pass_index];
+        for (auto const &read : pass.reads)
+        {
+            if (auto const &state = resources[read]; state.last_writer != UINT32_MAX)
+            {
+                pass_deps.push_back(state.last_writer); // read-after-write
+            }
+        }
+        for (auto const &write : pass.writes)
+        {
+            auto const &state = resources[write];
+            if (state.last_writer != UINT32_MAX)
+            {
+                pass_deps.push_back(state.last_writer); // write-after-write
+            }
+            pass_deps.insert(pass_deps.end(), state.readers.begin(), state.readers.end()); // write-after-read
+        }
+        std::sort(pass_deps.begin(), pass_deps.end());
+        pass_deps.erase(std::unique(pass_deps.begin(), pass_deps.end()), pass_deps.end());
+        pass_deps.erase(std::remove(pass_deps.begin(), pass_deps.end(), pass_index), pass_deps.end());
+
+        // Update the resource states once all hazards of the pass have been collected
+        for (auto const &read : pass.reads)
+        {
+            resources[read].readers.push_back(pass_index);
+        }
+        for (auto const &write : pass.writes)
+        {
+            auto &state       = resources[write];
+            state.last_writer = pass_index;
+            state.readers.clear();
+        }
+    }
+    return dependencies;
+}
+
+PassDependencyGraph::Schedule PassDependencyGraph::build() const noexcept
+{
+    auto const dependencies = getDependencies();
+    auto const pass_count   = static_cast<uint32_t>(passes_.size());
+    Schedule   schedule     = {};
+    schedule.levels.assign(pass_count, 0);
+    schedule.queues.assign(pass_count, kQueue_Direct);
+
+    // Earliest start level of each pass, dependencies always point to earlier passes
+    for (uint32_t pass_index = 0; pass_index < pass_count; ++pass_index)
+    {
+        for (uint32_t const dependency : dependencies[pass_index])
+        {
+            schedule.levels[pass_index] =
+                std::max(schedule.levels[pass_index], schedule.levels[dependency] + 1);
+        }
+        schedule.level_count = std::max(schedule.level_count, schedule.levels[pass_index] + 1);
+    }
+
+    // Latest start level of each pass without lengthening the critical path
+    std::vector<uint32_t> latest_levels(pass_count, schedule.level_count - 1);
+    for (uint32_t pass_index = pass_count; pass_index-- > 0;)
+    {
+        for (uint32_t const dependency : dependencies[pass_index])
+        {
+            latest_levels[dependency] = std::min(latest_levels[dependency], latest_levels[pass_index] - 1);
+        }
+    }
+
+    // Move the compute passes with some slack off the critical path
+    for (uint32_t pass_index = 0; pass_index < pass_count; ++pass_index)
+    {
+        if (passes_[pass_index].async_compute && latest_levels[pass_index] > schedule.levels[pass_index])
+        {
+            schedule.queues[pass_index] = kQueue_AsyncCompute;
+        }
+    }
+
+    // Order each queue by level then submission order, which respects all dependencies
+    std::vector<uint32_t> queue_positions(pass_count, 0);
+    for (uint32_t queue = 0; queue < kQueue_Count; ++queue)
+    {
+        auto &queue_passes = schedule.queue_passes[queue];
+        for (uint32_t pass_index = 0; pass_index < pass_count; ++pass_index)
+        {
+            if (schedule.queues[pass_index] == queue)
+            {
+                queue_passes.push_back(pass_index);
+            }
+        }
+        std::stable_sort(queue_passes.begin(), queue_passes.end(),
+            [&schedule](uint32_t const lhs, uint32_t const rhs) {
+                return schedule.levels[lhs] < schedule.levels[rhs];
+            });
+        for (uint32_t position = 0; position < static_cast<uint32_t>(queue_passes.size()); ++position)
+        {
+            queue_positions[queue_passes[position]] = position;
+        }
+    }
+
+    // Interleaving both queues level by level gives an order that a single queue can submit
+    schedule.submission_order.resize(pass_count);
+    std::iota(schedule.submission_order.begin(), schedule.submission_order.end(), 0U);
+    std::stable_sort(schedule.submission_order.begin(), schedule.submission_order.end(),
+        [&schedule](uint32_t const lhs, uint32_t const rhs) {
+            return schedule.levels[lhs] < schedule.levels[rhs];
+        });
+
+    // Emit the cross queue fences, skipping those already covered by an earlier wait on the same queue
+    for (uint32_t queue = 0; queue < kQueue_Count; ++queue)
+    {
+        int64_t waited_position = -1; // last waited position on the other queue
+        for (uint32_t const pass_index : schedule.queue_passes[queue])
+        {
+            uint32_t signal_pass     = UINT32_MAX;
+            int64_t  signal_position = waited_position;
+            for (uint32_t const dependency : dependencies[pass_index])
+            {
+                if (schedule.queues[dependency] != queue && queue_positions[dependency] > signal_position)
+                {
+                    signal_pass     = dependency;
+                    signal_position = queue_positions[dependency];
+                }
+            }
+            if (signal_pass != UINT32_MAX)
+            {
+                schedule.fences.push_back({signal_pass, pass_index});
+                waited_position = signal_position;
+            }
+        }
+    }
+    return schedule;
+}
+} // namespace Capsaicin
@@ -0,0 +1,111 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Dependency analysis for a sequence of GPU passes.
+ * Each pass declares the resources it reads and writes, in submission order. Read-after-write,
+ * write-after-read and write-after-write hazards are turned into dependencies which are then used to
+ * split the passes between the direct queue and an async compute queue, along with the fences needed to
+ * synchronise the two.
+ * Passes on the critical path stay on the direct queue, while any compute pass with some slack is moved to
+ * the async compute queue so that it can overlap with the critical path.
+ */
+class PassDependencyGraph
+{
+public:
+    enum Queue : uint32_t
+    {
+        kQueue_Direct = 0,
+        kQueue_AsyncCompute,
+
+        kQueue_Count
+    };
+
+    /** A cross queue dependency. */
+    struct Fence
+    {
+        uint32_t signal_pass; /**< Pass after which the producing queue signals */
+        uint32_t wait_pass;   /**< Pass before which the consuming queue waits */
+    };
+
+    /** A pass declaration. */
+    struct Pass
+    {
+        std::string              name;
+        std::vector<std::string> reads;
+        std::vector<std::string> writes;
+        bool                     async_compute = false; /**< Allowed to run on the async compute queue */
+    };
+
+    /** Result of the dependency analysis. */
+    struct Schedule
+    {
+        std::vector<uint32_t> levels;                     /**< Earliest start level of each pass */
+        std::vector<Queue>    queues;                     /**< Queue of each pass */
+        std::vector<uint32_t> queue_passes[kQueue_Count]; /**< Passes of each queue in execution order */
+        std::vector<Fence>    fences;                     /**< Minimal set of cross queue fences */
+        std::vector<uint32_t> submission_order;           /**< All passes in level order (single queue) */
+        uint32_t              level_count = 0;            /**< Length of the critical path */
+    };
+
+    PassDependencyGraph() noexcept = default;
+
+    /** Removes all passes. */
+    void clear() noexcept;
+
+    /**
+     * Declares a new pass, passes must be added in submission order.
+     * @param name          The name of the pass.
+     * @param reads         The resources read by the pass.
+     * @param writes        The resources written by the pass (read-write resources may appear in both lists).
+     * @param async_compute True if the pass is a compute pass that may run on the async compute queue.
+     * @return The index of the new pass.
+     */
+    uint32_t addPass(std::string_view const &name, std::vector<std::string_view> const &reads,
+        std::vector<std::string_view> const &writes, bool async_compute) noexcept;
+
+    /**
+     * Builds the dependencies and the queue schedule for the declared passes.
+     * @return The schedule.
+     */
+    [[nodiscard]] Schedule build() const noexcept;
+
+    [[nodiscard]] std::vector<Pass> const &getPasses() const noexcept { return passes_; }
+
+    /**
+     * Gets the dependencies of each pass.
+     * @return The indices of the passes each pass directly depends on (sorted and unique).
+     */
+    [[nodiscard]] std::vector<std::vector<uint32_t>> getDependencies() const noexcept;
+
+private:
+    std::vector<Pass> passes_;
+};
+} // namespace Capsaicin
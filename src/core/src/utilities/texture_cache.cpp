@@ -0,0 +1,192 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "texture_cache.h"
+
+namespace Capsaicin
+{
+namespace
+{
+/**
+ * Gets the size of a texel of the formats supported by the cache.
+ * @param format The texture format.
+ * @return The size of a texel (in bytes), 0 if the format is not supported.
+ */
+uint32_t GetBytesPerPixel(DXGI_FORMAT const format) noexcept
+{
+    switch (format)
+    {
+    case DXGI_FORMAT_R32G32B32A32_FLOAT: return 16;
+    case DXGI_FORMAT_R16G16B16A16_FLOAT: [[fallthrough]];
+    case DXGI_FORMAT_R32G32_FLOAT:       return 8;
+    case DXGI_FORMAT_R16G16_FLOAT:       [[fallthrough]];
+    case DXGI_FORMAT_R32_FLOAT:          [[fallthrough]];
+    case DXGI_FORMAT_R11G11B10_FLOAT:    [[fallthrough]];
+    case DXGI_FORMAT_R8G8B8A8_UNORM:     return 4;
+    case DXGI_FORMAT_R16_FLOAT:          return 2;
+    default:                             return 0;
+    }
+}
+
+/**
+ * Calculate the size of the texel data of a texture.
+ * @param texture The texture.
+ * @return The size of all subresources (in bytes), 0 if the format is not supported.
+ */
+uint64_t CalculateTextureSize(GfxTexture const &texture) noexcept
+{
+    return CalculateTextureCacheSize(GetBytesPerPixel(texture.getFormat()), texture.getWidth(),
+        texture.getHeight(), texture.getMipLevels(), texture.isCube());
+}
+} // namespace
+
+TextureCache::~TextureCache() noexcept
+{
+    clear();
+}
+
+void TextureCache::initialise(GfxContext const &gfx) noexcept
+{
+    gfx_ = gfx;
+}
+
+void TextureCache::setDirectory(std::filesystem::path const &directory) noexcept
+{
+    directory_ = directory;
+}
+
+std::filesystem::path const &TextureCache::getDirectory() const noexcept
+{
+    return directory_;
+}
+
+bool TextureCache::isEnabled() const noexcept
+{
+    return !directory_.empty();
+}
+
+bool TextureCache::read(
+    std::string_view const name, uint64_t const key, TextureCacheData &data) const noexcept
+{
+    if (!isEnabled())
+    {
+        return false;
+    }
+    return ReadTextureCacheFile(GetTextureCacheFile(directory_, name, key), key, data);
+}
+
+bool TextureCache::upload(TextureCacheData const &data, GfxTexture const &texture) const noexcept
+{
+    uint64_t const size = CalculateTextureSize(texture);
+    if (size == 0 || data.data.size() != size || data.format != static_cast<uint32_t>(texture.getFormat())
+        || data.width != texture.getWidth() || data.height != texture.getHeight()
+        || data.mip_levels != texture.getMipLevels() || data.is_cube != texture.isCube())
+    {
+        GFX_PRINTLN("Ignoring cached texture as it does not match the requested texture");
+        return false;
+    }
+
+    GfxBuffer const upload_buffer = gfxCreateBuffer(gfx_, size, data.data.data(), kGfxCpuAccess_Write);
+    gfxCommandCopyBufferToTexture(gfx_, texture, upload_buffer);
+    gfxDestroyBuffer(gfx_, upload_buffer);
+    return true;
+}
+
+bool TextureCache::load(
+    std::string_view const name, uint64_t const key, GfxTexture const &texture) const noexcept
+{
+    TextureCacheData data;
+    return read(name, key, data) && upload(data, texture);
+}
+
+void TextureCache::save(std::string_view const name, uint64_t const key, GfxTexture const &texture,
+    std::array<uint32_t, 4> const &userData) noexcept
+{
+    uint64_t const size = CalculateTextureSize(texture);
+    if (!isEnabled() || size == 0)
+    {
+        return;
+    }
+
+    PendingWrite pending;
+    pending.buffer = gfxCreateBuffer(gfx_, size, nullptr, kGfxCpuAccess_Read);
+    pending.buffer.setName("Capsaicin_TextureCacheBuffer");
+    gfxCommandCopyTextureToBuffer(gfx_, pending.buffer, texture);
+
+    pending.data.key        = key;
+    pending.data.format     = static_cast<uint32_t>(texture.getFormat());
+    pending.data.width      = texture.getWidth();
+    pending.data.height     = texture.getHeight();
+    pending.data.mip_levels = texture.getMipLevels();
+    pending.data.is_cube    = texture.isCube();
+    pending.data.user_data  = userData;
+
+    pending.file_path        = GetTextureCacheFile(directory_, name, key);
+    pending.remaining_frames = gfxGetBackBufferCount(gfx_);
+    pending_writes_.push_back(std::move(pending));
+}
+
+void TextureCache::update() noexcept
+{
+    // Readbacks complete in order so only the front of the queue needs checking
+    for (auto &pending : pending_writes_)
+    {
+        if (pending.remaining_frames > 0)
+        {
+            --pending.remaining_frames;
+        }
+    }
+    while (!pending_writes_.empty() && pending_writes_.front().remaining_frames == 0)
+    {
+        write(pending_writes_.front());
+        gfxDestroyBuffer(gfx_, pending_writes_.front().buffer);
+        pending_writes_.pop_front();
+    }
+}
+
+void TextureCache::flush() noexcept
+{
+    for (auto &pending : pending_writes_)
+    {
+        write(pending);
+    }
+    clear();
+}
+
+void TextureCache::clear() noexcept
+{
+    for (auto const &pending : pending_writes_)
+    {
+        gfxDestroyBuffer(gfx_, pending.buffer);
+    }
+    pending_writes_.clear();
+}
+
+void TextureCache::write(PendingWrite &pending) const noexcept
+{
+    auto const *readback_data = static_cast<uint8_t const *>(gfxBufferGetData(gfx_, pending.buffer));
+    pending.data.data.assign(readback_data, readback_data + pending.buffer.getSize());
+    if (!WriteTextureCacheFile(pending.file_path, pending.data))
+    {
+        GFX_PRINTLN("Failed to write texture cache file: %s", pending.file_path.string().c_str());
+    }
+}
+} // namespace Capsaicin
@@ -0,0 +1,146 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "texture_cache_file.h"
+
+#include <deque>
+#include <gfx.h>
+
+namespace Capsaicin
+{
+/**
+ * An on-disk cache of textures that are expensive to generate but only depend on a few inputs (e.g. lookup
+ * tables, environment maps generated from a source image).
+ * Textures are stored as DDS files named after their key (see TextureCacheKey) so that a later run using the
+ * same inputs can upload them directly instead of regenerating them. Saving a texture requires a GPU readback
+ * which only completes a few frames later, so the files are written from update().
+ */
+class TextureCache
+{
+public:
+    /** Default constructor. */
+    TextureCache() noexcept = default;
+
+    /** Destructor. */
+    ~TextureCache() noexcept;
+
+    TextureCache(TextureCache const &other)                = delete;
+    TextureCache(TextureCache &&other) noexcept            = delete;
+    TextureCache &operator=(TextureCache const &other)     = delete;
+    TextureCache &operator=(TextureCache &&other) noexcept = delete;
+
+    /**
+     * Initialise the cache.
+     * @param gfx Current gfx context.
+     */
+    void initialise(GfxContext const &gfx) noexcept;
+
+    /**
+     * Set the directory used to store the cached textures.
+     * @param directory The cache directory, an empty path disables the cache.
+     */
+    void setDirectory(std::filesystem::path const &directory) noexcept;
+
+    /**
+     * Gets the directory used to store the cached textures.
+     * @return The cache directory (empty if disabled).
+     */
+    [[nodiscard]] std::filesystem::path const &getDirectory() const noexcept;
+
+    /**
+     * Check if the cache is enabled.
+     * @return True if a cache directory has been set.
+     */
+    [[nodiscard]] bool isEnabled() const noexcept;
+
+    /**
+     * Read a cached texture.
+     * @param name Name of the texture.
+     * @param key  Key of the texture contents.
+     * @param [out] data The texture read from the cache.
+     * @return True if the texture was found in the cache.
+     */
+    bool read(std::string_view name, uint64_t key, TextureCacheData &data) const noexcept;
+
+    /**
+     * Upload cached texture data to a texture.
+     * @param data    The cached texture.
+     * @param texture The texture to upload to, must match the format and dimensions of the cached data.
+     * @return True if the data was uploaded.
+     */
+    bool upload(TextureCacheData const &data, GfxTexture const &texture) const noexcept;
+
+    /**
+     * Load a texture from the cache.
+     * @param name    Name of the texture.
+     * @param key     Key of the texture contents.
+     * @param texture The texture to upload to.
+     * @return True if the texture was found in the cache and uploaded.
+     */
+    bool load(std::string_view name, uint64_t key, GfxTexture const &texture) const noexcept;
+
+    /**
+     * Store a texture in the cache.
+     * @note The texture contents are read back at the current point of the command list but only written to
+     * disk once the readback is complete.
+     * @param name     Name of the texture.
+     * @param key      Key of the texture contents.
+     * @param texture  The texture to store.
+     * @param userData (Optional) Additional values to store along with the texture.
+     */
+    void save(std::string_view name, uint64_t key, GfxTexture const &texture,
+        std::array<uint32_t, 4> const &userData = {}) noexcept;
+
+    /** Write any textures whose readback has completed, must be called once per frame. */
+    void update() noexcept;
+
+    /**
+     * Write all pending textures.
+     * @note The GPU must be idle (e.g. after gfxFinish).
+     */
+    void flush() noexcept;
+
+    /** Release any pending readbacks without writing them. */
+    void clear() noexcept;
+
+private:
+    /** A texture waiting for its readback to complete. */
+    struct PendingWrite
+    {
+        GfxBuffer             buffer;               /**< The readback buffer */
+        TextureCacheData      data;                 /**< Description of the texture (without texel data) */
+        std::filesystem::path file_path;            /**< The cache file to write */
+        uint32_t              remaining_frames = 0; /**< Number of frames until the readback is available */
+    };
+
+    /**
+     * Write a texture whose readback has completed.
+     * @param pending The pending texture.
+     */
+    void write(PendingWrite &pending) const noexcept;
+
+    GfxContext               gfx_;
+    std::filesystem::path    directory_;      /**< Cache directory, empty if disabled */
+    std::deque<PendingWrite> pending_writes_; /**< Textures waiting to be written */
+};
+} // namespace Capsaicin
@@ -0,0 +1,355 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "texture_cache_file.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace Capsaicin
+{
+namespace
+{
+constexpr uint64_t kFNVOffsetBasis = 0xCBF29CE484222325ULL;
+constexpr uint64_t kFNVPrime       = 0x100000001B3ULL;
+
+/** Create a little endian four character code. */
+constexpr uint32_t MakeFourCC(char const a, char const b, char const c, char const d) noexcept
+{
+    return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16)
+         | (static_cast<uint32_t>(d) << 24);
+}
+
+constexpr uint32_t kDDSMagic           = MakeFourCC('D', 'D', 'S', ' ');
+constexpr uint32_t kDDSFourCCDX10      = MakeFourCC('D', 'X', '1', '0');
+constexpr uint32_t kTextureCacheTag    = MakeFourCC('C', 'P', 'S', 'N');
+constexpr uint32_t kDDSFlagsRequired   = 0x1 | 0x2 | 0x4 | 0x1000; /**< CAPS|HEIGHT|WIDTH|PIXELFORMAT */
+constexpr uint32_t kDDSFlagMipMapCount = 0x20000;
+constexpr uint32_t kDDSPixelFourCC     = 0x4;
+constexpr uint32_t kDDSCapsComplex     = 0x8;
+constexpr uint32_t kDDSCapsTexture     = 0x1000;
+constexpr uint32_t kDDSCapsMipMap      = 0x400000;
+constexpr uint32_t kDDSCaps2CubeMap    = 0xFE00; /**< CUBEMAP and all 6 faces */
+constexpr uint32_t kDDSDimensionTex2D  = 3;
+constexpr uint32_t kDDSMiscTextureCube = 0x4;
+
+struct DDSPixelFormat
+{
+    uint32_t size;
+    uint32_t flags;
+    uint32_t four_cc;
+    uint32_t rgb_bit_count;
+    uint32_t r_bit_mask;
+    uint32_t g_bit_mask;
+    uint32_t b_bit_mask;
+    uint32_t a_bit_mask;
+};
+
+/**
+ * The DDS header followed by the DX10 extension.
+ * The reserved values store the cache tag (0), the key (1-2) and the user data (3-6).
+ */
+struct DDSHeader
+{
+    uint32_t       magic;
+    uint32_t       size;
+    uint32_t       flags;
+    uint32_t       height;
+    uint32_t       width;
+    uint32_t       pitch_or_linear_size;
+    uint32_t       depth;
+    uint32_t       mip_map_count;
+    uint32_t       reserved1[11];
+    DDSPixelFormat pixel_format;
+    uint32_t       caps;
+    uint32_t       caps2;
+    uint32_t       caps3;
+    uint32_t       caps4;
+    uint32_t       reserved2;
+    uint32_t       dxgi_format;
+    uint32_t       resource_dimension;
+    uint32_t       misc_flag;
+    uint32_t       array_size;
+    uint32_t       misc_flags2;
+};
+static_assert(sizeof(DDSHeader) == 4 + 124 + 20);
+
+uint64_t HashBytes(uint64_t hash, uint8_t const *data, size_t const size) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * kFNVPrime;
+    }
+    return hash;
+}
+} // namespace
+
+TextureCacheKey::TextureCacheKey() noexcept
+    : hash_(kFNVOffsetBasis)
+{
+    add(kTextureCacheVersion);
+}
+
+TextureCacheKey &TextureCacheKey::add(void const *data, size_t const size) noexcept
+{
+    hash_ = HashBytes(hash_, static_cast<uint8_t const *>(data), size);
+    return *this;
+}
+
+TextureCacheKey &TextureCacheKey::add(std::string_view const value) noexcept
+{
+    add(static_cast<uint64_t>(value.size()));
+    return add(value.data(), value.size());
+}
+
+bool TextureCacheKey::addFile(std::filesystem::path const &filePath) noexcept
+{
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    // Source images can be large so the contents are hashed a word at a time
+    constexpr size_t      chunk_size = 1 << 20;
+    std::vector<uint64_t> chunk(chunk_size / sizeof(uint64_t));
+    uint64_t              file_size = 0;
+    while (file)
+    {
+        file.read(reinterpret_cast<char *>(chunk.data()), static_cast<std::streamsize>(chunk_size));
+        auto const read_size = static_cast<size_t>(file.gcount());
+        size_t     word      = 0;
+        for (; word < read_size / sizeof(uint64_t); ++word)
+        {
+            hash_ = (hash_ ^ chunk[word]) * kFNVPrime;
+        }
+        hash_ = HashBytes(
+            hash_, reinterpret_cast<uint8_t const *>(&chunk[word]), read_size % sizeof(uint64_t));
+        file_size += read_size;
+    }
+    if (file.bad())
+    {
+        return false;
+    }
+    add(file_size);
+    return true;
+}
+
+bool TextureCacheKey::addShaderFile(std::filesystem::path const &filePath,
+    std::vector<std::filesystem::path> const &includePaths) noexcept
+{
+    std::set<std::filesystem::path> visited;
+    return addShaderFile(filePath, includePaths, visited);
+}
+
+bool TextureCacheKey::addShaderFile(std::filesystem::path const &filePath,
+    std::vector<std::filesystem::path> const &includePaths, std::set<std::filesystem::path> &visited) noexcept
+{
+    std::error_code ec;
+    auto const      canonical_path = std::filesystem::weakly_canonical(filePath, ec);
+    if (ec)
+    {
+        return false;
+    }
+    if (!visited.insert(canonical_path).second)
+    {
+        return true; // already added through another include
+    }
+    if (!addFile(canonical_path))
+    {
+        return false;
+    }
+
+    // Follow the include directives, ones inside inactive preprocessor branches must also resolve
+    std::ifstream file(canonical_path);
+    std::string   line;
+    while (std::getline(file, line))
+    {
+        std::string_view directive(line);
+        directive.remove_prefix(std::min(directive.find_first_not_of(" \t"), directive.size()));
+        if (!directive.starts_with('#'))
+        {
+            continue;
+        }
+        directive.remove_prefix(1);
+        directive.remove_prefix(std::min(directive.find_first_not_of(" \t"), directive.size()));
+        if (!directive.starts_with("include"))
+        {
+            continue;
+        }
+        size_t const begin = directive.find_first_of("\"<");
+        if (begin == std::string_view::npos)
+        {
+            continue;
+        }
+        size_t const end = directive.find_first_of("\">", begin + 1);
+        if (end == std::string_view::npos)
+        {
+            return false;
+        }
+        std::filesystem::path const include(directive.substr(begin + 1, end - begin - 1));
+
+        std::filesystem::path include_path = canonical_path.parent_path() / include;
+        for (auto const &directory : includePaths)
+        {
+            if (std::filesystem::exists(include_path, ec))
+            {
+                break;
+            }
+            include_path = directory / include;
+        }
+        if (!std::filesystem::exists(include_path, ec) || !addShaderFile(include_path, includePaths, visited))
+        {
+            return false;
+        }
+    }
+    return !file.bad();
+}
+
+uint64_t TextureCacheKey::getValue() const noexcept
+{
+    return hash_;
+}
+
+uint64_t CalculateTextureCacheSize(uint32_t const bytesPerPixel, uint32_t const width, uint32_t const height,
+    uint32_t const mipLevels, bool const isCube) noexcept
+{
+    uint64_t size = 0;
+    for (uint32_t mip_level = 0; mip_level < mipLevels; ++mip_level)
+    {
+        size += static_cast<uint64_t>(std::max(width >> mip_level, 1U)) * std::max(height >> mip_level, 1U);
+    }
+    return size * bytesPerPixel * (isCube ? 6 : 1);
+}
+
+std::filesystem::path GetTextureCacheFile(
+    std::filesystem::path const &directory, std::string_view const name, uint64_t const key) noexcept
+{
+    return directory / std::format("{}_{:016x}.dds", name, key);
+}
+
+bool WriteTextureCacheFile(std::filesystem::path const &filePath, TextureCacheData const &data) noexcept
+{
+    DDSHeader header = {};
+    header.magic         = kDDSMagic;
+    header.size          = 124;
+    header.flags         = kDDSFlagsRequired | (data.mip_levels > 1 ? kDDSFlagMipMapCount : 0);
+    header.height        = data.height;
+    header.width         = data.width;
+    header.mip_map_count = data.mip_levels;
+    header.reserved1[0]  = kTextureCacheTag;
+    header.reserved1[1]  = static_cast<uint32_t>(data.key);
+    header.reserved1[2]  = static_cast<uint32_t>(data.key >> 32);
+    std::ranges::copy(data.user_data, &header.reserved1[3]);
+    header.pixel_format.size    = sizeof(DDSPixelFormat);
+    header.pixel_format.flags   = kDDSPixelFourCC;
+    header.pixel_format.four_cc = kDDSFourCCDX10;
+    header.caps                 = kDDSCapsTexture;
+    if (data.mip_levels > 1)
+    {
+        header.caps |= kDDSCapsComplex | kDDSCapsMipMap;
+    }
+    if (data.is_cube)
+    {
+        header.caps |= kDDSCapsComplex;
+    }
+    header.caps2              = data.is_cube ? kDDSCaps2CubeMap : 0;
+    header.dxgi_format        = data.format;
+    header.resource_dimension = kDDSDimensionTex2D;
+    header.misc_flag          = data.is_cube ? kDDSMiscTextureCube : 0;
+    header.array_size         = 1;
+
+    // Write to a unique temporary file first as the cache may be shared by several processes
+    std::error_code ec;
+    std::filesystem::create_directories(filePath.parent_path(), ec);
+    auto const unique = std::hash<std::thread::id> {}(std::this_thread::get_id())
+                      ^ static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    std::filesystem::path temp_path = filePath;
+    temp_path += std::format(".{:x}.tmp", unique);
+    {
+        std::ofstream file(temp_path, std::ios::binary);
+        if (!file.is_open())
+        {
+            return false;
+        }
+        file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        file.write(reinterpret_cast<char const *>(data.data.data()),
+            static_cast<std::streamsize>(data.data.size()));
+        if (!file.good())
+        {
+            file.close();
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+    }
+    std::filesystem::rename(temp_path, filePath, ec);
+    if (ec)
+    {
+        // Another process may have written the same file in the meantime
+        std::filesystem::remove(temp_path, ec);
+        return std::filesystem::exists(filePath, ec);
+    }
+    return true;
+}
+
+bool ReadTextureCacheFile(
+    std::filesystem::path const &filePath, uint64_t const key, TextureCacheData &data) noexcept
+{
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    auto const file_size = static_cast<uint64_t>(file.tellg());
+    if (file_size < sizeof(DDSHeader))
+    {
+        return false;
+    }
+    file.seekg(0);
+
+    DDSHeader header = {};
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    uint64_t const file_key =
+        static_cast<uint64_t>(header.reserved1[1]) | (static_cast<uint64_t>(header.reserved1[2]) << 32);
+    if (!file.good() || header.magic != kDDSMagic || header.size != 124
+        || header.pixel_format.four_cc != kDDSFourCCDX10 || header.reserved1[0] != kTextureCacheTag
+        || file_key != key || header.resource_dimension != kDDSDimensionTex2D || header.array_size != 1)
+    {
+        return false;
+    }
+
+    data.key        = file_key;
+    data.format     = header.dxgi_format;
+    data.width      = header.width;
+    data.height     = header.height;
+    data.mip_levels = (header.flags & kDDSFlagMipMapCount) != 0 ? std::max(header.mip_map_count, 1U) : 1U;
+    data.is_cube    = (header.misc_flag & kDDSMiscTextureCube) != 0;
+    std::copy_n(&header.reserved1[3], data.user_data.size(), data.user_data.begin());
+    data.data.resize(file_size - sizeof(DDSHeader));
+    file.read(reinterpret_cast<char *>(data.data.data()), static_cast<std::streamsize>(data.data.size()));
+    return file.good();
+}
+} // namespace Capsaicin
@@ -0,0 +1,169 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <set>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Version of the data stored in the texture cache.
+ * Must be incremented whenever the contents of a cached texture change in a way its key does not capture
+ * (e.g. the layout of the files) so that any previously stored files are no longer matched. Changes to the
+ * generating shaders are captured by hashing their sources (see TextureCacheKey::addShaderFile).
+ */
+constexpr uint32_t kTextureCacheVersion = 1;
+
+/**
+ * Builds the key identifying the contents of a cached texture.
+ * The key is a 64bit FNV-1a hash of everything the texture is generated from (source file contents, sizes,
+ * sample counts...). Unlike std::hash the result is identical across runs and machines so it can be used
+ * to name files shared between processes.
+ */
+class TextureCacheKey
+{
+public:
+    /** Default constructor, the key is seeded with the cache version. */
+    TextureCacheKey() noexcept;
+
+    /**
+     * Add raw data to the key.
+     * @param data Pointer to the data.
+     * @param size The size of the data (in bytes).
+     * @return The updated key.
+     */
+    TextureCacheKey &add(void const *data, size_t size) noexcept;
+
+    /**
+     * Add a value to the key.
+     * @tparam TYPE Type of the value, must not contain any pointers or padding.
+     * @param value The value.
+     * @return The updated key.
+     */
+    template<typename TYPE>
+        requires std::is_trivially_copyable_v<TYPE>
+    TextureCacheKey &add(TYPE const &value) noexcept
+    {
+        return add(&value, sizeof(TYPE));
+    }
+
+    /**
+     * Add a string to the key.
+     * @param value The string.
+     * @return The updated key.
+     */
+    TextureCacheKey &add(std::string_view value) noexcept;
+
+    /**
+     * Add the contents of a file to the key.
+     * @param filePath The file to read.
+     * @return False if the file could not be read, in which case the key should not be used.
+     */
+    bool addFile(std::filesystem::path const &filePath) noexcept;
+
+    /**
+     * Add the contents of a shader source file and of all the files it includes to the key.
+     * Includes are resolved relative to the including file first and then against each include path in turn,
+     * the same as the shader compiler. Each file is only added once.
+     * @param filePath     The shader file to read.
+     * @param includePaths Directories searched for included files.
+     * @return False if the file or any of its includes could not be read, in which case the key should not
+     *         be used.
+     */
+    bool addShaderFile(std::filesystem::path const &filePath,
+        std::vector<std::filesystem::path> const &includePaths) noexcept;
+
+    /**
+     * Gets the current value of the key.
+     * @return The key value.
+     */
+    [[nodiscard]] uint64_t getValue() const noexcept;
+
+private:
+    bool addShaderFile(std::filesystem::path const &filePath,
+        std::vector<std::filesystem::path> const &includePaths,
+        std::set<std::filesystem::path>          &visited) noexcept;
+
+    uint64_t hash_ = 0;
+};
+
+/** The contents of a cached texture. */
+struct TextureCacheData
+{
+    uint64_t                key        = 0;     /**< Key of the contents (see TextureCacheKey) */
+    uint32_t                format     = 0;     /**< The DXGI format of the texture */
+    uint32_t                width      = 0;     /**< Width of the first mip level */
+    uint32_t                height     = 0;     /**< Height of the first mip level */
+    uint32_t                mip_levels = 1;     /**< Number of mip levels */
+    bool                    is_cube    = false; /**< True if the texture is a cube map (6 faces) */
+    std::array<uint32_t, 4> user_data  = {};    /**< Additional values stored along with the texture */
+    std::vector<uint8_t>    data; /**< Texel data, all mips of each face in turn (D3D12 subresource order) */
+};
+
+/**
+ * Calculate the size of the texel data of a texture.
+ * @param bytesPerPixel Number of bytes per texel.
+ * @param width         Width of the first mip level.
+ * @param height        Height of the first mip level.
+ * @param mipLevels     Number of mip levels.
+ * @param isCube        True if the texture is a cube map.
+ * @return The size of the tightly packed data of all subresources (in bytes).
+ */
+[[nodiscard]] uint64_t CalculateTextureCacheSize(
+    uint32_t bytesPerPixel, uint32_t width, uint32_t height, uint32_t mipLevels, bool isCube) noexcept;
+
+/**
+ * Gets the file used to store a cached texture.
+ * @param directory The cache directory.
+ * @param name      Name of the texture.
+ * @param key       Key of the texture contents.
+ * @return The file path.
+ */
+[[nodiscard]] std::filesystem::path GetTextureCacheFile(
+    std::filesystem::path const &directory, std::string_view name, uint64_t key) noexcept;
+
+/**
+ * Write a cached texture to a DDS file.
+ * The file is first written under a temporary name and then renamed so that other processes sharing the
+ * cache never read a partially written file.
+ * @param filePath The file to write.
+ * @param data     The texture to write.
+ * @return True if the file was written.
+ */
+bool WriteTextureCacheFile(std::filesystem::path const &filePath, TextureCacheData const &data) noexcept;
+
+/**
+ * Read a cached texture from a DDS file.
+ * @param filePath The file to read.
+ * @param key      The expected key of the texture contents.
+ * @param [out] data The texture read from the file.
+ * @return False if the file does not exist, is invalid or was not written with the requested key.
+ */
+bool ReadTextureCacheFile(
+    std::filesystem::path const &filePath, uint64_t key, TextureCacheData &data) noexcept;
+} // namespace Capsaicin
@@ -0,0 +1,235 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "capsaicin/animation_scheduler.h"
+#include "test.h"
+
+#include <cmath>
+#include <utility>
+
+using namespace Capsaicin;
+
+namespace
+{
+using Action = AnimationScheduler::Action;
+
+/** Builds a camera at the origin looking down -z, with a 90 degree field of view. */
+AnimationScheduler::View CalculateView() noexcept
+{
+    // Right handed with a reversed [0, 1] depth range, as used by the renderer's camera matrices
+    float const near_z = 100.0F;
+    float const far_z  = 0.1F;
+    float4x4    projection(0.0F);
+    projection[0][0] = 1.0F;
+    projection[1][1] = 1.0F;
+    projection[2][2] = far_z / (near_z - far_z);
+    projection[2][3] = -1.0F;
+    projection[3][2] = -(far_z * near_z) / (far_z - near_z);
+
+    AnimationScheduler::View view;
+    view.view_projection = projection;
+    view.position        = float3(0.0F);
+    view.tan_half_fov_y  = 1.0F;
+    return view;
+}
+
+/** Creates an animated instance input of a cube. */
+AnimationScheduler::InstanceInput CreateInstance(float3 const &center, float const extent) noexcept
+{
+    AnimationScheduler::InstanceInput input;
+    input.bounds_min = center - extent;
+    input.bounds_max = center + extent;
+    input.animated   = true;
+    return input;
+}
+
+/** Settings with a fixed refit count and no growth limit, so that rebuilds only happen when requested. */
+AnimationScheduler::Settings CreateSettings() noexcept
+{
+    AnimationScheduler::Settings settings;
+    settings.min_projected_size = 0.05F;
+    settings.reduced_interval   = 4;
+    settings.hidden_interval    = 8;
+    settings.refit_budget       = 0;
+    settings.max_refit_count    = 1000;
+    settings.max_refit_growth   = 0.0F;
+    return settings;
+}
+
+void TestFirstFrame()
+{
+    AnimationScheduler scheduler;
+    scheduler.setSettings(CreateSettings());
+    std::vector<AnimationScheduler::InstanceInput> instances = {
+        CreateInstance(float3(0.0F, 0.0F, -10.0F), 1.0F), AnimationScheduler::InstanceInput {}};
+    auto const view = CalculateView();
+
+    // Everything animated is built on the first frame, static instances are never touched
+    scheduler.schedule(instances, view, false);
+    CHECK(scheduler.getAction(0) == Action::Rebuild);
+    CHECK(scheduler.getAction(1) == Action::Skip);
+    CHECK(scheduler.getAction(2) == Action::Skip); // out of range
+    CHECK(scheduler.getStatistics().rebuilt == 1);
+    CHECK(scheduler.getStatistics().skipped == 0);
+
+    scheduler.schedule(instances, view, false);
+    CHECK(scheduler.getAction(0) == Action::Refit);
+    scheduler.schedule(instances, view, true);
+    CHECK(scheduler.getAction(0) == Action::Rebuild);
+
+    // A change in the instance count discards the history
+    instances.push_back(CreateInstance(float3(0.0F, 0.0F, -10.0F), 1.0F));
+    scheduler.schedule(instances, view, false);
+    CHECK(scheduler.getAction(0) == Action::Rebuild);
+    CHECK(scheduler.getAction(2) == Action::Rebuild);
+}
+
+void TestUpdateRates()
+{
+    AnimationScheduler scheduler;
+    scheduler.setSettings(CreateSettings());
+    std::vector<AnimationScheduler::InstanceInput> const instances = {
+        CreateInstance(float3(0.0F, 0.0F, -10.0F), 1.0F),   // large and visible
+        CreateInstance(float3(0.0F, 0.0F, -50.0F), 0.01F),  // small and visible
+        CreateInstance(float3(0.0F, 0.0F, 10.0F), 1.0F),    // behind the camera
+        CreateInstance(float3(0.0F, 0.0F, -150.0F), 10.0F), // beyond the far plane
+    };
+    auto const view = CalculateView();
+    scheduler.schedule(instances, view, false);
+
+    uint32_t update_counts[4] = {};
+    for (uint32_t frame = 0; frame < 16; ++frame)
+    {
+        scheduler.schedule(instances, view, false);
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            Action const action = scheduler.getAction(i);
+            CHECK(action == Action::Refit || action == Action::Skip);
+            update_counts[i] += action != Action::Skip ? 1 : 0;
+        }
+    }
+    CHECK(update_counts[0] == 16);
+    CHECK(update_counts[1] == 4);
+    CHECK(update_counts[2] == 2);
+    CHECK(update_counts[3] == 2);
+
+    // Hidden instances can be frozen completely
+    auto settings            = CreateSettings();
+    settings.hidden_interval = 0;
+    scheduler.setSettings(settings);
+    for (uint32_t frame = 0; frame < 16; ++frame)
+    {
+        scheduler.schedule(instances, view, false);
+        CHECK(scheduler.getAction(2) == Action::Skip);
+    }
+}
+
+void TestBudget()
+{
+    AnimationScheduler scheduler;
+    auto               settings = CreateSettings();
+    settings.refit_budget       = 1;
+    scheduler.setSettings(settings);
+    std::vector<AnimationScheduler::InstanceInput> const instances = {
+        CreateInstance(float3(-2.0F, 0.0F, -10.0F), 1.0F),
+        CreateInstance(float3(0.0F, 0.0F, -10.0F), 1.0F),
+        CreateInstance(float3(2.0F, 0.0F, -10.0F), 1.0F),
+    };
+    auto const view = CalculateView();
+    scheduler.schedule(instances, view, false);
+
+    // Instances over the budget skip both skinning and refitting and are picked up in the following frames
+    uint32_t update_counts[3] = {};
+    for (uint32_t frame = 0; frame < 9; ++frame)
+    {
+        scheduler.schedule(instances, view, false);
+        CHECK(scheduler.getStatistics().refitted == 1);
+        CHECK(scheduler.getStatistics().deferred == 2);
+        CHECK(scheduler.getStatistics().skipped == 2);
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            update_counts[i] += scheduler.getAction(i) != Action::Skip ? 1 : 0;
+        }
+    }
+    CHECK(update_counts[0] == 3);
+    CHECK(update_counts[1] == 3);
+    CHECK(update_counts[2] == 3);
+}
+
+void TestForcedRebuild()
+{
+    AnimationScheduler scheduler;
+    auto               settings = CreateSettings();
+    settings.max_refit_count    = 3;
+    scheduler.setSettings(settings);
+    std::vector<AnimationScheduler::InstanceInput> instances = {
+        CreateInstance(float3(0.0F, 0.0F, -10.0F), 1.0F)};
+    auto const view = CalculateView();
+    scheduler.schedule(instances, view, false);
+
+    // Rebuilt after the maximum number of refits
+    for (uint32_t frame = 0; frame < 3; ++frame)
+    {
+        scheduler.schedule(instances, view, false);
+        CHECK(scheduler.getAction(0) == Action::Refit);
+    }
+    scheduler.schedule(instances, view, false);
+    CHECK(scheduler.getAction(0) == Action::Rebuild);
+
+    // Rebuilt when the bounds grow too much
+    settings.max_refit_count  = 1000;
+    settings.max_refit_growth = 2.0F;
+    scheduler.setSettings(settings);
+    instances[0] = CreateInstance(float3(0.0F, 0.0F, -10.0F), 1.3F);
+    scheduler.schedule(instances, view, false);
+    CHECK(scheduler.getAction(0) == Action::Refit);
+    instances[0] = CreateInstance(float3(0.0F, 0.0F, -10.0F), 1.5F);
+    scheduler.schedule(instances, view, false);
+    CHECK(scheduler.getAction(0) == Action::Rebuild);
+    scheduler.schedule(instances, view, false);
+    CHECK(scheduler.getAction(0) == Action::Refit);
+
+    // Everything is rebuilt after a reset
+    scheduler.reset();
+    scheduler.schedule(instances, view, false);
+    CHECK(scheduler.getAction(0) == Action::Rebuild);
+}
+
+void TestProjectedSize()
+{
+    auto const  view = CalculateView();
+    float const size = AnimationScheduler::CalculateProjectedSize(
+        float3(-1.0F, -1.0F, -11.0F), float3(1.0F, 1.0F, -9.0F), view);
+    CHECK(std::abs(size - std::sqrt(3.0F) / 10.0F) < 1e-5F);
+    CHECK(AnimationScheduler::CalculateProjectedSize(float3(-1.0F), float3(1.0F), view) == 1.0F);
+}
+} // namespace
+
+int main()
+{
+    TestFirstFrame();
+    TestUpdateRates();
+    TestBudget();
+    TestForcedRebuild();
+    TestProjectedSize();
+    return Test::Result();
+}
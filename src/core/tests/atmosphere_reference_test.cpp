@@ -0,0 +1,106 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "atmosphere/atmosphere_reference.h"
+#include "test.h"
+
+#include <cmath>
+
+using namespace Capsaicin;
+
+namespace
+{
+float3 SunDirection(float const elevation) noexcept
+{
+    float const angle = glm::radians(elevation);
+    return float3(0.0F, std::sin(angle), std::cos(angle));
+}
+
+bool IsValid(float3 const &value) noexcept
+{
+    return std::isfinite(value.x) && std::isfinite(value.y) && std::isfinite(value.z) && value.x >= 0.0F
+        && value.y >= 0.0F && value.z >= 0.0F;
+}
+
+void TestTables()
+{
+    auto const transmittance = AtmosphereReference::GenerateTransmittanceLut();
+    CHECK(transmittance.size()
+          == AtmosphereReference::kTransmittanceLutSize.x * AtmosphereReference::kTransmittanceLutSize.y);
+    for (auto const &texel : transmittance)
+    {
+        CHECK(IsValid(texel) && texel.x <= 1.0F && texel.y <= 1.0F && texel.z <= 1.0F);
+    }
+
+    // Less light reaches the ground towards the horizon, and blue is scattered the most
+    float const radius = AtmosphereReference::kPlanetRadius + 1.0F;
+    float3 const zenith  = AtmosphereReference::IntegrateTransmittance(radius, 1.0F);
+    float3 const horizon = AtmosphereReference::IntegrateTransmittance(radius, 0.05F);
+    CHECK(horizon.x < zenith.x && horizon.y < zenith.y && horizon.z < zenith.z);
+    CHECK(zenith.z < zenith.x);
+
+    auto const multi_scattering = AtmosphereReference::GenerateMultiScatteringLut(transmittance);
+    CHECK(multi_scattering.size()
+          == AtmosphereReference::kMultiScatteringLutSize.x * AtmosphereReference::kMultiScatteringLutSize.y);
+    for (auto const &texel : multi_scattering)
+    {
+        CHECK(IsValid(texel));
+    }
+
+    // Multiple scattering only adds light to the sky
+    auto const single = AtmosphereReference::GenerateSkyViewLut(transmittance, {}, radius, 0.5F);
+    auto const multi =
+        AtmosphereReference::GenerateSkyViewLut(transmittance, multi_scattering, radius, 0.5F);
+    CHECK(single.size() == multi.size());
+    for (size_t i = 0; i < single.size(); ++i)
+    {
+        CHECK(IsValid(single[i]));
+        CHECK(multi[i].x >= single[i].x && multi[i].y >= single[i].y && multi[i].z >= single[i].z);
+    }
+    for (auto const &direction :
+        {float3(0.0F, 1.0F, 0.0F), float3(1.0F, 0.0F, 0.0F), float3(0.0F, -1.0F, 0.0F)})
+    {
+        CHECK(IsValid(AtmosphereReference::EvaluateSky(multi, radius, direction, SunDirection(30.0F))));
+    }
+}
+
+void TestSingleScattering()
+{
+    // The table based single scattering must match the analytic model it replaced within 1% of the peak sky
+    // radiance, for sun elevations from near the horizon to overhead and for camera heights up to 2km
+    for (float const elevation : {3.0F, 30.0F, 89.0F})
+    {
+        for (float const height : {1.0F, 2000.0F})
+        {
+            float const error = AtmosphereReference::CalculateMaxError(height, SunDirection(elevation));
+            CHECK(error < 0.01F);
+        }
+    }
+}
+} // namespace
+
+int main()
+{
+    TestTables();
+    TestSingleScattering();
+    return Test::Result();
+}
@@ -0,0 +1,144 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "color_pyramid/color_pyramid_reference.h"
+#include "test.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace Capsaicin;
+
+namespace
+{
+std::vector<float3> CreateImage(uint2 const &dimensions) noexcept
+{
+    // Deterministic pseudo random HDR values
+    std::vector<float3> image;
+    uint32_t            state = 12345U;
+    auto const          next  = [&state] {
+        state = state * 1664525U + 1013904223U;
+        return static_cast<float>(state >> 8) / static_cast<float>(1U << 24) * 16.0F;
+    };
+    for (uint32_t i = 0; i < dimensions.x * dimensions.y; ++i)
+    {
+        float const r = next();
+        float const g = next();
+        image.emplace_back(r, g, next());
+    }
+    return image;
+}
+
+bool Near(float3 const &value, float3 const &expected) noexcept
+{
+    return compMax(abs(value - expected)) <= 1.0e-4F * std::max(compMax(abs(expected)), 1.0F);
+}
+
+void TestLevelDimensions()
+{
+    CHECK(ColorPyramidReference::LevelDimensions(uint2(1920, 1080), 0) == uint2(1920, 1080));
+    CHECK(ColorPyramidReference::LevelDimensions(uint2(1920, 1080), 1) == uint2(960, 540));
+    CHECK(ColorPyramidReference::LevelDimensions(uint2(1920, 1080), 2) == uint2(480, 270));
+    CHECK(ColorPyramidReference::LevelDimensions(uint2(5, 3), 2) == uint2(1, 1));
+    CHECK(ColorPyramidReference::LevelDimensions(uint2(1, 1), 1) == uint2(1, 1));
+}
+
+void TestFilterWeights()
+{
+    // The bilinear fetch at the shared corner of each 2x2 quad gives every covered pixel a weight of 1/4
+    uint2 const dimensions(8, 8);
+    for (uint2 const pixel : {uint2(0, 0), uint2(3, 2), uint2(7, 7)})
+    {
+        std::vector<float3> impulse(dimensions.x * dimensions.y, float3(0.0F));
+        impulse[pixel.y * dimensions.x + pixel.x] = float3(1.0F);
+        auto const levels = ColorPyramidReference::Generate(impulse, dimensions);
+        CHECK(levels.size() == 3);
+
+        // Level 1 only holds the impulse in the texel covering it, level 2 spreads it over 4x4 pixels
+        for (uint32_t level = 1; level < 3; ++level)
+        {
+            uint2 const levelDimensions = ColorPyramidReference::LevelDimensions(dimensions, level);
+            uint2 const covering        = pixel >> level;
+            float const weight          = 1.0F / static_cast<float>(1U << (2 * level));
+            CHECK(levels[level].size() == levelDimensions.x * levelDimensions.y);
+            for (uint32_t y = 0; y < levelDimensions.y; ++y)
+            {
+                for (uint32_t x = 0; x < levelDimensions.x; ++x)
+                {
+                    float const expected = uint2(x, y) == covering ? weight : 0.0F;
+                    CHECK(levels[level][y * levelDimensions.x + x].x == expected);
+                }
+            }
+        }
+    }
+
+    // The bilinear fetch is the same filter as an explicit 2x2 box for even dimensions
+    uint2 const         evenDimensions(16, 6);
+    std::vector<float3> image = CreateImage(evenDimensions);
+    auto const          fetched = ColorPyramidReference::Downsample(image, evenDimensions);
+    auto const          box     = ColorPyramidReference::BoxDownsample(image, evenDimensions);
+    CHECK(fetched.size() == box.size());
+    for (size_t i = 0; i < box.size(); ++i)
+    {
+        CHECK(Near(fetched[i], box[i]));
+    }
+}
+
+void TestAreaAverage()
+{
+    // Both levels match an exact area average of the full resolution image for power of 2 dimensions
+    uint2 const dimensions(32, 16);
+    auto const  image  = CreateImage(dimensions);
+    auto const  levels = ColorPyramidReference::Generate(image, dimensions);
+    for (uint32_t level = 1; level < 3; ++level)
+    {
+        uint2 const levelDimensions = ColorPyramidReference::LevelDimensions(dimensions, level);
+        for (uint32_t y = 0; y < levelDimensions.y; ++y)
+        {
+            for (uint32_t x = 0; x < levelDimensions.x; ++x)
+            {
+                CHECK(Near(levels[level][y * levelDimensions.x + x],
+                    ColorPyramidReference::AreaAverage(image, dimensions, level, uint2(x, y))));
+            }
+        }
+    }
+
+    // Odd dimensions do not split into exact 2x2 quads, the weights must still sum to 1
+    uint2 const               oddDimensions(7, 5);
+    std::vector<float3> const constant(oddDimensions.x * oddDimensions.y, float3(2.0F, 0.5F, 8.0F));
+    for (auto const &level : ColorPyramidReference::Generate(constant, oddDimensions))
+    {
+        for (auto const &texel : level)
+        {
+            CHECK(Near(texel, float3(2.0F, 0.5F, 8.0F)));
+        }
+    }
+}
+} // namespace
+
+int main()
+{
+    TestLevelDimensions();
+    TestFilterWeights();
+    TestAreaAverage();
+    return Test::Result();
+}
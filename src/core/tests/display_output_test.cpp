@@ -0,0 +1,105 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "display_output.h"
+#include "test.h"
+
+using namespace Capsaicin;
+
+namespace
+{
+constexpr uint32_t kFrameCount = 16;
+
+/** An output on a null device, presenting a frame the way CapsaicinInternal::render() does. */
+struct NullOutput
+{
+    GfxNullDevice device;
+    GfxContext    gfx = GfxContext(device);
+    GfxProgram    blit_program;
+    DisplayOutput output;
+
+    NullOutput() noexcept { output.initialise(gfx, blit_program); }
+
+    void renderFrames(uint32_t const frame_count) noexcept
+    {
+        for (uint32_t frame = 0; frame < frame_count; ++frame)
+        {
+            uint2 const dimensions = output.getDimensions();
+            output.present(GfxTexture(dimensions.x, dimensions.y));
+        }
+    }
+};
+
+void TestHeadlessUsesNoSwapChain() noexcept
+{
+    NullOutput headless;
+    headless.output.setOffscreenDimensions(uint2(1280, 720));
+    CHECK(headless.output.getOffscreen());
+    CHECK(headless.output.getDimensions() == uint2(1280, 720));
+
+    headless.renderFrames(kFrameCount);
+    headless.output.release();
+
+    // Nothing may be queried from, or drawn to, the swap chain
+    CHECK(headless.device.back_buffer_queries == 0);
+    CHECK(headless.device.graphics_kernels_created == 0);
+    CHECK(headless.device.draws == 0);
+    CHECK(headless.device.kernels_destroyed == 0);
+}
+
+void TestWindowedPresentsEachFrame() noexcept
+{
+    NullOutput windowed;
+    CHECK(!windowed.output.getOffscreen());
+    CHECK(windowed.output.getDimensions() == uint2(1920, 1080));
+
+    windowed.renderFrames(kFrameCount);
+    CHECK(windowed.device.back_buffer_queries > 0);
+    CHECK(windowed.device.graphics_kernels_created == 1);
+    CHECK(windowed.device.draws == kFrameCount);
+
+    windowed.output.release();
+    CHECK(windowed.device.kernels_destroyed == 1);
+}
+
+void TestInvalidDimensionsRevertToWindow() noexcept
+{
+    NullOutput output;
+    output.output.setOffscreenDimensions(uint2(1280, 720));
+    output.output.setOffscreenDimensions(uint2(0, 720));
+    CHECK(!output.output.getOffscreen());
+    CHECK(output.output.getDimensions() == uint2(1920, 1080));
+
+    // Switching to headless after presenting stops drawing to the back buffer
+    output.renderFrames(1);
+    output.output.setOffscreenDimensions(uint2(640, 480));
+    output.renderFrames(kFrameCount);
+    CHECK(output.device.draws == 1);
+}
+} // namespace
+
+int main()
+{
+    TestHeadlessUsesNoSwapChain();
+    TestWindowedPresentsEachFrame();
+    TestInvalidDimensionsRevertToWindow();
+    return Test::Result();
+}
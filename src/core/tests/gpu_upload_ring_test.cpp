@@ -0,0 +1,186 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "gpu_upload_ring.h"
+#include "test.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** A ring on a null device, advanced one back buffer per frame like gfxFrame() does. */
+struct NullRing
+{
+    GfxNullDevice device;
+    GfxContext    gfx = GfxContext(device);
+    GPUUploadRing ring;
+    uint32_t      frame_index = 0;
+
+    NullRing() noexcept { ring.initialise(gfx); }
+
+    void beginFrame() noexcept
+    {
+        device.back_buffer_index = frame_index++ % kGfxConstant_BackBufferCount;
+        ring.beginFrame();
+    }
+};
+
+/**
+ * Records a frame the way the render techniques use the ring: a few constant buffers and structured
+ * uploads whose sizes vary from frame to frame, each filled with a tag identifying the frame.
+ */
+std::vector<GfxBuffer> RecordFrame(NullRing &ring, uint32_t const frame) noexcept
+{
+    std::vector<GfxBuffer> buffers;
+    for (uint32_t i = 0; i < 4 + frame % 5; ++i)
+    {
+        std::vector<uint32_t> const constants(16 + i, frame);
+        buffers.push_back(ring.ring.allocate(constants.data(), static_cast<uint32_t>(constants.size())));
+    }
+    std::vector<float3> const instances(1000 * (1 + frame % 7), float3(static_cast<float>(frame)));
+    buffers.push_back(ring.ring.allocate(instances.data(), static_cast<uint32_t>(instances.size())));
+    return buffers;
+}
+
+/** Checks every buffer still holds the tag written by the given frame. */
+bool HoldsFrame(GfxContext const &gfx, std::vector<GfxBuffer> const &buffers, uint32_t const frame) noexcept
+{
+    return std::ranges::all_of(buffers, [&](GfxBuffer const &buffer) {
+        void const *data = gfxBufferGetData(gfx, buffer);
+        return buffer.getStride() == sizeof(float3)
+                 ? static_cast<float const *>(data)[0] == static_cast<float>(frame)
+                 : static_cast<uint32_t const *>(data)[0] == frame;
+    });
+}
+
+void TestSteadyStateCreatesNoBuffers()
+{
+    NullRing ring;
+
+    // The workload cycles so the peak usage is only reached after a few frames
+    uint32_t const warm_up_frames = 7 + 2 * kGfxConstant_BackBufferCount;
+    for (uint32_t frame = 0; frame < warm_up_frames; ++frame)
+    {
+        ring.beginFrame();
+        for (GfxBuffer const &buffer : RecordFrame(ring, frame))
+        {
+            gfxDestroyBuffer(ring.gfx, buffer);
+        }
+    }
+    CHECK(ring.device.buffers_created >= kGfxConstant_BackBufferCount);
+
+    uint32_t const buffers_created = ring.device.buffers_created;
+    for (uint32_t frame = warm_up_frames; frame < warm_up_frames + 100; ++frame)
+    {
+        ring.beginFrame();
+        std::vector<GfxBuffer> const buffers = RecordFrame(ring, frame);
+        CHECK(ring.ring.getStatistics().buffers_created == 0);
+        CHECK(ring.ring.getStatistics().allocations == buffers.size());
+        CHECK(ring.ring.getStatistics().bytes_used <= ring.ring.getStatistics().capacity);
+        for (GfxBuffer const &buffer : buffers)
+        {
+            gfxDestroyBuffer(ring.gfx, buffer);
+        }
+    }
+    CHECK(ring.device.buffers_created == buffers_created);
+    CHECK(ring.device.ranges_created > 100);
+
+    // Releasing the ring destroys one pool per back buffer
+    uint32_t const buffers_destroyed = ring.device.buffers_destroyed;
+    ring.ring.clear();
+    CHECK(ring.device.buffers_destroyed == buffers_destroyed + kGfxConstant_BackBufferCount);
+}
+
+void TestFramesInFlightAreNotOverwritten()
+{
+    NullRing ring;
+
+    // Keep the buffers of the frames the GPU may still be reading and check later frames leave them intact
+    std::vector<std::vector<GfxBuffer>> in_flight;
+    for (uint32_t frame = 0; frame < 32; ++frame)
+    {
+        ring.beginFrame();
+        in_flight.push_back(RecordFrame(ring, frame));
+        if (in_flight.size() > kGfxConstant_BackBufferCount)
+        {
+            in_flight.erase(in_flight.begin());
+        }
+        for (size_t i = 0; i < in_flight.size(); ++i)
+        {
+            CHECK(HoldsFrame(ring.gfx, in_flight[i], frame + 1 + i - in_flight.size()));
+        }
+    }
+}
+
+void TestAlignment()
+{
+    NullRing ring;
+    ring.beginFrame();
+
+    // Constant buffers are aligned for constant buffer views, structured buffers also to their stride
+    GfxBuffer const constants = ring.ring.allocate(20);
+    GfxBuffer const elements  = ring.ring.allocate<float3>(5);
+    GfxBuffer const more      = ring.ring.allocate(4, 4);
+    CHECK(constants.getOffset() == 0 && constants.getSize() == 20);
+    CHECK(elements.getOffset() == 768 && elements.getSize() == 5 * sizeof(float3));
+    CHECK(elements.getStride() == sizeof(float3));
+    CHECK(more.getOffset() == 1024);
+    CHECK(ring.ring.getStatistics().bytes_used == 1024 + 4);
+}
+
+void TestGrowWithinFrame()
+{
+    NullRing ring;
+    ring.beginFrame();
+
+    // Outgrowing the pool mid-frame replaces it, earlier allocations keep the old memory alive
+    GfxBuffer const first = ring.ring.allocate<uint32_t>(16);
+    static_cast<uint32_t *>(gfxBufferGetData(ring.gfx, first))[0] = 42;
+    GfxBuffer const large = ring.ring.allocate(1 << 20);
+    CHECK(ring.ring.getStatistics().buffers_created == 2);
+    CHECK(large.getOffset() == 0);
+    CHECK(static_cast<uint32_t const *>(gfxBufferGetData(ring.gfx, first))[0] == 42);
+    CHECK(ring.ring.getStatistics().capacity >= (1 << 20));
+
+    // Every pool then grows to the peak on its next use and is not created again
+    for (uint32_t frame = 0; frame < 2 * kGfxConstant_BackBufferCount; ++frame)
+    {
+        ring.beginFrame();
+        CHECK(ring.ring.getStatistics().capacity >= (1 << 20));
+        gfxDestroyBuffer(ring.gfx, ring.ring.allocate(1 << 20));
+        uint32_t const expected = frame < kGfxConstant_BackBufferCount - 1 ? 1 : 0;
+        CHECK(ring.ring.getStatistics().buffers_created == expected);
+    }
+}
+} // namespace
+
+int main()
+{
+    TestSteadyStateCreatesNoBuffers();
+    TestFramesInFlightAreNotOverwritten();
+    TestAlignment();
+    TestGrowWithinFrame();
+    return Test::Result();
+}
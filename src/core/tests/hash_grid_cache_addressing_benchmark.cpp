@@ -0,0 +1,125 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "gi1/hash_grid_cache_simulator.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace Capsaicin;
+
+namespace
+{
+using Simulator = HashGridCacheSimulator;
+
+/**
+ * Generates a synthetic query stream: a camera flying over a ground plane dotted with boxes, each frame
+ * tracing rays in random directions from the camera and hitting the closest surface.
+ */
+std::vector<std::vector<Simulator::Query>> GenerateQueryStream(
+    uint32_t const frame_count, uint32_t const queries_per_frame) noexcept
+{
+    std::mt19937                          random(0x1234U);
+    std::uniform_real_distribution<float> uniform(-1.0F, 1.0F);
+
+    std::vector<std::vector<Simulator::Query>> frames(frame_count);
+    for (uint32_t frame = 0; frame < frame_count; ++frame)
+    {
+        float const  angle = 0.01F * static_cast<float>(frame);
+        float3 const eye(40.0F * std::cos(angle), 2.0F, 40.0F * std::sin(angle));
+        frames[frame].reserve(queries_per_frame);
+        while (frames[frame].size() < queries_per_frame)
+        {
+            float3 direction(uniform(random), -std::abs(uniform(random)), uniform(random));
+            if (glm::dot(direction, direction) < 1e-4F)
+            {
+                continue;
+            }
+            direction = glm::normalize(direction);
+
+            // Ground plane, with 1m boxes on a 4m grid standing in for more detailed geometry
+            float        hit_distance = -eye.y / direction.y;
+            float3 const ground       = eye + hit_distance * direction;
+            float3 const local        = ground - 4.0F * glm::floor(ground / 4.0F);
+            if (local.x < 1.0F && local.z < 1.0F)
+            {
+                hit_distance = std::max(hit_distance - 1.0F, 0.1F);
+            }
+
+            Simulator::Query &query = frames[frame].emplace_back();
+            query.eye_position      = eye;
+            query.direction         = direction;
+            query.hit_distance      = hit_distance;
+            query.hit_position      = eye + hit_distance * direction;
+            query.radiance          = float3(1.0F);
+        }
+    }
+    return frames;
+}
+} // namespace
+
+/**
+ * Replays a query stream through the linear and cuckoo bucket addressing schemes.
+ * Usage: hash_grid_cache_addressing_benchmark [query stream file]
+ * The stream is loaded from the given file if it exists, otherwise a synthetic stream is generated and
+ * saved to it so that later runs replay the exact same queries.
+ */
+int main(int const argc, char const *const *argv)
+{
+    std::vector<std::vector<Simulator::Query>> frames;
+    if (argc > 1 && Simulator::LoadQueryStream(argv[1], frames))
+    {
+        std::printf("Loaded %zu frames from '%s'\n", frames.size(), argv[1]);
+    }
+    else
+    {
+        frames = GenerateQueryStream(64, 1U << 16);
+        if (argc > 1 && !Simulator::SaveQueryStream(argv[1], frames))
+        {
+            std::fprintf(stderr, "Failed to save query stream to '%s'\n", argv[1]);
+            return 1;
+        }
+    }
+
+    for (uint32_t const num_tiles_per_bucket : {2U, 4U, 6U})
+    {
+        Simulator::Settings settings;
+        settings.num_buckets          = 16 - num_tiles_per_bucket;
+        settings.num_tiles_per_bucket = num_tiles_per_bucket;
+        auto const start              = std::chrono::steady_clock::now();
+        auto const reports            = Simulator::BenchmarkAddressing(settings, frames);
+        auto const end                = std::chrono::steady_clock::now();
+        std::printf("2^%u buckets of 2^%u tiles (%.1f ms):\n", settings.num_buckets, num_tiles_per_bucket,
+            std::chrono::duration<double, std::milli>(end - start).count());
+        for (auto const &report : reports)
+        {
+            std::printf("  %-6s: %.2f%% failed, %.2f average probes (max %u), load %.1f%% at first failure, "
+                        "%.1f%% final\n",
+                report.use_cuckoo_hashing ? "cuckoo" : "linear", 100.0F * report.failure_rate,
+                report.average_probe_length, report.max_probe_length, 100.0F * report.max_load_factor,
+                100.0F * report.final_load_factor);
+        }
+    }
+    return 0;
+}
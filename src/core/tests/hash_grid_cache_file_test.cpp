@@ -0,0 +1,265 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "gi1/hash_grid_cache_file.h"
+#include "test.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** A directory removed once the test completes. */
+struct TempDirectory
+{
+    TempDirectory() noexcept
+    {
+        std::error_code ec;
+        path = std::filesystem::temp_directory_path(ec) / "capsaicin_hash_grid_cache_file_test";
+        std::filesystem::remove_all(path, ec);
+        std::filesystem::create_directories(path, ec);
+    }
+
+    ~TempDirectory() noexcept
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    TempDirectory(TempDirectory const &other)                = delete;
+    TempDirectory(TempDirectory &&other) noexcept            = delete;
+    TempDirectory &operator=(TempDirectory const &other)     = delete;
+    TempDirectory &operator=(TempDirectory &&other) noexcept = delete;
+
+    std::filesystem::path path;
+};
+
+/** Size of the file header, magic to stored tile count. */
+constexpr uint64_t kHeaderSize = 48;
+
+/** Cache buffers as read back from the GPU. */
+struct Buffers
+{
+    std::vector<uint32_t> hashes;
+    std::vector<uint32_t> values;
+    std::vector<uint32_t> indirect_values;
+};
+
+HashGridCacheFile::Layout MakeLayout() noexcept
+{
+    HashGridCacheFile::Layout layout;
+    layout.scene_hash           = 0x0123456789ABCDEFULL;
+    layout.num_buckets          = 8;
+    layout.num_tiles_per_bucket = 4;
+    layout.num_cells_per_tile   = 85; // 8x8 tiles with all their mips
+    layout.flags                = HashGridCacheFile::kFlag_UseMultibounce;
+    layout.cell_size            = 32.0F;
+    layout.min_cell_size        = 0.1F;
+    layout.tile_cell_ratio      = 8;
+    return layout;
+}
+
+/** Fills every third tile with distinct hashes and values, leaving the others free. */
+Buffers MakeBuffers(HashGridCacheFile::Layout const &layout)
+{
+    size_t const num_tiles           = static_cast<size_t>(layout.num_buckets) * layout.num_tiles_per_bucket;
+    size_t const num_values_per_tile = 2 * static_cast<size_t>(layout.num_cells_per_tile);
+    Buffers      buffers;
+    buffers.hashes.assign(num_tiles, 0);
+    buffers.values.assign(num_tiles * num_values_per_tile, 0);
+    buffers.indirect_values.assign(num_tiles * num_values_per_tile, 0);
+    for (size_t tile = 0; tile < num_tiles; tile += 3)
+    {
+        buffers.hashes[tile] = static_cast<uint32_t>(0x1000 + tile);
+        for (size_t value = 0; value < num_values_per_tile; ++value)
+        {
+            size_t const index             = tile * num_values_per_tile + value;
+            buffers.values[index]          = static_cast<uint32_t>(index * 7 + 1);
+            buffers.indirect_values[index] = static_cast<uint32_t>(index * 13 + 5);
+        }
+    }
+    return buffers;
+}
+
+void TestCompactAndExpand()
+{
+    HashGridCacheFile::Layout const layout  = MakeLayout();
+    Buffers const                   buffers = MakeBuffers(layout);
+
+    // Only the allocated tiles are kept, in increasing index order
+    HashGridCacheFile::Contents contents;
+    HashGridCacheFile::Compact(
+        layout, buffers.hashes.data(), buffers.values.data(), buffers.indirect_values.data(), contents);
+    CHECK(contents.layout == layout);
+    CHECK(contents.tile_indices.size() == 11);
+    CHECK(contents.tile_indices.front() == 0 && contents.tile_indices.back() == 30);
+    CHECK(contents.tile_hashes.size() == 11 && contents.tile_hashes[1] == 0x1003);
+    CHECK(contents.values.size() == 11 * 170 && contents.indirect_values.size() == 11 * 170);
+    CHECK(contents.values[170] == buffers.values[3 * 170]);
+    CHECK(HashGridCacheFile::IsValid(contents));
+
+    // Expanding restores the original buffers, free tiles included
+    Buffers expanded;
+    HashGridCacheFile::Expand(contents, expanded.hashes, expanded.values, expanded.indirect_values);
+    CHECK(expanded.hashes == buffers.hashes);
+    CHECK(expanded.values == buffers.values);
+    CHECK(expanded.indirect_values == buffers.indirect_values);
+
+    // Without the multi-bounce radiance the flag is dropped along with the indirect values
+    HashGridCacheFile::Compact(layout, buffers.hashes.data(), buffers.values.data(), nullptr, contents);
+    CHECK((contents.layout.flags & HashGridCacheFile::kFlag_UseMultibounce) == 0);
+    CHECK(contents.indirect_values.empty());
+    CHECK(HashGridCacheFile::IsValid(contents));
+    HashGridCacheFile::Expand(contents, expanded.hashes, expanded.values, expanded.indirect_values);
+    CHECK(expanded.hashes == buffers.hashes);
+    CHECK(expanded.values == buffers.values);
+    CHECK(expanded.indirect_values.empty());
+
+    // An empty cache compacts to no tiles at all
+    std::vector<uint32_t> const free_hashes(buffers.hashes.size(), 0);
+    HashGridCacheFile::Compact(layout, free_hashes.data(), buffers.values.data(), nullptr, contents);
+    CHECK(contents.tile_indices.empty() && contents.values.empty());
+    CHECK(HashGridCacheFile::IsValid(contents));
+}
+
+void TestIsValid()
+{
+    HashGridCacheFile::Layout const layout  = MakeLayout();
+    Buffers const                   buffers = MakeBuffers(layout);
+    HashGridCacheFile::Contents     valid;
+    HashGridCacheFile::Compact(
+        layout, buffers.hashes.data(), buffers.values.data(), buffers.indirect_values.data(), valid);
+    CHECK(HashGridCacheFile::IsValid(valid));
+
+    HashGridCacheFile::Contents contents = valid;
+    contents.layout.num_buckets          = 0;
+    CHECK(!HashGridCacheFile::IsValid(contents));
+
+    contents                           = valid;
+    contents.layout.num_cells_per_tile = 0;
+    CHECK(!HashGridCacheFile::IsValid(contents));
+
+    contents                 = valid;
+    contents.tile_indices[2] = contents.tile_indices[1];
+    CHECK(!HashGridCacheFile::IsValid(contents)); // tiles must be strictly increasing
+
+    contents                  = valid;
+    contents.tile_indices[10] = 32;
+    CHECK(!HashGridCacheFile::IsValid(contents)); // out of range tile
+
+    contents                = valid;
+    contents.tile_hashes[4] = 0;
+    CHECK(!HashGridCacheFile::IsValid(contents)); // free tiles are never stored
+
+    contents = valid;
+    contents.tile_hashes.pop_back();
+    CHECK(!HashGridCacheFile::IsValid(contents));
+
+    contents = valid;
+    contents.values.pop_back();
+    CHECK(!HashGridCacheFile::IsValid(contents));
+
+    contents = valid;
+    contents.indirect_values.clear();
+    CHECK(!HashGridCacheFile::IsValid(contents)); // the multi-bounce flag requires indirect values
+    contents.layout.flags = 0;
+    CHECK(HashGridCacheFile::IsValid(contents));
+}
+
+void TestSaveAndLoad(std::filesystem::path const &directory)
+{
+    HashGridCacheFile::Layout const layout  = MakeLayout();
+    Buffers const                   buffers = MakeBuffers(layout);
+    HashGridCacheFile::Contents     contents;
+    HashGridCacheFile::Compact(
+        layout, buffers.hashes.data(), buffers.values.data(), buffers.indirect_values.data(), contents);
+
+    std::filesystem::path const file_path = directory / "cache.bin";
+    CHECK(HashGridCacheFile::Save(file_path, contents));
+    CHECK(std::filesystem::file_size(file_path) == kHeaderSize + (2 * 11 + 2 * 11 * 170) * sizeof(uint32_t));
+
+    HashGridCacheFile::Contents read;
+    CHECK(HashGridCacheFile::Load(file_path, read));
+    CHECK(read.layout == contents.layout);
+    CHECK(read.tile_indices == contents.tile_indices);
+    CHECK(read.tile_hashes == contents.tile_hashes);
+    CHECK(read.values == contents.values);
+    CHECK(read.indirect_values == contents.indirect_values);
+
+    // Invalid contents are never written
+    HashGridCacheFile::Contents invalid = contents;
+    invalid.tile_hashes[0]              = 0;
+    CHECK(!HashGridCacheFile::Save(directory / "invalid.bin", invalid));
+    CHECK(!std::filesystem::exists(directory / "invalid.bin"));
+
+    // Missing, truncated, extended and corrupt files are all rejected and leave the contents empty
+    CHECK(!HashGridCacheFile::Load(directory / "missing.bin", read));
+    CHECK(read.tile_indices.empty() && read.values.empty());
+
+    auto const patch_file = [&](std::filesystem::path const &path, std::streamoff const offset,
+                                uint32_t const value) {
+        std::filesystem::copy_file(file_path, path, std::filesystem::copy_options::overwrite_existing);
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    };
+    std::filesystem::path const patched_path = directory / "patched.bin";
+    patch_file(patched_path, 0, 0xDEADBEEFU);
+    CHECK(!HashGridCacheFile::Load(patched_path, read)); // magic
+    patch_file(patched_path, 4, HashGridCacheFile::kVersion + 1);
+    CHECK(!HashGridCacheFile::Load(patched_path, read)); // version
+    patch_file(patched_path, kHeaderSize - 4, 0xFFFFFFFFU);
+    CHECK(!HashGridCacheFile::Load(patched_path, read)); // stored tile count larger than the cache
+    patch_file(patched_path, kHeaderSize - 4, 10);
+    CHECK(!HashGridCacheFile::Load(patched_path, read)); // stored tile count not matching the length
+    patch_file(patched_path, kHeaderSize + 4, 0);
+    CHECK(!HashGridCacheFile::Load(patched_path, read)); // tile indices out of order
+    CHECK(read.tile_indices.empty() && read.values.empty());
+
+    std::filesystem::copy_file(file_path, patched_path, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::resize_file(patched_path, std::filesystem::file_size(file_path) - 1);
+    CHECK(!HashGridCacheFile::Load(patched_path, read));
+    std::filesystem::resize_file(patched_path, std::filesystem::file_size(file_path) + 4);
+    CHECK(!HashGridCacheFile::Load(patched_path, read));
+    std::filesystem::resize_file(patched_path, 20);
+    CHECK(!HashGridCacheFile::Load(patched_path, read));
+
+    // The loaded contents expand back into the original buffers
+    CHECK(HashGridCacheFile::Load(file_path, read));
+    Buffers expanded;
+    HashGridCacheFile::Expand(read, expanded.hashes, expanded.values, expanded.indirect_values);
+    CHECK(expanded.hashes == buffers.hashes);
+    CHECK(expanded.values == buffers.values);
+    CHECK(expanded.indirect_values == buffers.indirect_values);
+}
+} // namespace
+
+int main()
+{
+    TempDirectory const directory;
+    TestCompactAndExpand();
+    TestIsValid();
+    TestSaveAndLoad(directory.path);
+    return Test::Result();
+}
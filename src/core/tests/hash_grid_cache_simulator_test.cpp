@@ -0,0 +1,378 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "gi1/hash_grid_cache_simulator.h"
+#include "test.h"
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace Capsaicin;
+
+namespace
+{
+using Simulator = HashGridCacheSimulator;
+
+/** Settings giving half metre tiles for hits 10 units away from the eye. */
+Simulator::Settings SmallTileSettings() noexcept
+{
+    Simulator::Settings settings;
+    settings.cell_size = 0.001F;
+    return settings;
+}
+
+/** Creates a query facing down -z for a hit at the given position, the eye sits at the origin. */
+Simulator::Query MakeQuery(float3 const &hit_position, float3 const &radiance = float3(0.0F)) noexcept
+{
+    Simulator::Query query;
+    query.eye_position = float3(0.0F);
+    query.hit_position = hit_position;
+    query.direction    = float3(0.0F, 0.0F, -1.0F);
+    query.hit_distance = glm::length(hit_position);
+    query.radiance     = radiance;
+    return query;
+}
+
+std::string ReadShader(char const *file_path)
+{
+    std::ifstream const file(file_path);
+    CHECK(file.good());
+    std::stringstream source;
+    source << file.rdbuf();
+    return source.str();
+}
+
+void TestHashFunctions()
+{
+    // Expected values evaluated from the formulas in 'math/hash.hlsl'
+    CHECK(Simulator::PcgHash(0x0U) == 0x07BB2FE2U);
+    CHECK(Simulator::PcgHash(0x1U) == 0xA8BEEA3CU);
+    CHECK(Simulator::PcgHash(12345U) == 0xF45EAD0EU);
+    CHECK(Simulator::PcgHash(0xFFFFFFFFU) == 0xE62A4902U);
+    CHECK(Simulator::XxHash(0x0U) == 0x34560F83U);
+    CHECK(Simulator::XxHash(0x1U) == 0x9485C89BU);
+    CHECK(Simulator::XxHash(12345U) == 0x420EAC6AU);
+    CHECK(Simulator::XxHash(0xFFFFFFFFU) == 0x3A2692A7U);
+}
+
+void TestShaderIsInSync()
+{
+    // The simulator duplicates the shader constants, make sure they still match
+    std::string const cache = ReadShader(CAPSAICIN_SOURCE_DIR "/render_techniques/gi1/hash_grid_cache.hlsl");
+    CHECK(cache.find("#define kHashGridCache_TileDecay     " + std::to_string(Simulator::kTileDecay))
+          != std::string::npos);
+    CHECK(Simulator::kFloatQuantize == 1e3F);
+    CHECK(cache.find("#define kHashGridCache_FloatQuantize 1e3f") != std::string::npos);
+    CHECK(cache.find("#define HASHGRIDCACHE_STEP_FACTOR 1e3f") != std::string::npos);
+    CHECK(cache.find("#define HASHGRIDCACHE_SIZE_FACTOR 1e-3f") != std::string::npos);
+    CHECK(cache.find("bucket_index ^ (pcgHash(tile_hash) & (g_HashGridCacheConstants.num_buckets - 1))")
+          != std::string::npos);
+
+    std::string const hash = ReadShader(CAPSAICIN_SOURCE_DIR "/math/hash.hlsl");
+    CHECK(hash.find("uint state = value * 747796405u + 2891336453u;") != std::string::npos);
+    CHECK(hash.find("277803737u") != std::string::npos);
+    CHECK(hash.find("prime32_4 = 668265263u,  prime32_5 = 374761393u;") != std::string::npos);
+}
+
+void TestAddressing()
+{
+    Simulator::Settings settings = SmallTileSettings();
+    Simulator           simulator;
+    CHECK(simulator.initialise(settings));
+    CHECK(simulator.getNumBuckets() == 1U << settings.num_buckets);
+    CHECK(simulator.getNumTiles() == (1U << settings.num_buckets) * (1U << settings.num_tiles_per_bucket));
+
+    // 8x8 tiles hold 64 + 16 + 4 + 1 cells laid out mip after mip
+    CHECK(simulator.getNumCells() == simulator.getNumTiles() * 85);
+    CHECK(simulator.cellIndex(uint2(0, 0), 0, 0) == 0);
+    CHECK(simulator.cellIndex(uint2(7, 7), 0, 0) == 63);
+    CHECK(simulator.cellIndex(uint2(0, 0), 0, 1) == 64);
+    CHECK(simulator.cellIndex(uint2(7, 7), 0, 1) == 79);
+    CHECK(simulator.cellIndex(uint2(0, 0), 0, 2) == 80);
+    CHECK(simulator.cellIndex(uint2(7, 7), 0, 3) == 84);
+    CHECK(simulator.cellIndex(uint2(3, 5), 2, 0) == 2 * 85 + 3 + 5 * 8);
+
+    // Reproduce the nested hash calls of 'HashGridCache_GetDesc' literally
+    Simulator::Query const query = MakeQuery(float3(1.3F, -2.7F, 10.0F));
+    float const            step  = std::floor(std::log2(1e3F * std::max(10.0F * settings.cell_size, 0.1F)));
+    float const            tile  = 1e-3F * std::exp2(step) * 8.0F;
+    uint3 const            c     = uint3(int3(glm::floor(query.hit_position / tile)));
+    uint3 const            d     = uint3(int3(glm::floor(0.5F + (0.5F * query.direction + 0.5F) * 4.0F)));
+    auto const             l     = static_cast<uint32_t>(step);
+    uint32_t const         t     = query.hit_distance < tile ? 1U : 0U;
+    auto const             pcg   = &Simulator::PcgHash;
+    auto const             xx    = &Simulator::XxHash;
+    uint32_t const         bucket_index =
+        pcg(l + pcg(c.x + pcg(c.y + pcg(c.z + pcg(d.x + pcg(d.y + pcg(d.z + pcg(t))))))))
+        % simulator.getNumBuckets();
+    uint32_t const tile_hash =
+        std::max(1U, xx(l + xx(c.x + xx(c.y + xx(c.z + xx(d.x + xx(d.y + xx(d.z + xx(t)))))))));
+
+    Simulator::Desc const desc = simulator.getDesc(query);
+    CHECK(desc.bucket_index == bucket_index);
+    CHECK(desc.tile_hash == tile_hash);
+    CHECK(desc.tile_hash != 0);
+    CHECK(desc.cell_offset.x < settings.tile_cell_ratio && desc.cell_offset.y < settings.tile_cell_ratio);
+
+    // Facing down z the cell offset is the position of the hit within its tile along x and y
+    float3 const cell =
+        glm::floor(query.hit_position / (tile / 8.0F)) - glm::floor(query.hit_position / tile) * 8.0F;
+    CHECK(desc.cell_offset.x == static_cast<uint32_t>(cell.x));
+    CHECK(desc.cell_offset.y == static_cast<uint32_t>(cell.y));
+
+    // The alternate bucket can be recovered from either bucket using the tile hash only
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        auto const            x     = static_cast<float>(i);
+        Simulator::Desc const other = simulator.getDesc(MakeQuery(float3(x - 128.0F, 0.5F * x, 10.0F)));
+        uint32_t const mask = simulator.getNumBuckets() - 1;
+        CHECK(other.bucket_index < simulator.getNumBuckets());
+        CHECK(other.bucket_index_alt < simulator.getNumBuckets());
+        CHECK(other.bucket_index_alt == (other.bucket_index ^ (Simulator::PcgHash(other.tile_hash) & mask)));
+        CHECK((other.bucket_index_alt ^ (Simulator::PcgHash(other.tile_hash) & mask)) == other.bucket_index);
+    }
+}
+
+void TestInsertAndFind()
+{
+    Simulator simulator;
+    CHECK(simulator.initialise(SmallTileSettings()));
+
+    Simulator::Query const lit     = MakeQuery(float3(0.1F, 0.1F, 10.0F), float3(0.5F, 0.25F, 2.0F));
+    Simulator::Query const missing = MakeQuery(float3(5.1F, 5.1F, 10.0F));
+    uint32_t               tile_index;
+    CHECK(simulator.findCell(lit, tile_index) == Simulator::kInvalidId);
+
+    simulator.simulateFrame(0, {lit});
+    CHECK(simulator.getStatistics().num_queries == 1);
+    CHECK(simulator.getStatistics().num_inserted == 1);
+    CHECK(simulator.getStatistics().num_new_tiles == 1);
+    CHECK(simulator.getStatistics().num_packed_tiles == 1);
+
+    uint32_t const cell_index = simulator.findCell(lit, tile_index);
+    CHECK(cell_index != Simulator::kInvalidId);
+    uint32_t const num_tiles_per_bucket = simulator.getNumTilesPerBucket();
+    CHECK(tile_index / num_tiles_per_bucket == simulator.getDesc(lit).bucket_index);
+    CHECK(simulator.getHashBuffer()[tile_index] == simulator.getDesc(lit).tile_hash);
+    CHECK(simulator.findCell(missing, tile_index) == Simulator::kInvalidId);
+
+    // Radiance is stored pre-multiplied by the sample count, these values are exact in half precision
+    CHECK(simulator.getCellRadiance(cell_index) == float4(0.5F, 0.25F, 2.0F, 1.0F));
+
+    // Two more samples in the next frame are averaged, then blended with the history by 1 / sample count
+    Simulator::Query const brighter = MakeQuery(lit.hit_position, float3(1.5F, 0.25F, 4.0F));
+    simulator.simulateFrame(1, {brighter, brighter});
+    CHECK(simulator.getStatistics().num_new_tiles == 0);
+    CHECK(simulator.getStatistics().num_updated_tiles == 1);
+    CHECK(simulator.findCell(lit, tile_index) == cell_index);
+    float4 const radiance = simulator.getCellRadiance(cell_index);
+    CHECK(radiance.w == 3.0F);
+    CHECK(std::abs(radiance.x / radiance.w - (0.5F + (1.5F - 0.5F) / 3.0F)) < 1e-2F);
+    CHECK(std::abs(radiance.y / radiance.w - 0.25F) < 1e-2F);
+    CHECK(std::abs(radiance.z / radiance.w - (2.0F + (4.0F - 2.0F) / 3.0F)) < 1e-2F);
+
+    // Coarser mips hold the sum of the cells below them
+    float4 const mip3 = simulator.getCellRadiance(simulator.cellIndex(uint2(0, 0), tile_index, 3));
+    CHECK(std::abs(mip3.w - radiance.w) < 1e-3F);
+
+    // Quantization is exact to 1/kFloatQuantize
+    uint4 const quantized = Simulator::QuantizeRadiance(float3(0.0004F, 0.0005F, 12.3456F));
+    CHECK(quantized == uint4(0, 1, 12346, 1));
+    CHECK(Simulator::RecoverRadiance(quantized) == float4(0.0F, 0.001F, 12.346F, 1.0F));
+}
+
+void TestDecay(uint32_t const first_frame)
+{
+    Simulator simulator;
+    CHECK(simulator.initialise(SmallTileSettings()));
+
+    Simulator::Query const query = MakeQuery(float3(0.1F, 0.1F, 10.0F), float3(1.0F));
+    uint32_t               frame = first_frame;
+    simulator.simulateFrame(frame, {query});
+
+    // Untouched tiles survive kTileDecay - 1 frames...
+    for (uint32_t i = 1; i < Simulator::kTileDecay; ++i)
+    {
+        simulator.simulateFrame(++frame, {});
+        CHECK(simulator.getStatistics().num_evicted_tiles == 0);
+    }
+    uint32_t tile_index;
+    CHECK(simulator.findCell(query, tile_index) != Simulator::kInvalidId);
+    CHECK(simulator.getDecayTileBuffer()[tile_index] == first_frame);
+
+    // ...and are freed on the next one
+    simulator.simulateFrame(++frame, {});
+    CHECK(simulator.getStatistics().num_evicted_tiles == 1);
+    CHECK(simulator.getStatistics().num_packed_tiles == 0);
+    CHECK(simulator.findCell(query, tile_index) == Simulator::kInvalidId);
+
+    // Touching a tile resets its decay
+    simulator.simulateFrame(++frame, {query});
+    CHECK(simulator.getStatistics().num_new_tiles == 1);
+    std::vector<Simulator::Query> const no_queries;
+    for (uint32_t i = 1; i < Simulator::kTileDecay; ++i)
+    {
+        simulator.simulateFrame(++frame, i == Simulator::kTileDecay / 2 ? std::vector {query} : no_queries);
+        CHECK(simulator.getStatistics().num_new_tiles == 0);
+    }
+    simulator.simulateFrame(++frame, {});
+    CHECK(simulator.getStatistics().num_evicted_tiles == 0);
+    CHECK(simulator.findCell(query, tile_index) != Simulator::kInvalidId);
+}
+
+/** Counts the tiles holding the given hash. */
+uint32_t CountTiles(Simulator const &simulator, uint32_t const tile_hash)
+{
+    uint32_t count = 0;
+    for (uint32_t const hash : simulator.getHashBuffer())
+    {
+        count += hash == tile_hash ? 1 : 0;
+    }
+    return count;
+}
+
+void TestCuckooAlternateBucket()
+{
+    // Single tile buckets, so any second tile mapping to a bucket has to move to its alternate bucket
+    Simulator::Settings settings  = SmallTileSettings();
+    settings.num_buckets          = 4;
+    settings.num_tiles_per_bucket = 0;
+    settings.use_cuckoo_hashing   = true;
+    Simulator simulator;
+    CHECK(simulator.initialise(settings));
+
+    // Find two tiles sharing a primary bucket, the second one having a distinct alternate bucket
+    Simulator::Query const first      = MakeQuery(float3(0.1F, 0.1F, 10.0F));
+    Simulator::Desc const  first_desc = simulator.getDesc(first);
+    Simulator::Query       second     = first;
+    for (uint32_t i = 1; i < 1024; ++i)
+    {
+        second                     = MakeQuery(float3(static_cast<float>(i) + 0.1F, 0.1F, 10.0F));
+        Simulator::Desc const desc = simulator.getDesc(second);
+        if (desc.bucket_index == first_desc.bucket_index && desc.bucket_index_alt != desc.bucket_index
+            && desc.tile_hash != first_desc.tile_hash)
+        {
+            break;
+        }
+    }
+    Simulator::Desc const second_desc = simulator.getDesc(second);
+    CHECK(second_desc.bucket_index == first_desc.bucket_index);
+    CHECK(second_desc.bucket_index_alt != second_desc.bucket_index);
+
+    // The primary bucket is filled first, the alternate bucket takes the overflow
+    uint32_t tile_index;
+    simulator.simulateFrame(0, {first, second});
+    CHECK(simulator.getStatistics().num_new_tiles == 2);
+    CHECK(simulator.getStatistics().num_overflows == 0);
+    CHECK(simulator.findCell(first, tile_index) != Simulator::kInvalidId);
+    CHECK(tile_index == first_desc.bucket_index);
+    CHECK(simulator.findCell(second, tile_index) != Simulator::kInvalidId);
+    CHECK(tile_index == second_desc.bucket_index_alt);
+
+    // Linear addressing has nowhere to put the second tile
+    settings.use_cuckoo_hashing = false;
+    CHECK(simulator.initialise(settings));
+    simulator.simulateFrame(0, {first, second});
+    CHECK(simulator.getStatistics().num_new_tiles == 1);
+    CHECK(simulator.getStatistics().num_overflows == 1);
+
+    // Once the primary bucket frees up, the tile in the alternate bucket is found rather than duplicated
+    settings.use_cuckoo_hashing = true;
+    CHECK(simulator.initialise(settings));
+    uint32_t frame = 0;
+    simulator.simulateFrame(frame, {first, second});
+    while (frame < Simulator::kTileDecay)
+    {
+        simulator.simulateFrame(++frame, {second});
+    }
+    CHECK(simulator.findCell(first, tile_index) == Simulator::kInvalidId);
+    CHECK(simulator.getHashBuffer()[first_desc.bucket_index] == 0);
+    simulator.simulateFrame(++frame, {second});
+    CHECK(simulator.getStatistics().num_new_tiles == 0);
+    CHECK(CountTiles(simulator, second_desc.tile_hash) == 1);
+    CHECK(simulator.findCell(second, tile_index) != Simulator::kInvalidId);
+    CHECK(tile_index == second_desc.bucket_index_alt);
+}
+
+void TestNoDuplicateTilesAfterEviction()
+{
+    // A single bucket, so every tile shares the same candidate tiles
+    Simulator::Settings settings  = SmallTileSettings();
+    settings.num_buckets          = 0;
+    settings.num_tiles_per_bucket = 2;
+    Simulator simulator;
+    CHECK(simulator.initialise(settings));
+
+    Simulator::Query const stale = MakeQuery(float3(0.1F, 0.1F, 10.0F), float3(1.0F));
+    Simulator::Query const live  = MakeQuery(float3(2.1F, 0.1F, 10.0F), float3(1.0F));
+    Simulator::Query const other = MakeQuery(float3(4.1F, 0.1F, 10.0F), float3(1.0F));
+    uint32_t               frame = 0;
+    simulator.simulateFrame(frame, {stale, live});
+    uint32_t live_tile;
+    CHECK(simulator.findCell(live, live_tile) != Simulator::kInvalidId);
+    CHECK(live_tile == 1);
+
+    // Evicting the first tile leaves a free tile in front of the live one
+    while (frame < Simulator::kTileDecay)
+    {
+        simulator.simulateFrame(++frame, {live});
+    }
+    CHECK(simulator.getHashBuffer()[0] == 0);
+
+    // The live tile keeps being found, and the free tile goes to the next new tile
+    simulator.simulateFrame(++frame, {live, other});
+    CHECK(simulator.getStatistics().num_new_tiles == 1);
+    CHECK(CountTiles(simulator, simulator.getDesc(live).tile_hash) == 1);
+    uint32_t tile_index;
+    CHECK(simulator.findCell(live, tile_index) != Simulator::kInvalidId);
+    CHECK(tile_index == live_tile);
+    CHECK(simulator.findCell(other, tile_index) != Simulator::kInvalidId);
+    CHECK(tile_index == 0);
+}
+
+void TestShaderProbesAllCandidates()
+{
+    // The shader must not stop probing at the first free tile either
+    std::string const cache = ReadShader(CAPSAICIN_SOURCE_DIR "/render_techniques/gi1/hash_grid_cache.hlsl");
+    size_t const      find   = cache.find("uint HashGridCache_FindCell(in HashGridCache_Desc desc");
+    size_t const      insert = cache.find("uint HashGridCache_InsertCell(");
+    CHECK(find != std::string::npos && insert != std::string::npos && find < insert);
+    CHECK(cache.find("HashGridCache_FindCell(desc, tile_index)", insert) != std::string::npos);
+    CHECK(cache.substr(find, insert - find).find("== 0") == std::string::npos);
+}
+} // namespace
+
+int main()
+{
+    TestHashFunctions();
+    TestShaderIsInSync();
+    TestAddressing();
+    TestInsertAndFind();
+    TestDecay(0);
+    TestDecay(0xFFFFFFFFU - Simulator::kTileDecay / 2); // decay across the frame index wraparound
+    TestCuckooAlternateBucket();
+    TestNoDuplicateTilesAfterEviction();
+    TestShaderProbesAllCandidates();
+    return Test::Result();
+}
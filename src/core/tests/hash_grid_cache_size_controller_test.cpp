@@ -0,0 +1,230 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "gi1/hash_grid_cache_size_controller.h"
+#include "test.h"
+
+#include <cmath>
+
+using namespace Capsaicin;
+
+namespace
+{
+using Controller = HashGridCacheSizeController;
+
+/**
+ * Builds a synthetic statistics sample as read back from the 'BuildBucketStatistics' pass.
+ * @param num_buckets          Log2 of the number of buckets the sample was captured at.
+ * @param num_tiles_per_bucket Log2 of the number of tiles per bucket the sample was captured at.
+ * @param occupancy            Ratio of allocated tiles, placed into completely filled buckets.
+ * @param overflow_ratio       Ratio of buckets that failed an insertion.
+ */
+Controller::Statistics MakeSample(uint32_t const num_buckets, uint32_t const num_tiles_per_bucket,
+    float const occupancy, float const overflow_ratio = 0.0F)
+{
+    auto const     bucket_count = static_cast<float>(1U << num_buckets);
+    uint32_t const bucket_size  = 1U << num_tiles_per_bucket;
+    float const    full_buckets = std::round(occupancy * bucket_count);
+
+    Controller::Statistics statistics;
+    statistics.num_buckets          = num_buckets;
+    statistics.num_tiles_per_bucket = num_tiles_per_bucket;
+    statistics.bucket_occupancy.assign(bucket_size + 1, 0.0F);
+    statistics.bucket_occupancy[0]           = bucket_count - full_buckets;
+    statistics.bucket_occupancy[bucket_size] = full_buckets;
+    statistics.free_bucket_count             = statistics.bucket_occupancy[0];
+    statistics.used_bucket_count             = full_buckets;
+    statistics.bucket_overflow.assign(65, 0.0F);
+    statistics.bucket_overflow[1] = std::round(overflow_ratio * bucket_count);
+    statistics.bucket_overflow[0] = bucket_count - statistics.bucket_overflow[1];
+    return statistics;
+}
+
+/** Feeds the same sample several times, returning the number of resize decisions. */
+uint32_t Feed(Controller &controller, Controller::Statistics const &statistics, uint32_t const count)
+{
+    uint32_t resize_count = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        resize_count += controller.update(statistics).resize ? 1 : 0;
+    }
+    return resize_count;
+}
+
+void TestMetrics()
+{
+    Controller::Statistics const statistics = MakeSample(10, 4, 0.25F, 0.125F);
+    CHECK(std::abs(Controller::CalculateOccupancy(statistics) - 0.25F) < 1e-6F);
+    CHECK(std::abs(Controller::CalculateOverflowRatio(statistics) - 0.125F) < 1e-6F);
+    CHECK(Controller::CalculateOccupancy(MakeSample(10, 4, 0.0F)) == 0.0F);
+}
+
+void TestGrow()
+{
+    Controller controller;
+    controller.setSettings({});
+    Controller::Settings const &settings = controller.getSettings();
+
+    // A full cache adds buckets once enough consecutive samples agree
+    Controller::Statistics const full = MakeSample(12, 4, 0.9F);
+    CHECK(Feed(controller, full, settings.grow_sample_count - 1) == 0);
+    Controller::Decision decision = controller.update(full);
+    CHECK(decision.resize);
+    CHECK(decision.num_buckets == 13 && decision.num_tiles_per_bucket == 4);
+    CHECK(std::abs(controller.getOccupancy() - 0.9F) < 1e-3F);
+
+    // Overflowing while mostly empty means clustered tiles, so the buckets get deeper instead
+    controller.reset();
+    Controller::Statistics const clustered = MakeSample(12, 4, 0.1F, 0.05F);
+    CHECK(Feed(controller, clustered, settings.grow_sample_count - 1) == 0);
+    decision = controller.update(clustered);
+    CHECK(decision.resize);
+    CHECK(decision.num_buckets == 12 && decision.num_tiles_per_bucket == 5);
+
+    // Once the buckets cannot get deeper, clustered tiles fall back to adding buckets
+    controller.reset();
+    Controller::Statistics const deepest = MakeSample(12, settings.max_num_tiles_per_bucket, 0.1F, 0.05F);
+    CHECK(Feed(controller, deepest, settings.grow_sample_count - 1) == 0);
+    decision = controller.update(deepest);
+    CHECK(decision.resize);
+    CHECK(decision.num_buckets == 13 && decision.num_tiles_per_bucket == settings.max_num_tiles_per_bucket);
+
+    // Nothing happens at the largest size
+    controller.reset();
+    CHECK(Feed(controller,
+              MakeSample(settings.max_num_buckets, settings.max_num_tiles_per_bucket, 0.9F, 0.5F), 16)
+          == 0);
+}
+
+void TestShrink()
+{
+    Controller controller;
+    controller.setSettings({});
+    Controller::Settings const &settings = controller.getSettings();
+
+    // A mostly empty cache removes buckets first...
+    Controller::Statistics const empty = MakeSample(12, 4, 0.05F);
+    CHECK(Feed(controller, empty, settings.shrink_sample_count - 1) == 0);
+    Controller::Decision decision = controller.update(empty);
+    CHECK(decision.resize);
+    CHECK(decision.num_buckets == 11 && decision.num_tiles_per_bucket == 4);
+
+    // ...then bucket depth once at the smallest bucket count
+    controller.reset();
+    Controller::Statistics const narrowest = MakeSample(settings.min_num_buckets, 4, 0.05F);
+    CHECK(Feed(controller, narrowest, settings.shrink_sample_count - 1) == 0);
+    decision = controller.update(narrowest);
+    CHECK(decision.resize);
+    CHECK(decision.num_buckets == settings.min_num_buckets && decision.num_tiles_per_bucket == 3);
+
+    // Nothing happens at the smallest size
+    controller.reset();
+    CHECK(Feed(controller, MakeSample(settings.min_num_buckets, settings.min_num_tiles_per_bucket, 0.0F), 32)
+          == 0);
+
+    // Any overflow prevents shrinking
+    controller.reset();
+    CHECK(Feed(controller, MakeSample(12, 4, 0.05F, 0.005F), 32) == 0);
+}
+
+void TestHysteresis()
+{
+    Controller controller;
+    controller.setSettings({});
+    Controller::Settings const &settings = controller.getSettings();
+
+    // Occupancy between the shrink and grow thresholds keeps the current size
+    CHECK(Feed(controller, MakeSample(12, 4, 0.5F), 64) == 0);
+
+    // Transient spikes, shorter than the required streaks, never resize
+    Controller::Statistics const full   = MakeSample(12, 4, 0.9F);
+    Controller::Statistics const empty  = MakeSample(12, 4, 0.05F);
+    Controller::Statistics const steady = MakeSample(12, 4, 0.5F);
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        CHECK(Feed(controller, full, settings.grow_sample_count - 1) == 0);
+        CHECK(Feed(controller, steady, 1) == 0);
+        CHECK(Feed(controller, empty, settings.shrink_sample_count - 1) == 0);
+        CHECK(Feed(controller, steady, 1) == 0);
+    }
+
+    // A grow sample also breaks a shrink streak
+    CHECK(Feed(controller, empty, settings.shrink_sample_count - 1) == 0);
+    CHECK(Feed(controller, full, 1) == 0);
+    CHECK(Feed(controller, empty, settings.shrink_sample_count - 1) == 0);
+    CHECK(Feed(controller, empty, 1) == 1);
+
+    // Shrinking doubles occupancy, which must land below the grow threshold
+    CHECK(2.0F * settings.shrink_occupancy < settings.grow_occupancy);
+}
+
+void TestCooldown()
+{
+    Controller controller;
+    controller.setSettings({});
+    Controller::Settings const &settings = controller.getSettings();
+
+    Controller::Statistics const full = MakeSample(12, 4, 0.9F);
+    CHECK(Feed(controller, full, settings.grow_sample_count) == 1);
+
+    // Samples in flight from before the resize are ignored, and do not count towards the next decision
+    CHECK(Feed(controller, full, settings.cooldown_sample_count) == 0);
+    CHECK(std::abs(controller.getOccupancy() - 0.9F) < 1e-3F);
+    Controller::Statistics const grown = MakeSample(13, 4, 0.95F);
+    CHECK(Feed(controller, grown, settings.grow_sample_count - 1) == 0);
+    Controller::Decision const decision = controller.update(grown);
+    CHECK(decision.resize && decision.num_buckets == 14);
+    CHECK(std::abs(controller.getOccupancy() - 0.95F) < 1e-3F);
+
+    // Resetting clears the cooldown
+    CHECK(Feed(controller, MakeSample(14, 4, 0.9F), settings.cooldown_sample_count) == 0);
+    controller.reset();
+    CHECK(Feed(controller, MakeSample(14, 4, 0.9F), settings.grow_sample_count) == 1);
+}
+
+void TestMislabelledSamples()
+{
+    Controller controller;
+    controller.setSettings({});
+    Controller::Settings const &settings = controller.getSettings();
+
+    // A sample labelled with a size other than the one it was captured at is discarded
+    Controller::Statistics wrong_buckets = MakeSample(12, 4, 0.9F);
+    wrong_buckets.num_buckets            = 13;
+    Controller::Statistics wrong_tiles   = MakeSample(12, 4, 0.9F);
+    wrong_tiles.num_tiles_per_bucket     = 5;
+    CHECK(Feed(controller, wrong_buckets, 2 * settings.grow_sample_count) == 0);
+    CHECK(Feed(controller, wrong_tiles, 2 * settings.grow_sample_count) == 0);
+    CHECK(controller.getOccupancy() == 0.0F);
+}
+} // namespace
+
+int main()
+{
+    TestMetrics();
+    TestGrow();
+    TestShrink();
+    TestHysteresis();
+    TestCooldown();
+    TestMislabelledSamples();
+    return Test::Result();
+}
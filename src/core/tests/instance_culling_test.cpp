@@ -0,0 +1,102 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "capsaicin/frustum.h"
+#include "test.h"
+
+#include <cmath>
+#include <utility>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** Builds the view projection of a camera at (0, 0, 5) looking down -z, with a 90 degree field of view. */
+float4x4 CalculateViewProjection(float near_z, float far_z, bool const reversed_depth) noexcept
+{
+    // Right handed with a [0, 1] depth range, the renderer's camera matrices use reversed depth
+    if (reversed_depth)
+    {
+        std::swap(near_z, far_z);
+    }
+    float4x4 projection(0.0F);
+    projection[0][0] = 1.0F;
+    projection[1][1] = 1.0F;
+    projection[2][2] = far_z / (near_z - far_z);
+    projection[2][3] = -1.0F;
+    projection[3][2] = -(far_z * near_z) / (far_z - near_z);
+
+    float4x4 view(1.0F);
+    view[3][2] = -5.0F;
+    return projection * view;
+}
+
+void TestFrustumPlanes(bool const reversed_depth)
+{
+    float4 frustum[6];
+    CalculateFrustumPlanes(CalculateViewProjection(0.1F, 100.0F, reversed_depth), frustum);
+
+    for (auto const &plane : frustum)
+    {
+        CHECK(std::abs(length(float3(plane)) - 1.0F) < 1e-5F);
+        CHECK(dot(float3(0.0F, 0.0F, -10.0F), float3(plane)) + plane.w > 0.0F); // normals point inside
+    }
+
+    // The near and far planes lie at the expected distances from the camera, reversed depth swaps them
+    float4 const &near_plane = frustum[reversed_depth ? 5 : 4];
+    float4 const &far_plane  = frustum[reversed_depth ? 4 : 5];
+    CHECK(std::abs(dot(float3(0.0F, 0.0F, 4.9F), float3(near_plane)) + near_plane.w) < 1e-4F);
+    CHECK(std::abs(dot(float3(0.0F, 0.0F, -95.0F), float3(far_plane)) + far_plane.w) < 1e-3F);
+}
+
+void TestBoundsInFrustum(bool const reversed_depth)
+{
+    float4 frustum[6];
+    CalculateFrustumPlanes(CalculateViewProjection(0.1F, 100.0F, reversed_depth), frustum);
+
+    auto const is_visible = [&frustum](float3 const &center, float const extent) {
+        return IsBoundsInFrustum(center - extent, center + extent, frustum);
+    };
+    CHECK(is_visible(float3(0.0F, 0.0F, -10.0F), 1.0F));    // in front of the camera
+    CHECK(is_visible(float3(0.0F, 0.0F, 5.0F), 10.0F));     // around the camera
+    CHECK(is_visible(float3(-15.5F, 0.0F, -10.0F), 1.0F));  // straddling the left plane
+    CHECK(is_visible(float3(0.0F, 0.0F, -95.5F), 1.0F));    // straddling the far plane
+    CHECK(!is_visible(float3(0.0F, 0.0F, 10.0F), 1.0F));    // behind the camera
+    CHECK(!is_visible(float3(0.0F, 0.0F, -100.0F), 1.0F));  // beyond the far plane
+    CHECK(!is_visible(float3(-20.0F, 0.0F, -10.0F), 1.0F)); // left of the frustum
+    CHECK(!is_visible(float3(0.0F, 20.0F, -10.0F), 1.0F));  // above the frustum
+    CHECK(!is_visible(float3(0.0F, 0.0F, 4.97F), 0.02F));   // between the camera and the near plane
+
+    // Degenerate boxes (e.g., flat meshes) are handled
+    CHECK(IsBoundsInFrustum(float3(-1.0F, 0.0F, -10.0F), float3(1.0F, 0.0F, -10.0F), frustum));
+}
+} // namespace
+
+int main()
+{
+    for (bool const reversed_depth : {false, true})
+    {
+        TestFrustumPlanes(reversed_depth);
+        TestBoundsInFrustum(reversed_depth);
+    }
+    return Test::Result();
+}
@@ -0,0 +1,156 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "capsaicin/task_scheduler.h"
+
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** Synthetic skinned characters, standing in for the scene skins and morphed instances. */
+struct Rigs
+{
+    std::vector<std::vector<glm::mat4>> joint_matrices;   /**< Joint matrices of each skin */
+    std::vector<uint32_t>               joint_offsets;    /**< Offset of each skin in the joint buffer */
+    std::vector<std::vector<float>>     weights;          /**< Morph target weights of each instance */
+    std::vector<uint32_t>               weight_offsets;   /**< Offset of each instance in the weight buffer */
+    uint32_t                            joint_count  = 0; /**< Total number of joint matrices */
+    uint32_t                            weight_count = 0; /**< Total number of morph weights */
+};
+
+/** Creates rigs of varying sizes, like a crowd made of a few different character models. */
+Rigs MakeRigs(uint32_t const rig_count) noexcept
+{
+    Rigs rigs;
+    for (uint32_t i = 0; i < rig_count; ++i)
+    {
+        uint32_t const joint_count = 32 + 32 * (i % 4);
+        rigs.joint_offsets.push_back(rigs.joint_count);
+        rigs.joint_matrices.emplace_back(joint_count, glm::mat4(static_cast<float>(i)));
+        rigs.joint_count += joint_count;
+
+        uint32_t const weight_count = 8 * (i % 3);
+        rigs.weight_offsets.push_back(rigs.weight_count);
+        rigs.weights.emplace_back(weight_count, 0.5F);
+        rigs.weight_count += weight_count;
+    }
+    return rigs;
+}
+
+/** Runs a function a few times and returns its best time in milliseconds. */
+template<typename FUNCTION>
+double Measure(FUNCTION const &function) noexcept
+{
+    double best_time = 1e30;
+    for (uint32_t run = 0; run < 10; ++run)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        best_time = std::min(best_time,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best_time;
+}
+
+/**
+ * Gathers every skin and instance serially into fresh vectors that are then copied into newly created
+ * buffers, as updateSceneAnimatedGeometry() used to.
+ */
+void GatherSerial(
+    Rigs const &rigs, std::vector<glm::mat4> &joint_buffer, std::vector<float> &weight_buffer) noexcept
+{
+    std::vector<glm::mat4> joint_matrices_data(rigs.joint_count);
+    for (size_t i = 0; i < rigs.joint_matrices.size(); ++i)
+    {
+        memcpy(joint_matrices_data.data() + rigs.joint_offsets[i], rigs.joint_matrices[i].data(),
+            rigs.joint_matrices[i].size() * sizeof(glm::mat4));
+    }
+    std::vector<float> weight_data(rigs.weight_count);
+    for (size_t i = 0; i < rigs.weights.size(); ++i)
+    {
+        memcpy(weight_data.data() + rigs.weight_offsets[i], rigs.weights[i].data(),
+            rigs.weights[i].size() * sizeof(float));
+    }
+    joint_buffer  = std::vector(joint_matrices_data);
+    weight_buffer = std::vector(weight_data);
+}
+
+/** Writes every skin and instance in parallel straight into recycled upload memory, as done now. */
+void UploadParallel(Rigs const &rigs, glm::mat4 *joint_matrices_data, float *weight_data) noexcept
+{
+    ParallelFor(0U, static_cast<uint32_t>(rigs.joint_matrices.size()), [&](uint32_t const i) {
+        memcpy(joint_matrices_data + rigs.joint_offsets[i], rigs.joint_matrices[i].data(),
+            rigs.joint_matrices[i].size() * sizeof(glm::mat4));
+    });
+    memset(weight_data, 0, rigs.weight_count * sizeof(float));
+    ParallelFor(0U, static_cast<uint32_t>(rigs.weights.size()), [&](uint32_t const i) {
+        memcpy(weight_data + rigs.weight_offsets[i], rigs.weights[i].data(),
+            rigs.weights[i].size() * sizeof(float));
+    });
+}
+
+/** Copies a pipelined scene snapshot into the scene skins, as CapsaicinInternal::applySceneSnapshot does. */
+void ApplySnapshot(Rigs const &snapshot, Rigs &scene) noexcept
+{
+    ParallelFor(0U, static_cast<uint32_t>(scene.joint_matrices.size()),
+        [&](uint32_t const i) { scene.joint_matrices[i] = snapshot.joint_matrices[i]; });
+    ParallelFor(0U, static_cast<uint32_t>(scene.weights.size()),
+        [&](uint32_t const i) { scene.weights[i] = snapshot.weights[i]; });
+}
+} // namespace
+
+int main()
+{
+    uint32_t const max_worker_count = TaskScheduler::GetDefaultWorkerCount();
+    for (uint32_t const rig_count : {64U, 512U, 4096U})
+    {
+        Rigs const             snapshot = MakeRigs(rig_count);
+        Rigs                   scene    = MakeRigs(rig_count);
+        std::vector<glm::mat4> joint_buffer;
+        std::vector<float>     weight_buffer;
+        std::vector<glm::mat4> upload_joints(snapshot.joint_count);
+        std::vector<float>     upload_weights(snapshot.weight_count);
+
+        double const serial_time = Measure([&] { GatherSerial(snapshot, joint_buffer, weight_buffer); });
+        std::printf("%5u rigs (%7u joints): serial gather %.3f ms\n", rig_count, snapshot.joint_count,
+            serial_time);
+        for (uint32_t worker_count = 0; worker_count <= max_worker_count;
+             worker_count          = std::max(2 * worker_count, 1U))
+        {
+            TaskScheduler::Get().setWorkerCount(worker_count);
+            double const upload_time =
+                Measure([&] { UploadParallel(snapshot, upload_joints.data(), upload_weights.data()); });
+            double const apply_time = Measure([&] { ApplySnapshot(snapshot, scene); });
+            std::printf("%22u workers: upload %.3f ms (x%.2f), snapshot apply %.3f ms\n", worker_count,
+                upload_time, serial_time / upload_time, apply_time);
+        }
+    }
+    TaskScheduler::Get().setWorkerCount(max_worker_count);
+    return 0;
+}
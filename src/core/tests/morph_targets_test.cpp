@@ -0,0 +1,158 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "capsaicin/morph_targets.h"
+#include "test.h"
+
+#include <cmath>
+#include <random>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** Creates dense deltas (target major) where only some vertices of each target move, like blend shapes. */
+std::vector<MorphTargets::Delta> CreateDeltas(
+    uint32_t const vertex_count, uint32_t const targets_count, std::mt19937 &random) noexcept
+{
+    std::uniform_real_distribution<float> value(-1.0F, 1.0F);
+    std::uniform_real_distribution<float> probability(0.0F, 1.0F);
+    std::vector<MorphTargets::Delta>      deltas(static_cast<size_t>(vertex_count) * targets_count);
+    for (auto &delta : deltas)
+    {
+        if (probability(random) < 0.2F)
+        {
+            delta.position = 0.5F * float3(value(random), value(random), value(random));
+            delta.normal   = 0.1F * float3(value(random), value(random), value(random));
+            delta.uv       = 0.01F * float2(value(random), value(random));
+        }
+    }
+    return deltas;
+}
+
+uint32_t CountNonZero(std::vector<MorphTargets::Delta> const &deltas) noexcept
+{
+    uint32_t count = 0;
+    for (auto const &delta : deltas)
+    {
+        count += delta.position != float3(0.0F) || delta.normal != float3(0.0F) || delta.uv != float2(0.0F);
+    }
+    return count;
+}
+
+void TestSparseMatchesDense()
+{
+    std::mt19937                          random(1);
+    std::uniform_real_distribution<float> weight(-1.0F, 1.0F);
+    uint32_t const                        vertex_count  = 500;
+    uint32_t const                        targets_count = 8;
+    std::vector<uint32_t>                 offsets;
+    std::vector<MorphDelta>               compressed;
+
+    // Several meshes are appended to the same lists, so offsets must be absolute
+    for (uint32_t mesh = 0; mesh < 3; ++mesh)
+    {
+        auto const     deltas = CreateDeltas(vertex_count, targets_count, random);
+        auto const   offset = static_cast<uint32_t>(offsets.size());
+        size_t const first  = compressed.size();
+        float2 const scale =
+            MorphTargets::Compress(deltas, vertex_count, targets_count, offsets, compressed);
+        auto const stored = static_cast<uint32_t>(compressed.size() - first);
+        CHECK(offsets.size() == offset + vertex_count + 1);
+        CHECK(offsets[offset] == first && offsets.back() == compressed.size());
+        CHECK(stored == CountNonZero(deltas));
+        CHECK(scale.x > 0.0F && scale.y > 0.0F);
+
+        for (uint32_t weights_set = 0; weights_set < 4; ++weights_set)
+        {
+            // Also covers zero weights, whose targets are skipped by the sparse evaluation
+            std::vector<float> weights(targets_count, 1.0F);
+            float              weight_sum = static_cast<float>(targets_count);
+            if (weights_set > 0)
+            {
+                weight_sum = 0.0F;
+                for (uint32_t target = 0; target < targets_count; ++target)
+                {
+                    weights[target] = (target % weights_set == 0) ? 0.0F : weight(random);
+                    weight_sum += std::abs(weights[target]);
+                }
+            }
+
+            // Position and normal deltas are accurate to half a quantisation step, uvs to half precision
+            auto const error = MorphTargets::CalculateMaxError(
+                deltas, vertex_count, targets_count, offsets, compressed, offset, scale, weights);
+            float const position_bound = 0.5F * weight_sum * scale.x + 1e-6F;
+            float const normal_bound   = 0.5F * weight_sum * scale.y + 1e-6F;
+            float const uv_bound       = weight_sum * 0.01F / 2048.0F + 1e-7F;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                CHECK(error.position[i] <= position_bound);
+                CHECK(error.normal[i] <= normal_bound);
+            }
+            CHECK(error.uv.x <= uv_bound && error.uv.y <= uv_bound);
+        }
+    }
+}
+
+void TestDecodeDelta()
+{
+    // The largest delta of a mesh uses the full quantisation range and is decoded exactly
+    std::vector<MorphTargets::Delta> deltas(2);
+    deltas[1].position = float3(2.0F, -1.0F, 0.5F);
+    deltas[1].normal   = float3(0.0F, -0.25F, 0.0F);
+    deltas[1].uv       = float2(0.5F, -0.125F);
+    std::vector<uint32_t>   offsets;
+    std::vector<MorphDelta> compressed;
+    float2 const            scale = MorphTargets::Compress(deltas, 2, 1, offsets, compressed);
+    CHECK(compressed.size() == 1);
+    CHECK(offsets.size() == 3 && offsets[0] == 0 && offsets[1] == 0 && offsets[2] == 1);
+    CHECK(compressed[0].target == 0);
+
+    auto const decoded = MorphTargets::DecodeDelta(compressed[0], scale);
+    CHECK(decoded.position.x == 2.0F && decoded.normal.y == -0.25F);
+    CHECK(std::abs(decoded.position.y + 1.0F) <= 0.5F * scale.x);
+    CHECK(std::abs(decoded.position.z - 0.5F) <= 0.5F * scale.x);
+    CHECK(decoded.normal.x == 0.0F && decoded.normal.z == 0.0F);
+    CHECK(decoded.uv.x == 0.5F && decoded.uv.y == -0.125F);
+}
+
+void TestNoTargetsMoved()
+{
+    // A mesh whose targets are all zero stores no deltas and evaluates to zero
+    std::vector<MorphTargets::Delta> deltas(30);
+    std::vector<uint32_t>            offsets;
+    std::vector<MorphDelta>          compressed;
+    float2 const                     scale = MorphTargets::Compress(deltas, 10, 3, offsets, compressed);
+    CHECK(compressed.empty());
+    CHECK(offsets.size() == 11);
+    auto const sparse = MorphTargets::EvaluateSparse(offsets, compressed, 0, scale, {1.0F, 1.0F, 1.0F}, 5);
+    CHECK(sparse.position == float3(0.0F) && sparse.normal == float3(0.0F) && sparse.uv == float2(0.0F));
+}
+} // namespace
+
+int main()
+{
+    TestSparseMatchesDense();
+    TestDecodeDelta();
+    TestNoTargetsMoved();
+    return Test::Result();
+}
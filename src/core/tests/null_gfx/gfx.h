@@ -0,0 +1,245 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+// A null gfx backend for the unit tests: the subset of the gfx API used by the tested utilities, backed by
+// system memory and counting the objects it creates so that tests can check the allocation behaviour
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#define GFX_SNPRINTF(...) std::snprintf(__VA_ARGS__)
+
+enum GfxConstant : uint32_t
+{
+    kGfxConstant_BackBufferCount = 3
+};
+
+enum GfxCpuAccess : uint32_t
+{
+    kGfxCpuAccess_None = 0,
+    kGfxCpuAccess_Read,
+    kGfxCpuAccess_Write
+};
+
+/** State of the null device, shared by every copy of a context. */
+struct GfxNullDevice
+{
+    uint32_t back_buffer_index = 0; /**< Advanced by the test in place of gfxFrame() */
+    uint32_t buffers_created   = 0; /**< Number of buffers allocated (excluding ranges) */
+    uint32_t ranges_created    = 0; /**< Number of buffer ranges created */
+    uint32_t buffers_destroyed = 0; /**< Number of buffers and ranges destroyed */
+
+    uint32_t back_buffer_width        = 1920; /**< Size of the swap chain */
+    uint32_t back_buffer_height       = 1080;
+    uint32_t back_buffer_queries      = 0; /**< Number of times the swap chain has been queried */
+    uint32_t graphics_kernels_created = 0; /**< Number of graphics kernels created */
+    uint32_t kernels_destroyed        = 0; /**< Number of kernels destroyed */
+    uint32_t draws                    = 0; /**< Number of draw commands recorded */
+};
+
+class GfxContext
+{
+public:
+    GfxContext() noexcept = default;
+
+    explicit GfxContext(GfxNullDevice &device) noexcept
+        : device_(&device)
+    {}
+
+    [[nodiscard]] GfxNullDevice &getDevice() const noexcept { return *device_; }
+
+    explicit operator bool() const noexcept { return device_ != nullptr; }
+
+private:
+    GfxNullDevice *device_ = nullptr;
+};
+
+class GfxBuffer
+{
+public:
+    [[nodiscard]] uint64_t getSize() const noexcept { return size_; }
+
+    [[nodiscard]] uint32_t getStride() const noexcept { return stride_; }
+
+    [[nodiscard]] uint64_t getOffset() const noexcept { return offset_; }
+
+    [[nodiscard]] char const *getName() const noexcept { return name_; }
+
+    void setStride(uint32_t const stride) noexcept { stride_ = stride; }
+
+    void setName(char const *name) noexcept { GFX_SNPRINTF(name_, sizeof(name_), "%s", name); }
+
+    explicit operator bool() const noexcept { return memory_ != nullptr; }
+
+private:
+    friend GfxBuffer gfxCreateBuffer(GfxContext, uint64_t, void const *, GfxCpuAccess) noexcept;
+    friend GfxBuffer gfxCreateBufferRange(GfxContext, GfxBuffer, uint64_t, uint64_t) noexcept;
+    friend void     *gfxBufferGetData(GfxContext, GfxBuffer) noexcept;
+
+    std::shared_ptr<std::vector<std::byte>> memory_; /**< Ranges keep their parent memory alive */
+    uint64_t                                offset_   = 0;
+    uint64_t                                size_     = 0;
+    uint32_t                                stride_   = 4;
+    char                                    name_[64] = {};
+};
+
+class GfxTexture
+{
+public:
+    GfxTexture() noexcept = default;
+
+    GfxTexture(uint32_t const width, uint32_t const height) noexcept
+        : width_(width)
+        , height_(height)
+    {}
+
+    [[nodiscard]] uint32_t getWidth() const noexcept { return width_; }
+
+    [[nodiscard]] uint32_t getHeight() const noexcept { return height_; }
+
+    explicit operator bool() const noexcept { return width_ > 0; }
+
+private:
+    uint32_t width_  = 0;
+    uint32_t height_ = 0;
+};
+
+class GfxProgram
+{
+public:
+    explicit operator bool() const noexcept { return true; }
+};
+
+class GfxKernel
+{
+public:
+    explicit operator bool() const noexcept { return valid_; }
+
+private:
+    friend GfxKernel gfxCreateGraphicsKernel(GfxContext, GfxProgram) noexcept;
+
+    bool valid_ = false;
+};
+
+inline uint32_t gfxGetBackBufferIndex(GfxContext const context) noexcept
+{
+    return context.getDevice().back_buffer_index;
+}
+
+inline GfxBuffer gfxCreateBuffer(GfxContext const context, uint64_t const size, void const *data = nullptr,
+    GfxCpuAccess const cpu_access = kGfxCpuAccess_None) noexcept
+{
+    (void)cpu_access;
+    GfxBuffer buffer;
+    buffer.memory_ = std::make_shared<std::vector<std::byte>>(size);
+    buffer.size_   = size;
+    if (data != nullptr)
+    {
+        std::memcpy(buffer.memory_->data(), data, size);
+    }
+    ++context.getDevice().buffers_created;
+    return buffer;
+}
+
+inline GfxBuffer gfxCreateBufferRange(
+    GfxContext const context, GfxBuffer buffer, uint64_t const offset, uint64_t const size) noexcept
+{
+    if (!buffer || offset + size > buffer.size_)
+    {
+        return {};
+    }
+    buffer.offset_ += offset;
+    buffer.size_    = size;
+    ++context.getDevice().ranges_created;
+    return buffer;
+}
+
+inline void gfxDestroyBuffer(GfxContext const context, GfxBuffer const buffer) noexcept
+{
+    if (buffer)
+    {
+        ++context.getDevice().buffers_destroyed;
+    }
+}
+
+inline void *gfxBufferGetData(GfxContext const context, GfxBuffer const buffer) noexcept
+{
+    (void)context;
+    return buffer ? buffer.memory_->data() + buffer.offset_ : nullptr;
+}
+
+inline uint32_t gfxGetBackBufferWidth(GfxContext const context) noexcept
+{
+    ++context.getDevice().back_buffer_queries;
+    return context.getDevice().back_buffer_width;
+}
+
+inline uint32_t gfxGetBackBufferHeight(GfxContext const context) noexcept
+{
+    ++context.getDevice().back_buffer_queries;
+    return context.getDevice().back_buffer_height;
+}
+
+inline GfxKernel gfxCreateGraphicsKernel(GfxContext const context, GfxProgram const program) noexcept
+{
+    (void)program;
+    GfxKernel kernel;
+    kernel.valid_ = true;
+    ++context.getDevice().graphics_kernels_created;
+    return kernel;
+}
+
+inline void gfxDestroyKernel(GfxContext const context, GfxKernel const kernel) noexcept
+{
+    if (kernel)
+    {
+        ++context.getDevice().kernels_destroyed;
+    }
+}
+
+inline void gfxProgramSetTexture(
+    GfxContext const context, GfxProgram const program, char const *name, GfxTexture const texture) noexcept
+{
+    (void)context, (void)program, (void)name, (void)texture;
+}
+
+template<typename TYPE>
+void gfxProgramSetParameter(
+    GfxContext const context, GfxProgram const program, char const *name, TYPE const &value) noexcept
+{
+    (void)context, (void)program, (void)name, (void)value;
+}
+
+inline void gfxCommandBindKernel(GfxContext const context, GfxKernel const kernel) noexcept
+{
+    (void)context, (void)kernel;
+}
+
+inline void gfxCommandDraw(GfxContext const context, uint32_t const vertex_count) noexcept
+{
+    (void)vertex_count;
+    ++context.getDevice().draws;
+}
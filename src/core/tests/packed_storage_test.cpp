@@ -0,0 +1,128 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "gi1/packed_storage.h"
+#include "test.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace Capsaicin;
+
+namespace
+{
+float MaxComponent(float3 const &value) noexcept
+{
+    return std::max(std::abs(value.x), std::max(std::abs(value.y), std::abs(value.z)));
+}
+
+void TestSignedFloat3()
+{
+    // The largest component always uses the top bit of its 8bit mantissa, so the error of every component is
+    // within half a step of 1/128th of the largest one (a little over when rounding bumps the exponent)
+    std::mt19937                          random(1);
+    std::uniform_real_distribution<float> exponent(-15.0F, 15.0F);
+    std::uniform_real_distribution<float> component(-1.0F, 1.0F);
+    float                                 max_relative_error = 0.0F;
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        float3 value = float3(component(random), component(random), component(random));
+        value        = value * (std::exp2(exponent(random)) / std::max(MaxComponent(value), 1e-6F));
+
+        float3 const unpacked = PackedStorage::UnpackSignedFloat3(PackedStorage::PackSignedFloat3(value));
+        float const  error    = MaxComponent(unpacked - value) / MaxComponent(value);
+        max_relative_error    = std::max(max_relative_error, error);
+        for (uint32_t j = 0; j < 3; ++j)
+        {
+            CHECK(unpacked[j] == 0.0F || (unpacked[j] < 0.0F) == (value[j] < 0.0F));
+        }
+    }
+    CHECK(max_relative_error <= 1.0F / 255.0F);
+
+    // Zero stays zero without turning negative, out of range values are clamped
+    float3 const zero = PackedStorage::UnpackSignedFloat3(PackedStorage::PackSignedFloat3(float3(-0.0F)));
+    CHECK(zero.x == 0.0F && zero.y == 0.0F && zero.z == 0.0F);
+    CHECK(!std::signbit(zero.x) && !std::signbit(zero.y) && !std::signbit(zero.z));
+    float3 const clamped =
+        PackedStorage::UnpackSignedFloat3(PackedStorage::PackSignedFloat3(float3(1e6F, -1e6F, 1.0F)));
+    CHECK(clamped.x == PackedStorage::kMaxSignedFloat3 && clamped.y == -PackedStorage::kMaxSignedFloat3);
+}
+
+void TestOctahedral()
+{
+    // 16bit snorm coordinates keep directions within a few hundredths of a degree
+    std::mt19937                          random(2);
+    std::uniform_real_distribution<float> component(-1.0F, 1.0F);
+    float                                 min_cosine = 1.0F;
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        float3 direction(component(random), component(random), component(random));
+        if (glm::length(direction) < 1e-3F)
+        {
+            continue;
+        }
+        direction             = glm::normalize(direction);
+        float3 const unpacked = PackedStorage::UnpackOctahedral(PackedStorage::PackOctahedral(direction));
+        min_cosine            = std::min(min_cosine, glm::dot(direction, unpacked));
+    }
+    CHECK(std::acos(std::min(min_cosine, 1.0F)) < 1e-3F);
+
+    // The axes lie on the corners and folds of the octahedron
+    float3 const axes[] = {float3(1.0F, 0.0F, 0.0F), float3(-1.0F, 0.0F, 0.0F), float3(0.0F, 1.0F, 0.0F),
+        float3(0.0F, -1.0F, 0.0F), float3(0.0F, 0.0F, 1.0F), float3(0.0F, 0.0F, -1.0F)};
+    for (float3 const &axis : axes)
+    {
+        float3 const unpacked = PackedStorage::UnpackOctahedral(PackedStorage::PackOctahedral(axis));
+        CHECK(glm::dot(axis, unpacked) > 0.99999F);
+    }
+}
+
+void TestIndirectSample()
+{
+    // Half precision origins and hit distances, the hit direction being relative to the quantized origin
+    std::mt19937                          random(3);
+    std::uniform_real_distribution<float> position(-500.0F, 500.0F);
+    std::uniform_real_distribution<float> offset(-20.0F, 20.0F);
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        PackedStorage::IndirectSample sample;
+        sample.origin       = float3(position(random), position(random), position(random));
+        sample.hit_position = sample.origin + float3(offset(random), offset(random), offset(random));
+
+        auto const unpacked =
+            PackedStorage::UnpackIndirectSample(PackedStorage::PackIndirectSample(sample));
+        float const hit_distance = glm::length(sample.hit_position - sample.origin);
+        CHECK(MaxComponent(unpacked.origin - sample.origin) <= MaxComponent(sample.origin) / 2048.0F);
+        CHECK(glm::length(unpacked.hit_position - sample.hit_position)
+              <= MaxComponent(sample.origin) / 2048.0F + hit_distance * 2e-3F);
+    }
+}
+} // namespace
+
+int main()
+{
+    TestSignedFloat3();
+    TestOctahedral();
+    TestIndirectSample();
+    return Test::Result();
+}
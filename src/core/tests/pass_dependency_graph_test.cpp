@@ -0,0 +1,168 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "test.h"
+#include "utilities/pass_dependency_graph.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** Checks the schedule invariants that any set of passes must satisfy. */
+void CheckScheduleIsValid(PassDependencyGraph const &graph, PassDependencyGraph::Schedule const &schedule)
+{
+    auto const dependencies = graph.getDependencies();
+    auto const pass_count   = static_cast<uint32_t>(graph.getPasses().size());
+    CHECK(schedule.submission_order.size() == pass_count);
+
+    std::vector<uint32_t> submission_positions(pass_count, UINT32_MAX);
+    for (uint32_t position = 0; position < schedule.submission_order.size(); ++position)
+    {
+        submission_positions[schedule.submission_order[position]] = position;
+    }
+    for (uint32_t pass_index = 0; pass_index < pass_count; ++pass_index)
+    {
+        CHECK(submission_positions[pass_index] != UINT32_MAX);
+        for (uint32_t const dependency : dependencies[pass_index])
+        {
+            // Single queue submission must respect every dependency
+            CHECK(submission_positions[dependency] < submission_positions[pass_index]);
+            CHECK(schedule.levels[dependency] < schedule.levels[pass_index]);
+
+            // Cross queue dependencies must be covered by a fence signalled no earlier than the dependency
+            // and waited on no later than the pass
+            if (schedule.queues[dependency] != schedule.queues[pass_index])
+            {
+                auto const &signal_queue = schedule.queue_passes[schedule.queues[dependency]];
+                auto const &wait_queue   = schedule.queue_passes[schedule.queues[pass_index]];
+                auto const  position     = [](std::vector<uint32_t> const &queue, uint32_t const pass) {
+                    return std::find(queue.begin(), queue.end(), pass) - queue.begin();
+                };
+                bool const is_covered = std::ranges::any_of(schedule.fences, [&](auto const &fence) {
+                    return schedule.queues[fence.signal_pass] == schedule.queues[dependency]
+                        && schedule.queues[fence.wait_pass] == schedule.queues[pass_index]
+                        && position(signal_queue, fence.signal_pass) >= position(signal_queue, dependency)
+                        && position(wait_queue, fence.wait_pass) <= position(wait_queue, pass_index);
+                });
+                CHECK(is_covered);
+            }
+        }
+        if (!graph.getPasses()[pass_index].async_compute)
+        {
+            CHECK(schedule.queues[pass_index] == PassDependencyGraph::kQueue_Direct);
+        }
+    }
+}
+
+void TestHazards()
+{
+    PassDependencyGraph graph;
+    graph.addPass("Write", {}, {"A"}, false);
+    graph.addPass("Read", {"A"}, {"B"}, false);
+    graph.addPass("Overwrite", {}, {"A"}, false);
+    graph.addPass("ReadWrite", {"A"}, {"A"}, false);
+    graph.addPass("Unrelated", {"C"}, {"D"}, false);
+
+    auto const dependencies = graph.getDependencies();
+    CHECK(dependencies[0].empty());
+    CHECK((dependencies[1] == std::vector<uint32_t> {0}));    // read-after-write
+    CHECK((dependencies[2] == std::vector<uint32_t> {0, 1})); // write-after-write and write-after-read
+    CHECK((dependencies[3] == std::vector<uint32_t> {2}));    // listing a resource twice is not a self hazard
+    CHECK(dependencies[4].empty());
+
+    auto const schedule = graph.build();
+    CHECK((schedule.levels == std::vector<uint32_t> {0, 1, 2, 3, 0}));
+    CHECK((schedule.submission_order == std::vector<uint32_t> {0, 4, 1, 2, 3}));
+    CHECK(schedule.fences.empty());
+    CheckScheduleIsValid(graph, schedule);
+}
+
+void TestGI1Pipeline()
+{
+    // Trimmed down version of the GI-1 passes, the reflections are on the critical path while the temporal
+    // denoising of the diffuse lighting has enough slack to overlap with them
+    PassDependencyGraph graph;
+    graph.addPass("ReprojectScreenProbes", {"GBuffers"}, {"ScreenProbes"}, true);                   // 0
+    graph.addPass("SpawnScreenProbes", {"ScreenProbes"}, {"ScreenProbes_Spawn"}, true);             // 1
+    graph.addPass("PopulateCells", {"ScreenProbes_Spawn"}, {"HashGridCache"}, true);                // 2
+    graph.addPass("ResolveCells", {"HashGridCache"}, {"ScreenProbes_Spawn"}, true);                 // 3
+    graph.addPass("BlendScreenProbes", {"ScreenProbes_Spawn"}, {"ScreenProbes"}, true);             // 4
+    graph.addPass("InterpolateScreenProbes", {"ScreenProbes"}, {"GIDenoiser", "Reflections"}, true); // 5
+    graph.addPass("TraceReflections", {"Reflections", "HashGridCache"}, {"Reflections"}, true);     // 6
+    graph.addPass("MarkFireflies", {"Reflections"}, {"Fireflies"}, true);                           // 7
+    graph.addPass("CleanupFireflies", {"Reflections", "Fireflies"}, {"Reflections"}, true);         // 8
+    graph.addPass("ReprojectReflections", {"Reflections"}, {"Reflection"}, true);                   // 9
+    graph.addPass("ReprojectGI", {"GIDenoiser"}, {"GIDenoiser"}, true);                             // 10
+    graph.addPass("FilterGI", {"GIDenoiser"}, {"GIDenoiser", "Irradiance"}, true);                  // 11
+    graph.addPass("ResolveGI1", {"Irradiance", "Reflection"}, {"GlobalIllumination"}, false);       // 12
+
+    auto const dependencies = graph.getDependencies();
+    CHECK((dependencies[3] == std::vector<uint32_t> {1, 2}));
+    CHECK((dependencies[4] == std::vector<uint32_t> {0, 1, 3}));
+    CHECK((dependencies[6] == std::vector<uint32_t> {2, 5}));
+    CHECK((dependencies[7] == std::vector<uint32_t> {6}));
+    CHECK((dependencies[8] == std::vector<uint32_t> {6, 7}));
+    CHECK((dependencies[10] == std::vector<uint32_t> {5}));
+    CHECK((dependencies[12] == std::vector<uint32_t> {9, 11}));
+
+    auto const schedule = graph.build();
+    CHECK(schedule.level_count == 11);
+    CHECK((schedule.levels == std::vector<uint32_t> {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 6, 7, 10}));
+    CHECK((schedule.queue_passes[PassDependencyGraph::kQueue_AsyncCompute]
+           == std::vector<uint32_t> {10, 11}));
+    CHECK((schedule.queue_passes[PassDependencyGraph::kQueue_Direct]
+           == std::vector<uint32_t> {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12}));
+    CHECK(schedule.fences.size() == 2);
+    if (schedule.fences.size() == 2)
+    {
+        CHECK(schedule.fences[0].signal_pass == 11 && schedule.fences[0].wait_pass == 12);
+        CHECK(schedule.fences[1].signal_pass == 5 && schedule.fences[1].wait_pass == 10);
+    }
+    CHECK((schedule.submission_order == std::vector<uint32_t> {0, 1, 2, 3, 4, 5, 6, 10, 7, 11, 8, 9, 12}));
+    CheckScheduleIsValid(graph, schedule);
+
+    // Dropping a declared read must drop the dependency, which is what a missing declaration looks like
+    PassDependencyGraph incomplete_graph;
+    for (auto const &pass : graph.getPasses())
+    {
+        std::vector<std::string_view> reads(pass.reads.begin(), pass.reads.end());
+        std::vector<std::string_view> writes(pass.writes.begin(), pass.writes.end());
+        if (pass.name == "MarkFireflies")
+        {
+            reads.clear();
+        }
+        incomplete_graph.addPass(pass.name, reads, writes, pass.async_compute);
+    }
+    CHECK(incomplete_graph.getDependencies()[7].empty());
+    CHECK(incomplete_graph.build().levels[7] == 0);
+}
+} // namespace
+
+int main()
+{
+    TestHazards();
+    TestGI1Pipeline();
+    return Test::Result();
+}
@@ -0,0 +1,250 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "components/post_process_chain/post_process_chain_reference.h"
+#include "test.h"
+
+#include <array>
+#include <cmath>
+
+using namespace Capsaicin;
+
+namespace
+{
+using Op = PostProcessChainReference::ToneMapOperator;
+
+bool Near(float3 const &value, float3 const &expected, float const tolerance) noexcept
+{
+    return compMax(abs(value - expected)) <= tolerance;
+}
+
+float EncodeSRGB(double const value) noexcept
+{
+    return static_cast<float>(value < 0.003041282560128 ? 12.92 * value
+                                                        : 1.055010718947587 * std::pow(value, 1.0 / 2.4)
+                                                              - 0.055010718947587);
+}
+
+void TestToneMapping()
+{
+    // The simple operators against their closed forms evaluated in double precision
+    PostProcessChainReference::Settings settings;
+    for (double const input : {0.0, 0.05, 0.18, 1.0, 4.0, 64.0})
+    {
+        auto const value = float3(static_cast<float>(input));
+        settings.exposure = 2.0F;
+        double const exposed = input * 2.0;
+
+        settings.tonemap_operator = Op::None;
+        CHECK(Near(
+            PostProcessChainReference::ToneMap(value, settings), float3(EncodeSRGB(exposed)), 1.0e-5F));
+        settings.tonemap_operator = Op::ReinhardSimple;
+        CHECK(Near(PostProcessChainReference::ToneMap(value, settings),
+            float3(EncodeSRGB(exposed / (exposed + 1.0))), 1.0e-5F));
+        settings.tonemap_operator = Op::ReinhardLuminance;
+        CHECK(Near(PostProcessChainReference::ToneMap(value, settings),
+            float3(EncodeSRGB(exposed / (exposed + 1.0))), 1.0e-4F));
+
+        double const aces = exposed * 0.6;
+        settings.tonemap_operator = Op::ACESFast;
+        CHECK(Near(PostProcessChainReference::ToneMap(value, settings),
+            float3(EncodeSRGB((aces * (aces * 2.51 + 0.03)) / (aces * (aces * 2.43 + 0.59) + 0.14))),
+            1.0e-5F));
+    }
+
+    // The remaining operators against known good values of the shader code they mirror
+    struct Golden
+    {
+        Op                    op;
+        std::array<float3, 4> outputs;
+    };
+    std::array const inputs  = {float3(0.18F), float3(1.0F), float3(4.0F, 1.0F, 0.25F), float3(16.0F)};
+    std::array const goldens = {
+        Golden {Op::ACES, {float3(0.348880F), float3(0.722119F), float3(0.956154F, 0.744725F, 0.542730F),
+                              float3(0.992526F)}},
+        Golden {Op::ACESFitted, {float3(0.358451F), float3(0.808952F),
+                                    float3(0.997751F, 0.834173F, 0.598398F), float3(0.995563F)}},
+        Golden {Op::PBRNeutral, {float3(0.410015F), float3(0.940091F),
+                                    float3(0.992603F, 0.714075F, 0.617664F), float3(0.998358F)}},
+        Golden {Op::AgxFitted, {float3(0.208464F), float3(0.500511F), float3(0.746481F, 0.531356F, 0.388538F),
+                                   float3(0.911610F)}},
+        Golden {Op::Agx, {float3(0.205953F), float3(0.503862F), float3(0.745653F, 0.533349F, 0.394210F),
+                             float3(0.914504F)}},
+    };
+    settings.exposure = 1.0F;
+    for (auto const &golden : goldens)
+    {
+        settings.tonemap_operator = golden.op;
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            CHECK(Near(PostProcessChainReference::ToneMap(inputs[i], settings), golden.outputs[i], 1.0e-4F));
+        }
+    }
+
+    // Display referred output stays black for black input and increases with the input
+    for (Op const op : {Op::None, Op::ReinhardSimple, Op::ReinhardLuminance, Op::ACESFast, Op::ACES,
+             Op::PBRNeutral, Op::Uncharted2, Op::Agx})
+    {
+        settings.tonemap_operator = op;
+        CHECK(Near(PostProcessChainReference::ToneMap(float3(0.0F), settings), float3(0.0F), 1.0e-4F));
+        float previous = -1.0F;
+        for (float const input : {0.01F, 0.1F, 0.5F, 1.0F, 2.0F, 8.0F})
+        {
+            float const output = PostProcessChainReference::ToneMap(float3(input), settings).y;
+            CHECK(output > previous);
+            previous = output;
+        }
+    }
+}
+
+void TestColorGrading()
+{
+    // Sampling a texel centre returns the 8bit quantised texel
+    PostProcessChainReference::Settings settings;
+    settings.lut_size = 4;
+    for (uint32_t z = 0; z < 4; ++z)
+    {
+        for (uint32_t y = 0; y < 4; ++y)
+        {
+            for (uint32_t x = 0; x < 4; ++x)
+            {
+                settings.lut.emplace_back(
+                    static_cast<float>(x) * 0.3F, static_cast<float>(y) * 0.2F, static_cast<float>(z) * 0.1F);
+            }
+        }
+    }
+    CHECK(Near(PostProcessChainReference::ColorGrade(float3(2.5F, 1.5F, 3.5F) / 4.0F, settings),
+        float3(153.0F, 51.0F, 77.0F) / 255.0F, 1.0e-6F));
+
+    // Half way between texels is the average of both, and coordinates outside the LUT clamp to its edges
+    CHECK(Near(PostProcessChainReference::ColorGrade(float3(2.0F, 0.5F, 0.5F) / 4.0F, settings),
+        float3((77.0F + 153.0F) * 0.5F, 0.0F, 0.0F) / 255.0F, 1.0e-6F));
+    CHECK(Near(PostProcessChainReference::ColorGrade(float3(1.0F, 0.0F, 1.0F), settings),
+        float3(230.0F, 0.0F, 77.0F) / 255.0F, 1.0e-6F));
+}
+
+void TestLens()
+{
+    PostProcessChainReference::Settings settings;
+    settings.dimensions      = uint2(16, 8);
+    settings.vignette_enable = true;
+    float3 const color(0.5F);
+
+    // Vignette leaves the centre untouched and darkens towards the corners
+    CHECK(Near(PostProcessChainReference::LensApply(uint2(8, 4), color, settings), color, 1.0e-6F));
+    float const edge   = PostProcessChainReference::LensApply(uint2(0, 4), color, settings).x;
+    float const corner = PostProcessChainReference::LensApply(uint2(0, 0), color, settings).x;
+    CHECK(corner < edge && edge < color.x);
+
+    // Film grain never pushes values outside of [0, 1]
+    settings.vignette_enable   = false;
+    settings.film_grain_enable = true;
+    settings.grain_amount      = 1.0F;
+    bool changed               = false;
+    for (uint32_t y = 0; y < 8; ++y)
+    {
+        for (uint32_t x = 0; x < 16; ++x)
+        {
+            for (float const value : {0.0F, 0.25F, 1.0F})
+            {
+                float3 const output =
+                    PostProcessChainReference::LensApply(uint2(x, y), float3(value), settings);
+                CHECK(output.x >= 0.0F && output.x <= 1.0F);
+                changed = changed || output.x != value;
+            }
+        }
+    }
+    CHECK(changed);
+    CHECK(Near(
+        PostProcessChainReference::LensApply(uint2(3, 5), float3(0.0F), settings), float3(0.0F), 0.0F));
+}
+
+void TestChain()
+{
+    // The fused kernel applies tone mapping, colour grading and then the lens effects
+    PostProcessChainReference::Settings settings;
+    settings.dimensions       = uint2(16, 8);
+    settings.tonemap_operator = Op::ACESFitted;
+    settings.exposure         = 1.5F;
+    settings.vignette_enable    = true;
+    settings.vignette_intensity = 0.5F;
+    settings.film_grain_enable  = true;
+    settings.grain_seed         = 3;
+
+    // A LUT that swaps the red and green channels
+    settings.lut_size = 2;
+    settings.lut      = {float3(0.0F, 0.0F, 0.0F), float3(0.0F, 1.0F, 0.0F), float3(1.0F, 0.0F, 0.0F),
+             float3(1.0F, 1.0F, 0.0F), float3(0.0F, 0.0F, 1.0F), float3(0.0F, 1.0F, 1.0F),
+             float3(1.0F, 0.0F, 1.0F), float3(1.0F, 1.0F, 1.0F)};
+
+    std::vector<float3> image;
+    for (uint32_t y = 0; y < settings.dimensions.y; ++y)
+    {
+        for (uint32_t x = 0; x < settings.dimensions.x; ++x)
+        {
+            image.emplace_back(static_cast<float>(x) * 0.25F, static_cast<float>(y) * 0.5F, 0.18F);
+        }
+    }
+    auto const output = PostProcessChainReference::Evaluate(image, settings);
+    CHECK(output.size() == image.size());
+    for (uint32_t y = 0; y < settings.dimensions.y; ++y)
+    {
+        for (uint32_t x = 0; x < settings.dimensions.x; ++x)
+        {
+            size_t const index    = static_cast<size_t>(y) * settings.dimensions.x + x;
+            float3 const expected = PostProcessChainReference::LensApply(uint2(x, y),
+                PostProcessChainReference::ColorGrade(
+                    PostProcessChainReference::ToneMap(image[index], settings), settings),
+                settings);
+            CHECK(Near(output[index], expected, 0.0F));
+        }
+    }
+
+    // Known good output of the full chain
+    struct Golden
+    {
+        uint2  pixel;
+        float3 input;
+        float3 output;
+    };
+    std::array const goldens = {
+        Golden {uint2(8, 4), float3(0.18F), float3(0.340654F, 0.340654F, 0.340651F)},
+        Golden {uint2(0, 0), float3(1.0F, 0.5F, 0.25F), float3(0.532334F, 0.532334F, 0.380800F)},
+        Golden {uint2(15, 7), float3(4.0F), float3(0.650284F)},
+        Golden {uint2(3, 5), float3(0.05F, 0.3F, 0.9F), float3(0.636159F, 0.092042F, 0.867896F)},
+    };
+    for (auto const &golden : goldens)
+    {
+        CHECK(Near(PostProcessChainReference::Evaluate(golden.pixel, golden.input, settings), golden.output,
+            1.0e-4F));
+    }
+}
+} // namespace
+
+int main()
+{
+    TestToneMapping();
+    TestColorGrading();
+    TestLens();
+    TestChain();
+    return Test::Result();
+}
@@ -0,0 +1,161 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "components/prefilter_ibl/prefilter_ibl_reference.h"
+#include "test.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Capsaicin;
+
+namespace
+{
+void TestSamples()
+{
+    // A perfect mirror reads the direction itself at the output resolution
+    auto const mirror =
+        PrefilterIBLReference::GenerateSamples(PrefilterIBLReference::CalculateAlpha(0, 5), 64);
+    CHECK(mirror.size() == 1);
+    CHECK(mirror[0].x == 0.0F && mirror[0].y == 0.0F && mirror[0].z == 1.0F);
+
+    float previous_lod = -1.0e9F;
+    for (uint32_t mip_level = 1; mip_level < 5; ++mip_level)
+    {
+        float const alpha   = PrefilterIBLReference::CalculateAlpha(mip_level, 5);
+        auto const  samples = PrefilterIBLReference::GenerateSamples(alpha, 64);
+        CHECK(!samples.empty() && samples.size() <= 64);
+        float lod = 0.0F;
+        for (auto const &sample : samples)
+        {
+            CHECK(sample.z > 0.0F);
+            CHECK(std::abs(length(float3(sample)) - 1.0F) < 1.0e-4F);
+            lod += sample.w;
+        }
+
+        // Rougher lobes spread the samples further apart so they read from coarser environment mips
+        lod /= static_cast<float>(samples.size());
+        CHECK(lod > previous_lod);
+        previous_lod = lod;
+    }
+    CHECK(PrefilterIBLReference::CalculateAlpha(4, 5) == 1.0F);
+}
+
+void TestCubeMap()
+{
+    // Every mip level of a constant environment holds the constant
+    auto const cube_map =
+        PrefilterIBLReference::CreateCubeMap(16, [](float3 const &) { return float3(0.25F, 0.5F, 1.0F); });
+    CHECK(cube_map.mips.size() == 5);
+    for (size_t mip_level = 0; mip_level < cube_map.mips.size(); ++mip_level)
+    {
+        size_t const size = 16 >> mip_level;
+        CHECK(cube_map.mips[mip_level].size() == size * size * 6);
+    }
+    for (uint32_t face = 0; face < 6; ++face)
+    {
+        float3 const direction = normalize(PrefilterIBLReference::GetCubeDirection(face, float2(0.3F, 0.7F)));
+        for (float const lod : {0.0F, 1.5F, 4.0F})
+        {
+            float3 const color = PrefilterIBLReference::SampleCubeMap(cube_map, direction, lod);
+            CHECK(compMax(abs(color - float3(0.25F, 0.5F, 1.0F))) < 1.0e-5F);
+        }
+    }
+
+    // Faces are laid out so that the direction of a texel samples back the same texel
+    auto const directional = PrefilterIBLReference::CreateCubeMap(8, [](float3 const &direction) {
+        return direction * 0.5F + 0.5F;
+    });
+    for (uint32_t face = 0; face < 6; ++face)
+    {
+        float2 const uv        = float2(2.5F, 5.5F) / 8.0F;
+        float3 const direction = normalize(PrefilterIBLReference::GetCubeDirection(face, uv));
+        float3 const color     = PrefilterIBLReference::SampleCubeMap(directional, direction, 0.0F);
+        CHECK(compMax(abs(color - directional.mips[0][(face * 8 + 5) * 8 + 2])) < 1.0e-5F);
+    }
+}
+
+void TestQuality()
+{
+    // A sky gradient with a small and very bright sun, the worst case for a low sample count
+    float3 const sun_direction = normalize(float3(0.3F, 0.6F, 0.5F));
+    auto const   cube_map =
+        PrefilterIBLReference::CreateCubeMap(128, [&sun_direction](float3 const &direction) {
+            float3 const sky = float3(0.3F, 0.5F, 1.0F) * std::max(direction.y, 0.0F) + 0.05F;
+            return sky + float3(100.0F) * std::pow(std::max(dot(direction, sun_direction), 0.0F), 1000.0F);
+        });
+    std::vector<float3> directions;
+    for (float const offset : {0.0F, 0.05F, 0.1F, 0.2F, 0.4F})
+    {
+        directions.push_back(normalize(sun_direction + float3(offset, 0.0F, 0.0F)));
+    }
+    for (uint32_t face = 0; face < 6; ++face)
+    {
+        directions.push_back(normalize(PrefilterIBLReference::GetCubeDirection(face, float2(0.5F))));
+    }
+
+    // PrefilterIBL takes 64 samples from the filtered environment mips where it previously took 1024 samples
+    // from the full resolution environment. Compare both against a brute force integration of the GGX lobe.
+    constexpr uint32_t output_size = 1024;
+    constexpr uint32_t mip_count   = 5;
+    for (uint32_t mip_level = 1; mip_level < mip_count; ++mip_level)
+    {
+        float const alpha   = PrefilterIBLReference::CalculateAlpha(mip_level, mip_count);
+        auto const  samples = PrefilterIBLReference::GenerateSamples(alpha, 64);
+        float       max_radiance         = 0.0F;
+        float       max_filtered_error   = 0.0F;
+        float       max_unfiltered_error = 0.0F;
+        for (auto const &direction : directions)
+        {
+            float3 const reference =
+                PrefilterIBLReference::IntegratePrefilter(cube_map, direction, alpha, 8192);
+            float3 const filtered =
+                PrefilterIBLReference::Prefilter(cube_map, direction, samples, output_size >> mip_level);
+            float3 const unfiltered =
+                PrefilterIBLReference::IntegratePrefilter(cube_map, direction, alpha, 1024);
+            max_radiance         = std::max(max_radiance, compMax(reference));
+            max_filtered_error   = std::max(max_filtered_error, compMax(abs(filtered - reference)));
+            max_unfiltered_error = std::max(max_unfiltered_error, compMax(abs(unfiltered - reference)));
+        }
+        float const filtered_error   = max_filtered_error / max_radiance;
+        float const unfiltered_error = max_unfiltered_error / max_radiance;
+
+        // Glossy mips lose some accuracy as the pre-blurred mips smear the sun (up to ~5% of the peak)
+        CHECK(filtered_error < 0.15F);
+        CHECK(filtered_error < unfiltered_error + 0.06F);
+        if (mip_level == mip_count - 1)
+        {
+            // The roughest mip is undersampled at 1024 samples, filtering removes most of the noise
+            CHECK(filtered_error < 0.5F * unfiltered_error);
+        }
+    }
+}
+} // namespace
+
+int main()
+{
+    TestSamples();
+    TestCubeMap();
+    TestQuality();
+    return Test::Result();
+}
@@ -0,0 +1,143 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "gi1/ray_binning.h"
+#include "test.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace Capsaicin;
+
+namespace
+{
+void TestSpreadBits()
+{
+    CHECK(RayBinning::SpreadBits(0x0U) == 0x0U);
+    CHECK(RayBinning::SpreadBits(0x5U) == 0x11U);
+    CHECK(RayBinning::SpreadBits(0xFFFU) == 0x555555U);
+    CHECK(RayBinning::SpreadBits(0x1000U) == 0x0U); // only the lower 12 bits are kept
+}
+
+void TestKeyLayout()
+{
+    uint32_t const cell_size = 8;
+
+    // The octant makes up the most significant bits
+    for (uint32_t octant = 0; octant < 8; ++octant)
+    {
+        float3 const direction((octant & 1) != 0 ? -1.0F : 1.0F, (octant & 2) != 0 ? -1.0F : 1.0F,
+            (octant & 4) != 0 ? -1.0F : 1.0F);
+        uint32_t const key = RayBinning::CalculateKey(direction, uint2(0, 0), cell_size);
+        CHECK(key == octant << (2 * RayBinning::kCellBitCount));
+        CHECK(RayBinning::GetOctant(key) == octant);
+        CHECK(key != RayBinning::kInvalidKey);
+    }
+
+    // The screen cells follow a Morton curve, x in the even bits and y in the odd ones
+    float3 const up(0.0F, 1.0F, 0.0F);
+    CHECK(RayBinning::CalculateKey(up, uint2(3 * cell_size, cell_size), cell_size) == 0x7U);
+    CHECK(RayBinning::CalculateKey(up, uint2(3 * cell_size + 7, cell_size + 7), cell_size) == 0x7U);
+    CHECK(RayBinning::CalculateKey(up, uint2(0, 2 * cell_size), cell_size) == 0x8U);
+
+    // Each aligned 2x2 block of cells maps to 4 consecutive keys
+    for (uint32_t y = 0; y < 16; y += 2)
+    {
+        for (uint32_t x = 0; x < 16; x += 2)
+        {
+            uint32_t const base_key = RayBinning::CalculateKey(up, uint2(x, y) * cell_size, cell_size);
+            CHECK(base_key % 4 == 0);
+            CHECK(RayBinning::CalculateKey(up, uint2(x + 1, y) * cell_size, cell_size) == base_key + 1);
+            CHECK(RayBinning::CalculateKey(up, uint2(x, y + 1) * cell_size, cell_size) == base_key + 2);
+            CHECK(RayBinning::CalculateKey(up, uint2(x + 1, y + 1) * cell_size, cell_size) == base_key + 3);
+        }
+    }
+}
+
+void TestSort()
+{
+    // Rays of a 16x16 pixel tile with directions alternating between two octants
+    uint32_t const        cell_size = 4;
+    std::vector<uint32_t> keys;
+    for (uint32_t y = 0; y < 16; ++y)
+    {
+        for (uint32_t x = 0; x < 16; ++x)
+        {
+            float3 const direction((x + y) % 2 == 0 ? 1.0F : -1.0F, 1.0F, 1.0F);
+            keys.push_back(RayBinning::CalculateKey(direction, uint2(x, y), cell_size));
+        }
+    }
+    keys[5]  = RayBinning::kInvalidKey;
+    keys[17] = RayBinning::kInvalidKey;
+
+    auto const order = RayBinning::Sort(keys);
+    CHECK(order.size() == keys.size());
+
+    std::vector<uint32_t> sorted_keys;
+    for (uint32_t const index : order)
+    {
+        sorted_keys.push_back(keys[index]);
+    }
+    CHECK(std::ranges::is_sorted(sorted_keys));
+
+    // Rays that do not need tracing come last, in their original order
+    CHECK(order[order.size() - 2] == 5 && order.back() == 17);
+
+    // Each octant forms a single contiguous run and rays sharing a key keep their original order
+    uint32_t octant_changes = 0;
+    for (size_t i = 1; i < order.size() - 2; ++i)
+    {
+        octant_changes += RayBinning::GetOctant(sorted_keys[i]) != RayBinning::GetOctant(sorted_keys[i - 1]);
+        if (sorted_keys[i] == sorted_keys[i - 1])
+        {
+            CHECK(order[i - 1] < order[i]);
+        }
+    }
+    CHECK(octant_changes == 1);
+}
+
+void TestShaderIsInSync()
+{
+    // The shader hard-codes the key layout, make sure it still matches the reference
+    std::ifstream const file(CAPSAICIN_SOURCE_DIR "/render_techniques/gi1/gi1.hlsl");
+    CHECK(file.good());
+    std::stringstream source;
+    source << file.rdbuf();
+    std::string const shader = source.str();
+
+    CHECK(shader.find("value &= 0x00000FFFu;") != std::string::npos);
+    std::string const octant_shift = "(octant << " + std::to_string(2 * RayBinning::kCellBitCount) + ")";
+    CHECK(shader.find(octant_shift) != std::string::npos);
+    CHECK(shader.find("(SpreadRayBinningBits(cell.y) << 1)") != std::string::npos);
+}
+} // namespace
+
+int main()
+{
+    TestSpreadBits();
+    TestKeyLayout();
+    TestSort();
+    TestShaderIsInSync();
+    return Test::Result();
+}
@@ -0,0 +1,181 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "capsaicin/task_scheduler.h"
+
+#include <glm/glm.hpp>
+
+#include "capsaicin/common_functions.inl"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** Simplified copy of the per-instance scene state touched by the scene update job. */
+struct Instance
+{
+    glm::mat4 transform;
+    glm::vec3 min_bounds;
+    glm::vec3 max_bounds;
+};
+
+/** Results of evaluating the scene for a frame, mirrors CapsaicinInternal::SceneSnapshot. */
+struct Snapshot
+{
+    size_t                                       transform_hash = 0;
+    std::vector<glm::mat4>                       transforms;
+    std::vector<std::pair<glm::vec3, glm::vec3>> bounds;
+};
+
+/** Animates every instance transform, standing in for gfxSceneApplyAnimation. */
+void ApplyAnimations(std::vector<Instance> &instances, double const play_time) noexcept
+{
+    ParallelFor(0U, static_cast<uint32_t>(instances.size()), [&](uint32_t const i) {
+        float const angle = static_cast<float>(play_time) + 0.001F * static_cast<float>(i);
+        float const c = std::cos(angle), s = std::sin(angle);
+        glm::mat4  &transform = instances[i].transform;
+        transform             = glm::mat4(1.0F);
+        transform[0][0]       = c;
+        transform[0][2]       = -s;
+        transform[2][0]       = s;
+        transform[2][2]       = c;
+        transform[3]          = glm::vec4(static_cast<float>(i % 128), std::sin(angle), 0.0F, 1.0F);
+    });
+}
+
+/**
+ * Evaluates the scene for the next frame, same steps as CapsaicinInternal::PrepareSceneSnapshot.
+ * @param instances The instances to animate, a private copy when pipelined.
+ */
+void PrepareSnapshot(std::vector<Instance> &instances, double const play_time, Snapshot &snapshot) noexcept
+{
+    ApplyAnimations(instances, play_time);
+    snapshot.transforms.resize(instances.size());
+    snapshot.bounds.resize(instances.size());
+    ParallelFor(0U, static_cast<uint32_t>(instances.size()), [&](uint32_t const i) {
+        snapshot.transforms[i] = instances[i].transform;
+        CalculateTransformedBounds(instances[i].min_bounds, instances[i].max_bounds, instances[i].transform,
+            snapshot.bounds[i].first, snapshot.bounds[i].second);
+    });
+    snapshot.transform_hash = ParallelReduce(
+        snapshot.transforms.data(), snapshot.transforms.data() + snapshot.transforms.size(),
+        static_cast<size_t>(0x12345678U),
+        [](glm::mat4 const *start, glm::mat4 const *end, size_t hash) -> size_t {
+            for (auto j = start; j < end; ++j)
+            {
+                for (uint32_t k = 0; k < 16; ++k)
+                {
+                    float const value = (*j)[k / 4][k % 4];
+                    hash ^= std::hash<float> {}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                }
+            }
+            return hash;
+        },
+        [](size_t const hash1, size_t const hash2) -> size_t {
+            return hash1 ^ (hash2 + 0x9e3779b9 + (hash1 << 6) + (hash1 >> 2));
+        });
+}
+
+/** Copies the animated transforms into the rendered scene, same as CapsaicinInternal::applySceneSnapshot. */
+void ApplySnapshot(Snapshot const &snapshot, std::vector<Instance> &instances) noexcept
+{
+    ParallelFor(0U, static_cast<uint32_t>(instances.size()),
+        [&](uint32_t const i) { instances[i].transform = snapshot.transforms[i]; });
+}
+
+/**
+ * Simulates a number of frames and returns the average render thread time per frame in milliseconds.
+ * @param pipelined True to evaluate the next frame's scene in a job that overlaps GUI and present.
+ */
+double RunFrames(std::vector<Instance> &instances, bool const pipelined) noexcept
+{
+    uint32_t const frame_count  = 60;
+    auto const     present_time = std::chrono::milliseconds(4);
+    double const   frame_time   = 1.0 / 60.0;
+    TaskGroup      scene_update_group;
+    // The job only accesses its own copy of the scene and the pending snapshot
+    std::vector<Instance> animation_instances = instances;
+    Snapshot              snapshot;
+    Snapshot              pending_snapshot;
+    double                play_time = 0.0;
+    double                busy_time = 0.0;
+    for (uint32_t frame = 0; frame < frame_count; ++frame)
+    {
+        // Scene update at the start of the frame, only the wait and the copy remain when pipelined
+        auto const start = std::chrono::steady_clock::now();
+        if (pipelined && frame > 0)
+        {
+            scene_update_group.wait();
+            std::swap(snapshot, pending_snapshot);
+            ApplySnapshot(snapshot, instances);
+        }
+        else
+        {
+            PrepareSnapshot(instances, play_time, snapshot);
+        }
+        auto const end = std::chrono::steady_clock::now();
+        busy_time += std::chrono::duration<double, std::milli>(end - start).count();
+        play_time += frame_time;
+
+        // Start evaluating the next frame, then block the render thread as GUI and present would
+        if (pipelined)
+        {
+            scene_update_group.run([&, next_play_time = play_time] {
+                PrepareSnapshot(animation_instances, next_play_time, pending_snapshot);
+            });
+        }
+        std::this_thread::sleep_for(present_time);
+    }
+    scene_update_group.wait();
+    return busy_time / frame_count;
+}
+} // namespace
+
+int main()
+{
+    uint32_t const max_worker_count = TaskScheduler::GetDefaultWorkerCount();
+    for (uint32_t const instance_count : {1U << 12, 1U << 16, 1U << 18})
+    {
+        std::vector<Instance> instances(instance_count);
+        for (auto &instance : instances)
+        {
+            instance.min_bounds = glm::vec3(-1.0F);
+            instance.max_bounds = glm::vec3(1.0F);
+        }
+        for (uint32_t worker_count = 0; worker_count <= max_worker_count;
+             worker_count          = std::max(2 * worker_count, 1U))
+        {
+            TaskScheduler::Get().setWorkerCount(worker_count);
+            double const serial_time    = RunFrames(instances, false);
+            double const pipelined_time = RunFrames(instances, true);
+            std::printf("%7u instances, %2u workers: render thread %.3f ms per frame, pipelined %.3f ms\n",
+                instance_count, worker_count, serial_time, pipelined_time);
+        }
+    }
+    TaskScheduler::Get().setWorkerCount(max_worker_count);
+    return 0;
+}
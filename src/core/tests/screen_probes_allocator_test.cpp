@@ -0,0 +1,205 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "gi1/screen_probes_allocator.h"
+#include "test.h"
+
+#include <cmath>
+#include <random>
+
+using namespace Capsaicin;
+
+namespace
+{
+using Allocator = ScreenProbesAllocator;
+
+/** A spawn tile of the given importance. */
+Allocator::Tile MakeTile(float const importance, bool const is_reprojected = true) noexcept
+{
+    Allocator::Tile tile;
+    tile.relative_variance = importance;
+    tile.is_reprojected    = is_reprojected;
+    return tile;
+}
+
+void TestImportance()
+{
+    Allocator::Tile tile;
+    CHECK(Allocator::CalculateImportance(tile) == 0.0F);
+    tile.relative_variance = 0.1F;
+    tile.normal_variation  = 0.3F;
+    tile.depth_variation   = 0.2F;
+    CHECK(Allocator::CalculateImportance(tile) == 0.3F);
+    tile.depth_variation = 0.4F;
+    CHECK(Allocator::CalculateImportance(tile) == 0.4F);
+}
+
+void TestProbeCount()
+{
+    Allocator::Settings const settings;
+    uint2 const               coords(3, 5);
+
+    // Sky tiles never spawn, whatever their importance
+    Allocator::Tile sky = MakeTile(1.0F);
+    sky.is_sky          = true;
+    CHECK(Allocator::CalculateProbeCount(settings, sky, coords, 0) == 0);
+
+    // Detailed tiles get a probe per non-sky probe tile
+    Allocator::Tile detailed = MakeTile(settings.high_threshold);
+    CHECK(Allocator::CalculateProbeCount(settings, detailed, coords, 0) == Allocator::kMaxProbesPerTile);
+    detailed.extra_probe_count = 1;
+    CHECK(Allocator::CalculateProbeCount(settings, detailed, coords, 0) == 2);
+    detailed.extra_probe_count = 7;
+    CHECK(Allocator::CalculateProbeCount(settings, detailed, coords, 0) == Allocator::kMaxProbesPerTile);
+
+    // Ordinary tiles, and flat tiles that failed reprojection, keep the single base probe
+    CHECK(Allocator::CalculateProbeCount(settings, MakeTile(0.1F), coords, 0) == 1);
+    CHECK(Allocator::CalculateProbeCount(settings, MakeTile(0.0F, false), coords, 0) == 1);
+    CHECK(Allocator::CalculateProbeCount(settings, MakeTile(settings.low_threshold), coords, 0) == 1);
+
+    // Flat reprojected tiles are refreshed every other frame, in a checkerboard so neighbours alternate
+    Allocator::Tile const flat = MakeTile(0.0F);
+    for (uint32_t frame = 0; frame < 4; ++frame)
+    {
+        uint32_t const count = Allocator::CalculateProbeCount(settings, flat, coords, frame);
+        CHECK(count <= 1);
+        CHECK(count + Allocator::CalculateProbeCount(settings, flat, coords, frame + 1) == 1);
+        CHECK(count + Allocator::CalculateProbeCount(settings, flat, uint2(4, 5), frame) == 1);
+    }
+}
+
+void TestAllocateWithinBudget()
+{
+    Allocator::Settings const settings;
+    uint32_t const            width = 8;
+    uint32_t const            count = width * 8;
+
+    // Ordinary tiles use the whole budget with base probes only
+    Allocator::Allocation allocation =
+        Allocator::Allocate(settings, std::vector(count, MakeTile(0.1F)), width, 0);
+    CHECK(allocation.budget == count);
+    CHECK(allocation.base_probe_count == count);
+    CHECK(allocation.extra_probe_count == 0 && allocation.dropped_count == 0);
+    CHECK(allocation.getRayBudgetSaved() == 0.0F);
+
+    // A flat and stable image only spawns half of the probes each frame
+    allocation = Allocator::Allocate(settings, std::vector(count, MakeTile(0.0F)), width, 1);
+    CHECK(allocation.getProbeCount() == count / 2);
+    CHECK(allocation.getRayBudgetSaved() == 0.5F);
+
+    // When every tile is detailed no budget is left for the extra probes, which are all dropped
+    allocation = Allocator::Allocate(settings, std::vector(count, MakeTile(1.0F)), width, 0);
+    CHECK(allocation.base_probe_count == count);
+    CHECK(allocation.extra_probe_count == 0);
+    CHECK(allocation.dropped_count == 3 * count);
+    CHECK(allocation.getRayBudgetSaved() == 0.0F);
+}
+
+void TestAllocateSpendsSavedBudget()
+{
+    Allocator::Settings const settings;
+    uint32_t const            width = 8;
+    uint32_t const            count = width * 8;
+
+    // The top half of the image is flat, the bottom half ordinary but for a few detailed tiles
+    std::vector<Allocator::Tile> tiles(count, MakeTile(0.1F));
+    std::fill_n(tiles.begin(), count / 2, MakeTile(0.0F));
+    for (uint32_t const tile_index : {40U, 45U, 50U, 63U})
+    {
+        tiles[tile_index] = MakeTile(1.0F);
+    }
+
+    // The flat half frees 16 probes, the detailed tiles request 12 extra ones which all fit
+    Allocator::Allocation allocation = Allocator::Allocate(settings, tiles, width, 0);
+    CHECK(allocation.base_probe_count == count / 4 + count / 2);
+    CHECK(allocation.extra_probe_count == 12 && allocation.dropped_count == 0);
+    CHECK(allocation.getProbeCount() == count - 4);
+    CHECK(std::abs(allocation.getRayBudgetSaved() - 4.0F / static_cast<float>(count)) < 1e-6F);
+
+    // With more detailed tiles than the saved budget allows, extra probes are granted in tile order
+    for (uint32_t tile_index = count / 2; tile_index < count / 2 + 8; ++tile_index)
+    {
+        tiles[tile_index] = MakeTile(1.0F);
+    }
+    allocation = Allocator::Allocate(settings, tiles, width, 0);
+    CHECK(allocation.base_probe_count == count / 4 + count / 2);
+    CHECK(allocation.extra_probe_count == count / 4);
+    CHECK(allocation.dropped_count == 12 * 3 - count / 4);
+    CHECK(allocation.getProbeCount() == allocation.budget);
+    CHECK(allocation.getRayBudgetSaved() == 0.0F);
+    CHECK(allocation.extra_offsets[count / 2] == 0 && allocation.extra_offsets[count / 2 + 1] == 3);
+}
+
+void TestAllocateInvariants()
+{
+    Allocator::Settings const             settings;
+    uint32_t const                        width = 16;
+    std::mt19937                          random(7);
+    std::uniform_real_distribution<float> importance(0.0F, 0.4F);
+    for (uint32_t frame = 0; frame < 32; ++frame)
+    {
+        std::vector<Allocator::Tile> tiles(width * 9);
+        for (auto &tile : tiles)
+        {
+            tile                   = MakeTile(importance(random), (random() & 3) != 0);
+            tile.is_sky            = (random() & 15) == 0;
+            tile.extra_probe_count = random() % 4;
+        }
+        Allocator::Allocation const allocation = Allocator::Allocate(settings, tiles, width, frame);
+
+        // Never over budget, and every requested probe is either spawned or dropped
+        uint32_t base_sum  = 0;
+        uint32_t extra_sum = 0;
+        for (size_t i = 0; i < tiles.size(); ++i)
+        {
+            CHECK(allocation.base_offsets[i] == base_sum);
+            CHECK(allocation.extra_offsets[i] == extra_sum);
+            CHECK(allocation.base_counts[i] <= 1);
+            CHECK(allocation.base_counts[i] > 0 || allocation.extra_counts[i] == 0);
+            base_sum  += allocation.base_counts[i];
+            extra_sum += allocation.extra_counts[i];
+        }
+        CHECK(allocation.base_probe_count == base_sum);
+        CHECK(allocation.extra_probe_count + allocation.dropped_count == extra_sum);
+        CHECK(allocation.getProbeCount() <= allocation.budget);
+        CHECK(allocation.dropped_count == 0 || allocation.getProbeCount() == allocation.budget);
+        CHECK(allocation.getRayBudgetSaved() >= 0.0F && allocation.getRayBudgetSaved() <= 1.0F);
+    }
+
+    // Degenerate inputs
+    Allocator::Allocation const empty = Allocator::Allocate(settings, {}, width, 0);
+    CHECK(empty.budget == 0 && empty.getProbeCount() == 0 && empty.getRayBudgetSaved() == 0.0F);
+    Allocator::Allocation const no_width =
+        Allocator::Allocate(settings, std::vector(4, MakeTile(0.1F)), 0, 0);
+    CHECK(no_width.getProbeCount() == 0);
+}
+} // namespace
+
+int main()
+{
+    TestImportance();
+    TestProbeCount();
+    TestAllocateWithinBudget();
+    TestAllocateSpendsSavedBudget();
+    TestAllocateInvariants();
+    return Test::Result();
+}
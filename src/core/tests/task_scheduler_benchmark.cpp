@@ -0,0 +1,97 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "capsaicin/task_scheduler.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** Runs a function a few times and returns its best time in milliseconds. */
+template<typename FUNCTION>
+double Measure(FUNCTION const &function) noexcept
+{
+    double best_time = 1e30;
+    for (uint32_t run = 0; run < 5; ++run)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        best_time = std::min(best_time,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best_time;
+}
+
+/** Some arithmetic heavy work that cannot be optimised away. */
+float Work(uint32_t const index) noexcept
+{
+    float value = static_cast<float>(index);
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        value = std::sin(value) * 0.5F + std::sqrt(std::abs(value) + 1.0F);
+    }
+    return value;
+}
+} // namespace
+
+int main()
+{
+    uint32_t const     max_worker_count = TaskScheduler::GetDefaultWorkerCount();
+    uint32_t const     item_count       = 1 << 16;
+    std::vector<float> results(item_count);
+
+    double const serial_time = Measure([&] {
+        for (uint32_t i = 0; i < item_count; ++i)
+        {
+            results[i] = Work(i);
+        }
+    });
+    std::printf("Serial loop: %.2f ms\n", serial_time);
+
+    for (uint32_t worker_count = 0; worker_count <= max_worker_count;
+         worker_count = std::max(2 * worker_count, 1U))
+    {
+        TaskScheduler::Get().setWorkerCount(worker_count);
+
+        // Scaling of a balanced loop
+        double const loop_time =
+            Measure([&] { ParallelFor(0U, item_count, [&](uint32_t const i) { results[i] = Work(i); }); });
+
+        // Overhead of scheduling many tiny tasks, including nested ones that get stolen
+        uint32_t const task_count = 1 << 16;
+        double const   task_time  = Measure([&] {
+            std::atomic<uint32_t> count = 0;
+            ParallelFor(0U, task_count / 64, 1U, [&](uint32_t) {
+                ParallelFor(0U, 64U, 1U, [&](uint32_t) { ++count; });
+            });
+        });
+
+        std::printf("%2u workers: loop %.2f ms (x%.2f), %.0f ns per task\n", worker_count, loop_time,
+            serial_time / loop_time, 1e6 * task_time / (task_count + task_count / 64));
+    }
+    TaskScheduler::Get().setWorkerCount(max_worker_count);
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "capsaicin/task_scheduler.h"
+#include "test.h"
+
+#include <numeric>
+#include <thread>
+
+using namespace Capsaicin;
+
+namespace
+{
+void TestNestedTasks(TaskScheduler &scheduler)
+{
+    // Tasks spawning tasks go to the worker queues, from where they get stolen by the other workers
+    std::vector<std::atomic<uint32_t>> counts(1000);
+    TaskGroup                          group(scheduler);
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        group.run([&scheduler, &counts, i] {
+            TaskGroup nested_group(scheduler);
+            for (uint32_t j = 0; j < 10; ++j)
+            {
+                nested_group.run([&counts, i] { ++counts[i]; });
+            }
+            nested_group.wait();
+        });
+    }
+    group.wait();
+    CHECK(std::ranges::all_of(counts, [](auto const &count) { return count == 10; }));
+}
+
+void TestParallelReduce()
+{
+    // The chunks do not depend on the thread count so the result is deterministic
+    std::vector<float> values(100000);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = 1.0F / static_cast<float>(i + 1);
+    }
+    auto const sum = [&values] {
+        return ParallelReduce(
+            values.data(), values.data() + values.size(), 0.0F,
+            [](float const *start, float const *end, float const init) {
+                return std::accumulate(start, end, init);
+            },
+            [](float const left, float const right) { return left + right; }, 1000);
+    };
+    float const reference = sum();
+    for (uint32_t worker_count : {0U, 1U, 3U, 8U})
+    {
+        TaskScheduler::Get().setWorkerCount(worker_count);
+        CHECK(sum() == reference);
+    }
+    TaskScheduler::Get().setWorkerCount(TaskScheduler::GetDefaultWorkerCount());
+}
+
+void TestContinuation(TaskScheduler &scheduler)
+{
+    std::atomic<uint32_t> count              = 0;
+    uint32_t              continuation_count = 0;
+    TaskGroup             group(scheduler);
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+        group.run([&count] { ++count; });
+    }
+    group.then([&count, &continuation_count, &group] {
+        // Continuations run once all previous tasks are done and may add more work
+        continuation_count = count;
+        group.run([&count] { count += 100; });
+    });
+    group.wait();
+    CHECK(continuation_count == 20);
+    CHECK(count == 120);
+}
+
+void TestConcurrentSubmission(TaskScheduler &scheduler)
+{
+    // External threads submitting to the shared queue while the workers are popping from it used to make
+    // the queued task count wrap around, after which idle workers would never go back to sleep
+    std::atomic<uint32_t>    count = 0;
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&] {
+            TaskGroup group(scheduler);
+            for (uint32_t j = 0; j < 10000; ++j)
+            {
+                group.run([&count] { ++count; });
+            }
+            group.wait();
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(count == 40000);
+    CHECK(!scheduler.runPendingTask());
+}
+} // namespace
+
+int main()
+{
+    for (uint32_t iteration = 0; iteration < 10; ++iteration)
+    {
+        TaskScheduler scheduler(1 + iteration % 4);
+        TestNestedTasks(scheduler);
+        TestContinuation(scheduler);
+        TestConcurrentSubmission(scheduler);
+    }
+    TestParallelReduce();
+    return Test::Result();
+}
@@ -0,0 +1,190 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "test.h"
+#include "utilities/texture_cache_file.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+
+using namespace Capsaicin;
+
+namespace
+{
+/** A directory removed once the test completes. */
+struct TempDirectory
+{
+    TempDirectory() noexcept
+    {
+        std::error_code ec;
+        path = std::filesystem::temp_directory_path(ec) / "capsaicin_texture_cache_test";
+        std::filesystem::remove_all(path, ec);
+        std::filesystem::create_directories(path, ec);
+    }
+
+    ~TempDirectory() noexcept
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    TempDirectory(TempDirectory const &other)                = delete;
+    TempDirectory(TempDirectory &&other) noexcept            = delete;
+    TempDirectory &operator=(TempDirectory const &other)     = delete;
+    TempDirectory &operator=(TempDirectory &&other) noexcept = delete;
+
+    std::filesystem::path path;
+};
+
+void WriteFile(std::filesystem::path const &filePath, std::string_view const contents)
+{
+    std::filesystem::create_directories(filePath.parent_path());
+    std::ofstream file(filePath, std::ios::binary);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+void TestKey(std::filesystem::path const &directory)
+{
+    // Keys are deterministic and depend on every value and on their order
+    CHECK(TextureCacheKey().add(1U).add(2U).getValue() == TextureCacheKey().add(1U).add(2U).getValue());
+    CHECK(TextureCacheKey().add(1U).add(2U).getValue() != TextureCacheKey().add(2U).add(1U).getValue());
+    CHECK(TextureCacheKey().add(1U).getValue() != TextureCacheKey().add(1ULL).getValue());
+    CHECK(TextureCacheKey().add("ab").add("c").getValue() != TextureCacheKey().add("a").add("bc").getValue());
+
+    // File contents are hashed rather than their name
+    WriteFile(directory / "a.bin", "0123456789abcdef0123456789");
+    WriteFile(directory / "b.bin", "0123456789abcdef0123456789");
+    TextureCacheKey file_a;
+    TextureCacheKey file_b;
+    CHECK(file_a.addFile(directory / "a.bin") && file_b.addFile(directory / "b.bin"));
+    CHECK(file_a.getValue() == file_b.getValue());
+    WriteFile(directory / "b.bin", "0123456789abcdef0123456788");
+    file_b = TextureCacheKey();
+    CHECK(file_b.addFile(directory / "b.bin"));
+    CHECK(file_a.getValue() != file_b.getValue());
+    CHECK(!TextureCacheKey().addFile(directory / "missing.bin"));
+}
+
+void TestShaderKey(std::filesystem::path const &directory)
+{
+    // Includes are resolved next to the including file first and then through the include paths
+    std::filesystem::path const shaders  = directory / "shaders";
+    std::filesystem::path const includes = directory / "includes";
+    WriteFile(shaders / "kernel.comp",
+        "#include \"local.hlsl\"\n  # include \"math/common.hlsl\"\nvoid main() {}\n");
+    WriteFile(shaders / "local.hlsl", "#include \"math/common.hlsl\"\nfloat Local();\n");
+    WriteFile(includes / "math/common.hlsl", "float Common();\n");
+    auto const hash = [&](std::vector<std::filesystem::path> const &include_paths) {
+        TextureCacheKey key;
+        return key.addShaderFile(shaders / "kernel.comp", include_paths) ? key.getValue() : 0;
+    };
+    uint64_t const key = hash({includes});
+    CHECK(key != 0);
+    CHECK(hash({includes}) == key);
+    CHECK(hash({}) == 0);
+
+    // Editing any included file changes the key
+    WriteFile(includes / "math/common.hlsl", "float Common(float value);\n");
+    uint64_t const common_key = hash({includes});
+    CHECK(common_key != 0 && common_key != key);
+    WriteFile(shaders / "local.hlsl", "#include \"math/common.hlsl\"\nfloat Local(float value);\n");
+    uint64_t const local_key = hash({includes});
+    CHECK(local_key != 0 && local_key != common_key);
+
+    // Include cycles terminate
+    WriteFile(shaders / "cycle.hlsl", "#include \"cycle.hlsl\"\n");
+    TextureCacheKey cycle_key;
+    CHECK(cycle_key.addShaderFile(shaders / "cycle.hlsl", {}));
+}
+
+void TestRoundTrip(std::filesystem::path const &directory)
+{
+    // A cube map with a full mip chain of 8 byte texels (e.g. R16G16B16A16_FLOAT)
+    TextureCacheData data;
+    data.key        = TextureCacheKey().add(42U).getValue();
+    data.format     = 10;
+    data.width      = 16;
+    data.height     = 16;
+    data.mip_levels = 5;
+    data.is_cube    = true;
+    data.user_data  = {4096, 2048, 0, 7};
+    data.data.resize(CalculateTextureCacheSize(8, 16, 16, 5, true));
+    CHECK(data.data.size() == (256 + 64 + 16 + 4 + 1) * 8 * 6);
+    for (size_t i = 0; i < data.data.size(); ++i)
+    {
+        data.data[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    std::filesystem::path const file_path = GetTextureCacheFile(directory, "EnvironmentMap", data.key);
+    CHECK(file_path.parent_path() == directory);
+    CHECK(WriteTextureCacheFile(file_path, data));
+    CHECK(std::filesystem::file_size(file_path) == 148 + data.data.size());
+
+    // No temporary files are left behind
+    size_t file_count = 0;
+    for ([[maybe_unused]] auto const &entry : std::filesystem::directory_iterator(directory))
+    {
+        ++file_count;
+    }
+    CHECK(file_count == 1);
+
+    TextureCacheData read;
+    CHECK(ReadTextureCacheFile(file_path, data.key, read));
+    CHECK(read.key == data.key);
+    CHECK(read.format == data.format);
+    CHECK(read.width == data.width && read.height == data.height);
+    CHECK(read.mip_levels == data.mip_levels);
+    CHECK(read.is_cube);
+    CHECK(read.user_data == data.user_data);
+    CHECK(read.data == data.data);
+
+    // Files written with another key or truncated are rejected
+    TextureCacheData rejected;
+    CHECK(!ReadTextureCacheFile(file_path, data.key + 1, rejected));
+    CHECK(!ReadTextureCacheFile(directory / "missing.dds", data.key, rejected));
+    std::filesystem::resize_file(file_path, 100);
+    CHECK(!ReadTextureCacheFile(file_path, data.key, rejected));
+
+    // A 2D texture without mips
+    TextureCacheData lut;
+    lut.key    = TextureCacheKey().add(43U).getValue();
+    lut.format = 34;
+    lut.width  = 8;
+    lut.height = 4;
+    lut.data.assign(CalculateTextureCacheSize(4, 8, 4, 1, false), 0xAB);
+    std::filesystem::path const lut_path = GetTextureCacheFile(directory / "nested", "BrdfLut", lut.key);
+    CHECK(WriteTextureCacheFile(lut_path, lut));
+    CHECK(ReadTextureCacheFile(lut_path, lut.key, read));
+    CHECK(read.width == 8 && read.height == 4 && read.mip_levels == 1 && !read.is_cube);
+    CHECK(read.data == lut.data);
+}
+} // namespace
+
+int main()
+{
+    TempDirectory const directory;
+    TestKey(directory.path);
+    TestShaderKey(directory.path);
+    TestRoundTrip(directory.path / "cache");
+    return Test::Result();
+}
@@ -0,0 +1,293 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "benchmark_manifest.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <tuple>
+#include <yaml-cpp/yaml.h>
+
+using namespace std;
+
+namespace
+{
+/**
+ * Read a list of strings that may be given either as a single value or as a list.
+ * @param node     The parent node.
+ * @param single   The key used for a single value.
+ * @param multiple The key used for a list of values.
+ * @return The values, or a list containing a single empty string if neither key exists.
+ */
+vector<string> ReadList(YAML::Node const &node, char const *single, char const *multiple)
+{
+    vector<string> ret;
+    if (auto const value = node[single])
+    {
+        ret.push_back(value.as<string>());
+    }
+    if (auto const values = node[multiple])
+    {
+        for (auto const &value : values)
+        {
+            ret.push_back(value.as<string>());
+        }
+    }
+    if (ret.empty())
+    {
+        ret.emplace_back();
+    }
+    return ret;
+}
+
+/**
+ * Read the frame count and first frames.
+ * @param node                The node containing the values.
+ * @param [in,out] frames     The frame count.
+ * @param [in,out] first      The first frames (timings, images), empty to use the last frame.
+ * @param [in,out] autoWarmup Set if the first timings frame should be detected automatically.
+ */
+void ReadFrames(YAML::Node const &node, uint32_t &frames, vector<uint32_t> &first, bool &autoWarmup)
+{
+    if (auto const value = node["frames"])
+    {
+        frames = value.as<uint32_t>();
+    }
+    if (auto const value = node["first_frame"])
+    {
+        first.clear();
+        autoWarmup           = false;
+        auto const readFrame = [&first, &autoWarmup](YAML::Node const &frame) {
+            if (first.empty() && frame.as<string>() == "auto")
+            {
+                // Timings start is detected at runtime, so use the last frame as a placeholder
+                autoWarmup = true;
+                first.push_back(numeric_limits<uint32_t>::max());
+            }
+            else
+            {
+                first.push_back(frame.as<uint32_t>());
+            }
+        };
+        if (value.IsSequence())
+        {
+            for (auto const &frame : value)
+            {
+                readFrame(frame);
+            }
+        }
+        else
+        {
+            readFrame(value);
+        }
+    }
+}
+
+string MakeName(BenchmarkRun const &run, string const &prefix)
+{
+    string name = prefix;
+    for (auto const &part : {run.scene, run.environmentMap, run.camera, run.renderer, run.preset})
+    {
+        if (part.empty())
+        {
+            continue;
+        }
+        // Only keep the file name of any paths
+        string const partName = part.find_first_of("/\\") != string::npos
+                                  ? filesystem::path(part).stem().string()
+                                  : part;
+        if (!name.empty())
+        {
+            name += '_';
+        }
+        name += partName;
+    }
+    // Remove characters that would be problematic in file names
+    ranges::replace_if(
+        name, [](char const c) { return c == ' ' || c == '/' || c == '\\' || c == ':' || c == '.'; }, '-');
+    return name;
+}
+} // namespace
+
+bool BenchmarkManifest::parse(string const &text, string &error) noexcept
+{
+    // Runs are expanded separately so that an error part way through leaves no runs behind
+    runs.clear();
+    vector<BenchmarkRun> parsed;
+    try
+    {
+        YAML::Node const data = YAML::Load(text);
+
+        uint32_t         defaultFrames = 512;
+        vector<uint32_t> defaultFirst;
+        bool             defaultAutoWarmup = false;
+        ReadFrames(data, defaultFrames, defaultFirst, defaultAutoWarmup);
+
+        map<string, vector<pair<string, string>>> presets;
+        if (auto const presetList = data["presets"])
+        {
+            for (auto const &preset : presetList)
+            {
+                auto &options = presets[preset.first.as<string>()];
+                for (auto const &option : preset.second)
+                {
+                    options.emplace_back(option.first.as<string>(), option.second.as<string>());
+                }
+            }
+        }
+
+        auto const runList = data["runs"];
+        if (!runList || !runList.IsSequence() || runList.size() == 0)
+        {
+            error = "Benchmark manifest does not contain any runs";
+            return false;
+        }
+        for (auto const &entry : runList)
+        {
+            uint32_t         frames     = defaultFrames;
+            vector<uint32_t> first      = defaultFirst;
+            bool             autoWarmup = defaultAutoWarmup;
+            ReadFrames(entry, frames, first, autoWarmup);
+            if (frames == 0)
+            {
+                error = "Benchmark manifest run has an invalid frame count";
+                return false;
+            }
+            uint32_t const lastFrame = frames - 1;
+
+            auto const scenes = ReadList(entry, "scene", "scenes");
+            if (scenes.front().empty())
+            {
+                error = "Benchmark manifest run is missing a scene";
+                return false;
+            }
+            auto const renderers = ReadList(entry, "renderer", "renderers");
+            if (renderers.front().empty())
+            {
+                error = "Benchmark manifest run is missing a renderer";
+                return false;
+            }
+            auto const   environmentMaps = ReadList(entry, "environment_map", "environment_maps");
+            auto const   cameras         = ReadList(entry, "camera", "cameras");
+            auto const   presetNames     = ReadList(entry, "preset", "presets");
+            string const prefix          = entry["name"] ? entry["name"].as<string>() : "";
+
+            for (auto const &presetName : presetNames)
+            {
+                if (!presetName.empty() && !presets.contains(presetName))
+                {
+                    error = "Benchmark manifest uses unknown preset '" + presetName + "'";
+                    return false;
+                }
+            }
+
+            // Expand every combination of the lists, with scenes varying slowest and presets fastest
+            size_t const combinations = scenes.size() * environmentMaps.size() * cameras.size()
+                                      * renderers.size() * presetNames.size();
+            for (size_t combination = 0; combination < combinations; ++combination)
+            {
+                size_t     index = combination;
+                auto const next  = [&index](vector<string> const &list) -> string const & {
+                    string const &value = list[index % list.size()];
+                    index /= list.size();
+                    return value;
+                };
+                BenchmarkRun run;
+                run.preset         = next(presetNames);
+                run.renderer       = next(renderers);
+                run.camera         = next(cameras);
+                run.environmentMap = next(environmentMaps);
+                run.scene          = next(scenes);
+                if (!run.preset.empty())
+                {
+                    run.options = presets.at(run.preset);
+                }
+                run.frameCount       = frames;
+                run.timingStartFrame = !first.empty() ? min(first[0], lastFrame) : lastFrame;
+                run.imageStartFrame  = first.size() > 1 ? min(first[1], lastFrame) : lastFrame;
+                run.autoWarmup       = autoWarmup;
+                run.name             = MakeName(run, prefix);
+                parsed.push_back(std::move(run));
+            }
+        }
+    }
+    catch (exception const &e)
+    {
+        error = "Failed to parse benchmark manifest: "s + e.what();
+        return false;
+    }
+
+    // Ensure run names are unique so that saved files are not overwritten
+    map<string, uint32_t> nameCounts;
+    for (auto &run : parsed)
+    {
+        if (uint32_t const count = nameCounts[run.name]++; count > 0)
+        {
+            run.name += '_' + to_string(count);
+        }
+    }
+
+    Schedule(parsed);
+    runs = std::move(parsed);
+    return true;
+}
+
+bool BenchmarkManifest::load(filesystem::path const &fileName, string &error) noexcept
+{
+    ifstream file(fileName);
+    if (!file.is_open())
+    {
+        error = "Failed to open benchmark manifest '" + fileName.string() + "'";
+        return false;
+    }
+    stringstream text;
+    text << file.rdbuf();
+    return parse(text.str(), error);
+}
+
+vector<BenchmarkRun> const &BenchmarkManifest::getRuns() const noexcept
+{
+    return runs;
+}
+
+void BenchmarkManifest::Schedule(vector<BenchmarkRun> &runs) noexcept
+{
+    // Rank each value by its first appearance so that groups keep the manifest order
+    map<string, size_t> sceneOrder;
+    map<string, size_t> environmentOrder;
+    map<string, size_t> rendererOrder;
+    for (auto const &run : runs)
+    {
+        sceneOrder.try_emplace(run.scene, sceneOrder.size());
+        environmentOrder.try_emplace(run.environmentMap, environmentOrder.size());
+        rendererOrder.try_emplace(run.renderer, rendererOrder.size());
+    }
+    auto const rank = [&](BenchmarkRun const &run) {
+        return make_tuple(sceneOrder.at(run.scene), environmentOrder.at(run.environmentMap),
+            rendererOrder.at(run.renderer));
+    };
+    ranges::stable_sort(
+        runs, [&rank](BenchmarkRun const &a, BenchmarkRun const &b) { return rank(a) < rank(b); });
+}
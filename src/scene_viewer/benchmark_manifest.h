@@ -0,0 +1,104 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#pragma once
+
+#include <cinttypes>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/** A single benchmark configuration to be rendered. */
+struct BenchmarkRun
+{
+    std::string name;           /**< Unique name of the run (used as suffix for any saved files) */
+    std::string scene;          /**< Scene name or file */
+    std::string environmentMap; /**< Environment map name or file (empty to use the scene default) */
+    std::string camera;         /**< Camera name (empty to use the scene default) */
+    std::string renderer;       /**< Renderer name */
+    std::string preset;         /**< Render option preset name (empty if none) */
+    std::vector<std::pair<std::string, std::string>> options; /**< Render options set by the preset */
+    uint32_t frameCount       = 512; /**< Number of frames to render */
+    uint32_t timingStartFrame = 511; /**< First frame to capture timings from */
+    uint32_t imageStartFrame  = 511; /**< First frame to capture images from */
+    bool     autoWarmup       = false; /**< Start capturing timings once steady state is detected */
+};
+
+/**
+ * A list of benchmark configurations to be run within a single process.
+ * The manifest is a YAML (or JSON) file of the following form:
+ * @code
+ * frames: 512                    # Default number of frames of each run
+ * first_frame: [256, 511]        # Default first frame for timings ('auto' to detect) and (optionally) images
+ * presets:                       # Named lists of render options
+ *   low: {gi1_use_resampling: false}
+ * runs:                          # Each entry is expanded to every combination of its lists
+ *   - scenes: [Sponza, Gas Station] # 'scene' may be used instead of a single element list
+ *     environment_maps: [Kiara Dawn] # Optional
+ *     cameras: [User]            # Optional
+ *     renderers: [GI-1.1]
+ *     presets: [low]             # Optional
+ *     frames: 256                # Optional override of the defaults
+ *     first_frame: [128]         # Optional override of the defaults
+ *     name: prefix               # Optional prefix of the generated run names
+ * @endcode
+ * Runs are scheduled so that all runs sharing a scene, environment map and renderer are executed
+ * consecutively, this allows the scene and any compiled shaders to be reused between runs.
+ */
+class BenchmarkManifest
+{
+public:
+    /**
+     * Parse a manifest.
+     * @param text  The manifest contents.
+     * @param error Receives a description of the error on failure.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool parse(std::string const &text, std::string &error) noexcept;
+
+    /**
+     * Load and parse a manifest file.
+     * @param fileName The manifest file.
+     * @param error    Receives a description of the error on failure.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool load(std::filesystem::path const &fileName, std::string &error) noexcept;
+
+    /**
+     * Get the list of runs in the order they should be executed.
+     * @return The scheduled runs.
+     */
+    [[nodiscard]] std::vector<BenchmarkRun> const &getRuns() const noexcept;
+
+    /**
+     * Reorder runs so that runs sharing the same scene, environment map and renderer are consecutive.
+     * The relative order of runs within each group, and of the groups themselves, follows the order of first
+     * appearance.
+     * @param runs The runs to reorder.
+     */
+    static void Schedule(std::vector<BenchmarkRun> &runs) noexcept;
+
+private:
+    std::vector<BenchmarkRun> runs;
+};
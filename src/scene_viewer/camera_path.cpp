@@ -0,0 +1,359 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "camera_path.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <yaml-cpp/yaml.h>
+
+using namespace std;
+using namespace glm;
+
+namespace
+{
+/**
+ * Read a vector from a sequence node.
+ * @tparam N Number of vector components.
+ * @param node The node to read.
+ * @param name The name of the value (used for error reporting).
+ * @return The vector.
+ */
+template<length_t N>
+vec<N, float> ReadVector(YAML::Node const &node, char const *name)
+{
+    if (!node.IsSequence() || node.size() != N)
+    {
+        throw runtime_error("Camera path value '"s + name + "' has an invalid number of components");
+    }
+    vec<N, float> ret;
+    for (length_t i = 0; i < N; ++i)
+    {
+        ret[i] = node[static_cast<size_t>(i)].as<float>();
+    }
+    return ret;
+}
+
+/**
+ * Write a vector as a flow sequence.
+ * @tparam N Number of vector components.
+ * @param out   The emitter to write to.
+ * @param value The vector to write.
+ */
+template<length_t N>
+void WriteVector(YAML::Emitter &out, vec<N, float> const &value)
+{
+    out << YAML::Flow << YAML::BeginSeq;
+    for (length_t i = 0; i < N; ++i)
+    {
+        out << value[i];
+    }
+    out << YAML::EndSeq;
+}
+
+/**
+ * Evaluate a cubic Hermite curve.
+ * @param p1 The start value.
+ * @param m1 The start tangent (scaled to the segment length).
+ * @param p2 The end value.
+ * @param m2 The end tangent (scaled to the segment length).
+ * @param u  The position along the segment in the range [0, 1].
+ * @return The interpolated value.
+ */
+template<typename T>
+T Hermite(T const &p1, T const &m1, T const &p2, T const &m2, float const u)
+{
+    float const u2 = u * u;
+    float const u3 = u2 * u;
+    return p1 * (2.0F * u3 - 3.0F * u2 + 1.0F) + m1 * (u3 - 2.0F * u2 + u) + p2 * (3.0F * u2 - 2.0F * u3)
+         + m2 * (u3 - u2);
+}
+
+/**
+ * Evaluate a cubic Bezier curve.
+ * @param b0 The start point.
+ * @param b1 The first control point.
+ * @param b2 The second control point.
+ * @param b3 The end point.
+ * @param u  The position along the segment in the range [0, 1].
+ * @return The interpolated point.
+ */
+vec3 Bezier(vec3 const &b0, vec3 const &b1, vec3 const &b2, vec3 const &b3, float const u)
+{
+    float const v = 1.0F - u;
+    return b0 * (v * v * v) + b1 * (3.0F * v * v * u) + b2 * (3.0F * v * u * u) + b3 * (u * u * u);
+}
+} // namespace
+
+bool CameraPath::parse(string const &text, string &error) noexcept
+{
+    keys.clear();
+    interpolation = Interpolation::CatmullRom;
+    try
+    {
+        YAML::Node const data = YAML::Load(text);
+        if (auto const type = data["interpolation"])
+        {
+            if (auto const name = type.as<string>(); name == "bezier")
+            {
+                interpolation = Interpolation::Bezier;
+            }
+            else if (name != "catmull_rom")
+            {
+                error = "Camera path has unknown interpolation '" + name + "'";
+                return false;
+            }
+        }
+
+        auto const keyList = data["keys"];
+        if (!keyList || !keyList.IsSequence() || keyList.size() == 0)
+        {
+            error = "Camera path does not contain any keys";
+            return false;
+        }
+        for (auto const &entry : keyList)
+        {
+            if (!entry["time"] || !entry["position"] || !entry["forward"])
+            {
+                error = "Camera path key is missing a time, position or forward direction";
+                return false;
+            }
+            CameraPathKey key;
+            key.time     = entry["time"].as<double>();
+            key.position = ReadVector<3>(entry["position"], "position");
+            key.forward  = ReadVector<3>(entry["forward"], "forward");
+            if (auto const value = entry["up"])
+            {
+                key.up = ReadVector<3>(value, "up");
+            }
+            if (auto const value = entry["fov"])
+            {
+                key.fovY = radians(value.as<float>());
+            }
+            if (auto const value = entry["range"])
+            {
+                key.range = ReadVector<2>(value, "range");
+            }
+            auto const controlIn  = entry["control_in"];
+            auto const controlOut = entry["control_out"];
+            if (controlIn || controlOut)
+            {
+                // A missing control point is mirrored from the other one so the path remains smooth
+                if (controlIn)
+                {
+                    key.controlIn = ReadVector<3>(controlIn, "control_in");
+                }
+                key.controlOut = controlOut ? ReadVector<3>(controlOut, "control_out")
+                                            : 2.0F * key.position - key.controlIn;
+                if (!controlIn)
+                {
+                    key.controlIn = 2.0F * key.position - key.controlOut;
+                }
+                key.hasControls = true;
+            }
+            if (!keys.empty() && key.time <= keys.back().time)
+            {
+                error = "Camera path key times must be increasing";
+                keys.clear();
+                return false;
+            }
+            keys.push_back(key);
+        }
+    }
+    catch (exception const &e)
+    {
+        error = "Failed to parse camera path: "s + e.what();
+        keys.clear();
+        return false;
+    }
+    return true;
+}
+
+bool CameraPath::load(filesystem::path const &fileName, string &error) noexcept
+{
+    ifstream file(fileName);
+    if (!file.is_open())
+    {
+        error = "Failed to open camera path '" + fileName.string() + "'";
+        return false;
+    }
+    stringstream text;
+    text << file.rdbuf();
+    return parse(text.str(), error);
+}
+
+bool CameraPath::save(filesystem::path const &fileName) const noexcept
+{
+    try
+    {
+        YAML::Emitter out;
+        out << YAML::BeginMap;
+        out << YAML::Key << "interpolation" << YAML::Value
+            << (interpolation == Interpolation::Bezier ? "bezier" : "catmull_rom");
+        out << YAML::Key << "keys" << YAML::Value << YAML::BeginSeq;
+        for (auto const &key : keys)
+        {
+            out << YAML::BeginMap;
+            out << YAML::Key << "time" << YAML::Value << key.time;
+            out << YAML::Key << "position" << YAML::Value;
+            WriteVector(out, key.position);
+            out << YAML::Key << "forward" << YAML::Value;
+            WriteVector(out, key.forward);
+            out << YAML::Key << "up" << YAML::Value;
+            WriteVector(out, key.up);
+            out << YAML::Key << "fov" << YAML::Value << degrees(key.fovY);
+            out << YAML::Key << "range" << YAML::Value;
+            WriteVector(out, key.range);
+            if (key.hasControls)
+            {
+                out << YAML::Key << "control_in" << YAML::Value;
+                WriteVector(out, key.controlIn);
+                out << YAML::Key << "control_out" << YAML::Value;
+                WriteVector(out, key.controlOut);
+            }
+            out << YAML::EndMap;
+        }
+        out << YAML::EndSeq;
+        out << YAML::EndMap;
+
+        ofstream file(fileName);
+        if (!file.is_open())
+        {
+            return false;
+        }
+        file << out.c_str() << '\n';
+        return file.good();
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+void CameraPath::clear() noexcept
+{
+    keys.clear();
+}
+
+void CameraPath::addKey(CameraPathKey const &key) noexcept
+{
+    if (keys.empty() || key.time > keys.back().time)
+    {
+        keys.push_back(key);
+    }
+}
+
+void CameraPath::setInterpolation(Interpolation const newInterpolation) noexcept
+{
+    interpolation = newInterpolation;
+}
+
+bool CameraPath::empty() const noexcept
+{
+    return keys.empty();
+}
+
+double CameraPath::getDuration() const noexcept
+{
+    return !keys.empty() ? keys.back().time - keys.front().time : 0.0;
+}
+
+uint32_t CameraPath::getSegmentCount() const noexcept
+{
+    return keys.size() > 1 ? static_cast<uint32_t>(keys.size() - 1) : 1U;
+}
+
+uint32_t CameraPath::getSegment(double const time) const noexcept
+{
+    if (keys.size() < 2)
+    {
+        return 0;
+    }
+    // Find the first key after the requested time, the segment then starts at the preceding key
+    double const pathTime = keys.front().time + time;
+    auto const   next     = ranges::upper_bound(keys, pathTime, {}, &CameraPathKey::time);
+    auto const   segment  = std::max(next - keys.begin(), ptrdiff_t {1}) - 1;
+    return std::min(static_cast<uint32_t>(segment), getSegmentCount() - 1);
+}
+
+CameraPath::View CameraPath::evaluate(double const time) const noexcept
+{
+    if (keys.empty())
+    {
+        return {vec3(0.0F), vec3(0.0F, 0.0F, 1.0F), vec3(0.0F, 1.0F, 0.0F), radians(60.0F),
+            vec2(0.1F, 1000.0F)};
+    }
+    if (keys.size() == 1)
+    {
+        auto const &key = keys.front();
+        return {key.position, normalize(key.forward), normalize(key.up), key.fovY, key.range};
+    }
+
+    // Get the 4 keys surrounding the segment, duplicating the end keys where needed
+    uint32_t const segment = getSegment(time);
+    size_t const   i1      = segment;
+    size_t const   i2      = i1 + 1;
+    size_t const   i0      = i1 > 0 ? i1 - 1 : i1;
+    size_t const   i3      = std::min(i2 + 1, keys.size() - 1);
+    auto const    &k0      = keys[i0];
+    auto const    &k1      = keys[i1];
+    auto const    &k2      = keys[i2];
+    auto const    &k3      = keys[i3];
+
+    double const pathTime = std::clamp(keys.front().time + time, k1.time, k2.time);
+    auto const   u        = static_cast<float>((pathTime - k1.time) / (k2.time - k1.time));
+
+    // Non-uniform Catmull-Rom tangents, scaled to the length of the current segment
+    auto const scale1      = static_cast<float>((k2.time - k1.time) / (k2.time - k0.time));
+    auto const scale2      = static_cast<float>((k2.time - k1.time) / (k3.time - k1.time));
+    auto const interpolate = [&](auto const &p0, auto const &p1, auto const &p2, auto const &p3) {
+        return Hermite(p1, (p2 - p0) * scale1, p2, (p3 - p1) * scale2, u);
+    };
+
+    View ret;
+    if (interpolation == Interpolation::Bezier)
+    {
+        // Keys without control points use the control points equivalent to the Catmull-Rom tangents
+        vec3 const b1 =
+            k1.hasControls ? k1.controlOut : k1.position + (k2.position - k0.position) * (scale1 / 3.0F);
+        vec3 const b2 =
+            k2.hasControls ? k2.controlIn : k2.position - (k3.position - k1.position) * (scale2 / 3.0F);
+        ret.position = Bezier(k1.position, b1, b2, k2.position, u);
+    }
+    else
+    {
+        ret.position = interpolate(k0.position, k1.position, k2.position, k3.position);
+    }
+
+    // Directions are interpolated and then renormalised, falling back to the nearest key if degenerate
+    vec3 const forward = interpolate(k0.forward, k1.forward, k2.forward, k3.forward);
+    vec3 const up      = interpolate(k0.up, k1.up, k2.up, k3.up);
+    vec3 const &nearestForward = u < 0.5F ? k1.forward : k2.forward;
+    vec3 const &nearestUp      = u < 0.5F ? k1.up : k2.up;
+    ret.forward = dot(forward, forward) > 1e-8F ? normalize(forward) : normalize(nearestForward);
+    ret.up      = dot(up, up) > 1e-8F ? normalize(up) : normalize(nearestUp);
+    // Lens values are interpolated linearly as overshooting could produce an invalid near plane
+    ret.fovY  = mix(k1.fovY, k2.fovY, u);
+    ret.range = mix(k1.range, k2.range, u);
+    return ret;
+}
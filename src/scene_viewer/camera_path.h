@@ -0,0 +1,158 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#pragma once
+
+#include <cinttypes>
+#include <filesystem>
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+/** A single key of a camera path. */
+struct CameraPathKey
+{
+    double    time        = 0.0;                         /**< Time of the key along the path (seconds) */
+    glm::vec3 position    = glm::vec3(0.0F);             /**< Camera position */
+    glm::vec3 forward     = glm::vec3(0.0F, 0.0F, 1.0F); /**< Camera forward direction */
+    glm::vec3 up          = glm::vec3(0.0F, 1.0F, 0.0F); /**< Camera up direction */
+    float     fovY        = glm::radians(60.0F);         /**< Vertical field of view (radians) */
+    glm::vec2 range       = glm::vec2(0.1F, 1000.0F);    /**< Camera near/far range */
+    glm::vec3 controlIn   = glm::vec3(0.0F); /**< Bezier position control point preceding the key */
+    glm::vec3 controlOut  = glm::vec3(0.0F); /**< Bezier position control point following the key */
+    bool      hasControls = false;           /**< True if control points were provided for the key */
+};
+
+/**
+ * A timed spline that the camera follows during playback.
+ * Paths are stored as YAML files of the following form:
+ * @code
+ * interpolation: catmull_rom     # Or 'bezier'
+ * keys:
+ *   - time: 0.0                  # Seconds, must be increasing
+ *     position: [0.0, 1.0, 0.0]
+ *     forward: [0.0, 0.0, 1.0]
+ *     up: [0.0, 1.0, 0.0]        # Optional
+ *     fov: 60.0                  # Vertical field of view in degrees (optional)
+ *     range: [0.1, 1000.0]       # Optional
+ *     control_in: [0.0, 1.0, -1.0] # Bezier only (optional)
+ *     control_out: [0.0, 1.0, 1.0] # Bezier only (optional)
+ * @endcode
+ * Catmull-Rom paths pass smoothly through every key using tangents derived from the neighbouring keys.
+ * Bezier paths use the control points of each key where provided and fall back to the Catmull-Rom tangents
+ * otherwise. Each pair of consecutive keys forms a segment that can be used to break down path timings.
+ */
+class CameraPath
+{
+public:
+    enum class Interpolation : uint32_t
+    {
+        CatmullRom,
+        Bezier,
+    };
+
+    /** Camera data at a point along the path */
+    struct View
+    {
+        glm::vec3 position;
+        glm::vec3 forward;
+        glm::vec3 up;
+        float     fovY;
+        glm::vec2 range;
+    };
+
+    /**
+     * Parse a path.
+     * @param text  The path contents.
+     * @param error Receives a description of the error on failure.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool parse(std::string const &text, std::string &error) noexcept;
+
+    /**
+     * Load and parse a path file.
+     * @param fileName The path file.
+     * @param error    Receives a description of the error on failure.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool load(std::filesystem::path const &fileName, std::string &error) noexcept;
+
+    /**
+     * Save the path to file.
+     * @param fileName The path file.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool save(std::filesystem::path const &fileName) const noexcept;
+
+    /** Remove all keys from the path. */
+    void clear() noexcept;
+
+    /**
+     * Append a key to the end of the path.
+     * @note Keys with a time less than or equal to the previous key are ignored.
+     * @param key The key to add.
+     */
+    void addKey(CameraPathKey const &key) noexcept;
+
+    /**
+     * Set how the path is interpolated between keys.
+     * @param newInterpolation The interpolation type.
+     */
+    void setInterpolation(Interpolation newInterpolation) noexcept;
+
+    /**
+     * Query if the path has any keys.
+     * @return True if empty, false if not.
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * Get the time taken to traverse the whole path.
+     * @return The duration (seconds).
+     */
+    [[nodiscard]] double getDuration() const noexcept;
+
+    /**
+     * Get the number of segments along the path.
+     * @return The segment count (a path with a single key has a single segment).
+     */
+    [[nodiscard]] uint32_t getSegmentCount() const noexcept;
+
+    /**
+     * Get the segment containing a specified time.
+     * @param time The time from the start of the path (seconds), values outside the path are clamped.
+     * @return The segment index.
+     */
+    [[nodiscard]] uint32_t getSegment(double time) const noexcept;
+
+    /**
+     * Evaluate the camera at a specified time.
+     * @note The result only depends on the keys and time so playback is deterministic.
+     * @param time The time from the start of the path (seconds), values outside the path are clamped.
+     * @return The camera view.
+     */
+    [[nodiscard]] View evaluate(double time) const noexcept;
+
+private:
+    Interpolation              interpolation = Interpolation::CatmullRom;
+    std::vector<CameraPathKey> keys;
+};
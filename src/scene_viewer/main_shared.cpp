@@ -112,10 +112,17 @@ CapsaicinMain::CapsaicinMain(string_view &&programNameIn) noexcept
 CapsaicinMain::~CapsaicinMain() noexcept
 {
     // Destroy Capsaicin context
-    gfxImGuiTerminate();
+    if (!headless)
+    {
+        gfxImGuiTerminate();
+    }
     Capsaicin::Terminate();
     gfxDestroyContext(contextGFX);
     gfxDestroyWindow(window);
+    if (headlessDevice != nullptr)
+    {
+        headlessDevice->Release();
+    }
 
     // Detach from console
     if (hasConsole)
@@ -132,6 +139,12 @@ bool CapsaicinMain::run() noexcept
         return false;
     }
 
+    // Run each benchmark from any provided manifest
+    if (!benchmarkRuns.empty())
+    {
+        return runBenchmarks();
+    }
+
     // Render frames continuously
     while (true)
     {
@@ -143,55 +156,315 @@ bool CapsaicinMain::run() noexcept
 
     if (benchmarkMode)
     {
-        try
+        return finishBenchmark();
+    }
+    return true;
+}
+
+bool CapsaicinMain::finishBenchmark() noexcept
+{
+    try
+    {
+        // Flush remaining stats
+        for (uint32_t i = 0; i <= gfxGetBackBufferCount(contextGFX); ++i)
+        {
+            Capsaicin::Render();
+            gfxFrame(contextGFX);
+        }
+
+        if (!benchmarkModeSuffix.empty() && Capsaicin::hasOption<bool>("image_metrics_enable")
+            && Capsaicin::getOption<bool>("image_metrics_enable")
+            && Capsaicin::getOption<bool>("image_metrics_save_to_file"))
+        {
+            // Force finalising metrics file
+            Capsaicin::setOption<bool>("image_metrics_enable", false);
+            Capsaicin::Render();
+            // Rename metrics file to also contain suffix
+            auto const       savePath       = getSaveName();
+            filesystem::path newMetricsFile = savePath;
+            newMetricsFile += "_";
+            newMetricsFile += benchmarkModeSuffix;
+            newMetricsFile.replace_extension("csv");
+            if (exists(newMetricsFile))
+            {
+                filesystem::remove(newMetricsFile.c_str());
+            }
+            filesystem::path metricsFile = savePath;
+            metricsFile.replace_extension("csv");
+            error_code ec;
+            if (filesystem::rename(metricsFile.c_str(), newMetricsFile.c_str(), ec); !ec)
+            {
+                printString("Failed to rename image metrics file: "s + metricsFile.string(),
+                    MessageLevel::Warning);
+            }
+        }
+
+        if (benchmarkCaptureTimings && !profilingData.empty())
+        {
+            saveProfiling();
+        }
+    }
+    catch (...)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool CapsaicinMain::runBenchmarks() noexcept
+{
+    for (auto const &run : benchmarkRuns)
+    {
+        printString("Running benchmark: "s + run.name);
+        vector<pair<string, RenderOption>> previousOptions;
+        if (!beginBenchmarkRun(run, previousOptions))
+        {
+            return false;
+        }
+
+        // Render frames until the run completes
+        while (renderFrame())
+        {}
+        if (Capsaicin::GetFrameIndex() + 1U < run.frameCount)
+        {
+            printString("Benchmark run aborted: "s + run.name, MessageLevel::Warning);
+            return false;
+        }
+
+        currentBenchmarkRun = &run;
+        bool const result   = finishBenchmark();
+        currentBenchmarkRun = nullptr;
+
+        // Restore any options modified by the run so that they don't leak into subsequent runs
+        for (auto const &[option, value] : previousOptions)
+        {
+            visit([&option](auto const &previousValue) { Capsaicin::setOption(option, previousValue); },
+                value);
+        }
+        if (!result)
+        {
+            return false;
+        }
+    }
+
+    saveBenchmarkResults();
+    return true;
+}
+
+bool CapsaicinMain::beginBenchmarkRun(
+    BenchmarkRun const &run, vector<pair<string, RenderOption>> &previousOptions) noexcept
+{
+    try
+    {
+        // Changing renderer recompiles all shaders so is only done when needed, this must also precede
+        // setting the environment map as that depends on the renderers options
+        if (run.renderer != Capsaicin::GetCurrentRenderer() && !setRenderer(run.renderer))
         {
-            // Flush remaining stats
-            for (uint32_t i = 0; i <= gfxGetBackBufferCount(contextGFX); ++i)
+            return false;
+        }
+
+        // Only reload the scene if it differs from the previous run
+        auto const scene =
+            ranges::find_if(scenes, [&run](SceneData const &data) { return data.name == run.scene; });
+        filesystem::path const sceneFile =
+            scene != scenes.end() ? scene->fileName : filesystem::path(run.scene);
+        bool const newScene = sceneFile != benchmarkScene;
+        if (newScene)
+        {
+            if (!loadScene(sceneFile))
             {
-                Capsaicin::Render();
-                gfxFrame(contextGFX);
+                return false;
             }
+            benchmarkScene         = sceneFile;
+            benchmarkDefaultCamera = Capsaicin::GetSceneCurrentCamera();
+        }
 
-            if (!benchmarkModeSuffix.empty() && Capsaicin::hasOption<bool>("image_metrics_enable")
-                && Capsaicin::getOption<bool>("image_metrics_enable")
-                && Capsaicin::getOption<bool>("image_metrics_save_to_file"))
+        // Set the environment map, scenes listed internally fall back to the default environment map
+        string environmentMap = run.environmentMap;
+        if (environmentMap.empty() && scene != scenes.end())
+        {
+            environmentMap = scene->useEnvironmentMap ? defaultEnvironmentMap : "None";
+        }
+        if (!environmentMap.empty() && (newScene || environmentMap != benchmarkEnvironmentMap))
+        {
+            auto const environment = ranges::find_if(sceneEnvironmentMaps,
+                [&environmentMap](EnvironmentData const &data) { return data.first == environmentMap; });
+            if (!setEnvironmentMap(
+                    environment != sceneEnvironmentMaps.end() ? environment->second
+                                                             : filesystem::path(environmentMap)))
             {
-                // Force finalising metrics file
-                Capsaicin::setOption<bool>("image_metrics_enable", false);
-                Capsaicin::Render();
-                // Rename metrics file to also contain suffix
-                auto const       savePath       = getSaveName();
-                filesystem::path newMetricsFile = savePath;
-                newMetricsFile += "_";
-                newMetricsFile += benchmarkModeSuffix;
-                newMetricsFile.replace_extension("csv");
-                if (exists(newMetricsFile))
-                {
-                    filesystem::remove(newMetricsFile.c_str());
-                }
-                filesystem::path metricsFile = savePath;
-                metricsFile.replace_extension("csv");
-                error_code ec;
-                if (filesystem::rename(metricsFile.c_str(), newMetricsFile.c_str(), ec); !ec)
-                {
-                    printString("Failed to rename image metrics file: "s + metricsFile.string(),
-                        MessageLevel::Warning);
-                }
+                return false;
             }
+        }
+        benchmarkEnvironmentMap = environmentMap;
 
-            if (benchmarkCaptureTimings && !profilingData.empty())
+        // Apply the preset options, keeping the previous values so they can be restored afterwards
+        auto const &options = Capsaicin::GetOptions();
+        for (auto const &option : run.options)
+        {
+            if (auto const found = options.find(option.first); found != options.end())
             {
-                saveProfiling();
+                previousOptions.emplace_back(option.first, found->second);
             }
+            if (!setRenderOption(option.first, option.second))
+            {
+                return false;
+            }
+        }
+        // Finalising the image metrics for a run disables them so they must be re-enabled afterwards
+        if (auto const found = options.find("image_metrics_enable"); found != options.end())
+        {
+            previousOptions.emplace_back(found->first, found->second);
+        }
+
+        // Set the requested camera, camera paths are followed using the user camera
+        string_view camera = !run.camera.empty() ? run.camera : benchmarkDefaultCamera;
+        if (!cameraPath.empty())
+        {
+            camera = Capsaicin::GetSceneCameras()[0];
         }
-        catch (...)
+        if (auto const cameras = Capsaicin::GetSceneCameras(); ranges::find(cameras, camera) == cameras.end())
         {
+            printString("Invalid benchmark camera: "s + string(camera), MessageLevel::Error);
             return false;
         }
+        setCamera(camera);
+
+        // Setup the frame capture ranges of this run
+        benchmarkModeFrameCount             = run.frameCount;
+        benchmarkModeImageCaptureStartFrame = run.imageStartFrame;
+        benchmarkModeSuffix                 = run.name;
+        profilingData.clear();
+        statisticsData.clear();
+        cameraPathSegments.clear();
+        if (benchmarkAutoWarmup || run.autoWarmup)
+        {
+            startWarmupDetection();
+        }
+        else
+        {
+            setTimingCaptureStartFrame(run.timingStartFrame);
+        }
+
+        // Restart any animations so that every run renders the same frames
+        Capsaicin::RestartPlayback();
+    }
+    catch (exception const &e)
+    {
+        printString(e.what(), MessageLevel::Error);
+        return false;
     }
     return true;
 }
 
+void CapsaicinMain::saveBenchmarkResults() noexcept
+{
+    if (benchmarkResults.empty())
+    {
+        return;
+    }
+
+    filesystem::path savePath = dumpFolder;
+    if (error_code ec; !exists(savePath, ec))
+    {
+        create_directory(savePath, ec);
+    }
+    savePath /= "benchmark_results.csv";
+
+    std::ofstream stream(savePath);
+    if (!stream.is_open())
+    {
+        printString(
+            std::format("Can't save '{}': Could not open file", savePath.string()), MessageLevel::Warning);
+        return;
+    }
+
+    stream << "Run,Scene,Environment,Camera,Renderer,Preset,First Frame,Frames,Name,Average,Min,Max\n";
+    for (auto const &result : benchmarkResults)
+    {
+        stream << result << '\n';
+    }
+}
+
+void CapsaicinMain::startWarmupDetection() noexcept
+{
+    // Timings are not captured until the detector has found a steady state
+    benchmarkDetectingWarmup             = true;
+    benchmarkModeTimingCaptureStartFrame = numeric_limits<uint32_t>::max();
+    warmupDetector.reset(benchmarkWarmupWindow, static_cast<double>(benchmarkWarmupThreshold),
+        static_cast<double>(benchmarkWarmupMetricThreshold));
+}
+
+void CapsaicinMain::updateWarmupDetection() noexcept
+{
+    try
+    {
+        // Use the total GPU time of the frame along with any image metrics
+        double frameTime = 0.0;
+        for (auto const &timestamps : Capsaicin::GetProfiling())
+        {
+            if (!timestamps.children.empty())
+            {
+                frameTime += static_cast<double>(timestamps.children[0].time);
+            }
+        }
+        vector<double> metrics;
+        for (auto const &node : Capsaicin::GetStatistics())
+        {
+            if (node.name == "Image Metrics")
+            {
+                for (auto const &statistic : node.children)
+                {
+                    metrics.push_back(statistic.value);
+                }
+            }
+        }
+        bool const steady = warmupDetector.addFrame(frameTime, metrics);
+
+        // Timings start from the next frame, but must always include at least the last frame
+        uint32_t const lastFrame  = benchmarkModeFrameCount - 1U;
+        uint32_t const startFrame = Capsaicin::GetFrameIndex() + 2U;
+        if (!steady && startFrame < lastFrame)
+        {
+            return;
+        }
+        benchmarkDetectingWarmup = false;
+        setTimingCaptureStartFrame(glm::min(startFrame, lastFrame));
+        if (steady)
+        {
+            // The detector counts frames from when detection started, convert to absolute frame indexes
+            uint32_t const currentFrame = startFrame - 1U;
+            uint32_t const firstFrame   = currentFrame + 1U - warmupDetector.getFrameCount();
+            printString(std::format("Steady state detected over frames {}-{} (frame time variation {:.3f}), "
+                                    "capturing timings from frame {}",
+                firstFrame + warmupDetector.getSteadyFrame(), currentFrame, warmupDetector.getVariation(),
+                benchmarkModeTimingCaptureStartFrame));
+        }
+        else
+        {
+            printString(std::format("Steady state not detected (frame time variation {:.3f}), capturing "
+                                    "timings from frame {}",
+                            warmupDetector.getVariation(), benchmarkModeTimingCaptureStartFrame),
+                MessageLevel::Warning);
+        }
+    }
+    catch (exception const &e)
+    {
+        printString(e.what(), MessageLevel::Error);
+    }
+}
+
+void CapsaicinMain::setTimingCaptureStartFrame(uint32_t const frame) noexcept
+{
+    benchmarkModeTimingCaptureStartFrame = frame;
+    if (benchmarkCaptureTimings)
+    {
+        profilingData.reserve(benchmarkModeFrameCount - benchmarkModeTimingCaptureStartFrame);
+        statisticsData.reserve(benchmarkModeFrameCount - benchmarkModeTimingCaptureStartFrame);
+        cameraPathSegments.reserve(benchmarkModeFrameCount - benchmarkModeTimingCaptureStartFrame);
+    }
+}
+
 void CapsaicinMain::printString(string const &text, MessageLevel const level) noexcept
 {
     try
@@ -286,7 +559,7 @@ void CapsaicinMain::printString(string const &text, MessageLevel const level) no
                     GetStdHandle(STD_OUTPUT_HANDLE), {cursorPosX, static_cast<short>(lines + cursorPosY)});
             }
         }
-        if (level == MessageLevel::Error)
+        if (level == MessageLevel::Error && !headless)
         {
             MessageBoxA(nullptr, text.c_str(), "Error", MB_OK | MB_ICONEXCLAMATION | MB_TASKMODAL);
         }
@@ -297,6 +570,29 @@ void CapsaicinMain::printString(string const &text, MessageLevel const level) no
 
 bool CapsaicinMain::initialiseGfx()
 {
+    if (headless)
+    {
+        // Without a window there is no swap chain, so the context is created directly from a device and
+        // all output is kept in offscreen targets
+        if (headlessDevice == nullptr
+            && FAILED(D3D12CreateDevice(nullptr, D3D_FEATURE_LEVEL_12_1, IID_PPV_ARGS(&headlessDevice))))
+        {
+            printString("Failed to create device for headless rendering", MessageLevel::Error);
+            return false;
+        }
+        contextGFX = gfxCreateContext(headlessDevice);
+        if (!contextGFX)
+        {
+            return false;
+        }
+
+        // Create Capsaicin render context without any UI
+        Capsaicin::Initialize(contextGFX);
+        Capsaicin::SetOffscreenDimensions(offscreenWidth, offscreenHeight);
+        Capsaicin::SetTextureCacheDirectory(textureCacheFolder);
+        return true;
+    }
+
     contextGFX = gfxCreateContext(window,
         kGfxCreateContextFlag_EnableShaderCache | (useHDR ? kGfxCreateContextFlag_EnableHDRSwapChain : 0)
 #if _DEBUG || defined(SHADER_DEBUG)
@@ -346,6 +642,7 @@ bool CapsaicinMain::initialiseGfx()
 
     // Create Capsaicin render context
     Capsaicin::Initialize(contextGFX, ImGui::GetCurrentContext());
+    Capsaicin::SetTextureCacheDirectory(textureCacheFolder);
     return true;
 }
 
@@ -416,6 +713,10 @@ bool CapsaicinMain::initialise() noexcept
         bool startPlaying = false;
         app.add_flag("--start-playing", startPlaying, "Start with any animations running");
         auto *bench = app.add_flag("--benchmark-mode", benchmarkMode, "Enable benchmarking mode");
+        app.add_flag("--headless", headless,
+               "Render offscreen using '--width' and '--height' without creating a window (requires "
+               "benchmark mode)")
+            ->needs(bench);
         app.add_option("--benchmark-frames", benchmarkModeFrameCount,
                "Number of frames to render during benchmark mode")
             ->needs(bench)
@@ -439,9 +740,33 @@ bool CapsaicinMain::initialise() noexcept
                "Capture frame timings in benchmarking mode")
             ->needs(bench)
             ->capture_default_str();
+        string benchmarkManifest;
+        app.add_option("--benchmark-manifest", benchmarkManifest,
+               "YAML (or JSON) file listing multiple benchmark configurations to run within a single process")
+            ->needs(bench);
+        app.add_flag("--benchmark-auto-warmup", benchmarkAutoWarmup,
+               "Start capturing timings once frame times and any image metrics have stabilised (overrides "
+               "the timings frame of '--benchmark-first-frame')")
+            ->needs(bench);
+        app.add_option("--benchmark-warmup-window", benchmarkWarmupWindow,
+               "Number of consecutive frames that must be stable for automatic warm-up detection")
+            ->needs(bench)
+            ->check(CLI::Range(2U, numeric_limits<uint32_t>::max()))
+            ->capture_default_str();
+        app.add_option("--benchmark-warmup-threshold", benchmarkWarmupThreshold,
+               "Maximum coefficient of variation of frame times for automatic warm-up detection")
+            ->needs(bench)
+            ->check(CLI::PositiveNumber)
+            ->capture_default_str();
+        string cameraPathFile;
+        app.add_option("--camera-path", cameraPathFile,
+               "Camera path file (YAML) to follow using the user camera during benchmark mode")
+            ->needs(bench);
         string dumpFolderOverride;
         app.add_option("--dump-folder", dumpFolderOverride,
             "Name of the folder (or path) where the results will be saved.");
+        app.add_option("--texture-cache-folder", textureCacheFolder,
+            "Folder (or path) used to cache generated environment maps and lookup tables between runs");
 
         vector<string> renderOptions;
         app.add_option("--render-options", renderOptions, "Additional render options");
@@ -497,13 +822,44 @@ bool CapsaicinMain::initialise() noexcept
             return false;
         }
 
+        // Load any benchmark manifest before creating the window so that errors are reported early
+        if (!benchmarkManifest.empty())
+        {
+            BenchmarkManifest manifest;
+            if (string error; !manifest.load(benchmarkManifest, error))
+            {
+                printString(error, MessageLevel::Error);
+                return false;
+            }
+            benchmarkRuns = manifest.getRuns();
+        }
+
+        // Load any camera path
+        if (!cameraPathFile.empty())
+        {
+            if (string error; !cameraPath.load(cameraPathFile, error))
+            {
+                printString(error, MessageLevel::Error);
+                return false;
+            }
+        }
+
         // Create the internal gfx window and context
-        window = gfxCreateWindow(windowWidth, windowHeight, programName.c_str(),
-            (!benchmarkMode ? kGfxCreateWindowFlag_AcceptDrop : 0)
-                | (fullScreen ? kGfxCreateWindowFlag_FullscreenWindow : 0));
-        if (!window)
+        if (headless)
         {
-            return false;
+            offscreenWidth  = windowWidth;
+            offscreenHeight = windowHeight;
+            drawUI          = false;
+        }
+        else
+        {
+            window = gfxCreateWindow(windowWidth, windowHeight, programName.c_str(),
+                (!benchmarkMode ? kGfxCreateWindowFlag_AcceptDrop : 0)
+                    | (fullScreen ? kGfxCreateWindowFlag_FullscreenWindow : 0));
+            if (!window)
+            {
+                return false;
+            }
         }
 
         if (!initialiseGfx())
@@ -521,107 +877,38 @@ bool CapsaicinMain::initialise() noexcept
         }
 
         // Pass any command line render options
-        if (!renderOptions.empty())
+        for (auto const &opt : renderOptions)
         {
-            auto &validOpts = Capsaicin::GetOptions();
-            for (auto const &opt : renderOptions)
+            auto const splitLoc = opt.find('=');
+            if (splitLoc == string::npos)
             {
-                auto const splitLoc = opt.find('=');
-                if (splitLoc == string::npos)
-                {
-                    printString("Invalid command line format of '--render-options'", MessageLevel::Error);
-                    return false;
-                }
-                string const option = opt.substr(0, splitLoc);
-                string const value  = opt.substr(splitLoc + 1);
-                if (auto found = validOpts.find(option); found != validOpts.end())
-                {
-                    if (holds_alternative<bool>(found->second))
-                    {
-                        if (value == "true" || value == "1")
-                        {
-                            Capsaicin::setOption(option, true);
-                        }
-                        else if (value == "false" || value == "0")
-                        {
-                            Capsaicin::setOption(option, false);
-                        }
-                        else
-                        {
-                            printString("Invalid command line value passed for render option '" + option
-                                            + "' expected bool",
-                                MessageLevel::Error);
-                            return false;
-                        }
-                    }
-                    else if (holds_alternative<int32_t>(found->second))
-                    {
-                        try
-                        {
-                            int32_t const newValue = stoi(value);
-                            Capsaicin::setOption(option, newValue);
-                        }
-                        catch (...)
-                        {
-                            printString("Invalid command line value passed for render option '" + option
-                                            + "' expected integer",
-                                MessageLevel::Error);
-                            return false;
-                        }
-                    }
-                    else if (holds_alternative<uint32_t>(found->second))
-                    {
-                        try
-                        {
-                            uint32_t const newValue = stoul(value);
-                            Capsaicin::setOption(option, newValue);
-                        }
-                        catch (...)
-                        {
-                            printString("Invalid command line value passed for render option '" + option
-                                            + "' expected unsigned integer",
-                                MessageLevel::Error);
-                            return false;
-                        }
-                    }
-                    else if (holds_alternative<uint8_t>(found->second))
-                    {
-                        try
-                        {
-                            uint32_t const newValue = stoul(value);
-                            Capsaicin::setOption(option, static_cast<uint8_t>(newValue));
-                        }
-                        catch (...)
-                        {
-                            printString("Invalid command line value passed for render option '" + option
-                                            + "' expected 8-bit unsigned integer",
-                                MessageLevel::Error);
-                            return false;
-                        }
-                    }
-                    else if (holds_alternative<float>(found->second))
-                    {
-                        try
-                        {
-                            float const newValue = stof(value);
-                            Capsaicin::setOption(option, newValue);
-                        }
-                        catch (...)
-                        {
-                            printString("Invalid command line value passed for render option '" + option
-                                            + "' expected float",
-                                MessageLevel::Error);
-                            return false;
-                        }
-                    }
-                }
-                else
-                {
-                    printString("Invalid command line value passed for '--render-options': " + opt,
-                        MessageLevel::Error);
-                    return false;
-                }
+                printString("Invalid command line format of '--render-options'", MessageLevel::Error);
+                return false;
+            }
+            if (!setRenderOption(opt.substr(0, splitLoc), opt.substr(splitLoc + 1)))
+            {
+                return false;
+            }
+        }
+
+        // Each manifest run loads its own scene, environment map and camera
+        if (!benchmarkRuns.empty())
+        {
+            if (!benchmarkCaptureFrames && !benchmarkCaptureTimings)
+            {
+                printString(
+                    "Either frames or timings capture must be on in benchmark mode", MessageLevel::Error);
+                return false;
+            }
+
+            // Benchmark mode uses a fixed frame rate playback mode
+            Capsaicin::SetFixedFrameRate(true);
+
+            if (startPlaying)
+            {
+                Capsaicin::SetPaused(false);
             }
+            return true;
         }
 
         // Load the requested start scene
@@ -723,8 +1010,12 @@ bool CapsaicinMain::initialise() noexcept
         {
             uint32_t const lastFrame = benchmarkModeFrameCount - 1U;
 
-            benchmarkModeTimingCaptureStartFrame =
-                !startFrames.empty() ? glm::min(startFrames[0], lastFrame) : lastFrame;
+            // Camera paths are followed using the user camera
+            if (!cameraPath.empty())
+            {
+                setCamera(Capsaicin::GetSceneCameras()[0]);
+            }
+
             benchmarkModeImageCaptureStartFrame =
                 startFrames.size() > 1U ? glm::min(startFrames[1], lastFrame) : lastFrame;
 
@@ -738,9 +1029,14 @@ bool CapsaicinMain::initialise() noexcept
                 return false;
             }
 
-            if (benchmarkCaptureTimings)
+            if (benchmarkAutoWarmup)
             {
-                profilingData.reserve(benchmarkModeFrameCount - benchmarkModeTimingCaptureStartFrame);
+                startWarmupDetection();
+            }
+            else
+            {
+                setTimingCaptureStartFrame(
+                    !startFrames.empty() ? glm::min(startFrames[0], lastFrame) : lastFrame);
             }
         }
         else
@@ -787,6 +1083,98 @@ bool CapsaicinMain::initialise() noexcept
     return true;
 }
 
+bool CapsaicinMain::setRenderOption(string const &option, string const &value) noexcept
+{
+    auto const &validOpts = Capsaicin::GetOptions();
+    if (auto const found = validOpts.find(option); found != validOpts.end())
+    {
+        if (holds_alternative<bool>(found->second))
+        {
+            if (value == "true" || value == "1")
+            {
+                Capsaicin::setOption(option, true);
+            }
+            else if (value == "false" || value == "0")
+            {
+                Capsaicin::setOption(option, false);
+            }
+            else
+            {
+                printString(
+                    "Invalid value passed for render option '" + option + "' expected bool",
+                    MessageLevel::Error);
+                return false;
+            }
+        }
+        else if (holds_alternative<int32_t>(found->second))
+        {
+            try
+            {
+                int32_t const newValue = stoi(value);
+                Capsaicin::setOption(option, newValue);
+            }
+            catch (...)
+            {
+                printString(
+                    "Invalid value passed for render option '" + option + "' expected integer",
+                    MessageLevel::Error);
+                return false;
+            }
+        }
+        else if (holds_alternative<uint32_t>(found->second))
+        {
+            try
+            {
+                uint32_t const newValue = stoul(value);
+                Capsaicin::setOption(option, newValue);
+            }
+            catch (...)
+            {
+                printString(
+                    "Invalid value passed for render option '" + option + "' expected unsigned integer",
+                    MessageLevel::Error);
+                return false;
+            }
+        }
+        else if (holds_alternative<uint8_t>(found->second))
+        {
+            try
+            {
+                uint32_t const newValue = stoul(value);
+                Capsaicin::setOption(option, static_cast<uint8_t>(newValue));
+            }
+            catch (...)
+            {
+                printString(
+                    "Invalid value passed for render option '" + option + "' expected 8-bit unsigned integer",
+                    MessageLevel::Error);
+                return false;
+            }
+        }
+        else if (holds_alternative<float>(found->second))
+        {
+            try
+            {
+                float const newValue = stof(value);
+                Capsaicin::setOption(option, newValue);
+            }
+            catch (...)
+            {
+                printString(
+                    "Invalid value passed for render option '" + option + "' expected float",
+                    MessageLevel::Error);
+                return false;
+            }
+        }
+    }
+    else
+    {
+        printString("Invalid render option '" + option + "'", MessageLevel::Error);
+        return false;
+    }
+    return true;
+}
+
 bool CapsaicinMain::loadScene(filesystem::path const &sceneFile, bool const append) noexcept
 {
     try
@@ -920,21 +1308,25 @@ bool CapsaicinMain::renderFrame() noexcept
         kbMap = KeyboardMappings::AZERTY;
     }
 
-    // Check if window should close
-    if (gfxWindowIsCloseRequested(window) || gfxWindowIsKeyReleased(window, VK_ESCAPE))
+    // A headless benchmark has no window or user input
+    if (!headless)
     {
-        return false;
-    }
+        // Check if window should close
+        if (gfxWindowIsCloseRequested(window) || gfxWindowIsKeyReleased(window, VK_ESCAPE))
+        {
+            return false;
+        }
 
-    // Get events
-    gfxWindowPumpEvents(window);
+        // Get events
+        gfxWindowPumpEvents(window);
 
-    // Update keyboard parameters that may be changed regardless of benchmark mode
-    if (!ImGui::GetIO().WantCaptureKeyboard)
-    {
-        if (gfxWindowIsKeyPressed(window, VK_F7))
+        // Update keyboard parameters that may be changed regardless of benchmark mode
+        if (!ImGui::GetIO().WantCaptureKeyboard)
         {
-            drawUI = !drawUI;
+            if (gfxWindowIsKeyPressed(window, VK_F7))
+            {
+                drawUI = !drawUI;
+            }
         }
     }
 
@@ -1167,6 +1559,35 @@ bool CapsaicinMain::renderFrame() noexcept
         }
     }
 
+    if (cameraPathRecording)
+    {
+        // Sample the current camera into the recorded path at regular intervals
+        cameraPathRecordTime += Capsaicin::GetFrameTime();
+        if (cameraPath.empty()
+            || cameraPathRecordTime - cameraPath.getDuration() >= static_cast<double>(cameraPathKeyInterval))
+        {
+            auto const [position, forward, up] = Capsaicin::GetSceneCameraView();
+            CameraPathKey key;
+            key.time     = cameraPath.empty() ? 0.0 : cameraPathRecordTime;
+            key.position = position;
+            key.forward  = forward;
+            key.up       = up;
+            key.fovY     = Capsaicin::GetSceneCameraFOV();
+            key.range    = Capsaicin::GetSceneCameraRange();
+            cameraPath.addKey(key);
+        }
+    }
+    else if (benchmarkMode && !cameraPath.empty())
+    {
+        // Place the camera along the path based on the fixed frame rate so that playback is deterministic
+        double const time =
+            static_cast<double>(Capsaicin::GetFrameIndex() + 1U) * Capsaicin::GetFixedFrameTime();
+        auto const view = cameraPath.evaluate(time);
+        Capsaicin::SetSceneCameraView(view.position, view.forward, view.up);
+        Capsaicin::SetSceneCameraFOV(view.fovY);
+        Capsaicin::SetSceneCameraRange(view.range);
+    }
+
     if (benchmarkCaptureFrames)
     {
         // If current frame has reached our benchmark value then dump frame
@@ -1284,10 +1705,21 @@ bool CapsaicinMain::renderFrame() noexcept
             return false;
         }
 
+        if (benchmarkDetectingWarmup)
+        {
+            updateWarmupDetection();
+        }
+
         if (benchmarkCaptureTimings
             && (Capsaicin::GetFrameIndex() + 1U) >= benchmarkModeTimingCaptureStartFrame)
         {
             profilingData.push_back(Capsaicin::GetProfiling());
+            statisticsData.push_back(Capsaicin::GetStatistics());
+            if (!cameraPath.empty())
+            {
+                cameraPathSegments.push_back(cameraPath.getSegment(
+                    static_cast<double>(Capsaicin::GetFrameIndex()) * Capsaicin::GetFixedFrameTime()));
+            }
         }
     }
 
@@ -1501,6 +1933,46 @@ void CapsaicinMain::renderCameraDetails()
         Capsaicin::SetSceneCameraFOV(fov);
         ImGui::DragFloat("Speed", &cameraSpeed, 0.01F);
 
+        if (ImGui::TreeNode("Camera Path", "Camera Path"))
+        {
+            // Record the camera movement to a path that can be played back in benchmark mode
+            if (!cameraPathRecording)
+            {
+                ImGui::DragFloat("Key Interval", &cameraPathKeyInterval, 0.01F, 0.01F, 10.0F);
+                if (ImGui::Button("Record"))
+                {
+                    cameraPath.clear();
+                    cameraPathRecordTime = 0.0;
+                    cameraPathRecording  = true;
+                }
+            }
+            else
+            {
+                ImGui::Text("Recorded %.2f s", cameraPathRecordTime);
+                if (ImGui::Button("Stop Recording"))
+                {
+                    cameraPathRecording = false;
+                    if (error_code ec; !exists(dumpFolder, ec))
+                    {
+                        create_directory(dumpFolder, ec);
+                    }
+                    filesystem::path savePath = getSaveName();
+                    savePath += "_camera_path.yaml";
+                    if (cameraPath.save(savePath))
+                    {
+                        printString("Saved camera path: "s + savePath.string());
+                    }
+                    else
+                    {
+                        printString(
+                            "Failed to save camera path: "s + savePath.string(), MessageLevel::Warning);
+                    }
+                    cameraPath.clear();
+                }
+            }
+            ImGui::TreePop();
+        }
+
         if (ImGui::TreeNode("Camera Data", "Camera Data"))
         {
             ImGui::SetCursorPosX(20);
@@ -1855,6 +2327,18 @@ void CapsaicinMain::saveProfiling() noexcept
 
     stream << "Name,Average,Min,Max,Accumulated";
 
+    // Each manifest run also contributes its summary to the consolidated results
+    string resultPrefix;
+    if (currentBenchmarkRun != nullptr)
+    {
+        auto const &run = *currentBenchmarkRun;
+        resultPrefix    = std::format("{},{},{},{},{},{},{},{},", run.name, run.scene,
+               benchmarkEnvironmentMap.empty() ? "Default" : benchmarkEnvironmentMap,
+               Capsaicin::GetSceneCurrentCamera(), run.renderer, run.preset,
+               benchmarkModeTimingCaptureStartFrame,
+               benchmarkModeFrameCount - benchmarkModeTimingCaptureStartFrame);
+    }
+
     uint32_t const framesTotal = benchmarkModeFrameCount - benchmarkModeTimingCaptureStartFrame;
 
     for (size_t frame = 0U; frame < framesTotal; ++frame)
@@ -1917,12 +2401,114 @@ void CapsaicinMain::saveProfiling() noexcept
         auto const &[name, info] = *it;
         stream << std::format("{},{:.3f},{:.3f},{:.3f},{:.3f}", name, info.accumulated / framesTotal,
             info.minimum, info.maximum, info.accumulated);
+        if (currentBenchmarkRun != nullptr)
+        {
+            benchmarkResults.push_back(std::format("{}{},{:.3f},{:.3f},{:.3f}", resultPrefix, name,
+                info.accumulated / framesTotal, info.minimum, info.maximum));
+        }
         for (float duration : info.frameTimings)
         {
             stream << std::format(",{:.3f}", duration);
         }
         stream << '\n';
     }
+
+    // Break down the total frame time by the camera path segment being traversed
+    if (!cameraPathSegments.empty())
+    {
+        GFX_ASSERT(cameraPathSegments.size() == profilingData.size());
+        vector<ProfilingInfo> segments(cameraPath.getSegmentCount());
+        for (frame = 0U; frame < static_cast<uint32_t>(profilingData.size()); ++frame)
+        {
+            float duration = 0.0F;
+            for (auto const &timestamps : profilingData[frame])
+            {
+                duration += timestamps.children[0].time;
+            }
+            ProfilingInfo &info = segments[cameraPathSegments[frame]];
+            if (info.frameTimings.empty())
+            {
+                info.frameTimings.resize(framesTotal);
+            }
+            info.frameTimings[frame] = duration;
+            info.minimum             = std::min(info.minimum, duration);
+            info.maximum             = std::max(info.maximum, duration);
+            info.accumulated += duration;
+        }
+
+        for (uint32_t segment = 0; segment < static_cast<uint32_t>(segments.size()); ++segment)
+        {
+            auto const &info = segments[segment];
+            if (info.frameTimings.empty())
+            {
+                continue;
+            }
+            auto const frameCount = static_cast<float>(ranges::count(cameraPathSegments, segment));
+            std::string const name = std::format("Camera Path / Segment {}", segment);
+            stream << std::format("{},{:.3f},{:.3f},{:.3f},{:.3f}", name, info.accumulated / frameCount,
+                info.minimum, info.maximum, info.accumulated);
+            if (currentBenchmarkRun != nullptr)
+            {
+                benchmarkResults.push_back(std::format("{}{},{:.3f},{:.3f},{:.3f}", resultPrefix, name,
+                    info.accumulated / frameCount, info.minimum, info.maximum));
+            }
+            for (float duration : info.frameTimings)
+            {
+                stream << std::format(",{:.3f}", duration);
+            }
+            stream << '\n';
+        }
+    }
+
+    // Append any statistics reported by the render techniques using the same layout
+    struct StatisticInfo
+    {
+        std::vector<double> frameValues;
+        double              minimum     = std::numeric_limits<double>::max();
+        double              maximum     = std::numeric_limits<double>::lowest();
+        double              accumulated = 0.0;
+    };
+
+    std::map<std::string /*name*/, StatisticInfo>     statistics;
+    std::vector<decltype(statistics)::const_iterator> sorted_statistics;
+
+    frame = 0U;
+    for (auto const &nodes : statisticsData)
+    {
+        for (auto const &node : nodes)
+        {
+            for (auto const &statistic : node.children)
+            {
+                auto [it, inserted] =
+                    statistics.try_emplace(std::string(node.name) + " / " + std::string(statistic.name));
+                StatisticInfo &info = it->second;
+                if (inserted)
+                {
+                    info.frameValues.resize(framesTotal);
+                    sorted_statistics.push_back(it);
+                }
+
+                GFX_ASSERT(frame < framesTotal);
+                info.frameValues[frame] = statistic.value;
+                info.minimum            = std::min(info.minimum, statistic.value);
+                info.maximum            = std::max(info.maximum, statistic.value);
+                info.accumulated += statistic.value;
+            }
+        }
+        ++frame;
+    }
+
+    for (auto const &it : sorted_statistics)
+    {
+        auto const &[name, info] = *it;
+        stream << std::format("{},{:.3f},{:.3f},{:.3f},{:.3f}", name, info.accumulated / framesTotal,
+            info.minimum, info.maximum, info.accumulated);
+        for (double value : info.frameValues)
+        {
+            stream << std::format(",{:.3f}", value);
+        }
+        stream << '\n';
+    }
 }
 
 filesystem::path CapsaicinMain::getSaveName()
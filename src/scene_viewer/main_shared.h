@@ -22,6 +22,10 @@ THE SOFTWARE.
 
 #pragma once
 
+#include "benchmark_manifest.h"
+#include "camera_path.h"
+#include "steady_state.h"
+
 #include <array>
 #include <capsaicin.h>
 #include <cinttypes>
@@ -68,6 +72,9 @@ class CapsaicinMain
         Error,
     };
 
+    /** Value of a render option */
+    using RenderOption = std::remove_reference_t<decltype(Capsaicin::GetOptions())>::mapped_type;
+
     /**
      * Print a string to an output console or debugger window if one is available.
      * @note If a debugger is attached then the string will be output to the debug console, else if the
@@ -125,6 +132,14 @@ class CapsaicinMain
      */
     [[nodiscard]] bool setRenderer(std::string_view renderer) noexcept;
 
+    /**
+     * Set a render option from its string representation.
+     * @param option The name of the render option.
+     * @param value  The new value of the option.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool setRenderOption(std::string const &option, std::string const &value) noexcept;
+
     /**
      * Update render settings based on the currently set renderer.
      * @return Boolean signalling if no error occurred.
@@ -150,6 +165,50 @@ class CapsaicinMain
      */
     bool renderGUIDetails();
 
+    /**
+     * Run each benchmark from the loaded manifest in turn.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool runBenchmarks() noexcept;
+
+    /**
+     * Prepare the scene, renderer and settings for a benchmark run.
+     * @note Scenes, environment maps and renderers are only reloaded if they differ from the previous run.
+     * @param run             The benchmark run to start.
+     * @param previousOptions Receives the value of any render options modified by the run.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool beginBenchmarkRun(BenchmarkRun const &run,
+        std::vector<std::pair<std::string, RenderOption>> &previousOptions) noexcept;
+
+    /**
+     * Flush any pending frames and save the results of the current benchmark.
+     * @return Boolean signalling if no error occurred.
+     */
+    [[nodiscard]] bool finishBenchmark() noexcept;
+
+    /**
+     * Save the consolidated results of all benchmark runs to disk.
+     */
+    void saveBenchmarkResults() noexcept;
+
+    /**
+     * Start automatic detection of the first benchmark frame to capture timings from.
+     */
+    void startWarmupDetection() noexcept;
+
+    /**
+     * Pass the current frame to the warm-up detector and start capturing timings once steady.
+     * Should be called after gfxFrame().
+     */
+    void updateWarmupDetection() noexcept;
+
+    /**
+     * Set the first benchmark frame to capture timings from.
+     * @param frame The first frame.
+     */
+    void setTimingCaptureStartFrame(uint32_t frame) noexcept;
+
     /**
      * Save the currently displayed frame to disk.
      * Should be called before gfxFrame() but after render.
@@ -179,11 +238,12 @@ class CapsaicinMain
     static constexpr auto defaultEnvironmentMap = "Kiara Dawn";
     static constexpr auto defaultRenderer       = "GI-1.1";
 
-    GfxWindow  window;                              /**< Gfx window class */
-    GfxContext contextGFX;                          /**< Gfx context */
-    float      cameraSpeed       = 1.2F;            /**< Camera speed (m/s) used for camera movement */
-    glm::vec3  cameraTranslation = glm::vec3(0.0F); /**< Camera translation velocity (m/s) */
-    glm::vec2  cameraRotation    = glm::vec2(0.0F); /**< Camera rotation velocity (m/s) */
+    GfxWindow     window;                              /**< Gfx window class (not created when headless) */
+    GfxContext    contextGFX;                          /**< Gfx context */
+    ID3D12Device *headlessDevice    = nullptr;         /**< Device used to create the context when headless */
+    float         cameraSpeed       = 1.2F;            /**< Camera speed (m/s) used for camera movement */
+    glm::vec3     cameraTranslation = glm::vec3(0.0F); /**< Camera translation velocity (m/s) */
+    glm::vec2     cameraRotation    = glm::vec2(0.0F); /**< Camera rotation velocity (m/s) */
 
     /** List of supported scene files and associated data */
     struct SceneData
@@ -201,6 +261,9 @@ class CapsaicinMain
 
     std::string programName;    /**< Stored name for the current program */
     bool benchmarkMode = false; /**< If enabled this prevents user inputs and runs a predefined benchmark */
+    bool headless      = false; /**< Render offscreen without a window, UI or present (benchmark mode only) */
+    uint32_t offscreenWidth  = 0; /**< Output width when headless */
+    uint32_t offscreenHeight = 0; /**< Output height when headless */
     bool benchmarkCaptureFrames  = true; /**< Whether frame images should be captured in benchmark mode */
     bool benchmarkCaptureTimings = true; /**< Whether timings data should be captured in benchmark mode */
     uint32_t benchmarkModeFrameCount =
@@ -212,6 +275,23 @@ class CapsaicinMain
         std::numeric_limits<uint32_t>::max(); /**< First frame to start frame image capture in benchmark
                                                       mode (default is just the last frame). */
     std::string benchmarkModeSuffix;          /**< String appended to any saved files */
+    std::vector<BenchmarkRun> benchmarkRuns;  /**< Runs loaded from a benchmark manifest */
+    BenchmarkRun const *currentBenchmarkRun = nullptr; /**< The manifest run currently being rendered */
+    std::filesystem::path benchmarkScene;              /**< Scene file loaded by the previous manifest run */
+    std::string benchmarkEnvironmentMap; /**< Environment map set by the previous manifest run */
+    std::string benchmarkDefaultCamera;  /**< Default camera of the scene loaded by the manifest */
+    std::vector<std::string> benchmarkResults; /**< Consolidated timings of each completed manifest run */
+    CameraPath            cameraPath; /**< Camera path followed in benchmark mode or being recorded */
+    std::vector<uint32_t> cameraPathSegments; /**< Camera path segment of each frame with captured timings */
+    bool                  cameraPathRecording   = false; /**< Whether the camera is being recorded */
+    double                cameraPathRecordTime  = 0.0;   /**< Time since the recording started (seconds) */
+    float                 cameraPathKeyInterval = 0.25F; /**< Time between recorded path keys (seconds) */
+    SteadyStateDetector   warmupDetector; /**< Detects when benchmark timings have stabilised */
+    bool     benchmarkAutoWarmup      = false; /**< Detect the first frame to capture timings from */
+    bool     benchmarkDetectingWarmup = false; /**< Set while waiting for the benchmark to stabilise */
+    uint32_t benchmarkWarmupWindow    = 32;    /**< Number of consecutive frames that must be stable */
+    float    benchmarkWarmupThreshold = 0.05F; /**< Maximum frame time coefficient of variation when stable */
+    float    benchmarkWarmupMetricThreshold = 0.001F; /**< Maximum relative image metric change when stable */
     bool        saveAsJPEG      = false;      /**< File type selector for dump frame */
     bool        saveImage       = false;      /**< Used to buffer save image requests */
     bool        reDisableRender = false;      /**< Use to render only a single frame at a time */
@@ -221,6 +301,8 @@ class CapsaicinMain
     bool hasConsole = false; /**< Set if a console output terminal is attached */
 
     std::vector<std::vector<Capsaicin::NodeTimestamps>> profilingData;
+    std::vector<std::vector<Capsaicin::NodeStatistics>> statisticsData;
 
     std::filesystem::path dumpFolder = "./dump/";
+    std::filesystem::path textureCacheFolder; /**< Folder caching generated textures (empty if disabled) */
 };
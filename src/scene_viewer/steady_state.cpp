@@ -0,0 +1,132 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "steady_state.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+void SteadyStateDetector::reset(
+    uint32_t const windowSize, double const newTimeThreshold, double const newMetricThreshold) noexcept
+{
+    window          = max(windowSize, 2U);
+    timeThreshold   = newTimeThreshold;
+    metricThreshold = newMetricThreshold;
+    frameTimes.clear();
+    metricChanges.clear();
+    previousMetrics.clear();
+    variation   = 0.0;
+    steadyFrame = 0;
+    steady      = false;
+}
+
+bool SteadyStateDetector::addFrame(double const frameTime, vector<double> const &metrics) noexcept
+{
+    if (steady)
+    {
+        return true;
+    }
+
+    // Track the largest relative change of any metric, metrics that have only just become available count as
+    // unstable
+    double change = 0.0;
+    if (!metrics.empty())
+    {
+        if (metrics.size() != previousMetrics.size())
+        {
+            change = numeric_limits<double>::infinity();
+        }
+        else
+        {
+            for (size_t i = 0; i < metrics.size(); ++i)
+            {
+                double const delta = abs(metrics[i] - previousMetrics[i]);
+                change             = max(change, delta / max(abs(previousMetrics[i]), 1e-6));
+            }
+        }
+    }
+    previousMetrics = metrics;
+    frameTimes.push_back(frameTime);
+    metricChanges.push_back(change);
+
+    if (frameTimes.size() < window)
+    {
+        return false;
+    }
+
+    // Calculate the coefficient of variation over the most recent window
+    auto const begin     = frameTimes.size() - window;
+    auto const middle    = begin + window / 2;
+    double     firstHalf = 0.0;
+    double     lastHalf  = 0.0;
+    double     maxChange = 0.0;
+    for (size_t i = begin; i < frameTimes.size(); ++i)
+    {
+        (i < middle ? firstHalf : lastHalf) += frameTimes[i];
+        maxChange = max(maxChange, metricChanges[i]);
+    }
+    double const mean = (firstHalf + lastHalf) / static_cast<double>(window);
+    double variance = 0.0;
+    for (size_t i = begin; i < frameTimes.size(); ++i)
+    {
+        double const difference = frameTimes[i] - mean;
+        variance += difference * difference;
+    }
+    variance /= static_cast<double>(window - 1);
+    variation = mean > 0.0 ? sqrt(variance) / mean : 0.0;
+
+    // A slow drift can have a low variation within a window, so also require the mean of each half of the
+    // window to match
+    firstHalf /= static_cast<double>(middle - begin);
+    lastHalf /= static_cast<double>(frameTimes.size() - middle);
+    double const drift = mean > 0.0 ? abs(lastHalf - firstHalf) / mean : 0.0;
+
+    if (variation <= timeThreshold && drift <= 0.25 * timeThreshold && maxChange <= metricThreshold)
+    {
+        steady      = true;
+        steadyFrame = static_cast<uint32_t>(begin);
+    }
+    return steady;
+}
+
+bool SteadyStateDetector::isSteady() const noexcept
+{
+    return steady;
+}
+
+uint32_t SteadyStateDetector::getFrameCount() const noexcept
+{
+    return static_cast<uint32_t>(frameTimes.size());
+}
+
+uint32_t SteadyStateDetector::getSteadyFrame() const noexcept
+{
+    return steadyFrame;
+}
+
+double SteadyStateDetector::getVariation() const noexcept
+{
+    return variation;
+}
@@ -0,0 +1,89 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#pragma once
+
+#include <cinttypes>
+#include <vector>
+
+/**
+ * Detects when a benchmark has warmed up by tracking frame times and image metrics.
+ * The benchmark is considered steady once the coefficient of variation (standard deviation / mean) of the
+ * frame times over a sliding window of frames drops below a threshold, the means of each half of the window
+ * differ by less than a quarter of that threshold (to reject slow drifts), and the relative change of every
+ * image metric between consecutive frames within that window is also below a threshold. This accounts for
+ * caches and temporal effects (e.g. auto exposure) that take a scene dependent number of frames to converge.
+ */
+class SteadyStateDetector
+{
+public:
+    /**
+     * Reset the detector ready to process a new sequence of frames.
+     * @param windowSize         Number of consecutive frames that must be stable.
+     * @param newTimeThreshold   Maximum coefficient of variation of the frame times within the window.
+     * @param newMetricThreshold Maximum relative change of any image metric between consecutive frames.
+     */
+    void reset(uint32_t windowSize, double newTimeThreshold, double newMetricThreshold) noexcept;
+
+    /**
+     * Add the values of a new frame.
+     * @param frameTime The time taken by the frame.
+     * @param metrics   The image metrics of the frame (may be empty if none are available).
+     * @return True if steady state has been reached, false if not.
+     */
+    bool addFrame(double frameTime, std::vector<double> const &metrics) noexcept;
+
+    /**
+     * Query if steady state has been reached.
+     * @return True if steady, false if not.
+     */
+    [[nodiscard]] bool isSteady() const noexcept;
+
+    /**
+     * Get the number of frames added since the last reset.
+     * @return The frame count.
+     */
+    [[nodiscard]] uint32_t getFrameCount() const noexcept;
+
+    /**
+     * Get the first frame of the window in which steady state was detected.
+     * @return The index of the frame relative to the last reset (only valid if steady).
+     */
+    [[nodiscard]] uint32_t getSteadyFrame() const noexcept;
+
+    /**
+     * Get the coefficient of variation of the frame times within the most recent window.
+     * @return The coefficient of variation (0 if there are not yet enough frames).
+     */
+    [[nodiscard]] double getVariation() const noexcept;
+
+private:
+    uint32_t            window          = 32;
+    double              timeThreshold   = 0.05;
+    double              metricThreshold = 0.001;
+    std::vector<double> frameTimes;      /**< Time of each added frame */
+    std::vector<double> metricChanges;   /**< Largest relative image metric change of each added frame */
+    std::vector<double> previousMetrics; /**< Image metrics of the previous frame */
+    double              variation   = 0.0;
+    uint32_t            steadyFrame = 0;
+    bool                steady      = false;
+};
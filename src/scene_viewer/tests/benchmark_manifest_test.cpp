@@ -0,0 +1,181 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "benchmark_manifest.h"
+#include "test.h"
+
+#include <limits>
+
+namespace
+{
+constexpr char const *kManifest = R"(
+frames: 64
+first_frame: [32, 48]
+presets:
+  low: {gi1_use_resampling: false}
+  high: {gi1_use_resampling: true, gi1_probe_count: 4}
+runs:
+  - scenes: [Sponza, Gas Station]
+    renderers: [GI-1.1]
+    presets: [low, high]
+  - scene: Sponza
+    renderer: Path Tracer
+    camera: User
+    frames: 16
+    first_frame: auto
+    name: ref
+  - scene: Sponza
+    renderer: GI-1.1
+    environment_map: Kiara Dawn
+)";
+
+BenchmarkManifest LoadManifest(char const *text) noexcept
+{
+    BenchmarkManifest manifest;
+    std::string       error;
+    CHECK(manifest.parse(text, error));
+    CHECK(error.empty());
+    return manifest;
+}
+
+void TestExpansion()
+{
+    BenchmarkManifest const manifest = LoadManifest(kManifest);
+    auto const             &runs     = manifest.getRuns();
+    CHECK(runs.size() == 6);
+
+    // Each combination is expanded with presets varying fastest, and names only contain file safe characters
+    auto const find = [&runs](std::string const &name) -> BenchmarkRun const * {
+        for (auto const &run : runs)
+        {
+            if (run.name == name)
+            {
+                return &run;
+            }
+        }
+        return nullptr;
+    };
+    BenchmarkRun const *low = find("Gas-Station_GI-1-1_low");
+    CHECK(low != nullptr && low->scene == "Gas Station" && low->renderer == "GI-1.1" && low->preset == "low");
+    CHECK(low != nullptr && low->options.size() == 1 && low->options[0].first == "gi1_use_resampling"
+          && low->options[0].second == "false");
+    CHECK(low != nullptr && low->frameCount == 64);
+    CHECK(low != nullptr && low->timingStartFrame == 32 && low->imageStartFrame == 48);
+    CHECK(low != nullptr && !low->autoWarmup);
+    BenchmarkRun const *high = find("Sponza_GI-1-1_high");
+    CHECK(high != nullptr && high->options.size() == 2);
+
+    // Per run overrides replace the defaults, and first frames are clamped to the run length
+    BenchmarkRun const *reference = find("ref_Sponza_User_Path-Tracer");
+    CHECK(reference != nullptr && reference->camera == "User" && reference->preset.empty());
+    CHECK(reference != nullptr && reference->frameCount == 16 && reference->autoWarmup);
+    CHECK(reference != nullptr && reference->timingStartFrame == 15 && reference->imageStartFrame == 15);
+    BenchmarkRun const *environment = find("Sponza_Kiara-Dawn_GI-1-1");
+    CHECK(environment != nullptr && environment->environmentMap == "Kiara Dawn");
+}
+
+void TestSchedule()
+{
+    // Runs sharing a scene, environment map and renderer are consecutive, groups keep the manifest order
+    BenchmarkManifest const manifest = LoadManifest(kManifest);
+    auto const             &runs     = manifest.getRuns();
+    CHECK(runs.size() == 6);
+    char const *expected[] = {"Sponza_GI-1-1_low", "Sponza_GI-1-1_high", "ref_Sponza_User_Path-Tracer",
+        "Sponza_Kiara-Dawn_GI-1-1", "Gas-Station_GI-1-1_low", "Gas-Station_GI-1-1_high"};
+    for (size_t i = 0; i < runs.size() && i < std::size(expected); ++i)
+    {
+        CHECK(runs[i].name == expected[i]);
+    }
+
+    std::vector<BenchmarkRun> unordered(4);
+    unordered[0].scene    = "A";
+    unordered[0].renderer = "X";
+    unordered[1].scene    = "B";
+    unordered[1].renderer = "X";
+    unordered[2].scene    = "A";
+    unordered[2].renderer = "Y";
+    unordered[3].scene    = "A";
+    unordered[3].renderer = "X";
+    for (size_t i = 0; i < unordered.size(); ++i)
+    {
+        unordered[i].name = std::to_string(i);
+    }
+    BenchmarkManifest::Schedule(unordered);
+    CHECK(unordered[0].name == "0" && unordered[1].name == "3");
+    CHECK(unordered[2].name == "2" && unordered[3].name == "1");
+}
+
+void TestDefaults()
+{
+    BenchmarkManifest const manifest = LoadManifest(R"(
+runs:
+  - {scene: /scenes/sponza.gltf, renderer: R}
+  - {scene: /scenes/sponza.gltf, renderer: R, first_frame: 1000}
+)");
+    auto const             &runs     = manifest.getRuns();
+    CHECK(runs.size() == 2);
+    CHECK(runs[0].frameCount == 512 && runs[0].timingStartFrame == 511 && runs[0].imageStartFrame == 511);
+    CHECK(runs[1].timingStartFrame == 511 && runs[1].imageStartFrame == 511);
+
+    // Paths only contribute their file name, and duplicate names are made unique
+    CHECK(runs[0].name == "sponza_R");
+    CHECK(runs[1].name == "sponza_R_1");
+}
+
+void TestErrors()
+{
+    char const *malformed[] = {
+        "frames: 64",
+        "runs: []",
+        "runs: [{scene: A, renderer: R",
+        "runs:\n  - {renderer: R}",
+        "runs:\n  - {scene: A}",
+        "runs:\n  - {scene: A, renderer: R, preset: missing}",
+        "runs:\n  - {scene: A, renderer: R, frames: 0}",
+        "runs:\n  - {scene: A, renderer: R, frames: many}",
+        "runs:\n  - {scene: A, renderer: R, first_frame: [10, later]}",
+        // A valid run followed by an invalid one must not leave the first behind
+        "runs:\n  - {scene: A, renderer: R}\n  - {scene: B}",
+    };
+    for (char const *text : malformed)
+    {
+        BenchmarkManifest manifest;
+        std::string       error;
+        CHECK(manifest.parse(kManifest, error));
+        CHECK(!manifest.parse(text, error));
+        CHECK(!error.empty());
+        CHECK(manifest.getRuns().empty());
+    }
+
+    BenchmarkManifest manifest;
+    std::string       error;
+    CHECK(!manifest.load("missing_benchmark_manifest.yaml", error) && !error.empty());
+}
+} // namespace
+
+int main()
+{
+    TestExpansion();
+    TestSchedule();
+    TestDefaults();
+    TestErrors();
+    return Capsaicin::Test::Result();
+}
@@ -0,0 +1,229 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "camera_path.h"
+#include "test.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+constexpr char const *kPath = R"(
+interpolation: catmull_rom
+keys:
+  - time: 1.0
+    position: [0.0, 1.0, 0.0]
+    forward: [0.0, 0.0, -1.0]
+    fov: 60.0
+    range: [0.1, 100.0]
+  - time: 2.0
+    position: [4.0, 1.0, -2.0]
+    forward: [1.0, 0.0, -1.0]
+    fov: 40.0
+  - time: 4.0
+    position: [8.0, 2.0, -2.0]
+    forward: [1.0, 0.0, 0.0]
+  - time: 4.5
+    position: [8.0, 2.0, 4.0]
+    forward: [0.0, 0.0, 1.0]
+    range: [1.0, 500.0]
+)";
+
+bool Near(glm::vec3 const &left, glm::vec3 const &right, float const tolerance = 1e-5F) noexcept
+{
+    return glm::length(left - right) <= tolerance;
+}
+
+bool Equal(CameraPath::View const &left, CameraPath::View const &right) noexcept
+{
+    return std::memcmp(&left.position, &right.position, sizeof(left.position)) == 0
+        && std::memcmp(&left.forward, &right.forward, sizeof(left.forward)) == 0
+        && std::memcmp(&left.up, &right.up, sizeof(left.up)) == 0
+        && std::memcmp(&left.fovY, &right.fovY, sizeof(left.fovY)) == 0
+        && std::memcmp(&left.range, &right.range, sizeof(left.range)) == 0;
+}
+
+CameraPath LoadPath(char const *text) noexcept
+{
+    CameraPath  path;
+    std::string error;
+    CHECK(path.parse(text, error));
+    CHECK(error.empty());
+    return path;
+}
+
+void TestDeterminism()
+{
+    // Playback samples the path at frame index times the fixed frame time, replaying it must produce
+    // bit identical cameras regardless of the instance used or the order of evaluation
+    CameraPath const first       = LoadPath(kPath);
+    CameraPath const second      = LoadPath(kPath);
+    double const     frame_time  = 1.0 / 60.0;
+    uint32_t const   frame_count = static_cast<uint32_t>(first.getDuration() / frame_time) + 2;
+    std::vector<CameraPath::View> views;
+    for (uint32_t frame = 0; frame < frame_count; ++frame)
+    {
+        views.push_back(first.evaluate(static_cast<double>(frame) * frame_time));
+    }
+    for (uint32_t frame = frame_count; frame-- > 0;)
+    {
+        CHECK(Equal(views[frame], second.evaluate(static_cast<double>(frame) * frame_time)));
+        CHECK(Equal(views[frame], first.evaluate(static_cast<double>(frame) * frame_time)));
+    }
+}
+
+void TestInterpolation()
+{
+    CameraPath const path = LoadPath(kPath);
+    CHECK(!path.empty());
+    CHECK(path.getDuration() == 3.5);
+    CHECK(path.getSegmentCount() == 3);
+
+    // The path passes through every key (times are relative to the first key)
+    CHECK(Near(path.evaluate(0.0).position, glm::vec3(0.0F, 1.0F, 0.0F)));
+    CHECK(Near(path.evaluate(1.0).position, glm::vec3(4.0F, 1.0F, -2.0F)));
+    CHECK(Near(path.evaluate(3.0).position, glm::vec3(8.0F, 2.0F, -2.0F)));
+    CHECK(Near(path.evaluate(3.5).position, glm::vec3(8.0F, 2.0F, 4.0F)));
+    CHECK(Near(path.evaluate(1.0).forward, glm::normalize(glm::vec3(1.0F, 0.0F, -1.0F))));
+
+    // Directions are normalised and lens values are interpolated linearly
+    for (double time = 0.0; time <= 3.5; time += 0.05)
+    {
+        auto const view = path.evaluate(time);
+        CHECK(std::abs(glm::length(view.forward) - 1.0F) < 1e-5F);
+        CHECK(std::abs(glm::length(view.up) - 1.0F) < 1e-5F);
+        CHECK(view.range.x > 0.0F && view.range.x < view.range.y);
+    }
+    CHECK(std::abs(path.evaluate(0.5).fovY - glm::radians(50.0F)) < 1e-5F);
+    CHECK(std::abs(path.evaluate(3.25).range.x - 0.55F) < 1e-5F);
+
+    // Times outside the path are clamped to the end keys
+    CHECK(Equal(path.evaluate(-1.0), path.evaluate(0.0)));
+    CHECK(Equal(path.evaluate(10.0), path.evaluate(3.5)));
+}
+
+void TestSegments()
+{
+    CameraPath const path = LoadPath(kPath);
+    CHECK(path.getSegment(-1.0) == 0);
+    CHECK(path.getSegment(0.0) == 0);
+    CHECK(path.getSegment(0.99) == 0);
+    CHECK(path.getSegment(1.0) == 1);
+    CHECK(path.getSegment(2.99) == 1);
+    CHECK(path.getSegment(3.0) == 2);
+    CHECK(path.getSegment(3.5) == 2);
+    CHECK(path.getSegment(100.0) == 2);
+
+    // A single key is a stationary path with a single segment
+    CameraPath    single;
+    CameraPathKey key;
+    key.position = glm::vec3(1.0F, 2.0F, 3.0F);
+    single.addKey(key);
+    CHECK(single.getSegmentCount() == 1);
+    CHECK(single.getSegment(5.0) == 0);
+    CHECK(single.getDuration() == 0.0);
+    CHECK(Near(single.evaluate(5.0).position, key.position));
+}
+
+void TestBezier()
+{
+    CameraPath const path = LoadPath(R"(
+interpolation: bezier
+keys:
+  - time: 0.0
+    position: [0.0, 0.0, 0.0]
+    forward: [0.0, 0.0, -1.0]
+    control_out: [1.0, 2.0, 0.0]
+  - time: 1.0
+    position: [3.0, 0.0, 0.0]
+    forward: [0.0, 0.0, -1.0]
+    control_in: [2.0, 2.0, 0.0]
+)");
+    // Cubic Bezier midpoint is (b0 + 3 * b1 + 3 * b2 + b3) / 8
+    CHECK(Near(path.evaluate(0.5).position, glm::vec3(1.5F, 1.5F, 0.0F)));
+}
+
+void TestRoundTrip()
+{
+    CameraPath   path;
+    double const frame_time = 0.1;
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        CameraPathKey key;
+        key.time     = static_cast<double>(i) * frame_time;
+        key.position = glm::vec3(std::sin(static_cast<float>(i)), 0.25F * static_cast<float>(i), 1.0F);
+        key.forward  = glm::normalize(glm::vec3(std::cos(static_cast<float>(i)), -0.1F, -1.0F));
+        key.fovY     = glm::radians(45.0F + static_cast<float>(i));
+        key.range    = glm::vec2(0.1F, 1000.0F);
+        path.addKey(key);
+    }
+    // Keys that do not advance in time are ignored when recording
+    CameraPathKey late;
+    late.time = 0.2;
+    path.addKey(late);
+    CHECK(path.getSegmentCount() == 7);
+
+    auto const file_name = std::filesystem::temp_directory_path() / "capsaicin_camera_path_test.yaml";
+    CHECK(path.save(file_name));
+    CameraPath  loaded;
+    std::string error;
+    CHECK(loaded.load(file_name, error));
+    std::filesystem::remove(file_name);
+    CHECK(loaded.getSegmentCount() == path.getSegmentCount());
+    CHECK(loaded.getDuration() == path.getDuration());
+    for (double time = 0.0; time <= path.getDuration(); time += 0.01)
+    {
+        auto const original = path.evaluate(time);
+        auto const reloaded = loaded.evaluate(time);
+        CHECK(Near(original.position, reloaded.position, 1e-4F));
+        CHECK(Near(original.forward, reloaded.forward, 1e-4F));
+        CHECK(std::abs(original.fovY - reloaded.fovY) < 1e-4F);
+    }
+}
+
+void TestErrors()
+{
+    CameraPath  path;
+    std::string error;
+    CHECK(!path.parse("keys: []", error) && !error.empty());
+    CHECK(!path.parse("interpolation: linear\nkeys:\n  - {time: 0, position: [0, 0, 0], forward: [0, 0, 1]}",
+        error));
+    CHECK(!path.parse("keys:\n  - {time: 0, position: [0, 0, 0]}", error));
+    CHECK(!path.parse("keys:\n  - {time: 1, position: [0, 0, 0], forward: [0, 0, 1]}\n"
+                      "  - {time: 1, position: [1, 0, 0], forward: [0, 0, 1]}",
+        error));
+    CHECK(path.empty());
+    CHECK(!path.load("missing_camera_path.yaml", error));
+}
+} // namespace
+
+int main()
+{
+    TestDeterminism();
+    TestInterpolation();
+    TestSegments();
+    TestBezier();
+    TestRoundTrip();
+    TestErrors();
+    return Capsaicin::Test::Result();
+}
@@ -0,0 +1,166 @@
+/**********************************************************************
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "steady_state.h"
+#include "test.h"
+
+#include <cmath>
+#include <random>
+
+namespace
+{
+/** Frame time trace with a decaying warmup spike followed by a small amount of noise. */
+double WarmupFrameTime(uint32_t const frame, std::mt19937 &random) noexcept
+{
+    std::uniform_real_distribution<double> noise(-0.005, 0.005);
+    double const warmup = frame < 40 ? 8.0 * std::exp(-0.1 * static_cast<double>(frame)) : 0.0;
+    return 10.0 * (1.0 + noise(random)) + warmup;
+}
+
+void TestWarmup()
+{
+    std::mt19937        random(1);
+    SteadyStateDetector detector;
+    detector.reset(32, 0.02, 0.001);
+    uint32_t frame = 0;
+    for (; frame < 500 && !detector.addFrame(WarmupFrameTime(frame, random), {}); ++frame) {}
+    CHECK(detector.isSteady());
+    CHECK(detector.getFrameCount() == frame + 1);
+    CHECK(detector.getSteadyFrame() + 31 == frame);
+    CHECK(detector.getVariation() <= 0.02);
+
+    // The window may include the tail of the warmup spike (ending at frame 40) but not its bulk, and
+    // detection must not lag far behind the end of the spike
+    CHECK(detector.getSteadyFrame() >= 25);
+    CHECK(detector.getSteadyFrame() <= 40);
+
+    // Once steady any further frames are ignored
+    CHECK(detector.addFrame(100.0, {}));
+    CHECK(detector.getFrameCount() == frame + 1);
+
+    // Resetting starts over
+    detector.reset(32, 0.02, 0.001);
+    CHECK(!detector.isSteady());
+    CHECK(detector.getFrameCount() == 0);
+    CHECK(detector.getVariation() == 0.0);
+}
+
+void TestNoise()
+{
+    // Frame times alternating by +/-10% never become steady with a 5% threshold
+    SteadyStateDetector detector;
+    detector.reset(16, 0.05, 0.001);
+    for (uint32_t frame = 0; frame < 200; ++frame)
+    {
+        CHECK(!detector.addFrame(frame % 2 == 0 ? 9.0 : 11.0, {}));
+    }
+    CHECK(detector.getVariation() > 0.05);
+}
+
+void TestDrift()
+{
+    // A slow drift of 0.1% per frame has a variation under the threshold within a window of 16 frames
+    // but the means of each half differ, which a still settling benchmark must not be mistaken for
+    SteadyStateDetector detector;
+    detector.reset(16, 0.01, 0.001);
+    for (uint32_t frame = 0; frame < 200; ++frame)
+    {
+        CHECK(!detector.addFrame(10.0 * (1.0 + 0.001 * static_cast<double>(frame)), {}));
+    }
+    CHECK(detector.getVariation() <= 0.01);
+
+    // Once the drift stops the benchmark becomes steady
+    uint32_t frame = 0;
+    for (; frame < 100 && !detector.addFrame(12.0, {}); ++frame) {}
+    CHECK(detector.isSteady());
+    CHECK(frame < 16);
+}
+
+void TestMetrics()
+{
+    // Constant frame times but a converging image metric (e.g. auto exposure), steady state requires the
+    // relative change between consecutive frames to drop below the threshold over the whole window
+    SteadyStateDetector detector;
+    detector.reset(8, 0.05, 0.001);
+    double   metric = 1.0;
+    uint32_t frame  = 0;
+    for (; frame < 500; ++frame)
+    {
+        double const previous = metric;
+        metric                = 2.0 - 0.9 * (2.0 - metric);
+        if (detector.addFrame(10.0, {metric, 5.0}))
+        {
+            // Every change within the window is below the threshold
+            CHECK(std::abs(metric - previous) / previous <= 0.001);
+            break;
+        }
+    }
+    CHECK(detector.isSteady());
+    uint32_t const first_stable = [] {
+        double   value = 1.0;
+        uint32_t index = 0;
+        for (;; ++index)
+        {
+            double const next = 2.0 - 0.9 * (2.0 - value);
+            if (std::abs(next - value) / value <= 0.001)
+            {
+                return index;
+            }
+            value = next;
+        }
+    }();
+    CHECK(detector.getSteadyFrame() == first_stable);
+
+    // Metrics that only become available part way through count as a change
+    detector.reset(8, 0.05, 0.001);
+    for (frame = 0; frame < 7; ++frame)
+    {
+        CHECK(!detector.addFrame(10.0, {}));
+    }
+    for (frame = 7; frame < 15; ++frame)
+    {
+        CHECK(!detector.addFrame(10.0, {1.0}));
+    }
+    CHECK(detector.addFrame(10.0, {1.0}));
+    CHECK(detector.getSteadyFrame() == 8);
+}
+
+void TestWindowSize()
+{
+    // Windows are at least two frames so that a variation can be calculated
+    SteadyStateDetector detector;
+    detector.reset(0, 0.05, 0.001);
+    CHECK(!detector.addFrame(10.0, {}));
+    CHECK(detector.addFrame(10.0, {}));
+    CHECK(detector.getSteadyFrame() == 0);
+}
+} // namespace
+
+int main()
+{
+    TestWarmup();
+    TestNoise();
+    TestDrift();
+    TestMetrics();
+    TestWindowSize();
+    return Capsaicin::Test::Result();
+}